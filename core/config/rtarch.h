@@ -330,6 +330,7 @@
  * Refer to individual target sections below for flags' detailed description.
  * General rule for interpretation of RT_SIMD_COMPAT_* values is as following:
  * 0 - non-compat (fastest), 1 - max-compat (slower), 2 - min-compat (faster).
+ * RT_SIMD_COMPAT_FMA/FMS value 3 acts as 1 on targets with no specific option.
  */
 #define RT_SIMD_COMPAT_XMM_MASTER       1 /* 0 - 16, 1 - 15, 2 - 14 regs */
 #define RT_SIMD_COMPAT_RCP_MASTER       1 /* for full-precision rcpps_** */
@@ -363,17 +364,87 @@
 #define RT_REGS 32      /* <- 30 on predicated x64 AVX-512/1K4 & ARM-SVE */
 #endif /* RT_REGS: 8, 16, 32 */
 
+/*
+ * Register masks for ASM_ENTER_LITE/ASM_LEAVE_LITE, which save and restore
+ * only BASE and SIMD registers declared as used by the ASM section.
+ * Masks are combined with '|' and must remain plain constant expressions,
+ * as they are evaluated by the assembler in static code generation mode.
+ * Registers modified implicitly by instructions (like Redx in x86 div)
+ * must be included as well. Registers reserved for internal use by the
+ * backend are saved automatically and don't need to be put in the masks:
+ * r15 (jmpxx_mm) on all x64 targets, zmm30, zmm31 (div, rem, horizontal op
+ * temps) on 512x1v8 and zmm30 (horizontal op temp) on 128x1v2, 256x1v8
+ * in dynamic mode or when building for AVX-512, and mask regs k1-k7
+ * on AVX-512 targets (k1 on 128x1v2, 256x1v8) when building for AVX-512
+ * in static mode. No other internal SIMD regs exist on x32/x64.
+ * On A32/A64 internal temps x20-x27, v15/z15, v31/z31, SVE predicates
+ * and XmmE (all-ones on entry) are saved automatically. Other targets
+ * ignore the masks and save/load all registers (as with ASM_ENTER).
+ */
+#define RT_BASE_REAX    0x00000001
+#define RT_BASE_RECX    0x00000002
+#define RT_BASE_REDX    0x00000004
+#define RT_BASE_REBX    0x00000008
+#define RT_BASE_REBP    0x00000020 /* always saved, holds info in sections */
+#define RT_BASE_RESI    0x00000040
+#define RT_BASE_REDI    0x00000080
+#define RT_BASE_REG8    0x00000100
+#define RT_BASE_REG9    0x00000200
+#define RT_BASE_REGA    0x00000400
+#define RT_BASE_REGB    0x00000800
+#define RT_BASE_REGC    0x00001000
+#define RT_BASE_REGD    0x00002000
+#define RT_BASE_REGE    0x00004000
+
+#define RT_SIMD_XMM0    0x00000001
+#define RT_SIMD_XMM1    0x00000002
+#define RT_SIMD_XMM2    0x00000004
+#define RT_SIMD_XMM3    0x00000008
+#define RT_SIMD_XMM4    0x00000010
+#define RT_SIMD_XMM5    0x00000020
+#define RT_SIMD_XMM6    0x00000040
+#define RT_SIMD_XMM7    0x00000080
+#define RT_SIMD_XMM8    0x00000100
+#define RT_SIMD_XMM9    0x00000200
+#define RT_SIMD_XMMA    0x00000400
+#define RT_SIMD_XMMB    0x00000800
+#define RT_SIMD_XMMC    0x00001000
+#define RT_SIMD_XMMD    0x00002000
+#define RT_SIMD_XMME    0x00004000
+#define RT_SIMD_XMMF    0x00008000
+#define RT_SIMD_XMMG    0x00010000
+#define RT_SIMD_XMMH    0x00020000
+#define RT_SIMD_XMMI    0x00040000
+#define RT_SIMD_XMMJ    0x00080000
+#define RT_SIMD_XMMK    0x00100000
+#define RT_SIMD_XMML    0x00200000
+#define RT_SIMD_XMMM    0x00400000
+#define RT_SIMD_XMMN    0x00800000
+#define RT_SIMD_XMMO    0x01000000
+#define RT_SIMD_XMMP    0x02000000
+#define RT_SIMD_XMMQ    0x04000000
+#define RT_SIMD_XMMR    0x08000000
+#define RT_SIMD_XMMS    0x10000000
+#define RT_SIMD_XMMT    0x20000000
+
 /*
  * Short name for true-condition sign in assembler evaluation of (A == B).
  * The result of the condition evaluation is used as a mask for selection:
  * ((A == B) & C) | ((A != B) & D), therefore it needs to be (-1) if true.
  */
-#if __clang__ && __clang_major__ <= 6
+#if   RT_CODE_GEN != 0 /* runtime code generation evaluates (A == B) in C */
+#define M   -
+#elif __clang__ && __clang_major__ <= 6
 #define M   -
 #else /* gcc or clang-7 and beyond */
 #define M   +
 #endif /* M */
 
+/*
+ * Data structures and functions for runtime code generation (RT_CODE_GEN).
+ */
+#include "rtcode.h"
+
 /******************************************************************************/
 /***************************   OS, COMPILER, ARCH   ***************************/
 /******************************************************************************/
@@ -526,8 +597,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -555,8 +626,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -600,8 +671,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -632,8 +703,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -657,6 +728,8 @@
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
+#if RT_CODE_GEN == 0
+
 #define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
@@ -668,6 +741,21 @@
         ASM_BEG ASM_OP2(adrp, x0, lb) ASM_END                               \
         ASM_BEG ASM_OP3(add,  x0, x0, :lo12:lb) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define EMPTY                   /* emits nothing */
+#define EMITB(b)                code_emitb(&__Code__, (rt_ui32)(b));
+#define EMITW(w)                code_emitw(&__Code__, (rt_ui32)(w));
+#define EMITR(lb, rt)           code_reloc(&__Code__, #lb, rt);
+#define EMITL(lb)               code_label(&__Code__, #lb);
+
+#define movlb_ld(lb)/*Reax*/    /* 1st function argument is already in x0 */
+
+#define label_ld(lb)/*Reax*/                                                \
+        EMITR(lb, RT_CODE_ADR21) EMITW(0x10000000)  /* adr x0, lb */
+
+#endif /* RT_CODE_GEN */
+
 #if   (defined RT_A32)
 
 #define label_st(lb, MD, DD)                                                \
@@ -759,6 +847,40 @@
 #error "couldn't select appropriate SIMD target, check build flags"
 #endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
+#if RT_CODE_GEN == 0
+
+/* use 1 local to fix optimized builds, where locals are referenced via SP,
+ * while stack ops from within the asm block aren't counted into offsets */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+{                                                                           \
+    rt_full __Reax__;                                                       \
+    asm volatile                                                            \
+    (                                                                       \
+        movlb_st(%[Reax_])                                                  \
+        movlb_ld(%[Info_])
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        movlb_ld(%[Reax_])                                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_full)__Info__)                                 \
+        : "cc",  "memory"                                                   \
+    );                                                                      \
+}
+
+#else /* RT_CODE_GEN */
+
+/* code is generated into a buffer and called as a function,
+ * info is passed in the 1st argument, which is Reax (x0) */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+    CODE_BLOCK_BEG(__Info__)                                                \
+        movlb_ld(%[Info_])
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        EMITW(0xD65F03C0)                     /* <- return to the caller */ \
+    CODE_BLOCK_END(__Info__)
+
+#endif /* RT_CODE_GEN */
+
 /*
  * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
  * the stack, they are considered heavy and therefore best suited for compute
@@ -769,15 +891,8 @@
 #if RT_SIMD_FLUSH_ZERO == 0
 #if RT_SIMD_FAST_FCTRL == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -789,24 +904,12 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -821,12 +924,7 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
@@ -846,15 +944,8 @@
 
 #if RT_SIMD_FAST_FCTRL == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -869,24 +960,12 @@
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */         \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -904,18 +983,210 @@
         EMITW(0xD51B4400 | MRM(TNxx, 0x00, 0x00)) /* fpcr <- x20 */         \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+/*
+ * The ASM_ENTER_LITE/ASM_LEAVE_LITE versions save/load only those BASE/SIMD
+ * registers, which are declared in the masks (RT_BASE_*, RT_SIMD_* above),
+ * and are therefore better suited for short sections called very often.
+ * Internal BASE temps (x20-x27) are always saved along with Rebp.
+ * SIMD registers are saved at full width of the chosen target, followed by
+ * internal SIMD temps and SVE predicates (check sregs_sk/sregs_lk).
+ * XmmE is always saved, as it's set to all-ones on entry (as with ASM_ENTER).
+ * The SIMD unit is set to operate in its default mode (as with ASM_ENTER).
+ */
+
+#if RT_CODE_GEN == 0
+
+#define ASM_STR(s)              #s
+#define ASM_XSTR(s)             ASM_STR(s)
+
+/* masks are kept in assembler symbols and evaluated with .if directives */
+#define ASM_MSET(sym, mask)                                                 \
+        ASM_BEG ".set .L" #sym ", " ASM_XSTR(mask) ASM_END
+
+#define ASM_MBEG(sym, bit)                                                  \
+        ASM_BEG ".if (.L" #sym " >> " #bit ") & 1" ASM_END
+
+#define ASM_MEND                                                            \
+        ASM_BEG ".endif" ASM_END
+
+/* compiler-allocated operand registers don't need to be saved here,
+ * as the section modifies BASE regs only from the mask or internal temps */
+#define RT_BASE_LITE            (RT_BASE_REBP)
+#define RT_SIMD_LITE            (RT_SIMD_XMME)
+
+#else /* RT_CODE_GEN */
+
+/* masks are kept in locals and evaluated when the code is generated */
+#define ASM_MSET(sym, mask)                                                 \
+        rt_ui32 sym = (rt_ui32)(mask);
+
+#define ASM_MBEG(sym, bit)                                                  \
+        if ((sym >> bit) & 1) {
+
+#define ASM_MEND                                                            \
+        }
+
+/* callee-saved registers of the native ABI (AAPCS64) are saved as well,
+ * x19-x28 are outside of BASE regs, low halves of v8-v15 are SIMD regs */
+#define RT_BASE_LITE            (RT_BASE_REBP)
+#define RT_SIMD_LITE            (RT_SIMD_XMM8 | RT_SIMD_XMM9 | RT_SIMD_XMMA | \
+                                 RT_SIMD_XMMB | RT_SIMD_XMMC | RT_SIMD_XMMD | \
+                                 RT_SIMD_XMME)
+
+#endif /* RT_CODE_GEN */
+
+#define stack_sm() /* save BASE regs from the mask, not portable */         \
+        EMITW(0xA9BF0000 | MRM(TMxx,    SPxx,    0x00) | TIxx << 10)        \
+        EMITW(0xA9BF0000 | MRM(TDxx,    SPxx,    0x00) | TPxx << 10)        \
+        EMITW(0xA9BF0000 | MRM(TNxx,    SPxx,    0x00) | TAxx << 10)        \
+        EMITW(0xA9BF0000 | MRM(TCxx,    SPxx,    0x00) | TExx << 10)        \
+        ASM_MBEG(__Base__, 0x01) stack_st(Recx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x02) stack_st(Redx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x03) stack_st(Rebx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x05) stack_st(Rebp) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x06) stack_st(Resi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x07) stack_st(Redi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x08) stack_st(Reg8) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x09) stack_st(Reg9) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0A) stack_st(RegA) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0B) stack_st(RegB) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0C) stack_st(RegC) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0D) stack_st(RegD) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0E) stack_st(RegE) ASM_MEND
+
+#define stack_lm() /* load BASE regs from the mask, not portable */         \
+        ASM_MBEG(__Base__, 0x0E) stack_ld(RegE) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0D) stack_ld(RegD) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0C) stack_ld(RegC) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0B) stack_ld(RegB) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0A) stack_ld(RegA) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x09) stack_ld(Reg9) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x08) stack_ld(Reg8) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x07) stack_ld(Redi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x06) stack_ld(Resi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x05) stack_ld(Rebp) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x03) stack_ld(Rebx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x02) stack_ld(Redx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x01) stack_ld(Recx) ASM_MEND                    \
+        EMITW(0xA8C10000 | MRM(TCxx,    SPxx,    0x00) | TExx << 10)        \
+        EMITW(0xA8C10000 | MRM(TNxx,    SPxx,    0x00) | TAxx << 10)        \
+        EMITW(0xA8C10000 | MRM(TDxx,    SPxx,    0x00) | TPxx << 10)        \
+        EMITW(0xA8C10000 | MRM(TMxx,    SPxx,    0x00) | TIxx << 10)
+
+#define sregs_mx(op, XS, bit) /* not portable, do not use outside */        \
+        ASM_MBEG(__Simd__, bit)                                             \
+        op(W(XS), Oeax, PLAIN)                                              \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        ASM_MEND
+
+#define sregs_mF(op) /* not portable, do not use outside */                 \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_mx(op, Xmm0, 0x00)                                            \
+        sregs_mx(op, Xmm1, 0x01)                                            \
+        sregs_mx(op, Xmm2, 0x02)                                            \
+        sregs_mx(op, Xmm3, 0x03)                                            \
+        sregs_mx(op, Xmm4, 0x04)                                            \
+        sregs_mx(op, Xmm5, 0x05)                                            \
+        sregs_mx(op, Xmm6, 0x06)                                            \
+        sregs_mx(op, Xmm7, 0x07)                                            \
+        sregs_mx(op, Xmm8, 0x08)                                            \
+        sregs_mx(op, Xmm9, 0x09)                                            \
+        sregs_mx(op, XmmA, 0x0A)                                            \
+        sregs_mx(op, XmmB, 0x0B)                                            \
+        sregs_mx(op, XmmC, 0x0C)                                            \
+        sregs_mx(op, XmmD, 0x0D)                                            \
+        sregs_mx(op, XmmE, 0x0E)
+
+#define sregs_mW(op) /* not portable, do not use outside */                 \
+        sregs_mF(op)                                                        \
+        sregs_mx(op, XmmF, 0x0F)                                            \
+        sregs_mx(op, XmmG, 0x10)                                            \
+        sregs_mx(op, XmmH, 0x11)                                            \
+        sregs_mx(op, XmmI, 0x12)                                            \
+        sregs_mx(op, XmmJ, 0x13)                                            \
+        sregs_mx(op, XmmK, 0x14)                                            \
+        sregs_mx(op, XmmL, 0x15)                                            \
+        sregs_mx(op, XmmM, 0x16)                                            \
+        sregs_mx(op, XmmN, 0x17)                                            \
+        sregs_mx(op, XmmO, 0x18)                                            \
+        sregs_mx(op, XmmP, 0x19)                                            \
+        sregs_mx(op, XmmQ, 0x1A)                                            \
+        sregs_mx(op, XmmR, 0x1B)                                            \
+        sregs_mx(op, XmmS, 0x1C)                                            \
+        sregs_mx(op, XmmT, 0x1D)
+
+/* 15 SIMD regs on paired targets (XmmF is 128-bit only and isn't paired),
+ * internal SIMD temps and SVE predicates are saved after those from the mask
+ * by sregs_sk/sregs_lk, which every A32/A64 target defines */
+#if   (defined RT_SIMD_CODE) && (RT_REGS <= 16)
+#define sregs_sm()  sregs_mF(movox_st) sregs_sk() /* save SIMD regs (mask) */
+#define sregs_lm()  sregs_mF(movox_ld) sregs_lk() /* load SIMD regs (mask) */
+#elif (defined RT_SIMD_CODE) /* RT_REGS: 32 */
+#define sregs_sm()  sregs_mW(movox_st) sregs_sk() /* save SIMD regs (mask) */
+#define sregs_lm()  sregs_mW(movox_ld) sregs_lk() /* load SIMD regs (mask) */
+#endif /* RT_REGS: 16, 32 */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_ENTER_LITE(__Info__, __BMsk__, __SMsk__)                        \
+        ASM_BLOCK_BEG(__Info__)                                             \
+        ASM_MSET(__Base__, (__BMsk__) | RT_BASE_LITE)                       \
+        ASM_MSET(__Simd__, (__SMsk__) | RT_SIMD_LITE)                       \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sm()                                                          \
+        EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
+        movpx_ld(XmmE, Mebp, inf_GPC07)      /* SVE: z14 <- all-ones */     \
+        EMITS(0x04603000 | MXM(TmmQ, 0x0E, 0x0E)) /* z15 <- z14 (or) */     \
+        EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */
+
+#define ASM_LEAVE_LITE(__Info__)                                            \
+        sregs_lm()                                                          \
+        stack_lm()                                                          \
+        ASM_BLOCK_END(__Info__)
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_ENTER_LITE(__Info__, __BMsk__, __SMsk__)                        \
+        ASM_BLOCK_BEG(__Info__)                                             \
+        ASM_MSET(__Base__, (__BMsk__) | RT_BASE_LITE)                       \
+        ASM_MSET(__Simd__, (__SMsk__) | RT_SIMD_LITE)                       \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sm()                                                          \
+        EMITS(0x2518E3E0)                    /* SVE: p0  <- all-ones */     \
+        movpx_ld(XmmE, Mebp, inf_GPC07)      /* SVE: z14 <- all-ones */     \
+        EMITS(0x04603000 | MXM(TmmQ, 0x0E, 0x0E)) /* z15 <- z14 (or) */     \
+        EMITW(0x52A01800 | MRM(TExx, 0x00, 0x00)) /* x23 <- (3 << 22) */    \
+        EMITW(0x52A01000 | MRM(TCxx, 0x00, 0x00)) /* x22 <- (2 << 22) */    \
+        EMITW(0x52A00800 | MRM(TAxx, 0x00, 0x00)) /* x21 <- (1 << 22) */    \
+        EMITW(0x52A00000 | MRM(TNxx, 0x00, 0x00)) /* x20 <- (0 << 22) */
+
+#define ASM_LEAVE_LITE(__Info__)                                            \
+        sregs_lm()                                                          \
+        stack_lm()                                                          \
+        ASM_BLOCK_END(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
+#else /* RT_SIMD_FLUSH_ZERO */
+
+/* flush-to-zero mode requires full state save, use ASM_ENTER_F instead */
+#define ASM_ENTER_LITE(__Info__, __BMsk__, __SMsk__) ASM_ENTER_F(__Info__)
+
+#define ASM_LEAVE_LITE(__Info__) ASM_LEAVE_F(__Info__)
+
+#endif /* RT_SIMD_FLUSH_ZERO */
 
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
 #define sregs_la()
+#define sregs_sm()
+#define sregs_lm()
 #define movpx_ld(XD, MS, DS)
 #define EMITS(w) /* EMPTY */
 #elif (defined RT_SVEX1) || (defined RT_SVEX2)
@@ -942,6 +1213,8 @@
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
+#if RT_CODE_GEN == 0
+
 #define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
@@ -949,11 +1222,37 @@
 #define movlb_ld(lb)/*Reax*/    ASM_BEG ASM_OP2(move, $a0, lb) ASM_END
 #define movlb_st(lb)/*Reax*/    ASM_BEG ASM_OP2(move, lb, $a0) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define EMPTY                   /* emits nothing */
+#define EMITB(b)                code_emitb(&__Code__, (rt_ui32)(b));
+#define EMITW(w)                code_emitw(&__Code__, (rt_ui32)(w));
+#define EMITR(lb, rt)           code_reloc(&__Code__, #lb, rt);
+#define EMITL(lb)               code_label(&__Code__, #lb);
+
+#define movlb_ld(lb)/*Reax*/    /* 1st function argument is already in a0 */
+
+#endif /* RT_CODE_GEN */
+
 #if   (defined RT_M32)
 
+#if RT_CODE_GEN == 0
+
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(la, $a0, lb) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define label_ld(lb)/*Reax*/                                                \
+        EMITW(0x00000025 | MRM(TMxx,    0x1F,    TZxx)) /* t8 <- ra */      \
+        EMITW(0x04110001)                               /* bal  +8 */       \
+        EMITW(0x00000000)                               /* branch delay */  \
+        EMITR(lb, RT_CODE_ADR16)                                            \
+        EMITW(0x24000000 | MTM(TEax,    0x1F,    0x00)) /* a0 <- ra + lb */ \
+        EMITW(0x00000025 | MRM(0x1F,    TMxx,    TZxx)) /* ra <- t8 */
+
+#endif /* RT_CODE_GEN */
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
@@ -961,9 +1260,23 @@
 
 #elif (defined RT_M64)
 
+#if RT_CODE_GEN == 0
+
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(dla, $a0, lb) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define label_ld(lb)/*Reax*/                                                \
+        EMITW(0x00000025 | MRM(TMxx,    0x1F,    TZxx)) /* t8 <- ra */      \
+        EMITW(0x04110001)                               /* bal  +8 */       \
+        EMITW(0x00000000)                               /* branch delay */  \
+        EMITR(lb, RT_CODE_ADR16)                                            \
+        EMITW(0x64000000 | MTM(TEax,    0x1F,    0x00)) /* a0 <- ra + lb */ \
+        EMITW(0x00000025 | MRM(0x1F,    TMxx,    TZxx)) /* ra <- t8 */
+
+#endif /* RT_CODE_GEN */
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
@@ -1059,6 +1372,52 @@
 #error "couldn't select appropriate SIMD target, check build flags"
 #endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
+#if RT_CODE_GEN == 0
+
+/* use 1 local to fix optimized builds, where locals are referenced via SP,
+ * while stack ops from within the asm block aren't counted into offsets */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+{                                                                           \
+    rt_word __Reax__;                                                       \
+    asm volatile                                                            \
+    (                                                                       \
+        movlb_st(%[Reax_])                                                  \
+        movlb_ld(%[Info_])
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        movlb_ld(%[Reax_])                                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
+        : "cc",  "memory"                                                   \
+    );                                                                      \
+}
+
+#else /* RT_CODE_GEN */
+
+/* code is generated into a buffer and called as a function,
+ * info is passed in the 1st argument, which is Reax (a0) */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+    CODE_BLOCK_BEG(__Info__)                                                \
+        movlb_ld(%[Info_])
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        EMITW(0x03E00008)                     /* <- return to the caller */ \
+        EMITW(0x00000000)                     /* <- branch delay */         \
+    CODE_BLOCK_END(__Info__)
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        EMITW(0x03E00009)                     /* <- return to the caller */ \
+        EMITW(0x00000000)                     /* <- branch delay */         \
+    CODE_BLOCK_END(__Info__)
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#endif /* RT_CODE_GEN */
+
 /*
  * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
  * the stack, they are considered heavy and therefore best suited for compute
@@ -1069,15 +1428,8 @@
 #if RT_SIMD_FLUSH_ZERO == 0
 #if RT_SIMD_FAST_FCTRL == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_word __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1087,24 +1439,12 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_word __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1117,12 +1457,7 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
@@ -1142,15 +1477,8 @@
 
 #if RT_SIMD_FAST_FCTRL == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_word __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1165,24 +1493,12 @@
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */       \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_word __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1200,12 +1516,7 @@
         EMITS(0x783E0059 | MXM(0x00, TNxx, 0x00)) /* msacsr <- r20 */       \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
 
@@ -1229,6 +1540,8 @@
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
+#if RT_CODE_GEN == 0
+
 #define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
@@ -1236,12 +1549,39 @@
 #define movlb_ld(lb)/*Reax*/    ASM_BEG ASM_OP2(mr, %%r4, lb) ASM_END
 #define movlb_st(lb)/*Reax*/    ASM_BEG ASM_OP2(mr, lb, %%r4) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define EMPTY                   /* emits nothing */
+#define EMITB(b)                code_emitb(&__Code__, (rt_ui32)(b));
+#define EMITW(w)                code_emitw(&__Code__, (rt_ui32)(w));
+#define EMITR(lb, rt)           code_reloc(&__Code__, #lb, rt);
+#define EMITL(lb)               code_label(&__Code__, #lb);
+
+#define movlb_ld(lb)/*Reax*/                                                \
+        EMITW(0x7C000378 | MSM(TEax,    0x03,    0x03)) /* r4 <- r3 */
+
+/* label address is computed from LR set by bcl, original LR is kept in r24,
+ * label_ld is the same for 32/64-bit as labels are within 16-bit offset */
+#define label_ld(lb)/*Reax*/                                                \
+        EMITW(0x7C0802A6 | MTM(TMxx,    0x00,    0x00)) /* r24 <- lr */     \
+        EMITW(0x429F0005)                               /* bcl  +4 */       \
+        EMITW(0x7C0802A6 | MTM(TEax,    0x00,    0x00)) /* r4  <- lr */     \
+        EMITW(0x7C0803A6 | MTM(TMxx,    0x00,    0x00)) /* lr  <- r24 */    \
+        EMITR(lb, RT_CODE_LO16)                                             \
+        EMITW(0x38000000 | MTM(TEax,    TEax,    0x00)) /* r4 += lb */
+
+#endif /* RT_CODE_GEN */
+
 #if   (defined RT_P32)
 
+#if RT_CODE_GEN == 0
+
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(lis, %%r4, lb@h) ASM_END                            \
         ASM_BEG ASM_OP3(ori, %%r4, %%r4, lb@l) ASM_END
 
+#endif /* RT_CODE_GEN */
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C1(DD), EMPTY2)   \
@@ -1249,6 +1589,8 @@
 
 #elif (defined RT_P64)
 
+#if RT_CODE_GEN == 0
+
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(lis, %%r4, lb@highest) ASM_END                      \
         ASM_BEG ASM_OP3(ori, %%r4, %%r4, lb@higher) ASM_END                 \
@@ -1256,6 +1598,8 @@
         ASM_BEG ASM_OP3(oris, %%r4, %%r4, lb@h) ASM_END                     \
         ASM_BEG ASM_OP3(ori, %%r4, %%r4, lb@l) ASM_END
 
+#endif /* RT_CODE_GEN */
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C1(DD), EMPTY2)   \
@@ -1417,6 +1761,40 @@
 #error "couldn't select appropriate SIMD target, check build flags"
 #endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
+#if RT_CODE_GEN == 0
+
+/* use 1 local to fix optimized builds, where locals are referenced via SP,
+ * while stack ops from within the asm block aren't counted into offsets */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+{                                                                           \
+    rt_word __Reax__;                                                       \
+    asm volatile                                                            \
+    (                                                                       \
+        movlb_st(%[Reax_])                                                  \
+        movlb_ld(%[Info_])
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        movlb_ld(%[Reax_])                                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
+        : "cc",  "memory"                                                   \
+    );                                                                      \
+}
+
+#else /* RT_CODE_GEN */
+
+/* code is generated into a buffer and called as a function,
+ * info is passed in the 1st argument (r3) and then moved to Reax */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+    CODE_BLOCK_BEG(__Info__)                                                \
+        movlb_ld(%[Info_])
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        EMITW(0x4E800020)                     /* <- return to the caller */ \
+    CODE_BLOCK_END(__Info__)
+
+#endif /* RT_CODE_GEN */
+
 /*
  * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
  * the stack, they are considered heavy and therefore best suited for compute
@@ -1426,15 +1804,8 @@
 
 #if RT_SIMD_FLUSH_ZERO == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_word __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         EMITS(0x38000000 | MRM(T0xx, 0x00, 0x00)) /* r20 <- 0 */            \
@@ -1464,12 +1835,7 @@
         EMITS(0x7C0003A6 | MRM(TVxx, 0x08, 0x00)) /* vrsave <- r29 */       \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #else /* RT_SIMD_FLUSH_ZERO */
 
@@ -1486,15 +1852,8 @@
  * This mode is closely compatible with ARMv7, which lacks full IEEE support.
  */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_word __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         EMITS(0x38000000 | MRM(T0xx, 0x00, 0x00)) /* r20 <- 0 */            \
@@ -1530,12 +1889,7 @@
         EMITS(0x7C0003A6 | MRM(TVxx, 0x08, 0x00)) /* vrsave <- r29 */       \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
@@ -1566,22 +1920,65 @@
 #define ASM_BEG /*internal*/    ""
 #define ASM_END /*internal*/    "\n"
 
+#if RT_CODE_GEN == 0
+
 #define EMPTY                   ASM_BEG ASM_END /* endian-agnostic */
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
 
+/* register aliasing within instructions is resolved by the assembler */
+#define ASM_IFEQ(a, b)          ASM_BEG ASM_OP1(.if, (a) == (b)) ASM_END
+#define ASM_ELSE                ASM_BEG ASM_OP0(.else) ASM_END
+#define ASM_ENDI                ASM_BEG ASM_OP0(.endif) ASM_END
+
+#else /* RT_CODE_GEN */
+
+#define EMPTY                   /* emits nothing */
+#define EMITB(b)                code_emitb(&__Code__, (rt_ui32)(b));
+#define EMITW(w)                code_emitw(&__Code__, (rt_ui32)(w));
+#define EMITR(lb, rt)           code_reloc(&__Code__, #lb, rt);
+#define EMITL(lb)               code_label(&__Code__, #lb);
+
+/* register aliasing within instructions is resolved by the code generator */
+#define ASM_IFEQ(a, b)          if ((a) == (b)) {
+#define ASM_ELSE                } else {
+#define ASM_ENDI                }
+
+#endif /* RT_CODE_GEN */
+
 #define EMITH(h)                                                            \
         EMITB((h) >> 0x00 & 0xFF)                                           \
         EMITB((h) >> 0x08 & 0xFF)
 
+#if RT_CODE_GEN == 0
+
 #define movlb_ld(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, %%rax, lb) ASM_END
 #define movlb_st(lb)/*Reax*/    ASM_BEG ASM_OP2(movq, lb, %%rax) ASM_END
 
-#if   (defined RT_X32)
-
 #define label_ld(lb)/*Reax*/                                                \
         ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#if   (defined RT_WIN64) /* 1st function argument: Win64 - rcx, SysV - rdi */
+#define movlb_ld(lb)/*Reax*/                                                \
+        REW(0,             0) EMITB(0x89)                                   \
+        MRM(0x01,       0x03, 0x00)
+#else  /* RT_WIN64 */
+#define movlb_ld(lb)/*Reax*/                                                \
+        REW(0,             0) EMITB(0x89)                                   \
+        MRM(0x07,       0x03, 0x00)
+#endif /* RT_WIN64 */
+
+#define label_ld(lb)/*Reax*/                                                \
+        REW(0,             0) EMITB(0x8D)                                   \
+        MRM(0x00,       0x00, 0x05)                                         \
+        EMITR(lb, RT_CODE_REL32) EMITW(0x00000000)
+
+#endif /* RT_CODE_GEN */
+
+#if   (defined RT_X32)
+
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
     ADR REX(0,       RXB(MD)) EMITB(0x89)                                   \
@@ -1590,9 +1987,6 @@
 
 #elif (defined RT_X64)
 
-#define label_ld(lb)/*Reax*/                                                \
-        ASM_BEG ASM_OP2(leaq, %%rax, lb) ASM_END
-
 #define label_st(lb, MD, DD)                                                \
         label_ld(lb)/*Reax*/                                                \
     ADR REW(0,       RXB(MD)) EMITB(0x89)                                   \
@@ -1639,13 +2033,15 @@
 #endif /* RT_SIMD_COMPAT_RSQ */
 
 /* RT_SIMD_COMPAT_FMA when enabled changes the default behavior
- * of fmaps_** instructions to their full-precision fallback */
+ * of fmaps_** instructions to their full-precision fallback,
+ * 3 selects vectorized fp64 fallback instead of x87 (RT_128=4) */
 #ifndef RT_SIMD_COMPAT_FMA
 #define RT_SIMD_COMPAT_FMA      RT_SIMD_COMPAT_FMA_MASTER
 #endif /* RT_SIMD_COMPAT_FMA */
 
 /* RT_SIMD_COMPAT_FMS when enabled changes the default behavior
- * of fmsps_** instructions to their full-precision fallback */
+ * of fmsps_** instructions to their full-precision fallback,
+ * 3 selects vectorized fp64 fallback instead of x87 (RT_128=4) */
 #ifndef RT_SIMD_COMPAT_FMS
 #define RT_SIMD_COMPAT_FMS      RT_SIMD_COMPAT_FMS_MASTER
 #endif /* RT_SIMD_COMPAT_FMS */
@@ -1732,6 +2128,40 @@
 #error "couldn't select appropriate SIMD target, check build flags"
 #endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
 
+#if RT_CODE_GEN == 0
+
+/* use 1 local to fix optimized builds, where locals are referenced via SP,
+ * while stack ops from within the asm block aren't counted into offsets */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+{                                                                           \
+    rt_full __Reax__;                                                       \
+    asm volatile                                                            \
+    (                                                                       \
+        movlb_st(%[Reax_])                                                  \
+        movlb_ld(%[Info_])
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        movlb_ld(%[Reax_])                                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_full)__Info__)                                 \
+        : "cc",  "memory"                                                   \
+    );                                                                      \
+}
+
+#else /* RT_CODE_GEN */
+
+/* code is generated into a buffer and called as a function,
+ * info is passed in the 1st argument and then moved to Reax */
+#define ASM_BLOCK_BEG(__Info__)                                             \
+    CODE_BLOCK_BEG(__Info__)                                                \
+        movlb_ld(%[Info_])
+
+#define ASM_BLOCK_END(__Info__)                                             \
+        EMITB(0xC3)                           /* <- return to the caller */ \
+    CODE_BLOCK_END(__Info__)
+
+#endif /* RT_CODE_GEN */
+
 /*
  * As ASM_ENTER/ASM_LEAVE save/load a sizeable portion of registers onto/from
  * the stack, they are considered heavy and therefore best suited for compute
@@ -1742,15 +2172,8 @@
 #if RT_SIMD_FLUSH_ZERO == 0
 #if RT_SIMD_FAST_FCTRL == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1759,24 +2182,12 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER(__Info__)                                                 \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         sregs_sa()                                                          \
@@ -1788,12 +2199,7 @@
 #define ASM_LEAVE(__Info__)                                                 \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
 #else /* RT_SIMD_FLUSH_ZERO */
@@ -1826,15 +2232,8 @@
 
 #if RT_SIMD_FAST_FCTRL == 0
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         movxx_ld(Rebx, Mebp, inf_REGS)                                      \
@@ -1854,24 +2253,12 @@
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
 
 #else /* RT_SIMD_FAST_FCTRL */
 
-/* use 1 local to fix optimized builds, where locals are referenced via SP,
- * while stack ops from within the asm block aren't counted into offsets */
 #define ASM_ENTER_F(__Info__)                                               \
-{                                                                           \
-    rt_full __Reax__;                                                       \
-    asm volatile                                                            \
-    (                                                                       \
-        movlb_st(%[Reax_])                                                  \
-        movlb_ld(%[Info_])                                                  \
+        ASM_BLOCK_BEG(__Info__)                                             \
         stack_sa()                                                          \
         movxx_rr(Rebp, Reax)                                                \
         movxx_ld(Rebx, Mebp, inf_REGS)                                      \
@@ -1897,18 +2284,247 @@
         mxcsr_ld(Mebp, inf_FCTRL(0*4))                                      \
         sregs_la()                                                          \
         stack_la()                                                          \
-        movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_full)__Info__)                                  \
-        : "cc",  "memory"                                                   \
-    );                                                                      \
-}
+        ASM_BLOCK_END(__Info__)
+
+#endif /* RT_SIMD_FAST_FCTRL */
+
+/*
+ * The ASM_ENTER_LITE/ASM_LEAVE_LITE versions save/load only those BASE/SIMD
+ * registers, which are declared in the masks (RT_BASE_*, RT_SIMD_* above),
+ * and are therefore better suited for short sections called very often.
+ * SIMD registers are saved at full width of the chosen target, followed by
+ * internal SIMD temps and AVX-512 mask registers (check sregs_sk/sregs_lk).
+ * Mask registers are saved only in static mode when building for AVX-512
+ * (as then compilers can allocate them), with kmovq if AVX512BW is enabled,
+ * in dynamic mode (RT_CODE_GEN) they are caller-saved in the native ABI.
+ * The SIMD unit is set to operate in its default mode (as with ASM_ENTER).
+ */
+
+#if RT_CODE_GEN == 0
+
+#define ASM_STR(s)              #s
+#define ASM_XSTR(s)             ASM_STR(s)
+
+/* masks are kept in assembler symbols and evaluated with .if directives */
+#define ASM_MSET(sym, mask)                                                 \
+        ASM_BEG ".set .L" #sym ", " ASM_XSTR(mask) ASM_END
+
+#define ASM_MBEG(sym, bit)                                                  \
+        ASM_BEG ".if (.L" #sym " >> " #bit ") & 1" ASM_END
+
+#define ASM_MEND                                                            \
+        ASM_BEG ".endif" ASM_END
+
+/* compiler-allocated operand registers are saved along with r15 (internal),
+ * as any of them can be modified in the section without being in the mask */
+#define RT_BASE_LITE            (RT_BASE_REBP | 0x8000)
+#define RT_SIMD_LITE            0
+
+#define stack_so() /* not portable, do not use outside */                   \
+        ASM_BEG ASM_OP1(pushq, %[Reax_]) ASM_END                            \
+        ASM_BEG ASM_OP1(pushq, %[Info_]) ASM_END
+
+#define stack_lo() /* not portable, do not use outside */                   \
+        ASM_BEG ASM_OP1(popq, %[Info_]) ASM_END                             \
+        ASM_BEG ASM_OP1(popq, %[Reax_]) ASM_END
+
+#else /* RT_CODE_GEN */
+
+/* masks are kept in locals and evaluated when the code is generated */
+#define ASM_MSET(sym, mask)                                                 \
+        rt_ui32 sym = (rt_ui32)(mask);
+
+#define ASM_MBEG(sym, bit)                                                  \
+        if ((sym >> bit) & 1) {
+
+#define ASM_MEND                                                            \
+        }
+
+/* callee-saved registers of the native ABI are saved along with r15,
+ * as the code is called as a function rather than inlined into one */
+#if   (defined RT_WIN64)
+#define RT_BASE_LITE            (RT_BASE_REBX | RT_BASE_REBP | RT_BASE_RESI | \
+                                 RT_BASE_REDI | RT_BASE_REGC | RT_BASE_REGD | \
+                                 RT_BASE_REGE | 0x8000)
+#define RT_SIMD_LITE            (RT_REGS <= 8 ? 0x00FF : 0xFFC0)
+#else  /* RT_WIN64 */
+#define RT_BASE_LITE            (RT_BASE_REBX | RT_BASE_REBP | RT_BASE_REGC | \
+                                 RT_BASE_REGD | RT_BASE_REGE | 0x8000)
+#define RT_SIMD_LITE            0
+#endif /* RT_WIN64 */
+
+#define stack_so() /* not portable, do not use outside */
+#define stack_lo() /* not portable, do not use outside */
+
+#endif /* RT_CODE_GEN */
+
+#define stack_sm() /* save BASE regs from the mask, not portable */         \
+        stack_so()                                                          \
+        ASM_MBEG(__Base__, 0x01) stack_st(Recx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x02) stack_st(Redx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x03) stack_st(Rebx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x05) stack_st(Rebp) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x06) stack_st(Resi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x07) stack_st(Redi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x08) stack_st(Reg8) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x09) stack_st(Reg9) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0A) stack_st(RegA) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0B) stack_st(RegB) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0C) stack_st(RegC) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0D) stack_st(RegD) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0E) stack_st(RegE) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0F)                                            \
+        REX(0,             1) EMITB(0xFF)     /* <- save r15 or [RegF] */   \
+        MRM(0x06,       0x03, 0x07)                                         \
+        ASM_MEND
+
+#define stack_lm() /* load BASE regs from the mask, not portable */         \
+        ASM_MBEG(__Base__, 0x0F)                                            \
+        REX(0,             1) EMITB(0x8F)     /* <- load r15 or [RegF] */   \
+        MRM(0x00,       0x03, 0x07)                                         \
+        ASM_MEND                                                            \
+        ASM_MBEG(__Base__, 0x0E) stack_ld(RegE) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0D) stack_ld(RegD) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0C) stack_ld(RegC) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0B) stack_ld(RegB) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x0A) stack_ld(RegA) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x09) stack_ld(Reg9) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x08) stack_ld(Reg8) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x07) stack_ld(Redi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x06) stack_ld(Resi) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x05) stack_ld(Rebp) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x03) stack_ld(Rebx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x02) stack_ld(Redx) ASM_MEND                    \
+        ASM_MBEG(__Base__, 0x01) stack_ld(Recx) ASM_MEND                    \
+        stack_lo()
+
+#define sregs_mx(op, XS, bit) /* not portable, do not use outside */        \
+        ASM_MBEG(__Simd__, bit)                                             \
+        op(W(XS), Oeax, PLAIN)                                              \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        ASM_MEND
+
+#define sregs_m8(op) /* not portable, do not use outside */                 \
+        movxx_ld(Reax, Mebp, inf_REGS)                                      \
+        sregs_mx(op, Xmm0, 0x00)                                            \
+        sregs_mx(op, Xmm1, 0x01)                                            \
+        sregs_mx(op, Xmm2, 0x02)                                            \
+        sregs_mx(op, Xmm3, 0x03)                                            \
+        sregs_mx(op, Xmm4, 0x04)                                            \
+        sregs_mx(op, Xmm5, 0x05)                                            \
+        sregs_mx(op, Xmm6, 0x06)                                            \
+        sregs_mx(op, Xmm7, 0x07)
+
+#define sregs_mG(op) /* not portable, do not use outside */                 \
+        sregs_m8(op)                                                        \
+        sregs_mx(op, Xmm8, 0x08)                                            \
+        sregs_mx(op, Xmm9, 0x09)                                            \
+        sregs_mx(op, XmmA, 0x0A)                                            \
+        sregs_mx(op, XmmB, 0x0B)                                            \
+        sregs_mx(op, XmmC, 0x0C)                                            \
+        sregs_mx(op, XmmD, 0x0D)                                            \
+        sregs_mx(op, XmmE, 0x0E)                                            \
+        sregs_mx(op, XmmF, 0x0F)
+
+#define sregs_mW(op) /* not portable, do not use outside */                 \
+        sregs_mG(op)                                                        \
+        sregs_mx(op, XmmG, 0x10)                                            \
+        sregs_mx(op, XmmH, 0x11)                                            \
+        sregs_mx(op, XmmI, 0x12)                                            \
+        sregs_mx(op, XmmJ, 0x13)                                            \
+        sregs_mx(op, XmmK, 0x14)                                            \
+        sregs_mx(op, XmmL, 0x15)                                            \
+        sregs_mx(op, XmmM, 0x16)                                            \
+        sregs_mx(op, XmmN, 0x17)                                            \
+        sregs_mx(op, XmmO, 0x18)                                            \
+        sregs_mx(op, XmmP, 0x19)                                            \
+        sregs_mx(op, XmmQ, 0x1A)                                            \
+        sregs_mx(op, XmmR, 0x1B)                                            \
+        sregs_mx(op, XmmS, 0x1C)                                            \
+        sregs_mx(op, XmmT, 0x1D)
+
+/* internal SIMD temps and AVX-512 mask regs are saved after those from the
+ * mask by sregs_sk/sregs_lk, which AVX-512 targets define when building for
+ * AVX-512 (only then can compilers allocate them) or in dynamic mode */
+#ifndef sregs_sk
+#define sregs_sk() /* no internal SIMD regs to save */
+#define sregs_lk() /* no internal SIMD regs to load */
+#endif /* sregs_sk */
+
+#if (defined __AVX512BW__) /* compiler can allocate 64-bit masks (kmovq) */
+#define sregs_kx(op, kn) /* not portable, do not use outside */             \
+        VEW(0,             0,    0x00, 0, 0, 1) EMITB(op)                   \
+        MRM(kn,         0x00,    0x00)                                      \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))
+#else  /* __AVX512BW__ */
+#define sregs_kx(op, kn) /* not portable, do not use outside */             \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(op)                   \
+        MRM(kn,         0x00,    0x00)                                      \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))
+#endif /* __AVX512BW__ */
+
+#if   (defined RT_SIMD_CODE) && (RT_REGS <= 8)
+#define sregs_sm()  sregs_m8(movox_st) sregs_sk() /* save SIMD regs (mask) */
+#define sregs_lm()  sregs_m8(movox_ld) sregs_lk() /* load SIMD regs (mask) */
+#elif (defined RT_SIMD_CODE) && (RT_REGS <= 16)
+#define sregs_sm()  sregs_mG(movox_st) sregs_sk() /* save SIMD regs (mask) */
+#define sregs_lm()  sregs_mG(movox_ld) sregs_lk() /* load SIMD regs (mask) */
+#elif (defined RT_SIMD_CODE) /* RT_REGS: 32 */
+#define sregs_sm()  sregs_mW(movox_st) sregs_sk() /* save SIMD regs (mask) */
+#define sregs_lm()  sregs_mW(movox_ld) sregs_lk() /* load SIMD regs (mask) */
+#endif /* RT_REGS: 8, 16, 32 */
+
+#if RT_SIMD_FLUSH_ZERO == 0
+#if RT_SIMD_FAST_FCTRL == 0
+
+#define ASM_ENTER_LITE(__Info__, __BMsk__, __SMsk__)                        \
+        ASM_BLOCK_BEG(__Info__)                                             \
+        ASM_MSET(__Base__, (__BMsk__) | RT_BASE_LITE)                       \
+        ASM_MSET(__Simd__, (__SMsk__) | RT_SIMD_LITE)                       \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sm()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_LEAVE_LITE(__Info__)                                            \
+        sregs_lm()                                                          \
+        stack_lm()                                                          \
+        ASM_BLOCK_END(__Info__)
+
+#else /* RT_SIMD_FAST_FCTRL */
+
+#define ASM_ENTER_LITE(__Info__, __BMsk__, __SMsk__)                        \
+        ASM_BLOCK_BEG(__Info__)                                             \
+        ASM_MSET(__Base__, (__BMsk__) | RT_BASE_LITE)                       \
+        ASM_MSET(__Simd__, (__SMsk__) | RT_SIMD_LITE)                       \
+        stack_sm()                                                          \
+        movxx_rr(Rebp, Reax)                                                \
+        sregs_sm()                                                          \
+        movwx_mi(Mebp, inf_FCTRL(3*4), IH(0x7F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(2*4), IH(0x5F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(1*4), IH(0x3F80))                          \
+        movwx_mi(Mebp, inf_FCTRL(0*4), IH(0x1F80))
+
+#define ASM_LEAVE_LITE(__Info__)                                            \
+        sregs_lm()                                                          \
+        stack_lm()                                                          \
+        ASM_BLOCK_END(__Info__)
 
 #endif /* RT_SIMD_FAST_FCTRL */
+#else /* RT_SIMD_FLUSH_ZERO */
+
+/* flush-to-zero mode requires full state save, use ASM_ENTER_F instead */
+#define ASM_ENTER_LITE(__Info__, __BMsk__, __SMsk__) ASM_ENTER_F(__Info__)
+
+#define ASM_LEAVE_LITE(__Info__) ASM_LEAVE_F(__Info__)
+
+#endif /* RT_SIMD_FLUSH_ZERO */
 
 #ifndef RT_SIMD_CODE
 #define sregs_sa()
 #define sregs_la()
+#define sregs_sm()
+#define sregs_lm()
 #define mxcsr_ld(MS, DS)
 #endif /* RT_SIMD_CODE */
 
@@ -1928,6 +2544,11 @@
 #define EMITB(b)                ASM_BEG ASM_OP1(.byte, b) ASM_END
 #define EMITW(w)                ASM_BEG ASM_OP1(.long, w) ASM_END
 
+/* register aliasing within instructions is resolved by the assembler */
+#define ASM_IFEQ(a, b)          ASM_BEG ASM_OP1(.if, (a) == (b)) ASM_END
+#define ASM_ELSE                ASM_BEG ASM_OP0(.else) ASM_END
+#define ASM_ENDI                ASM_BEG ASM_OP0(.endif) ASM_END
+
 #define EMITH(h)                                                            \
         EMITB((h) >> 0x00 & 0xFF)                                           \
         EMITB((h) >> 0x08 & 0xFF)
@@ -2065,8 +2686,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -2094,8 +2715,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -2160,8 +2781,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -2203,8 +2824,8 @@
         sregs_la()                                                          \
         stack_la()                                                          \
         movlb_ld(%[Reax_])                                                  \
-        : [Reax_] "+r" (__Reax__)                                           \
-        : [Info_]  "r" ((rt_word)__Info__)                                  \
+        : [Reax_] "=&r" (__Reax__)                                          \
+        : [Info_]   "r" ((rt_word)__Info__)                                 \
         : "cc",  "memory"                                                   \
     );                                                                      \
 }
@@ -2242,6 +2863,11 @@
                                 EMITB((w) >> 0x10 & 0xFF)                   \
                                 EMITB((w) >> 0x18 & 0xFF)
 
+/* register aliasing within instructions is resolved by the compiler */
+#define ASM_IFEQ(a, b)          if ((a) == (b)) {
+#define ASM_ELSE                } else {
+#define ASM_ENDI                }
+
 #define EMITH(h)                                                            \
         EMITB((h) >> 0x00 & 0xFF)                                           \
         EMITB((h) >> 0x08 & 0xFF)
@@ -2523,6 +3149,16 @@
 
 #endif /* OS, COMPILER, ARCH */
 
+/*
+ * Targets without ASM_ENTER_LITE/ASM_LEAVE_LITE support (ARMv7, MIPS, POWER
+ * and legacy x86) fall back to full register save/load, in which case masks
+ * are ignored, only x32/x64 and A32/A64 save/load registers from the masks.
+ */
+#ifndef ASM_ENTER_LITE
+#define ASM_ENTER_LITE(__Info__, __BMsk__, __SMsk__) ASM_ENTER(__Info__)
+#define ASM_LEAVE_LITE(__Info__) ASM_LEAVE(__Info__)
+#endif /* ASM_ENTER_LITE */
+
 #endif /* RT_RTARCH_H */
 
 /******************************************************************************/
@@ -1798,6 +1798,26 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x0B000000 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
 
+/* prf (prefetch cache line at adr S into cache level given by hint)
+ * set-flags: no
+ * hint: L1 - all levels, L2 - outer levels, NT - non-temporal (streaming)
+ * never faults, treated as a no-op where the hint is not supported */
+
+#define RT_BASE_HINT_L1     0x00    /* PLDL1KEEP */
+#define RT_BASE_HINT_L2     0x02    /* PLDL2KEEP */
+#define RT_BASE_HINT_NT     0x01    /* PLDL1STRM */
+
+#define prfxx_ld(MS, DS, hint)   /* native disp is a multiple of 8 */       \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
+        EMITW(0xF8800000 | MDM(RT_BASE_HINT_##hint,                         \
+                               MOD(MS), VXL(DS), B1(DS), P1(DS)))
+
+/* fence (orders preceding non-temporal stores before subsequent stores)
+ * set-flags: no */
+
+#define fence_xx()                                                          \
+        EMITW(0xD5033ABF)                     /* dmb ishst */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -1833,6 +1853,8 @@
 
 #endif /* defined (RT_A32, RT_A64) */
 
+#if RT_CODE_GEN == 0
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(b,    lb) ASM_END
 
@@ -1875,6 +1897,52 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        EMITR(lb, RT_CODE_IMM26) EMITW(0x14000000)             /* b    lb */
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x0)       /* b.eq lb */
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x1)       /* b.ne lb */
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x0)       /* b.eq lb */
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x1)       /* b.ne lb */
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x3)       /* b.lo lb */
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x9)       /* b.ls lb */
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x8)       /* b.hi lb */
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0x2)       /* b.hs lb */
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0xB)       /* b.lt lb */
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0xD)       /* b.le lb */
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0xC)       /* b.gt lb */
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_IMM19) EMITW(0x54000000 | 0xA)       /* b.ge lb */
+
+#define LBL(lb)                                          /* code label */   \
+        EMITL(lb)
+
+#endif /* RT_CODE_GEN */
+
 /************************* register-size instructions *************************/
 
 /* stack (push stack = S, D = pop stack)
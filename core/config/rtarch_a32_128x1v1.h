@@ -243,6 +243,63 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movix_nt
+#define movix_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0x6E004000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6C000000 | MXM(REG(XS), TPxx,    0x00) | TmmM << 10)
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfix_ri
+#define shfix_ri(XD, XS, IT)                                                \
+        EMITW(0x4EA01C00 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6E040400 | MXM(REG(XD), TmmM,    0x00) |                    \
+                         ((VAL(IT))>>0&3)<<13 | 0<<19)                      \
+        EMITW(0x6E040400 | MXM(REG(XD), TmmM,    0x00) |                    \
+                         ((VAL(IT))>>2&3)<<13 | 1<<19)                      \
+        EMITW(0x6E040400 | MXM(REG(XD), TmmM,    0x00) |                    \
+                         ((VAL(IT))>>4&3)<<13 | 2<<19)                      \
+        EMITW(0x6E040400 | MXM(REG(XD), TmmM,    0x00) |                    \
+                         ((VAL(IT))>>6&3)<<13 | 3<<19)
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)                                                    \
+        EMITW(0x4E803800 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x4E807800 | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XG), TmmM,    TmmM))
+
+#undef  uzpix_rr
+#define uzpix_rr(XG, XS)                                                    \
+        EMITW(0x4E801800 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x4E805800 | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XG), TmmM,    TmmM))
+
+#undef  bcxix_ri
+#define bcxix_ri(XD, XS, IT)                                                \
+        EMITW(0x4E040400 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&3)<<19)
+
+#undef  rotix_ri
+#define rotix_ri(XD, XS, IT)                                                \
+        EMITW(0x6E000000 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((VAL(IT))&3)<<13)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movix_bc
+#define movix_bc(XD, MS, DS)                                                \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        EMITW(0x4E040400 | MXM(REG(XD), REG(XD), 0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -422,6 +479,12 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpis3rr
+#define mlpis3rr(XD, XS, XT)                                                \
+        EMITW(0x4E801800 | MXM(TmmM,    REG(XS), REG(XT)))                  \
+        EMITW(0x4E805800 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E20DC00 | MXM(REG(XD), REG(XD), TmmM))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -492,7 +555,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         EMITW(0x4E20CC00 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -508,7 +571,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         EMITW(0x4EA0CC00 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -541,6 +604,16 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpis3rr
+#define mnpis3rr(XD, XS, XT)                                                \
+        EMITW(0x6EA0F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mnpis3ld
+#define mnpis3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EA0F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -560,6 +633,16 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpis3rr
+#define mxpis3rr(XD, XS, XT)                                                \
+        EMITW(0x6E20F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mxpis3ld
+#define mxpis3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E20F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -834,6 +917,23 @@
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
         EMITW(0x6E21D800 | MXM(REG(XD), TmmM,    0x00))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvhis_ld
+#define cvhis_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0xFD400000 | MXM(REG(XD), TPxx,    0x00))                     \
+        EMITW(0x0E217800 | MXM(REG(XD), REG(XD), 0x00))
+
+#undef  cvhis_st
+#define cvhis_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0x0E216800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0xFD000000 | MXM(TmmM,    TPxx,    0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -1008,6 +1108,168 @@
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem with variable divisor extend each half of the elements to fp64
+ * (sxtl/uxtl, scvtf/ucvtf), where all 32-bit integer quotients are exact,
+ * instead of per-element BASE division loops, upper half goes to inf_SCR03;
+ * div by zero and signed INT_MIN/-1 don't trap: signed quotient is then
+ * 0x80000000, div by zero returns the lower half of the saturated 64-bit
+ * quotient (0xFFFFFFFF for positive dividends, 0 for negative or zero),
+ * rem by zero returns the dividend */
+
+#undef  divix3rr
+#define divix3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), 0x20000000)
+
+#undef  divix3ld
+#define divix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), 0x20000000)
+
+#undef  divin3rr
+#define divin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), 0x00000000)
+
+#undef  divin3ld
+#define divin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), 0x00000000)
+
+#undef  remix3rr
+#define remix3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmfix_rx(W(XD), 0x20000000)
+
+#undef  remix3ld
+#define remix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmfix_rx(W(XD), 0x20000000)
+
+#undef  remin3rr
+#define remin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmfix_rx(W(XD), 0x00000000)
+
+#undef  remin3ld
+#define remin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmfix_rx(W(XD), 0x00000000)
+
+/* dvf (D = inf_SCR01 / inf_SCR02), rmf (D = inf_SCR01 % inf_SCR02),
+ * us selects unsigned (0x20000000) or signed (0x00000000) conversions,
+ * 64-bit results of both halves are narrowed with uzp1 in dvzix_ld */
+
+#define dvfix_rx(XD, us) /* not portable, do not use outside */             \
+        dvhix_rx(W(XD), Mebp, inf_SCR02(0), (us) | 0x40000000)              \
+        movix_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        dvhix_rx(W(XD), Mebp, inf_SCR02(0), (us))                           \
+        dvzix_ld(W(XD), Mebp, inf_SCR03(0))
+
+#define rmfix_rx(XD, us) /* not portable, do not use outside */             \
+        rmhix_rx(W(XD), Mebp, inf_SCR02(0), (us) | 0x40000000)              \
+        movix_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        rmhix_rx(W(XD), Mebp, inf_SCR02(0), (us))                           \
+        dvzix_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        EMITW(0x6EA0B800 | MXM(REG(XD), REG(XD), 0x00))                     \
+        addix_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* dvh (one half selected by 0x40000000 in us), divisor half stays in TmmM,
+ * rmh (product of truncated quotient and divisor) */
+
+#define dvhix_rx(XD, MT, DT, us) /* not portable, do not use outside */     \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x0F20A400 | MXM(REG(XD), REG(XD), 0x00) | (us))              \
+        EMITW(0x4E61D800 | MXM(REG(XD), REG(XD), 0x00) | (us))              \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x0F20A400 | MXM(TmmM,    TmmM,    0x00) | (us))              \
+        EMITW(0x4E61D800 | MXM(TmmM,    TmmM,    0x00) | (us))              \
+        EMITW(0x6E60FC00 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x4EE1B800 | MXM(REG(XD), REG(XD), 0x00) | (us))
+
+#define rmhix_rx(XD, MT, DT, us) /* not portable, do not use outside */     \
+        dvhix_rx(W(XD), W(MT), W(DT), (us))                                 \
+        EMITW(0x4E61D800 | MXM(REG(XD), REG(XD), 0x00) | (us))              \
+        EMITW(0x6E60DC00 | MXM(REG(XD), REG(XD), TmmM))                     \
+        EMITW(0x4EE1B800 | MXM(REG(XD), REG(XD), 0x00) | (us))
+
+#define dvzix_ld(XD, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x4E801800 | MXM(REG(XD), REG(XD), TmmM))
+
+/* div, rem by immediate use 32x32->64-bit umull/umull2 products (unsigned)
+ * and doubling sqdmulh products (signed) instead of per-element BASE loops,
+ * the dividend is kept in inf_SCR01 where it's needed after multiply-high */
+
+#undef  divix_ri
+#define divix_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mhuix_rx(W(XG), IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF)))              \
+        EMITW(0x4EA01C00 | MXM(TmmM,    REG(XG), REG(XG)))                  \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x6EA08400 | MXM(REG(XG), REG(XG), TmmM))                     \
+        shrix_ri(W(XG), IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))               \
+        EMITW(0x4EA08400 | MXM(REG(XG), REG(XG), TmmM))                     \
+        shrix_ri(W(XG), IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#undef  divin_ri
+#define divin_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        mhnix_rx(W(XG), IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF)))              \
+        EMITW(0x4F3F1400 | MXM(REG(XG), TmmM,    0x00))                     \
+        shrin_ri(W(XG), IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                \
+        EMITW(0x6F211400 | MXM(REG(XG), REG(XG), 0x00))
+
+#undef  remix_ri
+#define remix_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        divix_ri(W(XG), W(IS))                                              \
+        rmiix_rx(W(XG), W(IS))
+
+#undef  remin_ri
+#define remin_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        divin_ri(W(XG), W(IS))                                              \
+        rmiix_rx(W(XG), W(IS))
+
+#define rmiix_rx(XG, IS) /* not portable, do not use outside */             \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x4E040C00 | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x4EA09C00 | MXM(TmmM,    REG(XG), TmmM))                     \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x6EA08400 | MXM(REG(XG), REG(XG), TmmM))
+
+/* mhu (G = mulhi(G, IS)) unsigned, upper half products go to TmmM first,
+ * then the magic number takes the place of G's upper half for the rest */
+
+#define mhuix_rx(XG, IS) /* not portable, do not use outside */             \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x4E040C00 | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x6EA0C000 | MXM(TmmM,    REG(XG), TmmM))                     \
+        EMITW(0x4E141C00 | MXM(REG(XG), TIxx,    0x00))                     \
+        EMITW(0x2F80A800 | MXM(REG(XG), REG(XG), REG(XG)))                  \
+        EMITW(0x4E805800 | MXM(REG(XG), REG(XG), TmmM))
+
+/* mhn (TmmM = 2 * mulhi(G, IS)) signed, sqdmulh never saturates here
+ * as the magic number can't be the most negative value */
+
+#define mhnix_rx(XG, IS) /* not portable, do not use outside */             \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x4E040C00 | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x4EA0B400 | MXM(TmmM,    REG(XG), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1485,7 +1747,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0x1F000000 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 10)
@@ -1501,7 +1763,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0x1F008000 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 10)
@@ -163,6 +163,15 @@
         EMITW(0x3D800000 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x3D800000 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movcx_nt
+#define movcx_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xAC000000 | MXM(REG(XS), TPxx,    0x00) | RYG(XS) << 10)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -460,7 +469,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmacs_rr(XG, XS, XT)                                                \
         EMITW(0x4E20CC00 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -479,7 +488,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmscs_rr(XG, XS, XT)                                                \
         EMITW(0x4EA0CC00 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -873,6 +882,25 @@
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E21D800 | MXM(RYG(XD), TmmM,    0x00))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvhcs_ld
+#define cvhcs_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x3DC00000 | MXM(TmmM,    TPxx,    0x00))                     \
+        EMITW(0x0E217800 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x4E217800 | MXM(RYG(XD), TmmM,    0x00))
+
+#undef  cvhcs_st
+#define cvhcs_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0x0E216800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4E216800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x3D800000 | MXM(TmmM,    TPxx,    0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -1507,6 +1535,18 @@
 
 /* sregs */
 
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        EMITW(0x3D800000 | MXM(TmmQ,    TEax,    0x00))                     \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
+        EMITW(0x3D800000 | MXM(TmmM,    TEax,    0x00))                     \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        EMITW(0x3DC00000 | MXM(TmmQ,    TEax,    0x00))                     \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))                           \
+        EMITW(0x3DC00000 | MXM(TmmM,    TEax,    0x00))                     \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_128*4))
+
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
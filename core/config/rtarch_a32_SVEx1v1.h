@@ -270,6 +270,58 @@
         EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
         EMITW(0x658D8000 | MTM(REG(XD), TmmM,    REG(PS)))
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65878000 | MTM(REG(XG), REG(XS), REG(PS)))
+
+#define minosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x65878000 | MTM(REG(XG), TmmM,    REG(PS)))
+
+#define minosPrr(XG, PS, XS)                                                \
+        minos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minosPld(XG, PS, MS, DS)                                            \
+        minos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minos4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65878000 | MTM(REG(XD), REG(XT), REG(PS)))
+
+#define minos4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65878000 | MTM(REG(XD), TmmM,    REG(PS)))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65868000 | MTM(REG(XG), REG(XS), REG(PS)))
+
+#define maxosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x65868000 | MTM(REG(XG), TmmM,    REG(PS)))
+
+#define maxosPrr(XG, PS, XS)                                                \
+        maxos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxosPld(XG, PS, MS, DS)                                            \
+        maxos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxos4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65868000 | MTM(REG(XD), REG(XT), REG(PS)))
+
+#define maxos4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65868000 | MTM(REG(XD), TmmM,    REG(PS)))
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqosPrr(PD, XS, XT)                                                \
@@ -394,6 +446,11 @@
         xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##32_SVE*RT_SIMD_WIDTH32))     \
         jezxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlox_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        EMITW(0x25A00400 | MXM(REG(PD), TZxx,    REG(RS)))
+
 /* mov (D = S), predicated */
 
 #define mxvox_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -710,6 +767,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), F1(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movox_nt
+#define movox_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE510E000 | MXM(REG(XS), TPxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -730,6 +796,104 @@
         EMITW(0x05A0C400 | MXM(TmmM,    REG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VAL(DG), B3(DG), F1(DG)))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h
+ * SVE zip/uzp work across the whole vector, per-quad forms use trn1/trn2,
+ * shf builds per-element table indices from T in-register for tbl */
+
+#undef  shfox_ri
+#define shfox_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x04A14000 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x05800020 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x04619C00 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x25B8C000 | MXM(REG(XD), 0x00,    0x00) |                    \
+                         ((VAL(IT))&0xFF)<<5)                               \
+        EMITW(0x04918000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05800020 | MXM(REG(XD), 0x00,    0x00))                     \
+        EMITW(0x04A14000 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x0580F3A0 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x04A00000 | MXM(REG(XD), REG(XD), TmmM))                     \
+        tblox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  zipox_rr
+#define zipox_rr(XG, XS)                                                    \
+        EMITW(0x05A07000 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x05A07400 | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0x05E07000 | MXM(REG(XG), TmmM,    REG(XS)))                  \
+        EMITW(0x05E07400 | MXM(REG(XS), TmmM,    REG(XS)))
+
+#undef  uzpox_rr
+#define uzpox_rr(XG, XS)                                                    \
+        EMITW(0x05E07000 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x05E07400 | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0x05A07000 | MXM(REG(XG), TmmM,    REG(XS)))                  \
+        EMITW(0x05A07400 | MXM(REG(XS), TmmM,    REG(XS)))
+
+#if   (RT_SIMD <= 512)
+
+#undef  bcxox_ri
+#define bcxox_ri(XD, XS, IT)                                                \
+        EMITW(0x05242000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&(RT_SIMD/32-1)&0x0C)<<20 |              \
+                         ((VAL(IT))&0x03)<<19)
+
+#else  /* RT_SIMD: 2K8, 1K4 */
+
+#undef  bcxox_ri
+#define bcxox_ri(XD, XS, IT)                                                \
+        EMITW(0x25B8C000 | MXM(TmmM,    0x00,    0x00) |                    \
+                         ((VAL(IT))&(RT_SIMD/32-1))<<5)                     \
+        EMITW(0x05A03000 | MXM(REG(XD), REG(XS), TmmM))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+#undef  rotox_ri
+#define rotox_ri(XD, XS, IT)                                                \
+        movox_rr(W(XD), W(XS))                                              \
+        EMITW(0x05200000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&(RT_SIMD/32-1)&0x3E)<<15 |              \
+                         ((VAL(IT))&0x01)<<12)
+
+#define tblox_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x05A03000 | MXM(REG(XG), TmmM,    REG(XG)))
+
+        /* cmp, exp are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* cmp ([D] = active elements of S packed), exp is taken from rtbase.h
+ * compact packs active elements to the bottom of TmmM, then TmmM is stored
+ * under a whilelo predicate built from the cntp count, which writes
+ * exactly mkc elements at D (memory past the count is left intact) */
+
+#undef  cmpox_st
+#define cmpox_st(XS, MD, DD)                                                \
+        EMITW(0x2480A000 | MXM(0x01,    Tmm0,    TmmQ))                     \
+        EMITW(0x05A18400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x25A08000 | MXM(TDxx,    0x01,    0x00))                     \
+        EMITW(0x25A00C00 | MXM(0x01,    TZxx,    TDxx))                     \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD)>>2, C3(DD), EMPTY2)\
+        EMITW(0xE5404000 | MXM(TmmM,    MOD(MD), TDxx) | 0x01 << 10)
+
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* gat (D = [S + T*4]), sca ([D + T*4] = S), MS/MD take plain M*** modes
+ * use all-ones p0 predicate, element indices are sign-extended from 32-bit */
+
+#undef  gatox_ld
+#define gatox_ld(XD, MS, XT) /* indexed load, T holds 32-bit indices */     \
+        EMITW(0x85604000 | MXM(REG(XD), REG(MS), REG(XT)))
+
+#undef  scaox_st
+#define scaox_st(XS, MD, XT) /* indexed store, T holds 32-bit indices */    \
+        EMITW(0xE560C000 | MXM(REG(XS), REG(MD), REG(XT)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -889,6 +1053,67 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* SVE has no fmulv, mlh multiplies S by itself rotated (ext)
+         * by half of the remaining elements with TmmM as temp,
+         * log-step reductions leave equal results in all elements */
+
+#define mlhos_rx(XD, RS, IT) /* not portable, do not use outside */         \
+        EMITW(0x04603000 | MXM(TmmM,    RS,      RS))                       \
+        EMITW(0x05200000 | MXM(TmmM,    RS,      0x00) |                    \
+                         ((IT)&0x3E)<<15 | ((IT)&0x01)<<12)                 \
+        EMITW(0x65800800 | MXM(REG(XD), RS,      TmmM))
+
+#define mlhos_r1(XD, RS) /* not portable, do not use outside */             \
+        mlhos_rx(W(XD), RS, 1)
+
+#define mlhos_r2(XD, RS) /* not portable, do not use outside */             \
+        mlhos_rx(W(XD), RS, 2)                                              \
+        mlhos_r1(W(XD), REG(XD))
+
+#define mlhos_r4(XD, RS) /* not portable, do not use outside */             \
+        mlhos_rx(W(XD), RS, 4)                                              \
+        mlhos_r2(W(XD), REG(XD))
+
+#define mlhos_r8(XD, RS) /* not portable, do not use outside */             \
+        mlhos_rx(W(XD), RS, 8)                                              \
+        mlhos_r4(W(XD), REG(XD))
+
+#define mlhos_r16(XD, RS) /* not portable, do not use outside */            \
+        mlhos_rx(W(XD), RS, 16)                                             \
+        mlhos_r8(W(XD), REG(XD))
+
+#define mlhos_r32(XD, RS) /* not portable, do not use outside */            \
+        mlhos_rx(W(XD), RS, 32)                                             \
+        mlhos_r16(W(XD), REG(XD))
+
+#undef  mlhos_rr
+#if   (RT_SIMD == 2048)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhos_r32(W(XD), REG(XS))
+
+#elif (RT_SIMD == 1024)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhos_r16(W(XD), REG(XS))
+
+#elif (RT_SIMD == 512)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhos_r8(W(XD), REG(XS))
+
+#elif (RT_SIMD == 256)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhos_r4(W(XD), REG(XS))
+
+#else  /* RT_SIMD == 128 */
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhos_r2(W(XD), REG(XS))
+
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divos_rr(XG, XS)                                                    \
@@ -961,7 +1186,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaos_rr(XG, XS, XT)                                                \
         EMITW(0x65A00000 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -977,7 +1202,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsos_rr(XG, XS, XT)                                                \
         EMITW(0x65A02000 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1175,6 +1400,13 @@
         addwxZri(Reax, IB(RT_SIMD_MASK_##mask##32_SVE))                     \
         jezxx_lb(lb)
 
+/* mkc (D = number of active elements in mask S), cntp on predicate */
+
+#undef  mkcox_rx
+#define mkcox_rx(XS, RD)        /* destroys Reax */                         \
+        EMITW(0x2480A000 | MXM(0x01,    REG(XS), TmmQ))                     \
+        EMITW(0x25A08000 | MXM(REG(RD), 0x01,    0x00))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1617,6 +1849,52 @@
         movox_rr(W(XD), W(XS))                                              \
         remon_ld(W(XD), W(MT), W(DT))
 
+/* div, rem by immediate use umulh (smulh) with duplicated magic number
+ * instead of per-element BASE multiply-high loops (or slower udiv/sdiv),
+ * rem keeps the dividend in inf_SCR01 where it's needed after division */
+
+#undef  divox_ri
+#define divox_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        mhiox_rx(W(XG), IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF)), 0x04930000)  \
+        EMITW(0x04A00400 | MXM(REG(XG), REG(XG), TmmM))                     \
+        shrox_ri(W(XG), IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))               \
+        EMITW(0x04A00000 | MXM(REG(XG), REG(XG), TmmM))                     \
+        shrox_ri(W(XG), IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#undef  divon_ri
+#define divon_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        mhiox_rx(W(XG), IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF)), 0x04920000)  \
+        EMITW(0x04A00000 | MXM(REG(XG), REG(XG), TmmM))                     \
+        shron_ri(W(XG), IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                \
+        EMITW(0x04619400 | MXM(TmmM,    REG(XG), 0x00))                     \
+        EMITW(0x04A00000 | MXM(REG(XG), REG(XG), TmmM))
+
+#undef  remox_ri
+#define remox_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        divox_ri(W(XG), W(IS))                                              \
+        rmiox_rx(W(XG), W(IS))
+
+#undef  remon_ri
+#define remon_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        divon_ri(W(XG), W(IS))                                              \
+        rmiox_rx(W(XG), W(IS))
+
+#define rmiox_rx(XG, IS) /* not portable, do not use outside */             \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x05A03800 | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x04900000 | MXM(TmmM,    REG(XG), 0x00))                     \
+        movox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x04A00400 | MXM(REG(XG), REG(XG), TmmM))
+
+/* mhi (TmmM = mulhi(G, IS)) keeps G intact, op selects umulh or smulh */
+
+#define mhiox_rx(XG, IS, op) /* not portable, do not use outside */         \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x05A03800 | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(op         | MXM(TmmM,    REG(XG), 0x00))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -2017,6 +2295,50 @@
 
 /* sregs */
 
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        EMITW(0xE5804000 | MXM(TmmQ,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5804000 | MXM(TmmM,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x00,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x01,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x02,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x03,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x04,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x05,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x06,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x07,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        EMITW(0x85804000 | MXM(TmmQ,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85804000 | MXM(TmmM,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x00,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x01,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x02,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x03,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x04,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x05,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x06,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x07,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))
+
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
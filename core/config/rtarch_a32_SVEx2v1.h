@@ -296,6 +296,74 @@
         EMITW(0x04902000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
         EMITW(0x658D8000 | MTM(RYG(XD), TmmM,    REP(PS)))
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65878000 | MTM(REG(XG), REG(XS), REG(PS)))                  \
+        EMITW(0x65878000 | MTM(RYG(XG), RYG(XS), REP(PS)))
+
+#define minosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65878000 | MTM(REG(XG), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65878000 | MTM(RYG(XG), TmmM,    REP(PS)))
+
+#define minosPrr(XG, PS, XS)                                                \
+        minos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minosPld(XG, PS, MS, DS)                                            \
+        minos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minos4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65878000 | MTM(REG(XD), REG(XT), REG(PS)))                  \
+        EMITW(0x04902000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65878000 | MTM(RYG(XD), RYG(XT), REP(PS)))
+
+#define minos4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65878000 | MTM(REG(XD), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04902000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65878000 | MTM(RYG(XD), TmmM,    REP(PS)))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65868000 | MTM(REG(XG), REG(XS), REG(PS)))                  \
+        EMITW(0x65868000 | MTM(RYG(XG), RYG(XS), REP(PS)))
+
+#define maxosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65868000 | MTM(REG(XG), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65868000 | MTM(RYG(XG), TmmM,    REP(PS)))
+
+#define maxosPrr(XG, PS, XS)                                                \
+        maxos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxosPld(XG, PS, MS, DS)                                            \
+        maxos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxos4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65868000 | MTM(REG(XD), REG(XT), REG(PS)))                  \
+        EMITW(0x04902000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65868000 | MTM(RYG(XD), RYG(XT), REP(PS)))
+
+#define maxos4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04902000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65868000 | MTM(REG(XD), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04902000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65868000 | MTM(RYG(XD), TmmM,    REP(PS)))
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqosPrr(PD, XS, XT)                                                \
@@ -460,6 +528,13 @@
         xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##32_SVE*RT_SIMD_WIDTH32))     \
         jezxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlox_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        EMITW(0x25A00400 | MXM(REG(PD), TZxx,    REG(RS)))                  \
+        EMITW(0x51000000 | MXM(TMxx,    REG(RS), 0x00) | (RT_SIMD/64)<<10)  \
+        EMITW(0x25A00400 | MXM(REP(PD), TZxx,    TMxx))
+
 /* mov (D = S), predicated */
 
 #define mxvox_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -875,6 +950,16 @@
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), K1(DD)))  \
         EMITW(0xE5804000 | MPM(RYG(XS), MOD(MD), VZL(DD), B3(DD), K1(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movox_nt
+#define movox_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE510E000 | MXM(REG(XS), TPxx,    0x00))                     \
+        EMITW(0xE510E000 | MXM(RYG(XS), TPxx,    0x01))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -904,6 +989,22 @@
         EMITW(0x05A0C400 | MXM(TmmM,    RYG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VZL(DG), B3(DG), K1(DG)))
 
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* gat (D = [S + T*4]), sca ([D + T*4] = S), MS/MD take plain M*** modes
+ * use all-ones p0 predicate, element indices are sign-extended from 32-bit */
+
+#undef  gatox_ld
+#define gatox_ld(XD, MS, XT) /* indexed load, T holds 32-bit indices */     \
+        EMITW(0x85604000 | MXM(REG(XD), REG(MS), REG(XT)))                  \
+        EMITW(0x85604000 | MXM(RYG(XD), REG(MS), RYG(XT)))
+
+#undef  scaox_st
+#define scaox_st(XS, MD, XT) /* indexed store, T holds 32-bit indices */    \
+        EMITW(0xE560C000 | MXM(REG(XS), REG(MD), REG(XT)))                  \
+        EMITW(0xE560C000 | MXM(RYG(XS), REG(MD), RYG(XT)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -1040,6 +1141,13 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhos_rr
+#define adhos_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        EMITW(0x65800000 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        EMITW(0x65802000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05A08000 | MXM(RYG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05A08000 | MXM(REG(XD), REG(XD), 0x00))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subos_rr(XG, XS)                                                    \
@@ -1081,6 +1189,71 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* SVE has no fmulv, mlh multiplies halves of S into TmmM,
+         * then TmmM by itself rotated (ext) by half of the remaining
+         * elements with D as temp, leaving equal results in all
+         * elements of both halves of D */
+
+#define mlhos_rx(XD, IT) /* not portable, do not use outside */             \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x05200000 | MXM(REG(XD), TmmM,    0x00) |                    \
+                         ((IT)&0x3E)<<15 | ((IT)&0x01)<<12)                 \
+        EMITW(0x65800800 | MXM(TmmM,    TmmM,    REG(XD)))
+
+#define mlhos_r1(XD) /* not portable, do not use outside */                 \
+        mlhos_rx(W(XD), 1)
+
+#define mlhos_r2(XD) /* not portable, do not use outside */                 \
+        mlhos_rx(W(XD), 2)                                                  \
+        mlhos_r1(W(XD))
+
+#define mlhos_r4(XD) /* not portable, do not use outside */                 \
+        mlhos_rx(W(XD), 4)                                                  \
+        mlhos_r2(W(XD))
+
+#define mlhos_r8(XD) /* not portable, do not use outside */                 \
+        mlhos_rx(W(XD), 8)                                                  \
+        mlhos_r4(W(XD))
+
+#define mlhos_r16(XD) /* not portable, do not use outside */                \
+        mlhos_rx(W(XD), 16)                                                 \
+        mlhos_r8(W(XD))
+
+#undef  mlhos_rr
+#if   (RT_SIMD == 2048)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65800800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhos_r16(W(XD))                                                    \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#elif (RT_SIMD == 1024)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65800800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhos_r8(W(XD))                                                     \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#elif (RT_SIMD == 512)
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65800800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhos_r4(W(XD))                                                     \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#else  /* RT_SIMD == 256 */
+
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65800800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhos_r2(W(XD))                                                     \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#endif /* RT_SIMD: 2048, 1024, 512, 256 */
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divos_rr(XG, XS)                                                    \
@@ -1166,7 +1339,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaos_rr(XG, XS, XT)                                                \
         EMITW(0x65A00000 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -1185,7 +1358,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsos_rr(XG, XS, XT)                                                \
         EMITW(0x65A02000 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -1226,6 +1399,14 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhos_rr
+#define mnhos_rr(XD, XS) /* horizontal reductive min */                     \
+        EMITW(0x04603000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65878000 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x65872000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05A08000 | MXM(RYG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05A08000 | MXM(REG(XD), REG(XD), 0x00))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxos_rr(XG, XS)                                                    \
@@ -1250,6 +1431,14 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhos_rr
+#define mxhos_rr(XD, XS) /* horizontal reductive max */                     \
+        EMITW(0x04603000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65868000 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x65862000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05A08000 | MXM(RYG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05A08000 | MXM(REG(XD), REG(XD), 0x00))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqos_rr(XG, XS)                                                    \
@@ -2451,6 +2640,26 @@
 
 /* sregs */
 
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        EMITW(0xE5804000 | MXM(TmmQ,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5804000 | MXM(TmmM,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x00,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0xE5800000 | MXM(0x01,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        EMITW(0x85804000 | MXM(TmmQ,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85804000 | MXM(TmmM,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x00,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        EMITW(0x85800000 | MXM(0x01,    TEax,    0x00))                     \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))
+
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
@@ -154,6 +154,53 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x3C800000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), P2(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movjx_nt
+#define movjx_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0x6E004000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6C000000 | MXM(REG(XS), TPxx,    0x00) | TmmM << 10)
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfjx_ri
+#define shfjx_ri(XD, XS, IT)                                                \
+        EMITW(0x4EA01C00 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x6E080400 | MXM(REG(XD), TmmM,    0x00) |                    \
+                         ((VAL(IT))>>0&1)<<14 | 0<<20)                      \
+        EMITW(0x6E080400 | MXM(REG(XD), TmmM,    0x00) |                    \
+                         ((VAL(IT))>>1&1)<<14 | 1<<20)
+
+#undef  zipjx_rr
+#define zipjx_rr(XG, XS)                                                    \
+        EMITW(0x4EC03800 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x4EC07800 | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0x4EA01C00 | MXM(REG(XG), TmmM,    TmmM))
+
+#undef  bcxjx_ri
+#define bcxjx_ri(XD, XS, IT)                                                \
+        EMITW(0x4E080400 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&1)<<20)
+
+#undef  rotjx_ri
+#define rotjx_ri(XD, XS, IT)                                                \
+        EMITW(0x6E000000 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((VAL(IT))&1)<<14)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movjx_bc
+#define movjx_bc(XD, MS, DS)                                                \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        EMITW(0x4E080400 | MXM(REG(XD), REG(XD), 0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -333,6 +380,12 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpjs3rr
+#define mlpjs3rr(XD, XS, XT)                                                \
+        EMITW(0x4EC01800 | MXM(TmmM,    REG(XS), REG(XT)))                  \
+        EMITW(0x4EC05800 | MXM(REG(XD), REG(XS), REG(XT)))                  \
+        EMITW(0x6E60DC00 | MXM(REG(XD), REG(XD), TmmM))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -403,7 +456,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmajs_rr(XG, XS, XT)                                                \
         EMITW(0x4E60CC00 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -419,7 +472,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsjs_rr(XG, XS, XT)                                                \
         EMITW(0x4EE0CC00 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -452,6 +505,16 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpjs3rr
+#define mnpjs3rr(XD, XS, XT)                                                \
+        EMITW(0x6EE0F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mnpjs3ld
+#define mnpjs3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6EE0F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -471,6 +534,16 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpjs3rr
+#define mxpjs3rr(XD, XS, XT)                                                \
+        EMITW(0x6E60F400 | MXM(REG(XD), REG(XS), REG(XT)))
+
+#undef  mxpjs3ld
+#define mxpjs3ld(XD, XS, MT, DT)                                            \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x3CC00000 | MPM(TmmM,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        EMITW(0x6E60F400 | MXM(REG(XD), REG(XS), TmmM))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -745,6 +818,26 @@
         EMITW(0x3CC00000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
         EMITW(0x6E61D800 | MXM(REG(XD), TmmM,    0x00))
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvljs_rr
+#define cvljs_rr(XD, XS)                                                    \
+        EMITW(0x0E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cvujs_rr
+#define cvujs_rr(XD, XS)                                                    \
+        EMITW(0x4E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cvlis_rr
+#define cvlis_rr(XD, XS)                                                    \
+        EMITW(0x0E616800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cvuis_rr
+#define cvuis_rr(XG, XS)                                                    \
+        EMITW(0x4E616800 | MXM(REG(XG), REG(XS), 0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -1507,7 +1600,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmats_rr(XG, XS, XT)                                                \
         EMITW(0x1F400000 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 10)
@@ -1523,7 +1616,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsts_rr(XG, XS, XT)                                                \
         EMITW(0x1F408000 | MXM(REG(XG), REG(XS), REG(XT)) | REG(XG) << 10)
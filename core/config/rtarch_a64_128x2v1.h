@@ -157,6 +157,15 @@
         EMITW(0x3D800000 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), L2(DD)))  \
         EMITW(0x3D800000 | MPM(RYG(XS), MOD(MD), VYL(DD), B4(DD), L2(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movdx_nt
+#define movdx_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xAC000000 | MXM(REG(XS), TPxx,    0x00) | RYG(XS) << 10)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -454,7 +463,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmads_rr(XG, XS, XT)                                                \
         EMITW(0x4E60CC00 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -473,7 +482,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsds_rr(XG, XS, XT)                                                \
         EMITW(0x4EE0CC00 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -867,6 +876,32 @@
         EMITW(0x3DC00000 | MPM(TmmM,    MOD(MS), VYL(DS), B4(DS), L2(DS)))  \
         EMITW(0x6E61D800 | MXM(RYG(XD), TmmM,    0x00))
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvlds_rr
+#define cvlds_rr(XD, XS)                                                    \
+        EMITW(0x4E617800 | MXM(RYG(XD), REG(XS), 0x00))                     \
+        EMITW(0x0E617800 | MXM(REG(XD), REG(XS), 0x00))
+
+#undef  cvuds_rr
+#define cvuds_rr(XD, XS)                                                    \
+        EMITW(0x0E617800 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x4E617800 | MXM(RYG(XD), RYG(XS), 0x00))
+
+#undef  cvlcs_rr
+#define cvlcs_rr(XD, XS)                                                    \
+        EMITW(0x0E616800 | MXM(REG(XD), REG(XS), 0x00))                     \
+        EMITW(0x4E616800 | MXM(REG(XD), RYG(XS), 0x00))                     \
+        EMITW(0x6E201C00 | MXM(RYG(XD), RYG(XD), RYG(XD)))
+
+#undef  cvucs_rr
+#define cvucs_rr(XG, XS)                                                    \
+        EMITW(0x0E616800 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x4E616800 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x4EA01C00 | MXM(RYG(XG), TmmM,    TmmM))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -236,6 +236,58 @@
         EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
         EMITW(0x65CD8000 | MTM(REG(XD), TmmM,    REG(PS)))
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65C78000 | MTM(REG(XG), REG(XS), REG(PS)))
+
+#define minqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x65C78000 | MTM(REG(XG), TmmM,    REG(PS)))
+
+#define minqsPrr(XG, PS, XS)                                                \
+        minqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minqsPld(XG, PS, MS, DS)                                            \
+        minqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minqs4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C78000 | MTM(REG(XD), REG(XT), REG(PS)))
+
+#define minqs4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C78000 | MTM(REG(XD), TmmM,    REG(PS)))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65C68000 | MTM(REG(XG), REG(XS), REG(PS)))
+
+#define maxqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x65C68000 | MTM(REG(XG), TmmM,    REG(PS)))
+
+#define maxqsPrr(XG, PS, XS)                                                \
+        maxqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxqsPld(XG, PS, MS, DS)                                            \
+        maxqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxqs4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C68000 | MTM(REG(XD), REG(XT), REG(PS)))
+
+#define maxqs4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), F1(DT)))  \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C68000 | MTM(REG(XD), TmmM,    REG(PS)))
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqqsPrr(PD, XS, XT)                                                \
@@ -356,10 +408,15 @@
 /* mxj (jump to lb) if (S satisfies mask condition) - NONE, FULL */
 
 #define mxjqx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0x25E08000 | MXM(Teax,    REG(PS), 0x00))                     \
+        EMITW(0x25E08000 | MXM(TEax,    REG(PS), 0x00))                     \
         xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##64_SVE*RT_SIMD_WIDTH64))     \
         jezxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlqx_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        EMITW(0x25E00400 | MXM(REG(PD), TZxx,    REG(RS)))
+
 /* mov (D = S), predicated */
 
 #define mxvqx_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -676,6 +733,15 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A1(DD), EMPTY2)   \
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), F1(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movqx_nt
+#define movqx_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE590E000 | MXM(REG(XS), TPxx,    0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -696,6 +762,92 @@
         EMITW(0x05E0C400 | MXM(TmmM,    REG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VAL(DG), B3(DG), F1(DG)))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfqx_ri
+#define shfqx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x04E14000 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x05820000 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x25F8C000 | MXM(REG(XD), 0x00,    0x00) |                    \
+                         ((VAL(IT))&0xFF)<<5)                               \
+        EMITW(0x04D18000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05820000 | MXM(REG(XD), 0x00,    0x00))                     \
+        EMITW(0x04E14000 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x0583FFC0 | MXM(TmmM,    0x00,    0x00))                     \
+        EMITW(0x04E00000 | MXM(REG(XD), REG(XD), TmmM))                     \
+        tblqx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  zipqx_rr
+#define zipqx_rr(XG, XS)                                                    \
+        EMITW(0x05E07000 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x05E07400 | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0x04603000 | MXM(REG(XG), TmmM,    TmmM))
+
+#if   (RT_SIMD <= 512)
+
+#undef  bcxqx_ri
+#define bcxqx_ri(XD, XS, IT)                                                \
+        EMITW(0x05282000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&(RT_SIMD/64-1)&0x06)<<21 |              \
+                         ((VAL(IT))&0x01)<<20)
+
+#else  /* RT_SIMD: 2K8, 1K4 */
+
+#undef  bcxqx_ri
+#define bcxqx_ri(XD, XS, IT)                                                \
+        EMITW(0x25F8C000 | MXM(TmmM,    0x00,    0x00) |                    \
+                         ((VAL(IT))&(RT_SIMD/64-1))<<5)                     \
+        EMITW(0x05E03000 | MXM(REG(XD), REG(XS), TmmM))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+#undef  rotqx_ri
+#define rotqx_ri(XD, XS, IT)                                                \
+        movqx_rr(W(XD), W(XS))                                              \
+        EMITW(0x05200000 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&(RT_SIMD/64-1))<<16)
+
+#define tblqx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), F1(DS)))  \
+        EMITW(0x05E03000 | MXM(REG(XG), TmmM,    REG(XG)))
+
+        /* cmp, exp are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* cmp ([D] = active elements of S packed), exp is taken from rtbase.h
+ * compact packs active elements to the bottom of TmmM, then TmmM is stored
+ * under a whilelo predicate built from the cntp count, which writes
+ * exactly mkc elements at D (memory past the count is left intact) */
+
+#undef  cmpqx_st
+#define cmpqx_st(XS, MD, DD)                                                \
+        EMITW(0x24C0A000 | MXM(0x01,    Tmm0,    TmmQ))                     \
+        EMITW(0x05E18400 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(0x25E08000 | MXM(TDxx,    0x01,    0x00))                     \
+        EMITW(0x25E00C00 | MXM(0x01,    TZxx,    TDxx))                     \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD)>>3, C3(DD), EMPTY2)\
+        EMITW(0xE5E04000 | MXM(TmmM,    MOD(MD), TDxx) | 0x01 << 10)
+
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* gat (D = [S + T*8]), sca ([D + T*8] = S), MS/MD take plain M*** modes
+ * use all-ones p0 predicate, element indices are taken as 64-bit */
+
+#undef  gatqx_ld
+#define gatqx_ld(XD, MS, XT) /* indexed load, T holds 64-bit indices */     \
+        EMITW(0xC5E0C000 | MXM(REG(XD), REG(MS), REG(XT)))
+
+#undef  scaqx_st
+#define scaqx_st(XS, MD, XT) /* indexed store, T holds 64-bit indices */    \
+        EMITW(0xE5A0A000 | MXM(REG(XS), REG(MD), REG(XT)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -855,6 +1007,62 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* SVE has no fmulv, mlh multiplies S by itself rotated (ext)
+         * by half of the remaining elements with TmmM as temp,
+         * log-step reductions leave equal results in all elements */
+
+#define mlhqs_rx(XD, RS, IT) /* not portable, do not use outside */         \
+        EMITW(0x04603000 | MXM(TmmM,    RS,      RS))                       \
+        EMITW(0x05200000 | MXM(TmmM,    RS,      0x00) | (IT)<<16)          \
+        EMITW(0x65C00800 | MXM(REG(XD), RS,      TmmM))
+
+#define mlhqs_r1(XD, RS) /* not portable, do not use outside */             \
+        mlhqs_rx(W(XD), RS, 1)
+
+#define mlhqs_r2(XD, RS) /* not portable, do not use outside */             \
+        mlhqs_rx(W(XD), RS, 2)                                              \
+        mlhqs_r1(W(XD), REG(XD))
+
+#define mlhqs_r4(XD, RS) /* not portable, do not use outside */             \
+        mlhqs_rx(W(XD), RS, 4)                                              \
+        mlhqs_r2(W(XD), REG(XD))
+
+#define mlhqs_r8(XD, RS) /* not portable, do not use outside */             \
+        mlhqs_rx(W(XD), RS, 8)                                              \
+        mlhqs_r4(W(XD), REG(XD))
+
+#define mlhqs_r16(XD, RS) /* not portable, do not use outside */            \
+        mlhqs_rx(W(XD), RS, 16)                                             \
+        mlhqs_r8(W(XD), REG(XD))
+
+#undef  mlhqs_rr
+#if   (RT_SIMD == 2048)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhqs_r16(W(XD), REG(XS))
+
+#elif (RT_SIMD == 1024)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhqs_r8(W(XD), REG(XS))
+
+#elif (RT_SIMD == 512)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhqs_r4(W(XD), REG(XS))
+
+#elif (RT_SIMD == 256)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhqs_r2(W(XD), REG(XS))
+
+#else  /* RT_SIMD == 128 */
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        mlhqs_r1(W(XD), REG(XS))
+
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divqs_rr(XG, XS)                                                    \
@@ -927,7 +1135,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaqs_rr(XG, XS, XT)                                                \
         EMITW(0x65E00000 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -943,7 +1151,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsqs_rr(XG, XS, XT)                                                \
         EMITW(0x65E02000 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1141,6 +1349,13 @@
         addwxZri(Reax, IB(RT_SIMD_MASK_##mask##64_SVE))                     \
         jezxx_lb(lb)
 
+/* mkc (D = number of active elements in mask S), cntp on predicate */
+
+#undef  mkcqx_rx
+#define mkcqx_rx(XS, RD)        /* destroys Reax */                         \
+        EMITW(0x24C0A000 | MXM(0x01,    REG(XS), TmmQ))                     \
+        EMITW(0x25E08000 | MXM(REG(RD), 0x01,    0x00))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
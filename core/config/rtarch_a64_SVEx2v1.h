@@ -268,6 +268,74 @@
         EMITW(0x04D02000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
         EMITW(0x65CD8000 | MTM(RYG(XD), TmmM,    REP(PS)))
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65C78000 | MTM(REG(XG), REG(XS), REG(PS)))                  \
+        EMITW(0x65C78000 | MTM(RYG(XG), RYG(XS), REP(PS)))
+
+#define minqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65C78000 | MTM(REG(XG), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65C78000 | MTM(RYG(XG), TmmM,    REP(PS)))
+
+#define minqsPrr(XG, PS, XS)                                                \
+        minqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minqsPld(XG, PS, MS, DS)                                            \
+        minqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minqs4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C78000 | MTM(REG(XD), REG(XT), REG(PS)))                  \
+        EMITW(0x04D02000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C78000 | MTM(RYG(XD), RYG(XT), REP(PS)))
+
+#define minqs4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C78000 | MTM(REG(XD), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04D02000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C78000 | MTM(RYG(XD), TmmM,    REP(PS)))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EMITW(0x65C68000 | MTM(REG(XG), REG(XS), REG(PS)))                  \
+        EMITW(0x65C68000 | MTM(RYG(XG), RYG(XS), REP(PS)))
+
+#define maxqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VAL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65C68000 | MTM(REG(XG), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MS), VZL(DS), B3(DS), K1(DS)))  \
+        EMITW(0x65C68000 | MTM(RYG(XG), TmmM,    REP(PS)))
+
+#define maxqsPrr(XG, PS, XS)                                                \
+        maxqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxqsPld(XG, PS, MS, DS)                                            \
+        maxqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxqs4rr(XD, PS, XS, XT)                                            \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C68000 | MTM(REG(XD), REG(XT), REG(PS)))                  \
+        EMITW(0x04D02000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C68000 | MTM(RYG(XD), RYG(XT), REP(PS)))
+
+#define maxqs4ld(XD, PS, XS, MT, DT)                                        \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VAL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04D02000 | MTM(REG(XD), REG(XS), REG(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C68000 | MTM(REG(XD), TmmM,    REG(PS)))                  \
+        EMITW(0x85804000 | MPM(TmmM,    MOD(MT), VZL(DT), B3(DT), K1(DT)))  \
+        EMITW(0x04D02000 | MTM(RYG(XD), RYG(XS), REP(PS)) | MOD(PS) << 16)  \
+        EMITW(0x65C68000 | MTM(RYG(XD), TmmM,    REP(PS)))
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqqsPrr(PD, XS, XT)                                                \
@@ -427,11 +495,18 @@
 /* mxj (jump to lb) if (S satisfies mask condition) - NONE, FULL */
 
 #define mxjqx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
-        EMITW(0x25E08000 | MXM(Teax,    REG(PS), 0x00))                     \
-        EMITW(0x25EC8800 | MXM(Teax,    REP(PS), 0x00))                     \
+        EMITW(0x25E08000 | MXM(TEax,    REG(PS), 0x00))                     \
+        EMITW(0x25EC8800 | MXM(TEax,    REP(PS), 0x00))                     \
         xorwxZri(Reax, IM(RT_SIMD_MASK_##mask##64_SVE*RT_SIMD_WIDTH64))     \
         jezxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlqx_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        EMITW(0x25E00400 | MXM(REG(PD), TZxx,    REG(RS)))                  \
+        EMITW(0x51000000 | MXM(TMxx,    REG(RS), 0x00) | (RT_SIMD/128)<<10) \
+        EMITW(0x25E00400 | MXM(REP(PD), TZxx,    TMxx))
+
 /* mov (D = S), predicated */
 
 #define mxvqx_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -847,6 +922,16 @@
         EMITW(0xE5804000 | MPM(REG(XS), MOD(MD), VAL(DD), B3(DD), K1(DD)))  \
         EMITW(0xE5804000 | MPM(RYG(XS), MOD(MD), VZL(DD), B3(DD), K1(DD)))
 
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movqx_nt
+#define movqx_nt(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C3(DD), EMPTY2)   \
+        EMITW(0x0B000000 | MRM(TPxx,    MOD(MD), TDxx) | ADR)               \
+        EMITW(0xE590E000 | MXM(REG(XS), TPxx,    0x00))                     \
+        EMITW(0xE590E000 | MXM(RYG(XS), TPxx,    0x01))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -876,6 +961,22 @@
         EMITW(0x05E0C400 | MXM(TmmM,    RYG(XS), TmmM))                     \
         EMITW(0xE5804000 | MPM(TmmM,    MOD(MG), VZL(DG), B3(DG), K1(DG)))
 
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* gat (D = [S + T*8]), sca ([D + T*8] = S), MS/MD take plain M*** modes
+ * use all-ones p0 predicate, element indices are taken as 64-bit */
+
+#undef  gatqx_ld
+#define gatqx_ld(XD, MS, XT) /* indexed load, T holds 64-bit indices */     \
+        EMITW(0xC5E0C000 | MXM(REG(XD), REG(MS), REG(XT)))                  \
+        EMITW(0xC5E0C000 | MXM(RYG(XD), REG(MS), RYG(XT)))
+
+#undef  scaqx_st
+#define scaqx_st(XS, MD, XT) /* indexed store, T holds 64-bit indices */    \
+        EMITW(0xE5A0A000 | MXM(REG(XS), REG(MD), REG(XT)))                  \
+        EMITW(0xE5A0A000 | MXM(RYG(XS), REG(MD), RYG(XT)))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -1012,6 +1113,13 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  adhqs_rr
+#define adhqs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        EMITW(0x65C00000 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        EMITW(0x65C02000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05E08000 | MXM(RYG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05E08000 | MXM(REG(XD), REG(XD), 0x00))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subqs_rr(XG, XS)                                                    \
@@ -1053,6 +1161,66 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* SVE has no fmulv, mlh multiplies halves of S into TmmM,
+         * then TmmM by itself rotated (ext) by half of the remaining
+         * elements with D as temp, leaving equal results in all
+         * elements of both halves of D */
+
+#define mlhqs_rx(XD, IT) /* not portable, do not use outside */             \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x05200000 | MXM(REG(XD), TmmM,    0x00) | (IT)<<16)          \
+        EMITW(0x65C00800 | MXM(TmmM,    TmmM,    REG(XD)))
+
+#define mlhqs_r1(XD) /* not portable, do not use outside */                 \
+        mlhqs_rx(W(XD), 1)
+
+#define mlhqs_r2(XD) /* not portable, do not use outside */                 \
+        mlhqs_rx(W(XD), 2)                                                  \
+        mlhqs_r1(W(XD))
+
+#define mlhqs_r4(XD) /* not portable, do not use outside */                 \
+        mlhqs_rx(W(XD), 4)                                                  \
+        mlhqs_r2(W(XD))
+
+#define mlhqs_r8(XD) /* not portable, do not use outside */                 \
+        mlhqs_rx(W(XD), 8)                                                  \
+        mlhqs_r4(W(XD))
+
+#undef  mlhqs_rr
+#if   (RT_SIMD == 2048)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65C00800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhqs_r8(W(XD))                                                     \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#elif (RT_SIMD == 1024)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65C00800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhqs_r4(W(XD))                                                     \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#elif (RT_SIMD == 512)
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65C00800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhqs_r2(W(XD))                                                     \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#else  /* RT_SIMD == 256 */
+
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x65C00800 | MXM(TmmM,    REG(XS), RYG(XS)))                  \
+        mlhqs_r1(W(XD))                                                     \
+        EMITW(0x04603000 | MXM(REG(XD), TmmM,    TmmM))                     \
+        EMITW(0x04603000 | MXM(RYG(XD), TmmM,    TmmM))
+
+#endif /* RT_SIMD: 2048, 1024, 512, 256 */
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divqs_rr(XG, XS)                                                    \
@@ -1138,7 +1306,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaqs_rr(XG, XS, XT)                                                \
         EMITW(0x65E00000 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -1157,7 +1325,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsqs_rr(XG, XS, XT)                                                \
         EMITW(0x65E02000 | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -1198,6 +1366,14 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhqs_rr
+#define mnhqs_rr(XD, XS) /* horizontal reductive min */                     \
+        EMITW(0x04603000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65C78000 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x65C72000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05E08000 | MXM(RYG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05E08000 | MXM(REG(XD), REG(XD), 0x00))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxqs_rr(XG, XS)                                                    \
@@ -1222,6 +1398,14 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhqs_rr
+#define mxhqs_rr(XD, XS) /* horizontal reductive max */                     \
+        EMITW(0x04603000 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x65C68000 | MXM(TmmM,    RYG(XS), 0x00))                     \
+        EMITW(0x65C62000 | MXM(REG(XD), TmmM,    0x00))                     \
+        EMITW(0x05E08000 | MXM(RYG(XD), REG(XD), 0x00))                     \
+        EMITW(0x05E08000 | MXM(REG(XD), REG(XD), 0x00))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqqs_rr(XG, XS)                                                    \
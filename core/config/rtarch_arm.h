@@ -1805,6 +1805,26 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0xE0800000 | MRM(REG(RD), MOD(MS), TDxx))
 
+/* prf (prefetch cache line at adr S into cache level given by hint)
+ * set-flags: no
+ * hint: L1 - all levels, L2 - outer levels, NT - non-temporal (streaming)
+ * never faults, treated as a no-op where the hint is not supported */
+
+#define RT_BASE_HINT_L1     0x00    /* pld, no cache level control */
+#define RT_BASE_HINT_L2     0x00    /* pld, no cache level control */
+#define RT_BASE_HINT_NT     0x00    /* pld, no cache level control */
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xF5D0F000 | MDM(RT_BASE_HINT_##hint,                         \
+                               MOD(MS), VAL(DS), B3(DS), P1(DS)))
+
+/* fence (orders preceding non-temporal stores before subsequent stores)
+ * set-flags: no */
+
+#define fence_xx()                                                          \
+        EMITW(0xF57FF05A)                     /* dmb ishst */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -243,6 +243,66 @@
 #define movjx_st(XS, MD, DD)                                                \
         movix_st(W(XS), W(MD), W(DD))
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0xF4200A8F | MXM(REG(XD), TPxx,    0x00))
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0xE0800000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0xF4000A8F | MXM(REG(XS), TPxx,    0x00))
+
+#undef  muvjx_ld
+#define muvjx_ld(XD, MS, DS)                                                \
+        muvix_ld(W(XD), W(MS), W(DS))
+
+#undef  muvjx_st
+#define muvjx_st(XS, MD, DD)                                                \
+        muvix_st(W(XS), W(MD), W(DD))
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfix_ri
+#define shfix_ri(XD, XS, IT)                                                \
+        EMITW(0xF2200150 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        shmix_rx(W(XD), (VAL(IT))>>0&3, 0)                                  \
+        shmix_rx(W(XD), (VAL(IT))>>2&3, 1)                                  \
+        shmix_rx(W(XD), (VAL(IT))>>4&3, 2)                                  \
+        shmix_rx(W(XD), (VAL(IT))>>6&3, 3)
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)                                                    \
+        EMITW(0xF3BA01C0 | MXM(REG(XG), 0x00,    REG(XS)))
+
+#undef  uzpix_rr
+#define uzpix_rr(XG, XS)                                                    \
+        EMITW(0xF3BA0140 | MXM(REG(XG), 0x00,    REG(XS)))
+
+#undef  bcxix_ri
+#define bcxix_ri(XD, XS, IT)                                                \
+        EMITW(0xF3B40C40 | MXM(REG(XD), 0x00,    REG(XS)) |                 \
+                         ((VAL(IT))&2)>>1 | ((VAL(IT))&1)<<19)
+
+#undef  rotix_ri
+#define rotix_ri(XD, XS, IT)                                                \
+        EMITW(0xF2B00040 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((VAL(IT))&3)<<10)
+
+#define shmix_rx(XD, is, id) /* not portable, do not use outside */         \
+        EMITW(0xEE100B10 | MXM(TIxx,    TmmM+((is)>>1), 0x00) |             \
+                         ((is)&1)<<21)                                      \
+        EMITW(0xEE000B10 | MXM(TIxx,    REG(XD)+((id)>>1), 0x00) |          \
+                         ((id)&1)<<21)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -799,7 +859,7 @@
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xF2000D50 | MXM(REG(XG), REG(XS), TmmM))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
@@ -873,7 +933,7 @@
         EMITW(0xF4200AAF | MXM(TmmM,    TPxx,    0x00))                     \
         EMITW(0xF2200D50 | MXM(REG(XG), REG(XS), TmmM))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
@@ -938,7 +998,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         EMITW(0xF2000C50 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -955,7 +1015,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         EMITW(0xF2200C50 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -3429,7 +3489,7 @@
         EMITW(0xF4A0083F | MXM(REH(XG), TPxx,    0x00))                     \
         EMITW(0xEE000A00 | MXM(REG(XG), REG(XS), REH(XG)))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
@@ -3467,7 +3527,7 @@
         EMITW(0xF4A0083F | MXM(REH(XG), TPxx,    0x00))                     \
         EMITW(0xEE000A40 | MXM(REG(XG), REG(XS), REH(XG)))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0xEEB70AC0 | MXM(TmmC+0,  0x00,    REG(XS)+0))                \
@@ -3496,7 +3556,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0xEEA00A00 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -3513,7 +3573,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0xEEA00A40 | MXM(REG(XG), REG(XS), REG(XT)))
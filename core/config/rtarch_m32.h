@@ -1794,31 +1794,31 @@
 
 #define arjwx_rx(RG, op, cc, lb)                                            \
         AR1(W(RG), op, w, _rx)                                              \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjwx_mx(MG, DG, op, cc, lb)                                        \
         AR2(W(MG), W(DG), op, w, Zmx)                                       \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define arjwx_ri(RG, IS, op, cc, lb)                                        \
         AR2(W(RG), W(IS), op, w, _ri)                                       \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjwx_mi(MG, DG, IS, op, cc, lb)                                    \
         AR3(W(MG), W(DG), W(IS), op, w, Zmi)                                \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define arjwx_rr(RG, RS, op, cc, lb)                                        \
         AR2(W(RG), W(RS), op, w, _rr)                                       \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjwx_ld(RG, MS, DS, op, cc, lb)                                    \
         AR3(W(RG), W(MS), W(DS), op, w, _ld)                                \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjwx_st(RS, MG, DG, op, cc, lb)                                    \
         AR3(W(RS), W(MG), W(DG), op, w, Zst)                                \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define arjwx_mr(MG, DG, RS, op, cc, lb)                                    \
         arjwx_st(W(RS), W(MG), W(DG), op, cc, lb)
@@ -1840,12 +1840,12 @@
 #define GE_n    J9
 
 #define cmjwx_rz(RS, cc, lb)                                                \
-        CMZ(cc, MOD(RS), lb)
+        CMZ(cc, MOD(RS), REG(RS), lb)
 
 #define cmjwx_mz(MS, DS, cc, lb)                                            \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define cmjwx_ri(RS, IT, cc, lb)                                            \
         CMI(cc, MOD(RS), REG(RS), W(IT), lb)
@@ -1856,57 +1856,57 @@
         CMI(cc, $t8,     TMxx,    W(IT), lb)
 
 #define cmjwx_rr(RS, RT, cc, lb)                                            \
-        CMR(cc, MOD(RS), MOD(RT), lb)
+        CMR(cc, MOD(RS), REG(RS), MOD(RT), REG(RT), lb)
 
 #define cmjwx_rm(RS, MT, DT, cc, lb)                                        \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0x8C000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjhn_rm(RS, MT, DT, cc, lb)   /* cmj 32/16-bit with sign-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0x84000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjhz_rm(RS, MT, DT, cc, lb)   /* cmj 32/16-bit with zero-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0x94000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjbn_rm(RS, MT, DT, cc, lb)   /* cmj 32/8-bit  with sign-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0x80000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjbz_rm(RS, MT, DT, cc, lb)   /* cmj 32/8-bit  with zero-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0x90000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjwx_mr(MS, DS, RT, cc, lb)                                        \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjhn_mr(MS, DS, RT, cc, lb)   /* cmj 16/32-bit with sign-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x84000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjhz_mr(MS, DS, RT, cc, lb)   /* cmj 16/32-bit with zero-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x94000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjbn_mr(MS, DS, RT, cc, lb)   /* cmj  8/32-bit with sign-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x80000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjbz_mr(MS, DS, RT, cc, lb)   /* cmj  8/32-bit with zero-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x90000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 /* cmp (flags = S ? T)
  * set-flags: yes */
@@ -1991,6 +1991,37 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x00000021 | MRM(REG(RD), MOD(MS), TDxx) | ADR)
 
+/* prf (prefetch cache line at adr S into cache level given by hint)
+ * set-flags: no
+ * hint: L1 - all levels, L2 - outer levels, NT - non-temporal (streaming)
+ * never faults, treated as a no-op where the hint is not supported */
+
+#define RT_BASE_HINT_L1     0x00    /* load */
+#define RT_BASE_HINT_L2     0x00    /* load, no cache level control */
+#define RT_BASE_HINT_NT     0x04    /* load_streamed */
+
+#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
+        EMITW(0xCC000000 | MDM(RT_BASE_HINT_##hint,                         \
+                               MOD(MS), VAL(DS), B3(DS), P1(DS)))
+
+#else /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+#define prfxx_ld(MS, DS, hint)   /* r6 pref has 9-bit disp only */          \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x00000021 | MRM(TPxx,    MOD(MS), TDxx) | ADR)               \
+        EMITW(0x7C000035 | MRM(0x00,    TPxx,    RT_BASE_HINT_##hint))
+
+#endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
+
+/* fence (orders preceding non-temporal stores before subsequent stores)
+ * set-flags: no */
+
+#define fence_xx()                                                          \
+        EMITW(0x0000000F)                     /* sync */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -2031,6 +2062,8 @@
 
 #endif /* defined (RT_M32, RT_M64) */
 
+#if RT_CODE_GEN == 0
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
@@ -2081,6 +2114,86 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000)                               /* b    lb */       \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TRxx)) /* beq */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TRxx)) /* bne */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TLxx,    TRxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TRxx,    TLxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TRxx,    TLxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TLxx,    TRxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TLxx,    TRxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TRxx,    TLxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TRxx,    TLxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TLxx,    TRxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define LBL(lb)                                          /* code label */   \
+        EMITL(lb)
+
+#endif /* RT_CODE_GEN */
+
 #else /* RT_BASE_COMPAT_REV >= 6 : r6 */
 
 /* jmp (if unconditional jump S/lb, else if cc flags then jump lb)
@@ -2112,6 +2225,8 @@
 
 #endif /* defined (RT_M32, RT_M64) */
 
+#if RT_CODE_GEN == 0
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
@@ -2154,6 +2269,87 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#else /* RT_CODE_GEN */
+
+/* r6 keeps branches with delay slots, used instead of compact ones */
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000)                               /* b    lb */       \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TRxx)) /* beq */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TRxx)) /* bne */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TLxx,    TRxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TRxx,    TLxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TRxx,    TLxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002B | MRM(TLxx,    TLxx,    TRxx)) /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TLxx,    TRxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TRxx,    TLxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TRxx,    TLxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x0000002A | MRM(TLxx,    TLxx,    TRxx)) /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define LBL(lb)                                          /* code label */   \
+        EMITL(lb)
+
+#endif /* RT_CODE_GEN */
+
 #endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
 
 /************************* register-size instructions *************************/
@@ -2256,42 +2452,235 @@
 #define AR3(P1, P2, P3, op, sz, sg)                                         \
         op(sz,sg)(W(P1), W(P2), W(P3))
 
-#if (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
+#if   RT_CODE_GEN != 0 /* dynamic mode uses branches with delay slots */
+
+/* internal definitions for combined-compare-jump (cmj) */
+
+#define ZJ0(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    p1,      TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ1(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    p1,      TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ2(r1, p1, lb) /* "never" branch as unsigned is always >= 0 */     \
+        EMPTY
+
+#define ZJ3(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    p1,      TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ4(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    p1,      TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ5(r1, p1, lb) /* "always" branch as unsigned is never < 0 */      \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000)                               /* b    lb */       \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ6(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x04000000 | MRM(0x00,    p1,      0x00)) /* bltz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ7(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x18000000 | MRM(0x00,    p1,      0x00)) /* blez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ8(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x1C000000 | MRM(0x00,    p1,      0x00)) /* bgtz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define ZJ9(r1, p1, lb)                                                     \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x04010000 | MRM(0x00,    p1,      0x00)) /* bgez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define CMZ(cc, r1, p1, lb)                                                 \
+        Z##cc(r1, p1, lb)
+
+
+#define IJ0(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    p1,      TRxx)) /* beq */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ1(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    p1,      TRxx)) /* bne */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ2(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x0000002B))    \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ3(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x0000002B | MRM(TLxx,    TRxx,    p1))   /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ4(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x0000002B | MRM(TLxx,    TRxx,    p1))   /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ5(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x0000002B))    \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ6(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
+        (M(TP1(IS) == 0) & 0x28000000) | (M(TP1(IS) != 0) & 0x0000002A))    \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ7(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x0000002A | MRM(TLxx,    TRxx,    p1))   /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ8(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x0000002A | MRM(TLxx,    TRxx,    p1))   /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define IJ9(r1, p1, IS, lb)                                                 \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(TLxx,    p1,      VAL(IS), T1(IS), M1(IS)) | \
+        (M(TP1(IS) == 0) & 0x28000000) | (M(TP1(IS) != 0) & 0x0000002A))    \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define CMI(cc, r1, p1, IS, lb)                                             \
+        I##cc(r1, p1, W(IS), lb)
+
+
+#define RJ0(r1, p1, r2, p2, lb)                                             \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    p1,      p2))   /* beq */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ1(r1, p1, r2, p2, lb)                                             \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    p1,      p2))   /* bne */           \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ2(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002B | MRM(TLxx,    p1,      p2))   /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ3(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002B | MRM(TLxx,    p2,      p1))   /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ4(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002B | MRM(TLxx,    p2,      p1))   /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ5(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002B | MRM(TLxx,    p1,      p2))   /* sltu */          \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ6(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002A | MRM(TLxx,    p1,      p2))   /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ7(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002A | MRM(TLxx,    p2,      p1))   /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ8(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002A | MRM(TLxx,    p2,      p1))   /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x14000000 | MRM(0x00,    TLxx,    TZxx)) /* bnez */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define RJ9(r1, p1, r2, p2, lb)                                             \
+        EMITW(0x0000002A | MRM(TLxx,    p1,      p2))   /* slt */           \
+        EMITR(lb, RT_CODE_OFF16)                                            \
+        EMITW(0x10000000 | MRM(0x00,    TLxx,    TZxx)) /* beqz */          \
+        EMITW(0x00000000)                               /* branch delay */
+
+#define CMR(cc, r1, p1, r2, p2, lb)                                         \
+        R##cc(r1, p1, r2, p2, lb)
+
+#elif (RT_BASE_COMPAT_REV < 6) /* pre-r6 */
 
 /* internal definitions for combined-compare-jump (cmj) */
 
-#define ZJ0(r1, lb)                                                         \
+#define ZJ0(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP3(beq,  r1, $zero, lb) ASM_END
 
-#define ZJ1(r1, lb)                                                         \
+#define ZJ1(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP3(bne,  r1, $zero, lb) ASM_END
 
-#define ZJ2(r1, lb) /* "never" branch as unsigned is always >= 0 */         \
+#define ZJ2(r1, p1, lb) /* "never" branch as unsigned is always >= 0 */     \
         EMPTY
 
-#define ZJ3(r1, lb)                                                         \
+#define ZJ3(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP3(beq,  r1, $zero, lb) ASM_END
 
-#define ZJ4(r1, lb)                                                         \
+#define ZJ4(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP3(bne,  r1, $zero, lb) ASM_END
 
-#define ZJ5(r1, lb) /* "always" branch as unsigned is never < 0 */          \
+#define ZJ5(r1, p1, lb) /* "always" branch as unsigned is never < 0 */      \
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
-#define ZJ6(r1, lb)                                                         \
+#define ZJ6(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bltz, r1, lb) ASM_END
 
-#define ZJ7(r1, lb)                                                         \
+#define ZJ7(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(blez, r1, lb) ASM_END
 
-#define ZJ8(r1, lb)                                                         \
+#define ZJ8(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bgtz, r1, lb) ASM_END
 
-#define ZJ9(r1, lb)                                                         \
+#define ZJ9(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bgez, r1, lb) ASM_END
 
-#define CMZ(cc, r1, lb)                                                     \
-        Z##cc(r1, lb)
+#define CMZ(cc, r1, p1, lb)                                                 \
+        Z##cc(r1, p1, lb)
 
 
 #define IJ0(r1, p1, IS, lb)                                                 \
@@ -2350,161 +2739,161 @@
         I##cc(r1, p1, W(IS), lb)
 
 
-#define RJ0(r1, r2, lb)                                                     \
+#define RJ0(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(beq,  r1,  r2, lb) ASM_END
 
-#define RJ1(r1, r2, lb)                                                     \
+#define RJ1(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bne,  r1,  r2, lb) ASM_END
 
-#define RJ2(r1, r2, lb)                                                     \
+#define RJ2(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(sltu, $t8, r1, r2) ASM_END                          \
         ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
 
-#define RJ3(r1, r2, lb)                                                     \
+#define RJ3(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(sltu, $t8, r2, r1) ASM_END                          \
         ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
 
-#define RJ4(r1, r2, lb)                                                     \
+#define RJ4(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(sltu, $t8, r2, r1) ASM_END                          \
         ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
 
-#define RJ5(r1, r2, lb)                                                     \
+#define RJ5(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(sltu, $t8, r1, r2) ASM_END                          \
         ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
 
-#define RJ6(r1, r2, lb)                                                     \
+#define RJ6(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(slt,  $t8, r1, r2) ASM_END                          \
         ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
 
-#define RJ7(r1, r2, lb)                                                     \
+#define RJ7(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(slt,  $t8, r2, r1) ASM_END                          \
         ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
 
-#define RJ8(r1, r2, lb)                                                     \
+#define RJ8(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(slt,  $t8, r2, r1) ASM_END                          \
         ASM_BEG ASM_OP2(bnez, $t8, lb) ASM_END
 
-#define RJ9(r1, r2, lb)                                                     \
+#define RJ9(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(slt,  $t8, r1, r2) ASM_END                          \
         ASM_BEG ASM_OP2(beqz, $t8, lb) ASM_END
 
-#define CMR(cc, r1, r2, lb)                                                 \
-        R##cc(r1, r2, lb)
+#define CMR(cc, r1, p1, r2, p2, lb)                                         \
+        R##cc(r1, p1, r2, p2, lb)
 
 #else /* RT_BASE_COMPAT_REV >= 6 : r6 */
 
 /* internal definitions for combined-compare-jump (cmj) */
 
-#define ZJ0(r1, lb)                                                         \
+#define ZJ0(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(beqzc, r1, lb) ASM_END
 
-#define ZJ1(r1, lb)                                                         \
+#define ZJ1(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bnezc, r1, lb) ASM_END
 
-#define ZJ2(r1, lb) /* "never" branch as unsigned is always >= 0 */         \
+#define ZJ2(r1, p1, lb) /* "never" branch as unsigned is always >= 0 */     \
         EMPTY
 
-#define ZJ3(r1, lb)                                                         \
+#define ZJ3(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(beqzc, r1, lb) ASM_END
 
-#define ZJ4(r1, lb)                                                         \
+#define ZJ4(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bnezc, r1, lb) ASM_END
 
-#define ZJ5(r1, lb) /* "always" branch as unsigned is never < 0 */          \
+#define ZJ5(r1, p1, lb) /* "always" branch as unsigned is never < 0 */      \
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
-#define ZJ6(r1, lb)                                                         \
+#define ZJ6(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bltzc, r1, lb) ASM_END
 
-#define ZJ7(r1, lb)                                                         \
+#define ZJ7(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(blezc, r1, lb) ASM_END
 
-#define ZJ8(r1, lb)                                                         \
+#define ZJ8(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bgtzc, r1, lb) ASM_END
 
-#define ZJ9(r1, lb)                                                         \
+#define ZJ9(r1, p1, lb)                                                     \
         ASM_BEG ASM_OP2(bgezc, r1, lb) ASM_END
 
-#define CMZ(cc, r1, lb)                                                     \
-        Z##cc(r1, lb)
+#define CMZ(cc, r1, p1, lb)                                                 \
+        Z##cc(r1, p1, lb)
 
 
 #define IJ0(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ0(r1, $t9, lb)
+        RJ0(r1, p1, $t9, TRxx, lb)
 
 #define IJ1(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ1(r1, $t9, lb)
+        RJ1(r1, p1, $t9, TRxx, lb)
 
 #define IJ2(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ2(r1, $t9, lb)
+        RJ2(r1, p1, $t9, TRxx, lb)
 
 #define IJ3(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ3(r1, $t9, lb)
+        RJ3(r1, p1, $t9, TRxx, lb)
 
 #define IJ4(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ4(r1, $t9, lb)
+        RJ4(r1, p1, $t9, TRxx, lb)
 
 #define IJ5(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ5(r1, $t9, lb)
+        RJ5(r1, p1, $t9, TRxx, lb)
 
 #define IJ6(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ6(r1, $t9, lb)
+        RJ6(r1, p1, $t9, TRxx, lb)
 
 #define IJ7(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ7(r1, $t9, lb)
+        RJ7(r1, p1, $t9, TRxx, lb)
 
 #define IJ8(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ8(r1, $t9, lb)
+        RJ8(r1, p1, $t9, TRxx, lb)
 
 #define IJ9(r1, p1, IS, lb)                                                 \
         AUW(EMPTY,    VAL(IS), TRxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
-        RJ9(r1, $t9, lb)
+        RJ9(r1, p1, $t9, TRxx, lb)
 
 #define CMI(cc, r1, p1, IS, lb)                                             \
         I##cc(r1, p1, W(IS), lb)
 
 
-#define RJ0(r1, r2, lb)                                                     \
+#define RJ0(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(beqc,  r1, r2, lb) ASM_END
 
-#define RJ1(r1, r2, lb)                                                     \
+#define RJ1(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bnec,  r1, r2, lb) ASM_END
 
-#define RJ2(r1, r2, lb)                                                     \
+#define RJ2(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bltuc, r1, r2, lb) ASM_END
 
-#define RJ3(r1, r2, lb)                                                     \
+#define RJ3(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bgeuc, r2, r1, lb) ASM_END
 
-#define RJ4(r1, r2, lb)                                                     \
+#define RJ4(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bltuc, r2, r1, lb) ASM_END
 
-#define RJ5(r1, r2, lb)                                                     \
+#define RJ5(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bgeuc, r1, r2, lb) ASM_END
 
-#define RJ6(r1, r2, lb)                                                     \
+#define RJ6(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bltc,  r1, r2, lb) ASM_END
 
-#define RJ7(r1, r2, lb)                                                     \
+#define RJ7(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bgec,  r2, r1, lb) ASM_END
 
-#define RJ8(r1, r2, lb)                                                     \
+#define RJ8(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bltc,  r2, r1, lb) ASM_END
 
-#define RJ9(r1, r2, lb)                                                     \
+#define RJ9(r1, p1, r2, p2, lb)                                             \
         ASM_BEG ASM_OP3(bgec,  r1, r2, lb) ASM_END
 
-#define CMR(cc, r1, r2, lb)                                                 \
-        R##cc(r1, r2, lb)
+#define CMR(cc, r1, p1, r2, p2, lb)                                         \
+        R##cc(r1, p1, r2, p2, lb)
 
 #endif /* RT_BASE_COMPAT_REV >= 6 : r6 */
 
@@ -284,6 +284,47 @@
     SHF(EMITW(0x78000026 | MFM(TmmM,    MOD(MD), VAL(DD), B4(DD), F2(DD)))) \
     SHX(EMITW(0x78000026 | MFM(REG(XS), MOD(MD), VAL(DD), B4(DD), F2(DD))))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfix_ri
+#define shfix_ri(XD, XS, IT)                                                \
+        EMITW(0x7A000002 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&0xFF)<<16)
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)                                                    \
+        EMITW(0x7AC00014 | MXM(TmmM,    REG(XS), REG(XG)))                  \
+        EMITW(0x7A400014 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XG), TmmM,    0x00))
+
+#undef  uzpix_rr
+#define uzpix_rr(XG, XS)                                                    \
+        EMITW(0x79400014 | MXM(TmmM,    REG(XS), REG(XG)))                  \
+        EMITW(0x79C00014 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XG), TmmM,    0x00))
+
+#undef  bcxix_ri
+#define bcxix_ri(XD, XS, IT)                                                \
+        EMITW(0x78700019 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&3)<<16)
+
+#undef  rotix_ri
+#define rotix_ri(XD, XS, IT)                                                \
+        movix_rr(W(XD), W(XS))                                              \
+        EMITW(0x78000019 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&3)<<18)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movix_bc
+#define movix_bc(XD, MS, DS)                                                \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        EMITW(0x78700019 | MXM(REG(XD), REG(XD), 0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -436,6 +477,43 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (shf.w), pck (pckev.w, pckod.w) keep horizontal ops
+         * in registers with TmmM as temp, log-step reductions leave
+         * equal results in all elements, adp_ld, mlp_ld, mnp_ld, mxp_ld
+         * reduce S into TmmM first, then load T and merge with sldi.b */
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0x7AB10002 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(op         | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0x7A4E0002 | MXM(TmmM,    REG(XD), 0x00))                     \
+        EMITW(op         | MXM(REG(XD), REG(XD), TmmM))
+
+#define hrpis_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        EMITW(0x79400014 | MXM(TmmM,    REG(XT), REG(XS)))                  \
+        EMITW(0x79C00014 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(op         | MXM(REG(XD), TmmM,    REG(XD)))
+
+#define hrpis_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        EMITW(0x7AB10002 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(op         | MXM(TmmM,    REG(XS), TmmM))                     \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        EMITW(0x79400014 | MXM(TmmM,    TmmM,    REG(XD)))                  \
+        EMITW(0x79C00014 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(op         | MXM(REG(XD), TmmM,    REG(XD)))                  \
+        EMITW(0x78080019 | MXM(REG(XD), TmmM,    0x00))
+
+#undef  adpis3rr
+#define adpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0x7800001B)
+
+#undef  adpis3ld
+#define adpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0x7800001B)
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzis_rr(W(XD), W(XS), 0x7800001B)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -473,6 +551,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpis3rr
+#define mlpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0x7880001B)
+
+#undef  mlpis3ld
+#define mlpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0x7880001B)
+
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzis_rr(W(XD), W(XS), 0x7880001B)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -540,7 +630,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         EMITW(0x7900001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -557,7 +647,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         EMITW(0x7940001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -592,6 +682,18 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpis3rr
+#define mnpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0x7B00001B)
+
+#undef  mnpis3ld
+#define mnpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0x7B00001B)
+
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), 0x7B00001B)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -612,6 +714,18 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpis3rr
+#define mxpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0x7B80001B)
+
+#undef  mxpis3ld
+#define mxpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0x7B80001B)
+
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), 0x7B80001B)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1179,6 +1293,78 @@
     SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
         EMITW(0x7B400012 | MXM(REG(XD), REG(XS), TmmM))
 
+/* div, rem by immediate use 32x32->64-bit dotp_u.d products (unsigned)
+ * and fixed-point mul_q.w products (signed) instead of native div/mod,
+ * the dividend is kept in inf_SCR01 where it's needed after multiply-high */
+
+#undef  divix_ri
+#define divix_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        mhuix_rx(W(XG), IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF)))              \
+        EMITW(0x78BE0019 | MXM(TmmM,    REG(XG), 0x00))                     \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x78C0000E | MXM(REG(XG), REG(XG), TmmM))                     \
+        shrix_ri(W(XG), IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))               \
+        EMITW(0x7840000E | MXM(REG(XG), REG(XG), TmmM))                     \
+        shrix_ri(W(XG), IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#undef  divin_ri
+#define divin_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        mhnix_rx(W(XG), IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF)))              \
+        EMITW(0x78C10009 | MXM(TmmM,    TmmM,    0x00))                     \
+        EMITW(0x7840000E | MXM(REG(XG), REG(XG), TmmM))                     \
+        shrin_ri(W(XG), IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                \
+        EMITW(0x795F0009 | MXM(TmmM,    REG(XG), 0x00))                     \
+        EMITW(0x7840000E | MXM(REG(XG), REG(XG), TmmM))
+
+#undef  remix_ri
+#define remix_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        divix_ri(W(XG), W(IS))                                              \
+        rmiix_rx(W(XG), W(IS))
+
+#undef  remin_ri
+#define remin_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        divin_ri(W(XG), W(IS))                                              \
+        rmiix_rx(W(XG), W(IS))
+
+#define rmiix_rx(XG, IS) /* not portable, do not use outside */             \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x7B02001E | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x78400012 | MXM(TmmM,    REG(XG), TmmM))                     \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x78C0000E | MXM(REG(XG), REG(XG), TmmM))
+
+/* mhu (G = mulhi(G, IS)) unsigned, even products go through inf_SCR02
+ * as movix_st may use TmmM, which holds zero-extended magic number */
+
+#define mhuix_rx(XG, IS) /* not portable, do not use outside */             \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x7B02001E | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    TmmM))                     \
+        EMITW(0x78E00013 | MXM(REG(XG), REG(XG), TmmM))                     \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        EMITW(0x7B02001E | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x7B400014 | MXM(TmmM,    TmmZ,    TmmM))                     \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x79200009 | MXM(REG(XG), REG(XG), 0x00))                     \
+        EMITW(0x78E00013 | MXM(REG(XG), REG(XG), TmmM))                     \
+        mhoix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define mhoix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A2(DS), EMPTY2)   \
+        EMITW(0x78000022 | MFM(TmmM,    MOD(MS), VAL(DS), B4(DS), F2(DS)))  \
+    SHF(EMITW(0x7AB10002 | MXM(TmmM,    TmmM,    0x00)))                    \
+        EMITW(0x7BC00014 | MXM(REG(XG), REG(XG), TmmM))
+
+/* mhn (TmmM = 2 * mulhi(G, IS)) signed, mul_q.w never saturates here
+ * as the magic number can't be the most negative value */
+
+#define mhnix_rx(XG, IS) /* not portable, do not use outside */             \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G3(IS))   \
+        EMITW(0x7B02001E | MXM(TmmM,    TIxx,    0x00))                     \
+        EMITW(0x7920001C | MXM(TmmM,    REG(XG), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1658,7 +1844,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0x7900001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1674,7 +1860,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0x7940001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1692,7 +1878,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0x46000018 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1708,7 +1894,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0x46000019 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1466,31 +1466,31 @@
 
 #define arjzx_rx(RG, op, cc, lb)                                            \
         AR1(W(RG), op, z, _rx)                                              \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjzx_mx(MG, DG, op, cc, lb)                                        \
         AR2(W(MG), W(DG), op, z, Zmx)                                       \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define arjzx_ri(RG, IS, op, cc, lb)                                        \
         AR2(W(RG), W(IS), op, z, _ri)                                       \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjzx_mi(MG, DG, IS, op, cc, lb)                                    \
         AR3(W(MG), W(DG), W(IS), op, z, Zmi)                                \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define arjzx_rr(RG, RS, op, cc, lb)                                        \
         AR2(W(RG), W(RS), op, z, _rr)                                       \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjzx_ld(RG, MS, DS, op, cc, lb)                                    \
         AR3(W(RG), W(MS), W(DS), op, z, _ld)                                \
-        CMZ(cc, MOD(RG), lb)
+        CMZ(cc, MOD(RG), REG(RG), lb)
 
 #define arjzx_st(RS, MG, DG, op, cc, lb)                                    \
         AR3(W(RS), W(MG), W(DG), op, z, Zst)                                \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define arjzx_mr(MG, DG, RS, op, cc, lb)                                    \
         arjzx_st(W(RS), W(MG), W(DG), op, cc, lb)
@@ -1502,12 +1502,12 @@
       * are provided in 32-bit rtarch_***.h files. */
 
 #define cmjzx_rz(RS, cc, lb)                                                \
-        CMZ(cc, MOD(RS), lb)
+        CMZ(cc, MOD(RS), REG(RS), lb)
 
 #define cmjzx_mz(MS, DS, cc, lb)                                            \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0xDC000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMZ(cc, $t8,     lb)
+        CMZ(cc, $t8,     TMxx,    lb)
 
 #define cmjzx_ri(RS, IT, cc, lb)                                            \
         CMI(cc, MOD(RS), REG(RS), W(IT), lb)
@@ -1518,37 +1518,37 @@
         CMI(cc, $t8,     TMxx,    W(IT), lb)
 
 #define cmjzx_rr(RS, RT, cc, lb)                                            \
-        CMR(cc, MOD(RS), MOD(RT), lb)
+        CMR(cc, MOD(RS), REG(RS), MOD(RT), REG(RT), lb)
 
 #define cmjzx_rm(RS, MT, DT, cc, lb)                                        \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0xDC000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjwn_rm(RS, MT, DT, cc, lb)   /* cmj 64/32-bit with sign-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0x8C000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjwz_rm(RS, MT, DT, cc, lb)   /* cmj 64/32-bit with zero-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), A1(DT), EMPTY2)   \
         EMITW(0x9C000000 | MDM(TMxx,    MOD(MT), VAL(DT), B3(DT), P1(DT)))  \
-        CMR(cc, MOD(RS), $t8,     lb)
+        CMR(cc, MOD(RS), REG(RS), $t8,     TMxx,    lb)
 
 #define cmjzx_mr(MS, DS, RT, cc, lb)                                        \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0xDC000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjwn_mr(MS, DS, RT, cc, lb)   /* cmj 32/64-bit with sign-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x8C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjwz_mr(MS, DS, RT, cc, lb)   /* cmj 32/64-bit with zero-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), A1(DS), EMPTY2)   \
         EMITW(0x9C000000 | MDM(TMxx,    MOD(MS), VAL(DS), B3(DS), P1(DS)))  \
-        CMR(cc, $t8,     MOD(RT), lb)
+        CMR(cc, $t8,     TMxx,    MOD(RT), REG(RT), lb)
 
 /* cmp (flags = S ? T)
  * set-flags: yes */
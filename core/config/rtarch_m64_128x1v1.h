@@ -153,6 +153,41 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), A2(DD), EMPTY2)   \
         EMITW(0x78000027 | MPM(REG(XS), MOD(MD), VAL(DD), B4(DD), P2(DD)))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfjx_ri
+#define shfjx_ri(XD, XS, IT)                                                \
+        EMITW(0x7A440002 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         (((VAL(IT))&1)*0x0A)<<16 | (((VAL(IT))&2)*0x50)<<16)
+
+#undef  zipjx_rr
+#define zipjx_rr(XG, XS)                                                    \
+        EMITW(0x7AE00014 | MXM(TmmM,    REG(XS), REG(XG)))                  \
+        EMITW(0x7A600014 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x78BE0019 | MXM(REG(XG), TmmM,    0x00))
+
+#undef  bcxjx_ri
+#define bcxjx_ri(XD, XS, IT)                                                \
+        EMITW(0x78780019 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&1)<<16)
+
+#undef  rotjx_ri
+#define rotjx_ri(XD, XS, IT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        EMITW(0x78000019 | MXM(REG(XD), REG(XS), 0x00) |                    \
+                         ((VAL(IT))&1)<<19)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movjx_bc
+#define movjx_bc(XD, MS, DS)                                                \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        EMITW(0x78780019 | MXM(REG(XD), REG(XD), 0x00))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -296,6 +331,41 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (shf.w), ilv (ilvr.d, ilvl.d) keep horizontal ops
+         * in registers with TmmM as temp, reductions leave equal
+         * results in both elements, adp_ld, mlp_ld, mnp_ld, mxp_ld
+         * reduce S into TmmM first, then load T and merge with sldi.b */
+
+#define hrzjs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0x7A4E0002 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(op         | MXM(REG(XD), REG(XS), TmmM))
+
+#define hrpjs_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        EMITW(0x7AE00014 | MXM(TmmM,    REG(XT), REG(XS)))                  \
+        EMITW(0x7A600014 | MXM(REG(XD), REG(XT), REG(XS)))                  \
+        EMITW(op         | MXM(REG(XD), TmmM,    REG(XD)))
+
+#define hrpjs_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        EMITW(0x7A4E0002 | MXM(TmmM,    REG(XS), 0x00))                     \
+        EMITW(op         | MXM(TmmM,    REG(XS), TmmM))                     \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        EMITW(0x7AE00014 | MXM(TmmM,    TmmM,    REG(XD)))                  \
+        EMITW(0x7A600014 | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW(op         | MXM(REG(XD), TmmM,    REG(XD)))                  \
+        EMITW(0x78080019 | MXM(REG(XD), TmmM,    0x00))
+
+#undef  adpjs3rr
+#define adpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0x7820001B)
+
+#undef  adpjs3ld
+#define adpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0x7820001B)
+
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzjs_rr(W(XD), W(XS), 0x7820001B)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjs_rr(XG, XS)                                                    \
@@ -331,6 +401,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpjs3rr
+#define mlpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0x78A0001B)
+
+#undef  mlpjs3ld
+#define mlpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0x78A0001B)
+
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzjs_rr(W(XD), W(XS), 0x78A0001B)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -396,7 +478,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmajs_rr(XG, XS, XT)                                                \
         EMITW(0x7920001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -412,7 +494,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsjs_rr(XG, XS, XT)                                                \
         EMITW(0x7960001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -445,6 +527,18 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpjs3rr
+#define mnpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0x7B20001B)
+
+#undef  mnpjs3ld
+#define mnpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0x7B20001B)
+
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzjs_rr(W(XD), W(XS), 0x7B20001B)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -464,6 +558,18 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpjs3rr
+#define mxpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0x7BA0001B)
+
+#undef  mxpjs3ld
+#define mxpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0x7BA0001B)
+
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzjs_rr(W(XD), W(XS), 0x7BA0001B)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -1473,7 +1579,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmats_rr(XG, XS, XT)                                                \
         EMITW(0x7920001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1489,7 +1595,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsts_rr(XG, XS, XT)                                                \
         EMITW(0x7960001B | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1507,7 +1613,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmats_rr(XG, XS, XT)                                                \
         EMITW(0x46200018 | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1523,7 +1629,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsts_rr(XG, XS, XT)                                                \
         EMITW(0x46200019 | MXM(REG(XG), REG(XS), REG(XT)))
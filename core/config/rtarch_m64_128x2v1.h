@@ -434,7 +434,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmads_rr(XG, XS, XT)                                                \
         EMITW(0x7920001B | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -453,7 +453,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsds_rr(XG, XS, XT)                                                \
         EMITW(0x7960001B | MXM(REG(XG), REG(XS), REG(XT)))                  \
@@ -322,12 +322,14 @@
                     EMITW(0x60000000 | TDxx << 16 | TDxx << 21 |            \
                                                     (0xFFFF & (dp)))
 
-/* splatters for SIMD shifts and scalars */
+/* splatters for SIMD shifts, scalars and lane permutes */
 
 #define SPLT    ((1-RT_ENDIAN)*3)
 #define SP16    ((1-RT_ENDIAN)*7)
 #define SP08    ((1-RT_ENDIAN)*15)
 #define SPL(DT) (SPLT+(2*RT_ENDIAN-1)*(3 & VAL(DT) >> 2))
+#define SPK(k)  (SPLT+(2*RT_ENDIAN-1)*(k))
+#define SPW(IT, k) SPK(3 & VAL(IT) >> (2*SPK(k)))
 
 /* registers    REG   (check mapping with ASM_ENTER/ASM_LEAVE in rtarch.h) */
 /* four registers T0xx,T1xx,T2xx,T3xx below must occupy consecutive indices */
@@ -2051,59 +2053,59 @@
         CWI(cc, %%r24,   TMxx,    W(IT), lb)
 
 #define cmjwx_rr(RS, RT, cc, lb)                                            \
-        CWR(cc, MOD(RS), MOD(RT), lb)
+        CWR(cc, MOD(RS), REG(RS), MOD(RT), REG(RT), lb)
 
 #define cmjwx_rm(RS, MT, DT, cc, lb)                                        \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        CWR(cc, MOD(RS), %%r24,   lb)
+        CWR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjhn_rm(RS, MT, DT, cc, lb)   /* cmj 32/16-bit with sign-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), PS(DT)))  \
-        CWR(cc, MOD(RS), %%r24,   lb)
+        CWR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjhz_rm(RS, MT, DT, cc, lb)   /* cmj 32/16-bit with zero-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), PH(DT)))  \
-        CWR(cc, MOD(RS), %%r24,   lb)
+        CWR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjbn_rm(RS, MT, DT, cc, lb)   /* cmj 32/8-bit  with sign-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), PB(DT)))  \
         EMITW(0x7C000774 | MSM(TMxx,    TMxx,    0x00))                     \
-        CWR(cc, MOD(RS), %%r24,   lb)
+        CWR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjbz_rm(RS, MT, DT, cc, lb)   /* cmj 32/8-bit  with zero-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), PB(DT)))  \
-        CWR(cc, MOD(RS), %%r24,   lb)
+        CWR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjwx_mr(MS, DS, RT, cc, lb)                                        \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
-        CWR(cc, %%r24,   MOD(RT), lb)
+        CWR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjhn_mr(MS, DS, RT, cc, lb)   /* cmj 16/32-bit with sign-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), PS(DS)))  \
-        CWR(cc, %%r24,   MOD(RT), lb)
+        CWR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjhz_mr(MS, DS, RT, cc, lb)   /* cmj 16/32-bit with zero-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), PH(DS)))  \
-        CWR(cc, %%r24,   MOD(RT), lb)
+        CWR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjbn_mr(MS, DS, RT, cc, lb)   /* cmj  8/32-bit with sign-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), PB(DS)))  \
         EMITW(0x7C000774 | MSM(TMxx,    TMxx,    0x00))                     \
-        CWR(cc, %%r24,   MOD(RT), lb)
+        CWR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjbz_mr(MS, DS, RT, cc, lb)   /* cmj  8/32-bit with zero-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), PB(DS)))  \
-        CWR(cc, %%r24,   MOD(RT), lb)
+        CWR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 #if   (defined RT_P32)
 
@@ -2194,6 +2196,25 @@
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
         EMITW(0x7C000214 | MRM(REG(RD), MOD(MS), TDxx))
 
+/* prf (prefetch cache line at adr S into cache level given by hint)
+ * set-flags: no
+ * hint: L1 - all levels, L2 - outer levels, NT - non-temporal (streaming)
+ * never faults, treated as a no-op where the hint is not supported */
+
+#define RT_BASE_HINT_L1     0x00    /* dcbt TH=0 */
+#define RT_BASE_HINT_L2     0x00    /* dcbt TH=0, no cache level control */
+#define RT_BASE_HINT_NT     0x10    /* dcbt TH=16, transient */
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C00022C | MRM(RT_BASE_HINT_##hint, MOD(MS), TDxx))
+
+/* fence (orders preceding non-temporal stores before subsequent stores)
+ * set-flags: no */
+
+#define fence_xx()                                                          \
+        EMITW(0x7C2004AC)                     /* lwsync */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -2222,6 +2243,8 @@
         EMITW(0x7C0003A6 | MRM(TMxx,    0x00,    0x09)) /* ctr <- r24 */    \
         EMITW(0x4C000420 | MTM(0x0C,    0x0A,    0x00)) /* beqctr cr2 */
 
+#if RT_CODE_GEN == 0
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
@@ -2274,6 +2297,75 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        EMITR(lb, RT_CODE_LI24)                                             \
+        EMITW(0x48000000)                               /* b     lb */
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000040 | MTM(0x00,    TLxx,    TRxx)) /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000040 | MTM(0x00,    TLxx,    TRxx)) /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000040 | MTM(0x00,    TLxx,    TRxx)) /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000040 | MTM(0x00,    TLxx,    TRxx)) /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000040 | MTM(0x00,    TLxx,    TRxx)) /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000040 | MTM(0x00,    TLxx,    TRxx)) /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000000 | MTM(0x00,    TLxx,    TRxx)) /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000000 | MTM(0x00,    TLxx,    TRxx)) /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000000 | MTM(0x00,    TLxx,    TRxx)) /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C000000 | MTM(0x00,    TLxx,    TRxx)) /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define LBL(lb)                                          /* code label */   \
+        EMITL(lb)
+
+#endif /* RT_CODE_GEN */
+
 /************************* register-size instructions *************************/
 
 /* stack (push stack = S, D = pop stack)
@@ -2385,6 +2477,137 @@
 
 /* internal definitions for combined-compare-jump (cmj) */
 
+#if RT_CODE_GEN != 0 /* dynamic mode resolves branches via relocations */
+
+#define IWJ0(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define IWJ1(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define IWJ2(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define IWJ3(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define IWJ4(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define IWJ5(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28000000) | (M(TP2(IS) != 0) & 0x7C000040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define IWJ6(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define IWJ7(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define IWJ8(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define IWJ9(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C000000) | (M(TP1(IS) != 0) & 0x7C000000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define CWI(cc, r1, p1, IS, lb)                                             \
+        IW##cc(r1, p1, W(IS), lb)
+
+
+#define RWJ0(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000040 | MTM(0x00,    p1,      p2))   /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define RWJ1(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000040 | MTM(0x00,    p1,      p2))   /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define RWJ2(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000040 | MTM(0x00,    p1,      p2))   /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define RWJ3(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000040 | MTM(0x00,    p1,      p2))   /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define RWJ4(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000040 | MTM(0x00,    p1,      p2))   /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define RWJ5(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000040 | MTM(0x00,    p1,      p2))   /* cmplw */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define RWJ6(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000000 | MTM(0x00,    p1,      p2))   /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define RWJ7(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000000 | MTM(0x00,    p1,      p2))   /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define RWJ8(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000000 | MTM(0x00,    p1,      p2))   /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define RWJ9(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C000000 | MTM(0x00,    p1,      p2))   /* cmpw  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define CWR(cc, r1, p1, r2, p2, lb)                                         \
+        RW##cc(r1, p1, r2, p2, lb)
+
+#else /* RT_CODE_GEN */
+
 #define IWJ0(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
@@ -2449,48 +2672,50 @@
         IW##cc(r1, p1, W(IS), lb)
 
 
-#define RWJ0(r1, r2, lb)                                                    \
+#define RWJ0(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(beq,   lb) ASM_END
 
-#define RWJ1(r1, r2, lb)                                                    \
+#define RWJ1(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bne,   lb) ASM_END
 
-#define RWJ2(r1, r2, lb)                                                    \
+#define RWJ2(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(blt,   lb) ASM_END
 
-#define RWJ3(r1, r2, lb)                                                    \
+#define RWJ3(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(ble,   lb) ASM_END
 
-#define RWJ4(r1, r2, lb)                                                    \
+#define RWJ4(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bgt,   lb) ASM_END
 
-#define RWJ5(r1, r2, lb)                                                    \
+#define RWJ5(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmplw, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bge,   lb) ASM_END
 
-#define RWJ6(r1, r2, lb)                                                    \
+#define RWJ6(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(blt,   lb) ASM_END
 
-#define RWJ7(r1, r2, lb)                                                    \
+#define RWJ7(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(ble,   lb) ASM_END
 
-#define RWJ8(r1, r2, lb)                                                    \
+#define RWJ8(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bgt,   lb) ASM_END
 
-#define RWJ9(r1, r2, lb)                                                    \
+#define RWJ9(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpw,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bge,   lb) ASM_END
 
-#define CWR(cc, r1, r2, lb)                                                 \
-        RW##cc(r1, r2, lb)
+#define CWR(cc, r1, p1, r2, p2, lb)                                         \
+        RW##cc(r1, p1, r2, p2, lb)
+
+#endif /* RT_CODE_GEN */
 
 #endif /* RT_RTARCH_P32_H */
 
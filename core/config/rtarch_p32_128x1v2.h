@@ -329,6 +329,63 @@
         AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
         EMITW(0x00000000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), O2(DD)))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h
+ * shf shifts in splats of S one by one, uzp is zip applied twice */
+
+#undef  shfix_ri
+#define shfix_ri(XD, XS, IT)                                                \
+        EMITW(0x1000028C | MXM(TmmM,    SPW(W(IT), 0), REG(XS)))            \
+        EMITW(0x1000028C | MXM(TmmQ,    SPW(W(IT), 1), REG(XS)))            \
+        EMITW(0x1000012C | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000028C | MXM(TmmQ,    SPW(W(IT), 2), REG(XS)))            \
+        EMITW(0x1000012C | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000028C | MXM(TmmQ,    SPW(W(IT), 3), REG(XS)))            \
+        EMITW(0x1000012C | MXM(REG(XD), TmmM,    TmmQ))
+
+#if RT_ENDIAN == 0 /* little-endian */
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)                                                    \
+        EMITW(0x1000018C | MXM(TmmM,    REG(XS), REG(XG)))                  \
+        EMITW(0x1000008C | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0xF0000497 | MXM(REG(XG), TmmM,    TmmM))
+
+#else  /* RT_ENDIAN == 1, big-endian */
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)                                                    \
+        EMITW(0x1000008C | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x1000018C | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0xF0000497 | MXM(REG(XG), TmmM,    TmmM))
+
+#endif /* RT_ENDIAN */
+
+#undef  uzpix_rr
+#define uzpix_rr(XG, XS)                                                    \
+        zipix_rr(W(XG), W(XS))                                              \
+        zipix_rr(W(XG), W(XS))
+
+#undef  bcxix_ri
+#define bcxix_ri(XD, XS, IT)                                                \
+        EMITW(0x1000028C | MXM(REG(XD), SPK(3 & (VAL(IT))), REG(XS)))
+
+#undef  rotix_ri
+#define rotix_ri(XD, XS, IT)                                                \
+        EMITW(0x1000002C | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((2*RT_ENDIAN-1)*(VAL(IT))&3)<<8)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movix_bc
+#define movix_bc(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(Ox7C000XXX | MPM(REG(XD), MOD(MS), VAL(DS), B2(DS), E2(DS)))  \
+    SPX(EMITW(0x1000028C | MXM(REG(XD), SPL(W(DS)), REG(XD))))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -463,6 +520,58 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* sld (xxsldwi), mrg (xxmrghw, xxmrglw) keep horizontal ops
+         * in registers with TmmM, TmmQ as temps, log-step reductions
+         * leave equal results in all elements,
+         * pairwise ops take T before S when elements load reversed */
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0xF0000217 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(op         | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(op         | MXM(REG(XD), REG(XD), TmmM))
+
+#if RT_ENDIAN == 0
+
+#define hrpis_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        hrpis_rx(W(XD), REG(XT), REG(XS), op)
+
+#define hrpis_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmQ,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        hrpis_rx(W(XD), TmmQ, REG(XS), op)
+
+#else  /* RT_ENDIAN == 0 */
+
+#define hrpis_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        hrpis_rx(W(XD), REG(XS), REG(XT), op)
+
+#define hrpis_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmQ,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+        hrpis_rx(W(XD), REG(XS), TmmQ, op)
+
+#endif /* RT_ENDIAN */
+
+#define hrpis_rx(XD, RS, RT, op) /* not portable, do not use outside */     \
+        EMITW(0xF0000097 | MXM(TmmM,    RS,      RT))                       \
+        EMITW(0xF0000197 | MXM(TmmQ,    RS,      RT))                       \
+        EMITW(0xF0000197 | MXM(REG(XD), TmmM,    TmmQ))                     \
+        EMITW(0xF0000097 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(op         | MXM(REG(XD), TmmM,    REG(XD)))
+
+#undef  adpis3rr
+#define adpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0xF0000207)
+
+#undef  adpis3ld
+#define adpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000207)
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzis_rr(W(XD), W(XS), 0xF0000207)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -498,6 +607,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpis3rr
+#define mlpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0xF0000287)
+
+#undef  mlpis3ld
+#define mlpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000287)
+
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzis_rr(W(XD), W(XS), 0xF0000287)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -569,7 +690,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         EMITW(0xF000020F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -585,7 +706,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         EMITW(0xF000068F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -618,6 +739,18 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpis3rr
+#define mnpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0xF0000647)
+
+#undef  mnpis3ld
+#define mnpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000647)
+
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), 0xF0000647)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -637,6 +770,18 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpis3rr
+#define mxpis3rr(XD, XS, XT)                                                \
+        hrpis_rr(W(XD), W(XS), W(XT), 0xF0000607)
+
+#undef  mxpis3ld
+#define mxpis3ld(XD, XS, MT, DT)                                            \
+        hrpis_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000607)
+
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), 0xF0000607)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1094,6 +1239,172 @@
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem by immediate use 32x32->64-bit even/odd word products merged
+ * back with vmrgew instead of per-element BASE loops,
+ * the magic number is splat from inf_SCR02, mulhi result is kept in TmmQ */
+
+#undef  divix_ri
+#define divix_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movwx_mi(Mebp, inf_SCR02(0), IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF))) \
+        mhiix_ld(W(XG), Mebp, inf_SCR02(0), 0x10000288)                     \
+        EMITW(0x10000480 | MXM(REG(XG), REG(XG), TmmQ))                     \
+        shrix_ri(W(XG), IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))               \
+        EMITW(0x10000080 | MXM(REG(XG), REG(XG), TmmQ))                     \
+        shrix_ri(W(XG), IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#undef  divin_ri
+#define divin_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        movwx_mi(Mebp, inf_SCR02(0), IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF))) \
+        mhiix_ld(W(XG), Mebp, inf_SCR02(0), 0x10000388)                     \
+        EMITW(0x10000080 | MXM(REG(XG), REG(XG), TmmQ))                     \
+        shrin_ri(W(XG), IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                \
+        EMITW(0x1000038C | MXM(TmmM,    0x1F,    0x00))                     \
+        EMITW(0x10000284 | MXM(TmmM,    REG(XG), TmmM))                     \
+        EMITW(0x10000080 | MXM(REG(XG), REG(XG), TmmM))
+
+#undef  remix_ri
+#define remix_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        divix_ri(W(XG), W(IS))                                              \
+        movwx_mi(Mebp, inf_SCR02(0), W(IS))                                 \
+        rmiix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#undef  remin_ri
+#define remin_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        divin_ri(W(XG), W(IS))                                              \
+        movwx_mi(Mebp, inf_SCR02(0), W(IS))                                 \
+        rmiix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define rmiix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(Ox7C000XXX | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), E2(DS)))  \
+    SPX(EMITW(0x1000028C | MXM(TmmM,    SPLT,    TmmM)))                    \
+        EMITW(0x10000089 | MXM(TmmM,    REG(XG), TmmM))                     \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        EMITW(0x10000480 | MXM(REG(XG), REG(XG), TmmM))
+
+/* mhi (TmmQ = mulhi(G, [MS, DS])) with even word product op given,
+ * odd word product op is 0x200 below the even one for both signs */
+
+#define mhiix_ld(XG, MS, DS, op) /* not portable, do not use outside */     \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(Ox7C000XXX | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), E2(DS)))  \
+    SPX(EMITW(0x1000028C | MXM(TmmM,    SPLT,    TmmM)))                    \
+        EMITW(op         | MXM(TmmQ,    REG(XG), TmmM))                     \
+        EMITW((op)-0x200 | MXM(TmmM,    REG(XG), TmmM))                     \
+        EMITW(0x1000078C | MXM(TmmQ,    TmmQ,    TmmM))
+
+/* div, rem with variable divisor convert even and odd words to fp64
+ * (xvcvsxwdp, xvcvuxwdp), where all 32-bit integer quotients are exact,
+ * instead of per-element BASE division loops, merged back with vmrgew,
+ * rem is computed in fp64 with xvnmsubadp on the truncated quotient;
+ * div by zero and signed INT_MIN/-1 don't trap: conversions saturate,
+ * so signed quotient is 0x7FFFFFFF for INT_MIN/-1 and positive dividends
+ * (0x80000000 otherwise), unsigned quotient is 0xFFFFFFFF (0 for 0/0),
+ * rem by zero is 0x80000000 (signed) or 0 (unsigned), INT_MIN % -1 is 0 */
+
+#undef  divix3rr
+#define divix3rr(XD, XS, XT)                                                \
+        dvfix_rr(W(XD), W(XS), W(XT), 0xF00003A3, 0xF0000323)
+
+#undef  divix3ld
+#define divix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), dvhix, 0xF00003A3, 0xF0000323)
+
+#undef  divin3rr
+#define divin3rr(XD, XS, XT)                                                \
+        dvfix_rr(W(XD), W(XS), W(XT), 0xF00003E3, 0xF0000363)
+
+#undef  divin3ld
+#define divin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), dvhix, 0xF00003E3, 0xF0000363)
+
+#undef  remix3rr
+#define remix3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), rmhix, 0xF00003A3, 0xF0000323)
+
+#undef  remix3ld
+#define remix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), rmhix, 0xF00003A3, 0xF0000323)
+
+#undef  remin3rr
+#define remin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), rmhix, 0xF00003E3, 0xF0000363)
+
+#undef  remin3ld
+#define remin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfix_rx(W(XD), rmhix, 0xF00003E3, 0xF0000363)
+
+/* dvf (D = S / T) in registers, even words go through TmmM, odd words
+ * are rotated into place with xxsldwi, cv, ct select signed or unsigned
+ * conversions to and from fp64 */
+
+#define dvfix_rr(XD, XS, XT, cv, ct) /* not portable, do not use outside */ \
+        EMITW((cv)       | MXM(TmmM,    0x00,    REG(XS)))                  \
+        EMITW((cv)       | MXM(TmmQ,    0x00,    REG(XT)))                  \
+        EMITW(0xF00003C7 | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW((ct)       | MXM(TmmM,    0x00,    TmmM))                     \
+        EMITW(0xF0000117 | MXM(TmmQ,    REG(XT), REG(XT)))                  \
+        EMITW(0xF0000117 | MXM(REG(XD), REG(XS), REG(XS)))                  \
+        EMITW((cv)       | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW((cv)       | MXM(TmmQ,    0x00,    TmmQ))                     \
+        EMITW(0xF00003C7 | MXM(REG(XD), REG(XD), TmmQ))                     \
+        EMITW((ct)       | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0x1000078C | MXM(REG(XD), TmmM,    REG(XD)))
+
+/* dvf (D = inf_SCR01 op inf_SCR02) with per-half dvh (div) or rmh (rem),
+ * odd words half goes to inf_SCR03 before the merge in dvzix_ld */
+
+#define dvfix_rx(XD, hx, cv, ct) /* not portable, do not use outside */     \
+        hx##_rx(W(XD), 0xF0000117, cv, ct)                                  \
+        movix_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        hx##_rx(W(XD), 0xF0000017, cv, ct)                                  \
+        dvzix_ld(W(XD), Mebp, inf_SCR03(0))
+
+#define dvhix_rx(XD, sh, cv, ct) /* not portable, do not use outside */     \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        EMITW((sh)       | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW((cv)       | MXM(TmmQ,    0x00,    REG(XD)))                  \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        EMITW((sh)       | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW((cv)       | MXM(TmmM,    0x00,    REG(XD)))                  \
+        EMITW(0xF00003C7 | MXM(REG(XD), TmmM,    TmmQ))                     \
+        EMITW((ct)       | MXM(REG(XD), 0x00,    REG(XD)))
+
+#define rmhix_rx(XD, sh, cv, ct) /* not portable, do not use outside */     \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        EMITW((sh)       | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW((cv)       | MXM(TmmQ,    0x00,    REG(XD)))                  \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        EMITW((sh)       | MXM(REG(XD), REG(XD), REG(XD)))                  \
+        EMITW((cv)       | MXM(TmmM,    0x00,    REG(XD)))                  \
+        EMITW(0xF00003C7 | MXM(REG(XD), TmmM,    TmmQ))                     \
+        EMITW(0xF0000367 | MXM(REG(XD), 0x00,    REG(XD)))                  \
+        EMITW(0xF000078F | MXM(TmmM,    REG(XD), TmmQ))                     \
+        EMITW((ct)       | MXM(REG(XD), 0x00,    TmmM))
+
+#define dvzix_ld(XD, MS, DS) /* not portable, do not use outside */         \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmM,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x1000078C | MXM(REG(XD), REG(XD), TmmM))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1572,7 +1883,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0xF000000F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1588,7 +1899,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0xF000048F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1736,7 +2047,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0xF000020F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1753,7 +2064,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0xF000068F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -252,6 +252,114 @@
         EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
         EMITW(0x7C0001CE | MXM(REG(XS), TEax & M(MOD(MD) == TPxx), TPxx))
 
+/* muv (D = S), unaligned load/store, see rtbase.h
+ * loads merge two aligned quads with lvsl/vperm (lvsr on little-endian),
+ * stores rotate S with lvsr/vperm (lvsl on little-endian) and write it back
+ * with element stores, hence D needs 32-bit alignment, destroys TmmW/TmmM */
+
+#if RT_ENDIAN == 0 /* little-endian */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00004C | MXM(TmmW,    TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(REG(XD), TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x0F)              \
+        EMITW(0x7C0000CE | MXM(TmmM,    TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), TmmM,    REG(XD)) | TmmW << 6)
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00000C | MXM(TmmW,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmW << 6)      \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))
+
+#else  /* RT_ENDIAN == 1, big-endian */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00000C | MXM(TmmW,    TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x7C0000CE | MXM(REG(XD), TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x0F)              \
+        EMITW(0x7C0000CE | MXM(TmmM,    TEax & M(MOD(MS) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmW << 6)
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+        AUW(EMPTY,    EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    REG(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00004C | MXM(TmmW,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmW << 6)      \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))   \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    TEax & M(MOD(MD) == TPxx), TPxx))
+
+#endif /* RT_ENDIAN */
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h
+ * shf shifts in splats of S one by one, uzp is zip applied twice */
+
+#undef  shfix_ri
+#define shfix_ri(XD, XS, IT)                                                \
+        EMITW(0x1000028C | MXM(TmmM,    SPW(W(IT), 0), REG(XS)))            \
+        EMITW(0x1000028C | MXM(TmmQ,    SPW(W(IT), 1), REG(XS)))            \
+        EMITW(0x1000012C | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000028C | MXM(TmmQ,    SPW(W(IT), 2), REG(XS)))            \
+        EMITW(0x1000012C | MXM(TmmM,    TmmM,    TmmQ))                     \
+        EMITW(0x1000028C | MXM(TmmQ,    SPW(W(IT), 3), REG(XS)))            \
+        EMITW(0x1000012C | MXM(REG(XD), TmmM,    TmmQ))
+
+#if RT_ENDIAN == 0 /* little-endian */
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)                                                    \
+        EMITW(0x1000018C | MXM(TmmM,    REG(XS), REG(XG)))                  \
+        EMITW(0x1000008C | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0x10000484 | MXM(REG(XG), TmmM,    TmmM))
+
+#else  /* RT_ENDIAN == 1, big-endian */
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)                                                    \
+        EMITW(0x1000008C | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0x1000018C | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0x10000484 | MXM(REG(XG), TmmM,    TmmM))
+
+#endif /* RT_ENDIAN */
+
+#undef  uzpix_rr
+#define uzpix_rr(XG, XS)                                                    \
+        zipix_rr(W(XG), W(XS))                                              \
+        zipix_rr(W(XG), W(XS))
+
+#undef  bcxix_ri
+#define bcxix_ri(XD, XS, IT)                                                \
+        EMITW(0x1000028C | MXM(REG(XD), SPK(3 & (VAL(IT))), REG(XS)))
+
+#undef  rotix_ri
+#define rotix_ri(XD, XS, IT)                                                \
+        EMITW(0x1000002C | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((2*RT_ENDIAN-1)*(VAL(IT))&3)<<8)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -395,6 +503,20 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* sld (vsldoi) keeps horizontal ops in registers with TmmM
+         * as temp, log-step reductions leave equal results in all
+         * elements, mlh multiplies with vmaddfp adding -0.0 (TmmS) */
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0x1000022C | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(op         | MXM(REG(XD), REG(XS), TmmM))                     \
+        EMITW(0x1000012C | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(op         | MXM(REG(XD), REG(XD), TmmM))
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzis_rr(W(XD), W(XS), 0x1000000A)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -432,6 +554,13 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        EMITW(0x1000022C | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(0x1000002E | MXM(REG(XD), REG(XS), TmmS) | TmmM << 6)         \
+        EMITW(0x1000012C | MXM(TmmM,    REG(XD), REG(XD)))                  \
+        EMITW(0x1000002E | MXM(REG(XD), REG(XD), TmmS) | TmmM << 6)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -637,7 +766,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         EMITW(0x1000002E | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)
@@ -654,7 +783,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         EMITW(0x1000002F | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)
@@ -689,6 +818,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), 0x1000044A)
+
 #undef  mnpis_rx
 #define mnpis_rx(XD) /* not portable, do not use outside */                 \
         movrs2ld(W(XD), Mebp, inf_SCR01(0x00))                              \
@@ -737,6 +870,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), 0x1000040A)
+
 #undef  mxpis_rx
 #define mxpis_rx(XD) /* not portable, do not use outside */                 \
         movrs2ld(W(XD), Mebp, inf_SCR01(0x00))                              \
@@ -1766,7 +1903,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0xEC00003A | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)
@@ -1782,7 +1919,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0xEC00003C | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)
@@ -2011,7 +2148,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EMITW(0x1000002E | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)
@@ -2029,7 +2166,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EMITW(0x1000002F | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)
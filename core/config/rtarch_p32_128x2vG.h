@@ -166,6 +166,86 @@
         EMITW(0x7C0001CE | MXM(REG(XS), T0xx,    TPxx))                     \
         EMITW(0x7C0001CE | MXM(RYG(XS), T1xx,    TPxx))
 
+/* muv (D = S), unaligned load/store, see rtbase.h
+ * same realignment as muvix in rtarch_p32_128x1v4.h applied to both halves,
+ * D needs 32-bit alignment, destroys TmmW/TmmM */
+
+#if RT_ENDIAN == 0 /* little-endian */
+
+#undef  muvcx_ld
+#define muvcx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00004C | MXM(TmmW,    T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(REG(XD), T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(TmmM,    T1xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(REG(XD), TmmM,    REG(XD)) | TmmW << 6)      \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x0F)              \
+        EMITW(0x7C0000CE | MXM(RYG(XD), T1xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(RYG(XD), RYG(XD), TmmM) | TmmW << 6)
+
+#undef  muvcx_st
+#define muvcx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00000C | MXM(TmmW,    T0xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmW << 6)      \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x1000002B | MXM(TmmM,    RYG(XS), RYG(XS)) | TmmW << 6)      \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))
+
+#else  /* RT_ENDIAN == 1, big-endian */
+
+#undef  muvcx_ld
+#define muvcx_ld(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C2(DS), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MS), VAL(DS), B2(DS), P2(DS)))  \
+        EMITW(0x7C00000C | MXM(TmmW,    T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(REG(XD), T0xx,    TPxx))                     \
+        EMITW(0x7C0000CE | MXM(TmmM,    T1xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(REG(XD), REG(XD), TmmM) | TmmW << 6)         \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x0F)              \
+        EMITW(0x7C0000CE | MXM(RYG(XD), T1xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(RYG(XD), TmmM,    RYG(XD)) | TmmW << 6)
+
+#undef  muvcx_st
+#define muvcx_st(XS, MD, DD)                                                \
+        AUW(SIB(MD),  EMPTY,  EMPTY,    MOD(MD), VAL(DD), C2(DD), EMPTY2)   \
+        EMITW(0x38000000 | MPM(TPxx,    MOD(MD), VAL(DD), B2(DD), P2(DD)))  \
+        EMITW(0x7C00004C | MXM(TmmW,    T0xx,    TPxx))                     \
+        EMITW(0x1000002B | MXM(TmmM,    REG(XS), REG(XS)) | TmmW << 6)      \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x1000002B | MXM(TmmM,    RYG(XS), RYG(XS)) | TmmW << 6)      \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))                     \
+        EMITW(0x38000000 | MTM(TPxx,    TPxx,    0x00) | 0x04)              \
+        EMITW(0x7C00018E | MXM(TmmM,    T0xx,    TPxx))
+
+#endif /* RT_ENDIAN */
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -662,7 +742,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmacs_rr(XG, XS, XT)                                                \
         EMITW(0x1000002E | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)   \
@@ -682,7 +762,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmscs_rr(XG, XS, XT)                                                \
         EMITW(0x1000002F | MXM(REG(XG), REG(XS), REG(XG)) | REG(XT) << 6)   \
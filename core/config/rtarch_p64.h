@@ -1340,37 +1340,37 @@
         CXI(cc, %%r24,   TMxx,    W(IT), lb)
 
 #define cmjzx_rr(RS, RT, cc, lb)                                            \
-        CXR(cc, MOD(RS), MOD(RT), lb)
+        CXR(cc, MOD(RS), REG(RS), MOD(RT), REG(RT), lb)
 
 #define cmjzx_rm(RS, MT, DT, cc, lb)                                        \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), F1(DT)))  \
-        CXR(cc, MOD(RS), %%r24,   lb)
+        CXR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjwn_rm(RS, MT, DT, cc, lb)   /* cmj 64/32-bit with sign-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), PW(DT)))  \
-        CXR(cc, MOD(RS), %%r24,   lb)
+        CXR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjwz_rm(RS, MT, DT, cc, lb)   /* cmj 64/32-bit with zero-extend */ \
         AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C1(DT), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MT), VAL(DT), B1(DT), P1(DT)))  \
-        CXR(cc, MOD(RS), %%r24,   lb)
+        CXR(cc, MOD(RS), REG(RS), %%r24,   TMxx,    lb)
 
 #define cmjzx_mr(MS, DS, RT, cc, lb)                                        \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), F1(DS)))  \
-        CXR(cc, %%r24,   MOD(RT), lb)
+        CXR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjwn_mr(MS, DS, RT, cc, lb)   /* cmj 32/64-bit with sign-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), PW(DS)))  \
-        CXR(cc, %%r24,   MOD(RT), lb)
+        CXR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 #define cmjwz_mr(MS, DS, RT, cc, lb)   /* cmj 32/64-bit with zero-extend */ \
         AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C1(DS), EMPTY2)   \
         EMITW(0x00000000 | MDM(TMxx,    MOD(MS), VAL(DS), B1(DS), P1(DS)))  \
-        CXR(cc, %%r24,   MOD(RT), lb)
+        CXR(cc, %%r24,   TMxx,    MOD(RT), REG(RT), lb)
 
 /* cmp (flags = S ? T)
  * set-flags: yes */
@@ -1525,6 +1525,8 @@
         EMITW(0x7C0003A6 | MRM(TMxx,    0x00,    0x09)) /* ctr <- r24 */    \
         EMITW(0x4C000420 | MTM(0x0C,    0x0A,    0x00)) /* beqctr cr2 */
 
+#if RT_CODE_GEN == 0
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(b, lb) ASM_END
 
@@ -1577,6 +1579,75 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        EMITR(lb, RT_CODE_LI24)                                             \
+        EMITW(0x48000000)                               /* b     lb */
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200040 | MTM(0x00,    TLxx,    TRxx)) /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200040 | MTM(0x00,    TLxx,    TRxx)) /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200040 | MTM(0x00,    TLxx,    TRxx)) /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200040 | MTM(0x00,    TLxx,    TRxx)) /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200040 | MTM(0x00,    TLxx,    TRxx)) /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200040 | MTM(0x00,    TLxx,    TRxx)) /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200000 | MTM(0x00,    TLxx,    TRxx)) /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200000 | MTM(0x00,    TLxx,    TRxx)) /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200000 | MTM(0x00,    TLxx,    TRxx)) /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        EMITW(0x7C200000 | MTM(0x00,    TLxx,    TRxx)) /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define LBL(lb)                                          /* code label */   \
+        EMITL(lb)
+
+#endif /* RT_CODE_GEN */
+
 /************************* register-size instructions *************************/
 
 /* stack (push stack = S, D = pop stack)
@@ -1655,6 +1726,137 @@
 
 /* internal definitions for combined-compare-jump (cmj) */
 
+#if RT_CODE_GEN != 0 /* dynamic mode resolves branches via relocations */
+
+#define IXJ0(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define IXJ1(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define IXJ2(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define IXJ3(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define IXJ4(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define IXJ5(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
+        (M(TP2(IS) == 0) & 0x28200000) | (M(TP2(IS) != 0) & 0x7C200040))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define IXJ6(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define IXJ7(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define IXJ8(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define IXJ9(r1, p1, IS, lb)                                                \
+        AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G1(IS))   \
+        EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T3(IS), M3(IS)) | \
+        (M(TP1(IS) == 0) & 0x2C200000) | (M(TP1(IS) != 0) & 0x7C200000))    \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define CXI(cc, r1, p1, IS, lb)                                             \
+        IX##cc(r1, p1, W(IS), lb)
+
+
+#define RXJ0(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200040 | MTM(0x00,    p1,      p2))   /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41820000)                               /* beq   lb */
+
+#define RXJ1(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200040 | MTM(0x00,    p1,      p2))   /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40820000)                               /* bne   lb */
+
+#define RXJ2(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200040 | MTM(0x00,    p1,      p2))   /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define RXJ3(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200040 | MTM(0x00,    p1,      p2))   /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define RXJ4(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200040 | MTM(0x00,    p1,      p2))   /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define RXJ5(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200040 | MTM(0x00,    p1,      p2))   /* cmpld */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define RXJ6(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200000 | MTM(0x00,    p1,      p2))   /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41800000)                               /* blt   lb */
+
+#define RXJ7(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200000 | MTM(0x00,    p1,      p2))   /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40810000)                               /* ble   lb */
+
+#define RXJ8(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200000 | MTM(0x00,    p1,      p2))   /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x41810000)                               /* bgt   lb */
+
+#define RXJ9(r1, p1, r2, p2, lb)                                            \
+        EMITW(0x7C200000 | MTM(0x00,    p1,      p2))   /* cmpd  */         \
+        EMITR(lb, RT_CODE_BD14)                                             \
+        EMITW(0x40800000)                               /* bge   lb */
+
+#define CXR(cc, r1, p1, r2, p2, lb)                                         \
+        RX##cc(r1, p1, r2, p2, lb)
+
+#else /* RT_CODE_GEN */
+
 #define IXJ0(r1, p1, IS, lb)                                                \
         AUW(EMPTY,    VAL(IS), TIxx,    EMPTY,   EMPTY,   EMPTY2, G2(IS))   \
         EMITW(0x00000000 | MIM(p1,      0x00,    VAL(IS), T2(IS), M2(IS)) | \
@@ -1719,48 +1921,50 @@
         IX##cc(r1, p1, W(IS), lb)
 
 
-#define RXJ0(r1, r2, lb)                                                    \
+#define RXJ0(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(beq,   lb) ASM_END
 
-#define RXJ1(r1, r2, lb)                                                    \
+#define RXJ1(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bne,   lb) ASM_END
 
-#define RXJ2(r1, r2, lb)                                                    \
+#define RXJ2(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(blt,   lb) ASM_END
 
-#define RXJ3(r1, r2, lb)                                                    \
+#define RXJ3(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(ble,   lb) ASM_END
 
-#define RXJ4(r1, r2, lb)                                                    \
+#define RXJ4(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bgt,   lb) ASM_END
 
-#define RXJ5(r1, r2, lb)                                                    \
+#define RXJ5(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpld, r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bge,   lb) ASM_END
 
-#define RXJ6(r1, r2, lb)                                                    \
+#define RXJ6(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(blt,   lb) ASM_END
 
-#define RXJ7(r1, r2, lb)                                                    \
+#define RXJ7(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(ble,   lb) ASM_END
 
-#define RXJ8(r1, r2, lb)                                                    \
+#define RXJ8(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bgt,   lb) ASM_END
 
-#define RXJ9(r1, r2, lb)                                                    \
+#define RXJ9(r1, p1, r2, p2, lb)                                            \
         ASM_BEG ASM_OP2(cmpd,  r1, r2) ASM_END                              \
         ASM_BEG ASM_OP1(bge,   lb) ASM_END
 
-#define CXR(cc, r1, r2, lb)                                                 \
-        RX##cc(r1, r2, lb)
+#define CXR(cc, r1, p1, r2, p2, lb)                                         \
+        RX##cc(r1, p1, r2, p2, lb)
+
+#endif /* RT_CODE_GEN */
 
 #endif /* (defined RT_P64) */
 
@@ -186,6 +186,62 @@
     SHF(EMITW(0x00000000 | MPM(TmmM,    MOD(MD), VAL(DD), B2(DD), O2(DD)))) \
     SHX(EMITW(0x00000000 | MPM(REG(XS), MOD(MD), VAL(DD), B2(DD), O2(DD))))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#if RT_ENDIAN == 0 && RT_ELEM_COMPAT_VMX == 0
+
+#undef  shfjx_ri
+#define shfjx_ri(XD, XS, IT)                                                \
+        EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((~(VAL(IT)))&3)<<8)
+
+#undef  zipjx_rr
+#define zipjx_rr(XG, XS)                                                    \
+        EMITW(0xF0000357 | MXM(TmmM,    REG(XS), REG(XG)))                  \
+        EMITW(0xF0000057 | MXM(REG(XS), REG(XS), REG(XG)))                  \
+        EMITW(0xF0000497 | MXM(REG(XG), TmmM,    TmmM))
+
+#undef  bcxjx_ri
+#define bcxjx_ri(XD, XS, IT)                                                \
+        EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((~(VAL(IT)))&1)*0x300)
+
+#else  /* RT_ENDIAN, RT_ELEM_COMPAT_VMX */
+
+#undef  shfjx_ri
+#define shfjx_ri(XD, XS, IT)                                                \
+        EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((VAL(IT))&1)<<9 | ((VAL(IT))&2)<<7)
+
+#undef  zipjx_rr
+#define zipjx_rr(XG, XS)                                                    \
+        EMITW(0xF0000057 | MXM(TmmM,    REG(XG), REG(XS)))                  \
+        EMITW(0xF0000357 | MXM(REG(XS), REG(XG), REG(XS)))                  \
+        EMITW(0xF0000497 | MXM(REG(XG), TmmM,    TmmM))
+
+#undef  bcxjx_ri
+#define bcxjx_ri(XD, XS, IT)                                                \
+        EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         ((VAL(IT))&1)*0x300)
+
+#endif /* RT_ENDIAN, RT_ELEM_COMPAT_VMX */
+
+#undef  rotjx_ri
+#define rotjx_ri(XD, XS, IT)                                                \
+        EMITW(0xF0000057 | MXM(REG(XD), REG(XS), REG(XS)) |                 \
+                         0x100 << ((VAL(IT))&1))
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movjx_bc
+#define movjx_bc(XD, MS, DS)                                                \
+        AUW(SIB(MS),  EMPTY,  EMPTY,    MOD(MS), VAL(DS), C3(DS), EMPTY2)   \
+        EMITW(0x7C000299 | MPM(REG(XD), MOD(MS), VAL(DS), B2(DS), E2(DS)))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -329,6 +385,56 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* swp (xxswapd), prm (xxpermdi) keep horizontal ops
+         * in registers with TmmM, TmmQ as temps, reductions
+         * leave equal results in both elements,
+         * pairwise ops take T before S when elements load reversed */
+
+#define hrzjs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        EMITW(0xF0000257 | MXM(TmmM,    REG(XS), REG(XS)))                  \
+        EMITW(op         | MXM(REG(XD), REG(XS), TmmM))
+
+#if RT_ENDIAN == 0 && RT_ELEM_COMPAT_VMX == 0
+
+#define hrpjs_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        hrpjs_rx(W(XD), REG(XT), REG(XS), op)
+
+#define hrpjs_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmQ,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmQ,    TmmQ,    TmmQ)))                    \
+        hrpjs_rx(W(XD), TmmQ, REG(XS), op)
+
+#else  /* RT_ENDIAN == 0 && RT_ELEM_COMPAT_VMX == 0 */
+
+#define hrpjs_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        hrpjs_rx(W(XD), REG(XS), REG(XT), op)
+
+#define hrpjs_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        AUW(SIB(MT),  EMPTY,  EMPTY,    MOD(MT), VAL(DT), C2(DT), EMPTY2)   \
+        EMITW(0x00000000 | MPM(TmmQ,    MOD(MT), VAL(DT), B2(DT), P2(DT)))  \
+    SHF(EMITW(0xF0000257 | MXM(TmmQ,    TmmQ,    TmmQ)))                    \
+        hrpjs_rx(W(XD), REG(XS), TmmQ, op)
+
+#endif /* RT_ENDIAN, RT_ELEM_COMPAT_VMX */
+
+#define hrpjs_rx(XD, RS, RT, op) /* not portable, do not use outside */     \
+        EMITW(0xF0000057 | MXM(TmmM,    RS,      RT))                       \
+        EMITW(0xF0000357 | MXM(TmmQ,    RS,      RT))                       \
+        EMITW(op         | MXM(REG(XD), TmmM,    TmmQ))
+
+#undef  adpjs3rr
+#define adpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0xF0000307)
+
+#undef  adpjs3ld
+#define adpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000307)
+
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzjs_rr(W(XD), W(XS), 0xF0000307)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjs_rr(XG, XS)                                                    \
@@ -366,6 +472,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpjs3rr
+#define mlpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0xF0000387)
+
+#undef  mlpjs3ld
+#define mlpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000387)
+
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzjs_rr(W(XD), W(XS), 0xF0000387)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -438,7 +556,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmajs_rr(XG, XS, XT)                                                \
         EMITW(0xF000030F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -455,7 +573,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsjs_rr(XG, XS, XT)                                                \
         EMITW(0xF000078F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -490,6 +608,18 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpjs3rr
+#define mnpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0xF0000747)
+
+#undef  mnpjs3ld
+#define mnpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000747)
+
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzjs_rr(W(XD), W(XS), 0xF0000747)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -510,6 +640,18 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpjs3rr
+#define mxpjs3rr(XD, XS, XT)                                                \
+        hrpjs_rr(W(XD), W(XS), W(XT), 0xF0000707)
+
+#undef  mxpjs3ld
+#define mxpjs3ld(XD, XS, MT, DT)                                            \
+        hrpjs_ld(W(XD), W(XS), W(MT), W(DT), 0xF0000707)
+
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzjs_rr(W(XD), W(XS), 0xF0000707)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -1495,7 +1637,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmats_rr(XG, XS, XT)                                                \
         EMITW(0xF000010F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -1511,7 +1653,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsts_rr(XG, XS, XT)                                                \
         EMITW(0xF000058F | MXM(REG(XG), REG(XS), REG(XT)))
@@ -206,6 +206,17 @@
         EMITB(0x00 | (1 - (rxg)) << 7 | 1 << 6 | (1 - (rxm)) << 5 | (aux))  \
         EMITB(0x80 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
 
+/* 3-byte VEX prefix with VSIB index extension (W0), rxm = B | X << 1 */
+#define VGX(rxg, rxm, ren, len, pfx, aux)                                   \
+        EMITB(0xC4)                                                         \
+        EMITB(0x00 | (1 - (rxg)) << 7 | (3 - (rxm)) << 5 | (aux))           \
+        EMITB(0x00 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
+
+/* 3-byte VEX prefix with VSIB index extension (W1), rxm = B | X << 1 */
+#define VGW(rxg, rxm, ren, len, pfx, aux)                                   \
+        EMITB(0xC4)                                                         \
+        EMITB(0x00 | (1 - (rxg)) << 7 | (3 - (rxm)) << 5 | (aux))           \
+        EMITB(0x80 | (len) << 2 | (0x0F - (ren)) << 3 | (pfx))
 /* 4-byte EVEX prefix with full customization (W0, KX) */
 #define EPX(pre, mod, rxg, rxm, ren, len, pfx, aux)                         \
         EMITB(0x62)                                                         \
@@ -1992,6 +2003,26 @@
         MRM(REG(RD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* prf (prefetch cache line at adr S into cache level given by hint)
+ * set-flags: no
+ * hint: L1 - all levels, L2 - outer levels, NT - non-temporal (streaming)
+ * never faults, treated as a no-op where the hint is not supported */
+
+#define RT_BASE_HINT_L1     0x01    /* prefetcht0 */
+#define RT_BASE_HINT_L2     0x02    /* prefetcht1 */
+#define RT_BASE_HINT_NT     0x00    /* prefetchnta */
+
+#define prfxx_ld(MS, DS, hint)                                              \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x18)                       \
+        MRM(RT_BASE_HINT_##hint, MOD(MS), REG(MS))                          \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* fence (orders preceding non-temporal stores before subsequent stores)
+ * set-flags: no */
+
+#define fence_xx()                                                          \
+        EMITB(0x0F) EMITB(0xAE) EMITB(0xF8)   /* sfence */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -2030,6 +2061,8 @@
 
 #endif /* defined (RT_X32, RT_X64) */
 
+#if RT_CODE_GEN == 0
+
 #define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
         ASM_BEG ASM_OP1(jmp, lb) ASM_END
 
@@ -2072,6 +2105,65 @@
 #define LBL(lb)                                          /* code label */   \
         ASM_BEG ASM_OP0(lb:) ASM_END
 
+#else /* RT_CODE_GEN */
+
+#define jmpxx_lb(lb)              /* label-targeted unconditional jump */   \
+        EMITB(0xE9)                                                         \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jezxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITB(0x0F) EMITB(0x84)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jnzxx_lb(lb)               /* setting-flags-arithmetic -> jump */   \
+        EMITB(0x0F) EMITB(0x85)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jeqxx_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x84)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jnexx_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x85)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jltxx_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x82)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jlexx_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x86)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jgtxx_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x87)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jgexx_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x83)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jltxn_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x8C)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jlexn_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x8E)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jgtxn_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x8F)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define jgexn_lb(lb)                                /* compare -> jump */   \
+        EMITB(0x0F) EMITB(0x8D)                                             \
+        EMITR(lb, RT_CODE_REL08) EMITW(0x00000000)
+
+#define LBL(lb)                                          /* code label */   \
+        EMITL(lb)
+
+#endif /* RT_CODE_GEN */
+
 /************************* register-size instructions *************************/
 
 /* stack (push stack = S, D = pop stack)
@@ -207,6 +207,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 0, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 0, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movix_nt
+#define movix_nt(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 0, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -362,6 +385,25 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+        /* shf (vpermilps) keeps horizontal reductions in registers
+         * using Tmm1 (saved in sregs_sk) as temp, log-step reductions
+         * leave bitwise equal results in all elements */
+
+#define shfix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        shfix_rr(Tmm1, W(XS), IB(0xB1))                                     \
+        op##3rr(W(XD), W(XS), Tmm1)                                         \
+        shfix_rr(Tmm1, W(XD), IB(0x4E))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzis_rr(W(XD), W(XS), addis)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -399,6 +441,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzis_rr(W(XD), W(XS), mulis)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -493,7 +539,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB8)                 \
@@ -510,7 +556,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBC)                 \
@@ -545,6 +591,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), minis)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -565,6 +615,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), maxis)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1066,6 +1120,144 @@
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem with variable divisor convert each half of the elements to fp64
+ * (vcvtdq2pd, vcvtudq2pd), where all 32-bit integer quotients are exact,
+ * instead of per-element BASE division loops, fp64 divisor half is kept
+ * in inf_SCR03; div by zero and signed INT_MIN/-1 don't trap: signed
+ * quotient is then 0x80000000 (integer indefinite), unsigned quotient is
+ * 0xFFFFFFFF, rem by zero returns the dividend */
+
+#undef  divix3rr
+#define divix3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvuix_rx(W(XD))
+
+#undef  divix3ld
+#define divix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvuix_rx(W(XD))
+
+#undef  divin3rr
+#define divin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvnix_rx(W(XD))
+
+#undef  divin3ld
+#define divin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvnix_rx(W(XD))
+
+#undef  remix3rr
+#define remix3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmuix_rx(W(XD))
+
+#undef  remix3ld
+#define remix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmuix_rx(W(XD))
+
+#undef  remin3rr
+#define remin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmnix_rx(W(XD))
+
+#undef  remin3ld
+#define remin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmnix_rx(W(XD))
+
+/* dvu, dvn (D = inf_SCR01 / inf_SCR02), rmu, rmn (D = inf_SCR01 % inf_SCR02)
+ * take halves through dvfjx_rx/rmfjx_rx, the quotient goes to inf_SCR01,
+ * the product of truncated quotient and divisor goes to inf_SCR02 */
+
+#define dvuix_rx(XD) /* not portable, do not use outside */                 \
+        dvfjx_rx(W(XD), cvuij, cvuji, 0x00)                                 \
+        dvfjx_rx(W(XD), cvuij, cvuji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define dvnix_rx(XD) /* not portable, do not use outside */                 \
+        dvfjx_rx(W(XD), cvnij, cvnji, 0x00)                                 \
+        dvfjx_rx(W(XD), cvnij, cvnji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define rmuix_rx(XD) /* not portable, do not use outside */                 \
+        rmfjx_rx(W(XD), cvuij, cvuji, 0x00)                                 \
+        rmfjx_rx(W(XD), cvuij, cvuji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rmnix_rx(XD) /* not portable, do not use outside */                 \
+        rmfjx_rx(W(XD), cvnij, cvnji, 0x00)                                 \
+        rmfjx_rx(W(XD), cvnij, cvnji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* dvf, rmf (one half at offset nx), cv, ct select signed or unsigned
+ * conversions to and from fp64 */
+
+#define dvfjx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movix_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divjs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhix_st(W(XD), Mebp, inf_SCR01(nx))
+
+#define rmfjx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movix_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divjs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        cv##_rr(W(XD), W(XD))                                               \
+        muljs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhix_st(W(XD), Mebp, inf_SCR02(nx))
+
+#define cvnij_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvnij_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 0, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvnji_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuij_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 2, 1) EMITB(0x7A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuij_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 0, 2, 1) EMITB(0x7A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvuji_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 0, 1) EMITB(0x78)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mvhix_st(XS, MD, DD) /* not portable, do not use outside */         \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0xD6)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1593,7 +1785,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB9)                 \
@@ -1610,7 +1802,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBD)                 \
@@ -188,6 +188,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+    ADR REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movix_nt
+#define movix_nt(XS, MD, DD)                                                \
+    ADR REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -224,6 +247,56 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         orrix_rr(Xmm0, W(XS))                                               \
         movix_st(Xmm0, W(MG), W(DG))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfix_ri
+#define shfix_ri(XD, XS, IT)                                                \
+        shfix_rr(W(XD), W(XS), W(IT))
+
+#undef  zipix_rr
+#define zipix_rr(XG, XS)     /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XS), W(XG))                                              \
+        unhix_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        unlix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  uzpix_rr
+#define uzpix_rr(XG, XS)     /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_rr(W(XS), W(XG))                                              \
+        shpis_ld(W(XS), Mebp, inf_SCR01(0), IB(0xDD))                       \
+        shpis_ld(W(XG), Mebp, inf_SCR01(0), IB(0x88))
+
+#undef  bcxix_ri
+#define bcxix_ri(XD, XS, IT)                                                \
+        shfix_rr(W(XD), W(XS), IB(((VAL(IT))&3)*0x55))
+
+#undef  rotix_ri
+#define rotix_ri(XD, XS, IT)                                                \
+        shfix_rr(W(XD), W(XS), IB(((0xE4 >> (((VAL(IT))&3)*2)) |            \
+                                  ((0xE4 << (8-((VAL(IT))&3)*2)) & 0xFF))))
+
+#define unlix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unhix_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movix_bc
+#define movix_bc(XD, MS, DS)                                                \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        shfix_rr(W(XD), W(XD), IB(0))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -360,6 +433,84 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x14)           \
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (pshufd), shp (shufps) keep horizontal ops in registers,
+         * replacing per-element scalar round-trips via scratch area,
+         * hrz walks lanes of S in Gray-code order (D = shf(D) op S),
+         * thus needs no temp-reg, if (#D == #S) S is spilled once,
+         * lane 0 is broadcast for add/mul as lanes round differently */
+
+#define shfix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfix_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define shpis_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0xC6)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzis_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzis_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0xB1))                             \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#undef  adpis3rr
+#define adpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        adpis_rx(W(XD))
+
+#undef  adpis3ld
+#define adpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        adpis_rx(W(XD))
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzis_rr(W(XD), W(XS), addis)                                       \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  adhis_ld
+#define adhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), addis)                                \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  adpis_rx
+#define adpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        addis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        addis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
+#endif /* RT_SIMD_COMPAT_SSE < 4 */
+
 #if (RT_SIMD_COMPAT_SSE >= 4)
 
 #undef  adpis_rr
@@ -426,6 +577,38 @@ ADR XF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpis3rr
+#define mlpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlpis_rx(W(XD))
+
+#undef  mlpis3ld
+#define mlpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlpis_rx(W(XD))
+
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzis_rr(W(XD), W(XS), mulis)                                       \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlhis_ld
+#define mlhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), mulis)                                \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlpis_rx
+#define mlpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        mulis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        mulis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -586,6 +769,43 @@ ADR XF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         fpuws_st(Mebp,  inf_SCR02(0x00))                                    \
         movix_ld(W(XG), Mebp, inf_SCR02(0))
 
+#elif RT_SIMD_COMPAT_FMA == 3
+
+#define fmais_rr(XG, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR04(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x00))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR04(0x00))                              \
+        fmajx_rx(W(XG), 0x00)                                               \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x08))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR04(0x08))                              \
+        fmajx_rx(W(XG), 0x08)                                               \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define fmais_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x00))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), W(MT), W(DT))                                       \
+        fmajx_rx(W(XG), 0x00)                                               \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x08))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfih_ld(W(XG), W(MT), W(DT))                                       \
+        fmajx_rx(W(XG), 0x08)                                               \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define fmajx_rx(XG, nx) /* not portable, do not use outside */             \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR01(nx))                                \
+        addjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfji_rr(W(XG), W(XG))                                              \
+        mvhix_st(W(XG), Mebp, inf_SCR01(nx))
+
 #endif /* RT_SIMD_COMPAT_FMA */
 
 /* fms (G = G - S * T) if (#G != #S && #G != #T)
@@ -672,8 +892,67 @@ ADR XF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         fpuws_st(Mebp,  inf_SCR02(0x00))                                    \
         movix_ld(W(XG), Mebp, inf_SCR02(0))
 
+#elif RT_SIMD_COMPAT_FMS == 3
+
+#define fmsis_rr(XG, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR04(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x00))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR04(0x00))                              \
+        fmsjx_rx(W(XG), 0x00)                                               \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x08))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR04(0x08))                              \
+        fmsjx_rx(W(XG), 0x08)                                               \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define fmsis_ld(XG, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x00))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), W(MT), W(DT))                                       \
+        fmsjx_rx(W(XG), 0x00)                                               \
+        cvfij_ld(W(XG), Mebp, inf_SCR03(0x08))                              \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfih_ld(W(XG), W(MT), W(DT))                                       \
+        fmsjx_rx(W(XG), 0x08)                                               \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define fmsjx_rx(XG, nx) /* not portable, do not use outside */             \
+        muljs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfij_ld(W(XG), Mebp, inf_SCR01(nx))                                \
+        subjs_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        cvfji_rr(W(XG), W(XG))                                              \
+        mvhix_st(W(XG), Mebp, inf_SCR01(nx))
+
 #endif /* RT_SIMD_COMPAT_FMS */
 
+/* RT_SIMD_COMPAT_FMA/FMS == 3 widen each half of fp32 elements to fp64,
+ * where the product is exact and only the final add/sub is rounded before
+ * narrowing back, double rounding may differ from true fma in rare cases */
+
+#define cvfij_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvfih_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS) + 0x08), EMPTY)
+
+#define cvfji_rr(XD, XS) /* not portable, do not use outside */             \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mhlix_rr(XD, XS) /* not portable, do not use outside */             \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
 /*************   packed single-precision floating-point compare   *************/
 
 /* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
@@ -698,6 +977,36 @@ ADR XF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpis3rr
+#define mnpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mnpis_rx(W(XD))
+
+#undef  mnpis3ld
+#define mnpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mnpis_rx(W(XD))
+
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), minis)
+
+#undef  mnhis_ld
+#define mnhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), minis)
+
+#undef  mnpis_rx
+#define mnpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        minis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        minis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -720,6 +1029,36 @@ ADR XF2 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x7C)                       \
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpis3rr
+#define mxpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mxpis_rx(W(XD))
+
+#undef  mxpis3ld
+#define mxpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mxpis_rx(W(XD))
+
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), maxis)
+
+#undef  mxhis_ld
+#define mxhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), maxis)
+
+#undef  mxpis_rx
+#define mxpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        maxis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        maxis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -1540,6 +1879,180 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x40)           \
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem by immediate use even/odd 32x32->64-bit pmuludq (pmuldq) products
+ * instead of per-element BASE multiply-high loops, rem needs SSE4 pmulld */
+
+#undef  divix_ri
+#define divix_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        mhiix_rx(W(XG), IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF)), EMITB(0xF4)) \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrix_ri(W(XG), IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))               \
+        addix_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrix_ri(W(XG), IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#if (RT_SIMD_COMPAT_SSE >= 4)
+
+#undef  divin_ri
+#define divin_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        mhiix_rx(W(XG), IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF)),              \
+                                          EMITB(0x38) EMITB(0x28))          \
+        addix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrin_ri(W(XG), IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrix_ri(W(XG), IB(31))                                             \
+        addix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#undef  remix_ri
+#define remix_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        divix_ri(W(XG), W(IS))                                              \
+        rmiix_rx(W(XG), W(IS))
+
+#undef  remin_ri
+#define remin_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        divin_ri(W(XG), W(IS))                                              \
+        rmiix_rx(W(XG), W(IS))
+
+#define rmiix_rx(XG, IS) /* not portable, do not use outside */             \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x04), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x0C), W(IS))                             \
+        mulix_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD_COMPAT_SSE >= 4 */
+
+/* mhi (G = mulhi(G, IS)) keeps G in inf_SCR01, clobbers inf_SCR02,
+ * odd elements are multiplied first (pshufd), even ones are or-ed in */
+
+#define mhiix_rx(XG, IS, op) /* not portable, do not use outside */         \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), W(IS))                             \
+        shfix_ld(W(XG), Mebp, inf_SCR01(0), IB(0xF5))                       \
+        mhiix_ld(W(XG), Mebp, inf_SCR02(0), op)                             \
+        shrjx_ri(W(XG), IB(32))                                             \
+        shljx_ri(W(XG), IB(32))                                             \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), W(IS))                             \
+        movix_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        mhiix_ld(W(XG), Mebp, inf_SCR02(0), op)                             \
+        shrjx_ri(W(XG), IB(32))                                             \
+        movwx_mi(Mebp,  inf_SCR02(0x00), IB(0))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), IB(0))                             \
+        orrix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define mhiix_ld(XG, MS, DS, op) /* not portable, do not use outside */     \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) op                                \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* div, rem (signed) with variable divisor convert each half of the elements
+ * to fp64 (cvtdq2pd), where all 32-bit integer quotients are exact, instead
+ * of per-element BASE division loops, unsigned forms are left in rtbase.h;
+ * div by zero and INT_MIN/-1 don't trap: quotient is then 0x80000000
+ * (integer indefinite), rem by zero returns the dividend */
+
+#undef  divin3rr
+#define divin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvnix_rx(W(XD))                                                     \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  divin3ld
+#define divin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvnix_rx(W(XD))                                                     \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  remin3rr
+#define remin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmnix_rx(W(XD))                                                     \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#undef  remin3ld
+#define remin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmnix_rx(W(XD))                                                     \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* dvn (inf_SCR01 = inf_SCR01 / inf_SCR02), clobbers inf_SCR02,
+ * the upper half of the divisor waits in Reax while the lower half
+ * is expanded to fp64 in its place (divpd needs an aligned operand) */
+
+#define dvnix_rx(XD) /* not portable, do not use outside */                 \
+        stack_st(Reax)                                                      \
+        movzx_ld(Reax,  Mebp, inf_SCR02(0x08))                              \
+        dvnjx_rx(W(XD), 0x00)                                               \
+        movzx_st(Reax,  Mebp, inf_SCR02(0x08))                              \
+        dvnjx_rx(W(XD), 0x08)                                               \
+        stack_ld(Reax)
+
+#define dvnjx_rx(XD, nx) /* not portable, do not use outside */             \
+        cvnij_ld(W(XD), Mebp, inf_SCR02(nx))                                \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvnij_ld(W(XD), Mebp, inf_SCR01(nx))                                \
+        divjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvnji_rr(W(XD), W(XD))                                              \
+        mvhix_st(W(XD), Mebp, inf_SCR01(nx))
+
+/* rmn (inf_SCR02 = inf_SCR01 / inf_SCR02 * inf_SCR02) keeps inf_SCR01,
+ * quotient is truncated and multiplied back in fp64, where it's exact */
+
+#define rmnix_rx(XD) /* not portable, do not use outside */                 \
+        stack_st(Reax)                                                      \
+        movzx_ld(Reax,  Mebp, inf_SCR02(0x08))                              \
+        rmnjx_rx(W(XD), 0x00)                                               \
+        mvhix_st(W(XD), Mebp, inf_SCR02(0x00))                              \
+        movzx_st(Reax,  Mebp, inf_SCR02(0x08))                              \
+        movzx_ld(Reax,  Mebp, inf_SCR02(0x00))                              \
+        rmnjx_rx(W(XD), 0x08)                                               \
+        mvhix_st(W(XD), Mebp, inf_SCR02(0x08))                              \
+        movzx_st(Reax,  Mebp, inf_SCR02(0x00))                              \
+        stack_ld(Reax)
+
+#define rmnjx_rx(XD, nx) /* not portable, do not use outside */             \
+        cvnij_ld(W(XD), Mebp, inf_SCR02(nx))                                \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvnij_ld(W(XD), Mebp, inf_SCR01(nx))                                \
+        divjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvnji_rr(W(XD), W(XD))                                              \
+        cvnij_rr(W(XD), W(XD))                                              \
+        muljs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvnji_rr(W(XD), W(XD))
+
+#define cvnij_rr(XD, XS) /* not portable, do not use outside */             \
+    XF3 REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0xE6)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvnij_ld(XD, MS, DS) /* not portable, do not use outside */         \
+ADR XF3 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0xE6)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvnji_rr(XD, XS) /* not portable, do not use outside */             \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0xE6)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mvhix_st(XS, MD, DD) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0xD6)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -2418,7 +2931,7 @@ ADR XF3 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         addrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -2492,7 +3005,7 @@ ADR XF3 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         subrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -2754,7 +3267,7 @@ ADR XF3 REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0xC2)                       \
 #if RT_SIMD_FAST_FCTRL == 0
 
 #define FCTRL_SET(mode)   /* sets given mode into fp control register */    \
-        movwx_mi(Mebp, inf_SCR02(4), IH(RT_SIMD_MODE_##mode << 13 | 0x1F80))\
+        movwx_mi(Mebp, inf_SCR02(4), IH(RT_SIMD_MODE_##mode << 13 | 0x1F80)) \
         mxcsr_ld(Mebp, inf_SCR02(4))
 
 #define FCTRL_RESET()     /* resumes default mode (ROUNDN) upon leave */    \
@@ -194,6 +194,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movix_nt
+#define movix_nt(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -212,6 +235,14 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movix_bc
+#define movix_bc(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 1, 2) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andix_rr(XG, XS)                                                    \
@@ -347,6 +378,49 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+        /* shf (vpermilps) keeps horizontal ops in registers, replacing
+         * per-element scalar round-trips via scratch area, adh reduces
+         * with adp (vhaddps) twice leaving the sum in all elements,
+         * hrz walks lanes of S in Gray-code order (D = shf(D) op S),
+         * thus needs no temp-reg, if (#D == #S) S is spilled once,
+         * lane 0 is broadcast for mul as lanes round differently */
+
+#define shfix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfix_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzis_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzis_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0xB1))                             \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        adpis3rr(W(XD), W(XS), W(XS))                                       \
+        adpis3rr(W(XD), W(XD), W(XD))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -384,6 +458,16 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzis_rr(W(XD), W(XS), mulis)                                       \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlhis_ld
+#define mlhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), mulis)                                \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -478,7 +562,7 @@
         addis_rr(W(XG), W(XS))                                              \
         movix_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -522,7 +606,7 @@
         subis_rr(W(XG), W(XS))                                              \
         movix_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -554,7 +638,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         VEX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB8)                 \
@@ -571,7 +655,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         VEX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBC)                 \
@@ -608,6 +692,14 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), minis)
+
+#undef  mnhis_ld
+#define mnhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), minis)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -628,6 +720,14 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), maxis)
+
+#undef  mxhis_ld
+#define mxhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), maxis)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -950,6 +1050,26 @@
         movix_ld(W(XD), W(MS), W(DS))                                       \
         cvtix_rr(W(XD), W(XD))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section,
+ * F16C is assumed to come along with FMA3 or AVX2 (not with AVX1) */
+
+#if (RT_128X1 >= 16)
+
+#undef  cvhis_ld
+#define cvhis_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cvhis_st
+#define cvhis_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x00))
+
+#endif /* RT_128X1 >= 16, FMA3 or AVX2 */
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -1180,6 +1300,161 @@
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem with variable divisor convert each half of the elements to fp64
+ * (vcvtdq2pd), where all 32-bit integer quotients are exact, instead of
+ * per-element BASE division loops, fp64 divisor half is kept in inf_SCR03,
+ * unsigned forms are biased by 0x80000000 with fp64 -2^31 in inf_SCR04;
+ * div by zero and signed INT_MIN/-1 don't trap: signed quotient is then
+ * 0x80000000 (integer indefinite), unsigned quotient is 0,
+ * rem by zero returns the dividend */
+
+#undef  divix3rr
+#define divix3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvuix_rx(W(XD))
+
+#undef  divix3ld
+#define divix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvuix_rx(W(XD))
+
+#undef  divin3rr
+#define divin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvnix_rx(W(XD))
+
+#undef  divin3ld
+#define divin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvnix_rx(W(XD))
+
+#undef  remix3rr
+#define remix3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmuix_rx(W(XD))
+
+#undef  remix3ld
+#define remix3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmuix_rx(W(XD))
+
+#undef  remin3rr
+#define remin3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmnix_rx(W(XD))
+
+#undef  remin3ld
+#define remin3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmnix_rx(W(XD))
+
+/* dvu, dvn (D = inf_SCR01 / inf_SCR02), rmu, rmn (D = inf_SCR01 % inf_SCR02)
+ * take halves through dvfjx_rx/rmfjx_rx, the quotient goes to inf_SCR01,
+ * the product of truncated quotient and divisor goes to inf_SCR02 */
+
+#define dvuix_rx(XD) /* not portable, do not use outside */                 \
+        bsuix_rx(W(XD))                                                     \
+        dvfjx_rx(W(XD), cvuij, cvuji, 0x00)                                 \
+        dvfjx_rx(W(XD), cvuij, cvuji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorix_ld(W(XD), Mebp, inf_GPC06_32)
+
+#define dvnix_rx(XD) /* not portable, do not use outside */                 \
+        dvfjx_rx(W(XD), cvnij, cvnji, 0x00)                                 \
+        dvfjx_rx(W(XD), cvnij, cvnji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define rmuix_rx(XD) /* not portable, do not use outside */                 \
+        bsuix_rx(W(XD))                                                     \
+        rmfjx_rx(W(XD), cvuij, cvuji, 0x00)                                 \
+        rmfjx_rx(W(XD), cvuij, cvuji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rmnix_rx(XD) /* not portable, do not use outside */                 \
+        rmfjx_rx(W(XD), cvnij, cvnji, 0x00)                                 \
+        rmfjx_rx(W(XD), cvnij, cvnji, 0x08)                                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subix_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* dvf, rmf (one half at offset nx), cv, ct select signed or unsigned
+ * conversions to and from fp64, biased ones (cvuij, cvuji) cancel out
+ * in the difference of inf_SCR01 and inf_SCR02 */
+
+#define dvfjx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movix_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divjs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhix_st(W(XD), Mebp, inf_SCR01(nx))
+
+#define rmfjx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movix_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divjs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        cv##_rr(W(XD), W(XD))                                               \
+        muljs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhix_st(W(XD), Mebp, inf_SCR02(nx))
+
+/* bsu (inf_SCR01, inf_SCR02 ^= 0x80000000), sets inf_SCR04 to fp64 -2^31 */
+
+#define bsuix_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorix_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movix_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorix_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvnij_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movix_st(W(XD), Mebp, inf_SCR04(0))
+
+#define cvuij_rr(XD, XS) /* not portable, do not use outside */             \
+        cvnij_rr(W(XD), W(XS))                                              \
+        subjs_ld(W(XD), Mebp, inf_SCR04(0))
+
+#define cvuij_ld(XD, MS, DS) /* not portable, do not use outside */         \
+        cvnij_ld(W(XD), W(MS), W(DS))                                       \
+        subjs_ld(W(XD), Mebp, inf_SCR04(0))
+
+#define cvuji_rr(XD, XS) /* not portable, do not use outside */             \
+        rnzjs_rr(W(XD), W(XS))                                              \
+        addjs_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        cvnji_rr(W(XD), W(XD))
+
+#define cvnij_rr(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvnij_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvnji_rr(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mvhix_st(XS, MD, DD) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0xD6)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1789,7 +2064,7 @@
         addrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -1863,7 +2138,7 @@
         subrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -1925,7 +2200,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         VEX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB9)                 \
@@ -1942,7 +2217,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         VEX(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBD)                 \
@@ -171,6 +171,38 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvcx_ld
+#define muvcx_ld(XD, MS, DS)                                                \
+    ADR REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#undef  muvcx_st
+#define muvcx_st(XS, MD, DD)                                                \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movcx_nt
+#define movcx_nt(XS, MD, DD)                                                \
+    ADR REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -384,6 +416,34 @@
 
 #endif /* RT_SIMD_COMPAT_SSE < 4 */
 
+        /* hrz reduces both halves of S into the 1st half of D, which then
+         * goes log-step with shuffles (pshufd) into the 2nd half of D,
+         * thus needs no temp-reg and no scratch area even if (#D == #S),
+         * leaves bitwise equal results in all elements of both halves,
+         * op is the opcode of the respective packed instruction */
+
+#define hrzcs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(op)                         \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(1,             0) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xB1))                                  \
+        REX(0,             1) EMITB(0x0F) EMITB(op)                         \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    ESC REX(1,             0) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x4E))                                  \
+        REX(0,             1) EMITB(0x0F) EMITB(op)                         \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(1,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzcs_rr(W(XD), W(XS), 0x58)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -435,6 +495,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzcs_rr(W(XD), W(XS), 0x59)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -543,7 +607,7 @@
         addcs_rr(W(XG), W(XS))                                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -645,7 +709,7 @@
         subcs_rr(W(XG), W(XS))                                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -758,6 +822,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzcs_rr(W(XD), W(XS), 0x5D)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -785,6 +853,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzcs_rr(W(XD), W(XS), 0x5F)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -163,6 +163,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvcx_ld
+#define muvcx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvcx_st
+#define muvcx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movcx_nt
+#define movcx_nt(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -181,6 +204,125 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#if (RT_256X1 >= 2) && (RT_SIMD == 256)
+
+/* gat (D = [S + T*4]), MS takes plain M*** modes, sca stays generic on AVX2
+ * vpcmpeqd sets all-ones mask in a temp reg distinct from D and T,
+ * which gets consumed by the instruction, then restored from scratch */
+
+#undef  gatox_ld
+#define gatox_ld(XD, MS, XT) /* indexed load, T holds 32-bit indices */     \
+        ASM_IFEQ(REN(XD), 0x00)                                             \
+        ASM_IFEQ(REN(XT), 0x01)                                             \
+        gtcxx_rx(W(XD), W(MS), W(XT), Xmm2)                                 \
+        ASM_ELSE                                                            \
+        gtcxx_rx(W(XD), W(MS), W(XT), Xmm1)                                 \
+        ASM_ENDI                                                            \
+        ASM_ELSE                                                            \
+        ASM_IFEQ(REN(XT), 0x00)                                             \
+        ASM_IFEQ(REN(XD), 0x01)                                             \
+        gtcxx_rx(W(XD), W(MS), W(XT), Xmm2)                                 \
+        ASM_ELSE                                                            \
+        gtcxx_rx(W(XD), W(MS), W(XT), Xmm1)                                 \
+        ASM_ENDI                                                            \
+        ASM_ELSE                                                            \
+        gtcxx_rx(W(XD), W(MS), W(XT), Xmm0)                                 \
+        ASM_ENDI                                                            \
+        ASM_ENDI
+
+#define gtcxx_rx(XD, MS, XT, XM) /* not portable, do not use outside */     \
+        movcx_st(W(XM), Mebp, inf_SCR01(0))                                 \
+        VEX(RXB(XM), RXB(XM), REN(XM), 1, 1, 1) EMITB(0x76)                 \
+        MRM(REG(XM), MOD(XM), REG(XM))                                      \
+    ADR VGX(RXB(XD), R1B(MS)|R1B(XT)<<1, REN(XM), 1, 1, 2) EMITB(0x92)      \
+        MRM(REG(XD),    0x01,    0x04)                                      \
+        EMITB(0x2<<6|REG(XT)<<3|REG(MS)) /* <- VSIB */                      \
+        EMITB(0x00)                                                         \
+        movcx_ld(W(XM), Mebp, inf_SCR01(0))
+
+#endif /* RT_256X1 >= 2, RT_SIMD: 256 */
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfcx_ri
+#define shfcx_ri(XD, XS, IT)                                                \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#undef  zipcx_rr
+#define zipcx_rr(XG, XS)     /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        VEX(RXB(XS), RXB(XS), REN(XG), 1, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XS), MOD(XS), REG(XS))                                      \
+        unlcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  uzpcx_rr
+#define uzpcx_rr(XG, XS)     /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        VEX(RXB(XS), RXB(XS), REN(XG), 1, 0, 1) EMITB(0xC6)                 \
+        MRM(REG(XS), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xDD))                                  \
+        shpcx_ld(W(XG), Mebp, inf_SCR01(0), IB(0x88))
+
+#undef  bcxcx_ri
+#define bcxcx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        bcscx_ld(W(XD), Mebp, inf_SCR01(((VAL(IT))&7)*4))
+
+#define unlcx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define shpcx_ld(XG, MS, DS, IT) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 0, 1) EMITB(0xC6)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define bcscx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#if (RT_256X1 >= 2)
+
+#undef  rotcx_ri
+#define rotcx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        rtqcx_rx(W(XD), W(XS), ((VAL(IT))&7)>>1)                            \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        rtqcx_rx(W(XD), W(XD), 2)                                           \
+        alrcx_ld(W(XD), Mebp, inf_SCR01(0), ((VAL(IT))&1)*4)
+
+/* rotate 64-bit elements of S down by it (vpermq), then for odd T
+ * align the 128-bit quads of two such rotations by one element (vpalignr) */
+
+#define rtqcx_rx(XD, XS, it) /* not portable, do not use outside */         \
+        VEW(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x00)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((((it)+0)&3)    | (((it)+1)&3)<<2 |     \
+                                   (((it)+2)&3)<<4 | (((it)+3)&3)<<6))
+
+#define alrcx_ld(XG, MS, DS, it) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 3) EMITB(0x0F)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(it))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movcx_bc
+#define movcx_bc(XD, MS, DS)                                                \
+        bcscx_ld(W(XD), W(MS), W(DS))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -305,6 +447,84 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (vpermilps/pd), prm (vperm2f128) keep horizontal ops
+         * in registers, replacing scalar round-trips via scratch area,
+         * hrz walks lanes of S in Gray-code order (D = shf(D) op S),
+         * thus needs no temp-reg, if (#D == #S) S is spilled once,
+         * lane 0 is broadcast for mul as lanes round differently,
+         * add swaps halves of S first and then uses had (vhaddps) */
+
+#define shfcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfcx_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define hadcs_rr(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 3, 1) EMITB(0x7C)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define hrzcs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzcs_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfcx_rr(W(XD), W(XS), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfcx_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        prmcx_rr(W(XD), W(XD), IB(0x01))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfcx_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfcx_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzcs_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfcx_ld(W(XD), W(MS), W(DS), IB(0xB1))                             \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfcx_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        prmcx_rr(W(XD), W(XD), IB(0x01))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfcx_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfcx_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        adhcs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        ASM_ELSE                                                            \
+        prmcx_rr(W(XD), W(XS), IB(0x23))                                    \
+        addcs_rr(W(XD), W(XS))                                              \
+        hadcs_rr(W(XD), W(XD))                                              \
+        hadcs_rr(W(XD), W(XD))                                              \
+        ASM_ENDI
+
+#undef  adhcs_ld
+#define adhcs_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))                                       \
+        prmcx_rr(W(XD), W(XD), IB(0x01))                                    \
+        addcs_ld(W(XD), W(MS), W(DS))                                       \
+        hadcs_rr(W(XD), W(XD))                                              \
+        hadcs_rr(W(XD), W(XD))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -342,6 +562,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzcs_rr(W(XD), W(XS), mulcs)                                       \
+        shfcx_rr(W(XD), W(XD), IB(0x00))                                    \
+        prmcx_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlhcs_ld
+#define mlhcs_ld(XD, MS, DS)                                                \
+        hrzcs_ld(W(XD), W(MS), W(DS), mulcs)                                \
+        shfcx_rr(W(XD), W(XD), IB(0x00))                                    \
+        prmcx_rr(W(XD), W(XD), IB(0x00))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -416,13 +648,13 @@
         /* rse, rss, rsq are defined in rtconf.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
-#if (RT_256X1 < 2) && !(RT_SIMD == 128 && RT_128X1 == 16)
-
 #define prmcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
         VEX(RXB(XD), RXB(XS), REN(XD), 1, 1, 3) EMITB(0x06)                 \
         MRM(REG(XD), MOD(XS), REG(XS))                                      \
         AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
 
+#if (RT_256X1 < 2) && !(RT_SIMD == 128 && RT_128X1 == 16)
+
 #define cvycs_rr(XD, XS)     /* not portable, do not use outside */         \
         VEX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
         MRM(REG(XD), MOD(XS), REG(XS))
@@ -454,7 +686,7 @@
         addcs_rr(W(XG), W(XS))                                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #define fmacs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -519,7 +751,7 @@
         subcs_rr(W(XG), W(XS))                                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #define fmscs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -572,7 +804,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmacs_rr(XG, XS, XT)                                                \
         VEX(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xB8)                 \
@@ -589,7 +821,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmscs_rr(XG, XS, XT)                                                \
         VEX(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xBC)                 \
@@ -626,6 +858,14 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzcs_rr(W(XD), W(XS), mincs)
+
+#undef  mnhcs_ld
+#define mnhcs_ld(XD, MS, DS)                                                \
+        hrzcs_ld(W(XD), W(MS), W(DS), mincs)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -646,6 +886,14 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzcs_rr(W(XD), W(XS), maxcs)
+
+#undef  mxhcs_ld
+#define mxhcs_ld(XD, MS, DS)                                                \
+        hrzcs_ld(W(XD), W(MS), W(DS), maxcs)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -984,6 +1232,26 @@
         movcx_ld(W(XD), W(MS), W(DS))                                       \
         cvtcx_rr(W(XD), W(XD))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section,
+ * F16C is assumed to come along with AVX2 (not with AVX1) */
+
+#if (RT_256X1 >= 2)
+
+#undef  cvhcs_ld
+#define cvhcs_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cvhcs_st
+#define cvhcs_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x00))
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -1541,6 +1809,90 @@
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem by immediate use even/odd 32x32->64-bit vpmuludq (vpmuldq)
+ * products instead of per-element BASE multiply-high loops */
+
+#undef  divcx_ri
+#define divcx_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        mhicx_rx(W(XG), IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF)), mhucx_ld)    \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        subcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrcx_ri(W(XG), IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))               \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrcx_ri(W(XG), IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#undef  divcn_ri
+#define divcn_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        mhicx_rx(W(XG), IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF)), mhncx_ld)    \
+        addcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        shrcn_ri(W(XG), IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrcx_ri(W(XG), IB(31))                                             \
+        addcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#undef  remcx_ri
+#define remcx_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        divcx_ri(W(XG), W(IS))                                              \
+        rmicx_rx(W(XG), W(IS))
+
+#undef  remcn_ri
+#define remcn_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        divcn_ri(W(XG), W(IS))                                              \
+        rmicx_rx(W(XG), W(IS))
+
+#define rmicx_rx(XG, IS) /* not portable, do not use outside */             \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x04), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x0C), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x10), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x14), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x18), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x1C), W(IS))                             \
+        mulcx_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        subcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+/* mhi (G = mulhi(G, IS)) keeps G in inf_SCR01, clobbers inf_SCR02,
+ * odd elements are multiplied first, even ones are or-ed in,
+ * multiply takes only the lower half of each 64-bit element */
+
+#define mhicx_rx(XG, IS, op) /* not portable, do not use outside */         \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x10), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x18), W(IS))                             \
+        shrdx_ri(W(XG), IB(32))                                             \
+        op(W(XG), Mebp, inf_SCR02(0))                                       \
+        shrdx_ri(W(XG), IB(32))                                             \
+        shldx_ri(W(XG), IB(32))                                             \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x10), W(IS))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x18), W(IS))                             \
+        movcx_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        op(W(XG), Mebp, inf_SCR02(0))                                       \
+        shrdx_ri(W(XG), IB(32))                                             \
+        movwx_mi(Mebp,  inf_SCR02(0x00), IB(0))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x08), IB(0))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x10), IB(0))                             \
+        movwx_mi(Mebp,  inf_SCR02(0x18), IB(0))                             \
+        orrcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define mhucx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 1) EMITB(0xF4)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mhncx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 2) EMITB(0x28)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1654,6 +2006,161 @@
 
 #endif /* RT_256X1 >= 2, AVX2 */
 
+/* div, rem with variable divisor convert each half of the elements to fp64
+ * (vcvtdq2pd), where all 32-bit integer quotients are exact, instead of
+ * per-element BASE division loops, fp64 divisor half is kept in inf_SCR03,
+ * unsigned forms are biased by 0x80000000 with fp64 -2^31 in inf_SCR04;
+ * div by zero and signed INT_MIN/-1 don't trap: signed quotient is then
+ * 0x80000000 (integer indefinite), unsigned quotient is 0,
+ * rem by zero returns the dividend */
+
+#undef  divcx3rr
+#define divcx3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvucx_rx(W(XD))
+
+#undef  divcx3ld
+#define divcx3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvucx_rx(W(XD))
+
+#undef  divcn3rr
+#define divcn3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvncx_rx(W(XD))
+
+#undef  divcn3ld
+#define divcn3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvncx_rx(W(XD))
+
+#undef  remcx3rr
+#define remcx3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmucx_rx(W(XD))
+
+#undef  remcx3ld
+#define remcx3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmucx_rx(W(XD))
+
+#undef  remcn3rr
+#define remcn3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmncx_rx(W(XD))
+
+#undef  remcn3ld
+#define remcn3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmncx_rx(W(XD))
+
+/* dvu, dvn (D = inf_SCR01 / inf_SCR02), rmu, rmn (D = inf_SCR01 % inf_SCR02)
+ * take halves through dvfdx_rx/rmfdx_rx, the quotient goes to inf_SCR01,
+ * the product of truncated quotient and divisor goes to inf_SCR02 */
+
+#define dvucx_rx(XD) /* not portable, do not use outside */                 \
+        bsucx_rx(W(XD))                                                     \
+        dvfdx_rx(W(XD), cvucd, cvudc, 0x00)                                 \
+        dvfdx_rx(W(XD), cvucd, cvudc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorcx_ld(W(XD), Mebp, inf_GPC06_32)
+
+#define dvncx_rx(XD) /* not portable, do not use outside */                 \
+        dvfdx_rx(W(XD), cvncd, cvndc, 0x00)                                 \
+        dvfdx_rx(W(XD), cvncd, cvndc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define rmucx_rx(XD) /* not portable, do not use outside */                 \
+        bsucx_rx(W(XD))                                                     \
+        rmfdx_rx(W(XD), cvucd, cvudc, 0x00)                                 \
+        rmfdx_rx(W(XD), cvucd, cvudc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rmncx_rx(XD) /* not portable, do not use outside */                 \
+        rmfdx_rx(W(XD), cvncd, cvndc, 0x00)                                 \
+        rmfdx_rx(W(XD), cvncd, cvndc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* dvf, rmf (one half at offset nx), cv, ct select signed or unsigned
+ * conversions to and from fp64, biased ones (cvucd, cvudc) cancel out
+ * in the difference of inf_SCR01 and inf_SCR02 */
+
+#define dvfdx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divds_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhcx_st(W(XD), Mebp, inf_SCR01(nx))
+
+#define rmfdx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divds_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        cv##_rr(W(XD), W(XD))                                               \
+        mulds_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhcx_st(W(XD), Mebp, inf_SCR02(nx))
+
+/* bsu (inf_SCR01, inf_SCR02 ^= 0x80000000), sets inf_SCR04 to fp64 -2^31 */
+
+#define bsucx_rx(XD) /* not portable, do not use outside */                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        xorcx_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        xorcx_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvncd_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        movcx_st(W(XD), Mebp, inf_SCR04(0))
+
+#define cvucd_rr(XD, XS) /* not portable, do not use outside */             \
+        cvncd_rr(W(XD), W(XS))                                              \
+        subds_ld(W(XD), Mebp, inf_SCR04(0))
+
+#define cvucd_ld(XD, MS, DS) /* not portable, do not use outside */         \
+        cvncd_ld(W(XD), W(MS), W(DS))                                       \
+        subds_ld(W(XD), Mebp, inf_SCR04(0))
+
+#define cvudc_rr(XD, XS) /* not portable, do not use outside */             \
+        rnzds_rr(W(XD), W(XS))                                              \
+        addds_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        cvndc_rr(W(XD), W(XD))
+
+#define cvncd_rr(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvncd_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvndc_rr(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mvhcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0x7F)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /****************   packed single-precision integer compare   *****************/
 
 #if (RT_256X1 < 2)
@@ -2065,24 +2572,24 @@
 
 #if   (RT_SIMD == 256)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define mrvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x28)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define mrvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
     ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x29)                 \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
 #elif (RT_SIMD == 128)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define mrvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
     ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define mrvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
     ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
@@ -2094,72 +2601,72 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_st(Xmm0, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm8, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm9, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmA, Oeax, PLAIN)                                         \
+        mrvcx_st(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmB, Oeax, PLAIN)                                         \
+        mrvcx_st(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmC, Oeax, PLAIN)                                         \
+        mrvcx_st(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmD, Oeax, PLAIN)                                         \
+        mrvcx_st(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmE, Oeax, PLAIN)                                         \
+        mrvcx_st(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(XmmF, Oeax, PLAIN)
+        mrvcx_st(XmmF, Oeax, PLAIN)
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm8, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm9, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmA, Oeax, PLAIN)                                         \
+        mrvcx_ld(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmB, Oeax, PLAIN)                                         \
+        mrvcx_ld(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmC, Oeax, PLAIN)                                         \
+        mrvcx_ld(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmD, Oeax, PLAIN)                                         \
+        mrvcx_ld(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmE, Oeax, PLAIN)                                         \
+        mrvcx_ld(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(XmmF, Oeax, PLAIN)
+        mrvcx_ld(XmmF, Oeax, PLAIN)
 
 #endif /* RT_256X1 */
 
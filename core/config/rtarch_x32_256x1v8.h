@@ -171,6 +171,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvcx_ld
+#define muvcx_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvcx_st
+#define muvcx_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movcx_nt
+#define movcx_nt(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -191,6 +214,33 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#if (RT_SIMD == 256)
+
+/* gat (D = [S + T*4]), sca ([D + T*4] = S), MS/MD take plain M*** modes
+ * kxnorw sets all-ones k1 mask, which gets consumed by the instruction */
+
+#undef  gatox_ld
+#define gatox_ld(XD, MS, XT) /* indexed load, T holds 32-bit indices */     \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKX(RXB(XD), R1B(MS)|R1B(XT)<<1, RE2(XT), 1, 1, 2) EMITB(0x92)      \
+        MRM(REG(XD),    0x01,    0x04)                                      \
+        EMITB(0x2<<6|REG(XT)<<3|REG(MS)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+#undef  scaox_st
+#define scaox_st(XS, MD, XT) /* indexed store, T holds 32-bit indices */    \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKX(RXB(XS), R1B(MD)|R1B(XT)<<1, RE2(XT), 1, 1, 2) EMITB(0xA2)      \
+        MRM(REG(XS),    0x01,    0x04)                                      \
+        EMITB(0x2<<6|REG(XT)<<3|REG(MD)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+#endif /* RT_SIMD: 256 */
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andcx_rr(XG, XS)                                                    \
@@ -315,6 +365,32 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (vpermilps), prm (vshuff32x4) keep horizontal reductions
+         * in registers using Tmm1 (saved in sregs_sk) as temp,
+         * log-step reductions leave bitwise equal results in all elements */
+
+#define shfcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define prmcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS), REN(XS), 1, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define hrzcs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        shfcx_rr(Tmm1, W(XS), IB(0xB1))                                     \
+        op##3rr(W(XD), W(XS), Tmm1)                                         \
+        shfcx_rr(Tmm1, W(XD), IB(0x4E))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)                                         \
+        prmcx_rr(Tmm1, W(XD), IB(0x01))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)
+
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzcs_rr(W(XD), W(XS), addcs)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -352,6 +428,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzcs_rr(W(XD), W(XS), mulcs)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -446,7 +526,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmacs_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xB8)                 \
@@ -463,7 +543,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmscs_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xBC)                 \
@@ -498,6 +578,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzcs_rr(W(XD), W(XS), mincs)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -518,6 +602,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzcs_rr(W(XD), W(XS), maxcs)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -831,6 +919,21 @@
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvhcs_ld
+#define cvhcs_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cvhcs_st
+#define cvhcs_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -1019,6 +1122,144 @@
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem with variable divisor convert each half of the elements to fp64
+ * (vcvtdq2pd, vcvtudq2pd), where all 32-bit integer quotients are exact,
+ * instead of per-element BASE division loops, fp64 divisor half is kept
+ * in inf_SCR03; div by zero and signed INT_MIN/-1 don't trap: signed
+ * quotient is then 0x80000000 (integer indefinite), unsigned quotient is
+ * 0xFFFFFFFF, rem by zero returns the dividend */
+
+#undef  divcx3rr
+#define divcx3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvucx_rx(W(XD))
+
+#undef  divcx3ld
+#define divcx3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvucx_rx(W(XD))
+
+#undef  divcn3rr
+#define divcn3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvncx_rx(W(XD))
+
+#undef  divcn3ld
+#define divcn3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvncx_rx(W(XD))
+
+#undef  remcx3rr
+#define remcx3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmucx_rx(W(XD))
+
+#undef  remcx3ld
+#define remcx3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmucx_rx(W(XD))
+
+#undef  remcn3rr
+#define remcn3rr(XD, XS, XT)                                                \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmncx_rx(W(XD))
+
+#undef  remcn3ld
+#define remcn3ld(XD, XS, MT, DT)                                            \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_ld(W(XD), W(MT), W(DT))                                       \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmncx_rx(W(XD))
+
+/* dvu, dvn (D = inf_SCR01 / inf_SCR02), rmu, rmn (D = inf_SCR01 % inf_SCR02)
+ * take halves through dvfdx_rx/rmfdx_rx, the quotient goes to inf_SCR01,
+ * the product of truncated quotient and divisor goes to inf_SCR02 */
+
+#define dvucx_rx(XD) /* not portable, do not use outside */                 \
+        dvfdx_rx(W(XD), cvucd, cvudc, 0x00)                                 \
+        dvfdx_rx(W(XD), cvucd, cvudc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define dvncx_rx(XD) /* not portable, do not use outside */                 \
+        dvfdx_rx(W(XD), cvncd, cvndc, 0x00)                                 \
+        dvfdx_rx(W(XD), cvncd, cvndc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))
+
+#define rmucx_rx(XD) /* not portable, do not use outside */                 \
+        rmfdx_rx(W(XD), cvucd, cvudc, 0x00)                                 \
+        rmfdx_rx(W(XD), cvucd, cvudc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rmncx_rx(XD) /* not portable, do not use outside */                 \
+        rmfdx_rx(W(XD), cvncd, cvndc, 0x00)                                 \
+        rmfdx_rx(W(XD), cvncd, cvndc, 0x10)                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        subcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/* dvf, rmf (one half at offset nx), cv, ct select signed or unsigned
+ * conversions to and from fp64 */
+
+#define dvfdx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divds_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhcx_st(W(XD), Mebp, inf_SCR01(nx))
+
+#define rmfdx_rx(XD, cv, ct, nx) /* not portable, do not use outside */     \
+        cv##_ld(W(XD), Mebp, inf_SCR02(nx))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        cv##_ld(W(XD), Mebp, inf_SCR01(nx))                                 \
+        divds_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        cv##_rr(W(XD), W(XD))                                               \
+        mulds_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ct##_rr(W(XD), W(XD))                                               \
+        mvhcx_st(W(XD), Mebp, inf_SCR02(nx))
+
+#define cvncd_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvncd_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvndc_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvucd_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 2, 1) EMITB(0x7A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvucd_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, 1, 2, 1) EMITB(0x7A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvudc_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x78)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mvhcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, 0, 2, 1) EMITB(0x7F)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -1406,80 +1647,114 @@
 
 #define RT_SIMD_WIDTH32_512     16
 
-#define muvox_ld(XD, MS, DS)                                                \
+#define Tmm1    0x1E, 0x03, EMPTY       /* zmm30, internal temp-reg */
+
+#define mrvox_ld(XD, MS, DS)                                                \
     ADR EVX(RXB(XD), RXB(MS),    0x00, 2, 0, 1) EMITB(0x10)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvox_st(XS, MD, DD)                                                \
+#define mrvox_st(XS, MD, DD)                                                \
     ADR EVX(RXB(XS), RXB(MD),    0x00, 2, 0, 1) EMITB(0x11)                 \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
 /* sregs */
 
+/* internal regs saved in ASM_ENTER_LITE/ASM_LEAVE_LITE (check rtarch.h),
+ * zmm30 (temp in horizontal ops), mask reg k1 used in compares */
+
+#undef  sregs_sk
+#undef  sregs_lk
+
+#if RT_CODE_GEN == 0 && (defined __AVX512F__)
+
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        movox_st(Tmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        sregs_kx(0x91, 0x01)
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        movox_ld(Tmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        sregs_kx(0x90, 0x01)
+
+#elif RT_CODE_GEN != 0
+
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        movox_st(Tmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        movox_ld(Tmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))
+
+#endif /* RT_CODE_GEN, __AVX512F__ */
+
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_st(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm0, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        mrvox_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm8, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm9, Oeax, PLAIN)                                         \
+        mrvox_st(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmA, Oeax, PLAIN)                                         \
+        mrvox_st(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmB, Oeax, PLAIN)                                         \
+        mrvox_st(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmC, Oeax, PLAIN)                                         \
+        mrvox_st(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmD, Oeax, PLAIN)                                         \
+        mrvox_st(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmE, Oeax, PLAIN)                                         \
+        mrvox_st(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmF, Oeax, PLAIN)                                         \
+        mrvox_st(XmmG, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmG, Oeax, PLAIN)                                         \
+        mrvox_st(XmmH, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmH, Oeax, PLAIN)                                         \
+        mrvox_st(XmmI, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmI, Oeax, PLAIN)                                         \
+        mrvox_st(XmmJ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmJ, Oeax, PLAIN)                                         \
+        mrvox_st(XmmK, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmK, Oeax, PLAIN)                                         \
+        mrvox_st(XmmL, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmL, Oeax, PLAIN)                                         \
+        mrvox_st(XmmM, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmM, Oeax, PLAIN)                                         \
+        mrvox_st(XmmN, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmN, Oeax, PLAIN)                                         \
+        mrvox_st(XmmO, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmO, Oeax, PLAIN)                                         \
+        mrvox_st(XmmP, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmP, Oeax, PLAIN)                                         \
+        mrvox_st(XmmQ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmQ, Oeax, PLAIN)                                         \
+        mrvox_st(XmmR, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmR, Oeax, PLAIN)                                         \
+        mrvox_st(XmmS, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmS, Oeax, PLAIN)                                         \
+        mrvox_st(XmmT, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmT, Oeax, PLAIN)                                         \
+        mrvox_st(Tmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -1502,65 +1777,67 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        mrvox_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm8, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm9, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmA, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmB, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmC, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmD, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmE, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmF, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmG, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmG, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmH, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmH, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmI, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmI, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmJ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmJ, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmK, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmK, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmL, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmL, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmM, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmM, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmN, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmN, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmO, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmO, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmP, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmP, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmQ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmQ, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmR, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmR, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmS, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmS, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmT, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmT, Oeax, PLAIN)                                         \
+        mrvox_ld(Tmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -171,6 +171,38 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvox_ld
+#define muvox_ld(XD, MS, DS)                                                \
+    ADR VEX(0,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MS),    0x00, 1, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VXL(DS)), EMPTY)
+
+#undef  muvox_st
+#define muvox_st(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movox_nt
+#define movox_nt(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -347,6 +379,37 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* hrz reduces both halves of S into the 1st half of D, which then
+         * goes log-step with shuffles (vperm2f128, vpermilps) into the 2nd
+         * half of D, thus needs no temp-reg and no scratch area even if
+         * (#D == #S), leaves bitwise equal results in all elements
+         * of both halves, op is the opcode of the respective instruction */
+
+#define hrzos_rr(XD, XS, op) /* not portable, do not use outside */         \
+        VEX(0,             1, REG(XS), 1, 0, 1) EMITB(op)                   \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        VEX(1,             0, REG(XD), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(0,             1, REG(XD), 1, 0, 1) EMITB(op)                   \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(1,             0,    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xB1))                                  \
+        VEX(0,             1, REG(XD), 1, 0, 1) EMITB(op)                   \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(1,             0,    0x00, 1, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x4E))                                  \
+        VEX(0,             1, REG(XD), 1, 0, 1) EMITB(op)                   \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(1,             0,    0x00, 1, 0, 1) EMITB(0x28)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  adhos_rr
+#define adhos_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzos_rr(W(XD), W(XS), 0x58)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subos_rr(XG, XS)                                                    \
@@ -394,6 +457,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhos_rr
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzos_rr(W(XD), W(XS), 0x59)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divos_rr(XG, XS)                                                    \
@@ -538,7 +605,7 @@
         addos_rr(W(XG), W(XS))                                              \
         movox_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #define fmaos_rr(XG, XS, XT)                                                \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -603,7 +670,7 @@
         subos_rr(W(XG), W(XS))                                              \
         movox_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #define fmsos_rr(XG, XS, XT)                                                \
         movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -656,7 +723,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaos_rr(XG, XS, XT)                                                \
         VEX(0,             0, REG(XS), 1, 1, 2) EMITB(0xB8)                 \
@@ -678,7 +745,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsos_rr(XG, XS, XT)                                                \
         VEX(0,             0, REG(XS), 1, 1, 2) EMITB(0xBC)                 \
@@ -725,6 +792,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhos_rr
+#define mnhos_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzos_rr(W(XD), W(XS), 0x5D)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxos_rr(XG, XS)                                                    \
@@ -750,6 +821,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhos_rr
+#define mxhos_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzos_rr(W(XD), W(XS), 0x5F)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqos_rr(XG, XS)                                                    \
@@ -1209,6 +1284,32 @@
         movox_ld(W(XD), W(MS), W(DS))                                       \
         cvtox_rr(W(XD), W(XD))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section,
+ * F16C is assumed to come along with AVX2 (not with AVX1) */
+
+#if (RT_256X2 >= 2)
+
+#undef  cvhos_ld
+#define cvhos_ld(XD, MS, DS)                                                \
+    ADR VEX(0,       RXB(MS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MS),    0x00, 1, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS) + 0x10), EMPTY)
+
+#undef  cvhos_st
+#define cvhos_st(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMITB(0x00))                           \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD) + 0x10), EMITB(0x00))
+
+#endif /* RT_256X2 >= 2, AVX2 */
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
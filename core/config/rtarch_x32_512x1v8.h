@@ -325,6 +325,58 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPX(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,0,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define minosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPX(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,0,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define minosPrr(XG, PS, XS)                                                \
+        minos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minosPld(XG, PS, MS, DS)                                            \
+        minos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minos4rr(XD, PS, XS, XT)                                            \
+        EPX(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,0,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minos4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPX(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,0,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPX(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,0,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPX(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,0,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define maxosPrr(XG, PS, XS)                                                \
+        maxos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxosPld(XG, PS, MS, DS)                                            \
+        maxos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxos4rr(XD, PS, XS, XT)                                            \
+        EPX(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,0,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxos4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPX(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,0,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqosPrr(PD, XS, XT)                                                \
@@ -476,6 +528,30 @@
         cmpwx_ri(Reax, IH(S0(mask, 32, K)))                                 \
         jeqxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlxx_rx(RS, lanes)  /* not portable, do not use outside */         \
+        REX(1,       RXB(RS)) EMITB(0x8B)                                   \
+        MRM(0x07,    MOD(RS), REG(RS))                                      \
+        movwx_ri(Reax, IB(lanes))                                           \
+        REX(1,             0) EMITB(0x3B)                                   \
+        MRM(0x07,       0x03, 0x00)                                         \
+        REX(1,             0) EMITB(0x0F) EMITB(0x4F)                       \
+        MRM(0x07,       0x03, 0x00)                                         \
+        xorwx_rr(Reax, Reax)                                                \
+        REX(1,             1) EMITB(0x85)                                   \
+        MRM(0x07,       0x03, 0x07)                                         \
+        REX(1,             0) EMITB(0x0F) EMITB(0x48)                       \
+        MRM(0x07,       0x03, 0x00)                                         \
+        notwx_rx(Reax)                                                      \
+        VEX(0,             0,    0x0F, 0, 0, 2) EMITB(0xF5)                 \
+        MRM(0x00,       0x03, 0x00)
+
+#define whlox_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        whlxx_rx(W(RS), (RT_SIMD/32))                                       \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(REG(PD),    0x03, 0x00)
+
 /* mov (D = S), predicated */
 
 #define mxvox_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -855,6 +931,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvox_ld
+#define muvox_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvox_st
+#define muvox_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movox_nt
+#define movox_nt(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -875,6 +974,110 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+        /* cmp, exp are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* cmp ([D] = active elements of S packed), exp (G = unpacked from [S])
+ * use Xmm0 implicitly as a mask register, vcompress stores only the active
+ * elements, vexpand merges them into G leaving inactive elements intact */
+
+#undef  cmpox_st
+#define cmpox_st(XS, MD, DD)                                                \
+        ck1ox_rm(Xmm0, Mebp, inf_GPC07)                                     \
+    ADR EKX(RXB(XS), RXB(MD),    0x00, K, 1, 2) EMITB(0x8A)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#undef  expox_ld
+#define expox_ld(XG, MS, DS)                                                \
+        ck1ox_rm(Xmm0, Mebp, inf_GPC07)                                     \
+    ADR EKX(RXB(XG), RXB(MS),    0x00, K, 1, 2) EMITB(0x88)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* gat (D = [S + T*4]), sca ([D + T*4] = S), MS/MD take plain M*** modes
+ * kxnorw sets all-ones k1 mask, which gets consumed by the instruction */
+
+#undef  gatox_ld
+#define gatox_ld(XD, MS, XT) /* indexed load, T holds 32-bit indices */     \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKX(RXB(XD), R1B(MS)|R1B(XT)<<1, RE2(XT), K, 1, 2) EMITB(0x92)      \
+        MRM(REG(XD),    0x01,    0x04)                                      \
+        EMITB(0x2<<6|REG(XT)<<3|REG(MS)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+#undef  scaox_st
+#define scaox_st(XS, MD, XT) /* indexed store, T holds 32-bit indices */    \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKX(RXB(XS), R1B(MD)|R1B(XT)<<1, RE2(XT), K, 1, 2) EMITB(0xA2)      \
+        MRM(REG(XS),    0x01,    0x04)                                      \
+        EMITB(0x2<<6|REG(XT)<<3|REG(MD)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfox_ri
+#define shfox_ri(XD, XS, IT)                                                \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 1) EMITB(0x70)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#undef  zipox_rr
+#define zipox_rr(XG, XS)     /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        EVX(RXB(XS), RXB(XS), REN(XG), K, 0, 1) EMITB(0x15)                 \
+        MRM(REG(XS), MOD(XS), REG(XS))                                      \
+        unlox_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  uzpox_rr
+#define uzpox_rr(XG, XS)     /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        EVX(RXB(XS), RXB(XS), REN(XG), K, 0, 1) EMITB(0xC6)                 \
+        MRM(REG(XS), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xDD))                                  \
+        shpox_ld(W(XG), Mebp, inf_SCR01(0), IB(0x88))
+
+#undef  bcxox_ri
+#define bcxox_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        bcsox_ld(W(XD), Mebp, inf_SCR01(((VAL(IT))&(RT_SIMD/32-1))*4))
+
+#undef  rotox_ri
+#define rotox_ri(XD, XS, IT)                                                \
+        EVX(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT))&(RT_SIMD/32-1)))
+
+#define unlox_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XG), RXB(MS), REN(XG), K, 0, 1) EMITB(0x14)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define shpox_ld(XG, MS, DS, IT) /* not portable, do not use outside */     \
+    ADR EVX(RXB(XG), RXB(MS), REN(XG), K, 0, 1) EMITB(0xC6)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define bcsox_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x58)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movox_bc
+#define movox_bc(XD, MS, DS)                                                \
+        bcsox_ld(W(XD), W(MS), W(DS))
+
 #if (RT_AWEX1 == 1 || RT_AWEX1 == 4)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
@@ -1091,6 +1294,96 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (vpermilps), shp (vshufps), prm (vshuff32x4) keep horizontal
+         * ops in registers using Tmm1, Tmm2 (saved in sregs_sk) as temps,
+         * log-step reductions leave bitwise equal results in all elements,
+         * pairwise ops select even/odd elements of S, T into Tmm1, Tmm2 and
+         * then restore element order across 128-bit lanes with prp */
+
+#define shfox_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x04)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shpox3rr(XD, XS, XT, IT) /* not portable, do not use outside */     \
+        EVX(RXB(XD), RXB(XT), REN(XS), K, 0, 1) EMITB(0xC6)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shpox3ld(XD, XS, MT, DT, IT) /* not portable, do not use outside */ \
+    ADR EVX(RXB(XD), RXB(MT), REN(XS), K, 0, 1) EMITB(0xC6)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(VAL(IT)))
+
+#define prmox_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVX(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x23)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define hrzox_rr(XD, XS, op) /* not portable, do not use outside */         \
+        shfox_rr(Tmm1, W(XS), IB(0xB1))                                     \
+        op##3rr(W(XD), W(XS), Tmm1)                                         \
+        shfox_rr(Tmm1, W(XD), IB(0x4E))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)                                         \
+        hrlox_rr(W(XD), op)
+
+#define hrpox_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        shpox3rr(Tmm1, W(XS), W(XT), IB(0x88))                              \
+        shpox3rr(Tmm2, W(XS), W(XT), IB(0xDD))                              \
+        op##3rr(W(XD), Tmm1, Tmm2)                                          \
+        prpox_rr(W(XD))
+
+#define hrpox_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        shpox3ld(Tmm1, W(XS), W(MT), W(DT), IB(0x88))                       \
+        shpox3ld(Tmm2, W(XS), W(MT), W(DT), IB(0xDD))                       \
+        op##3rr(W(XD), Tmm1, Tmm2)                                          \
+        prpox_rr(W(XD))
+
+#if   (RT_SIMD == 512*1)
+
+#define hrlox_rr(XD, op) /* not portable, do not use outside */             \
+        prmox_rr(Tmm1, W(XD), IB(0xB1))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)                                         \
+        prmox_rr(Tmm1, W(XD), IB(0x4E))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)
+
+#define prpox_rr(XD) /* not portable, do not use outside */                 \
+        EVW(RXB(XD), RXB(XD),    0x00, K, 1, 3) EMITB(0x01)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xD8))                                  \
+        prmox_rr(W(XD), W(XD), IB(0xD8))
+
+#elif (RT_SIMD == 256*1)
+
+#define hrlox_rr(XD, op) /* not portable, do not use outside */             \
+        prmox_rr(Tmm1, W(XD), IB(0x01))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)
+
+#define prpox_rr(XD) /* not portable, do not use outside */                 \
+        EVW(RXB(XD), RXB(XD),    0x00, K, 1, 3) EMITB(0x01)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0xD8))
+
+#else  /* (RT_SIMD == 128*1) */
+
+#define hrlox_rr(XD, op) /* not portable, do not use outside */
+
+#define prpox_rr(XD) /* not portable, do not use outside */
+
+#endif /* RT_SIMD: 512*1, 256*1, 128*1 */
+
+#undef  adpos3rr
+#define adpos3rr(XD, XS, XT)                                                \
+        hrpox_rr(W(XD), W(XS), W(XT), addos)
+
+#undef  adpos3ld
+#define adpos3ld(XD, XS, MT, DT)                                            \
+        hrpox_ld(W(XD), W(XS), W(MT), W(DT), addos)
+
+#undef  adhos_rr
+#define adhos_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzox_rr(W(XD), W(XS), addos)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subos_rr(XG, XS)                                                    \
@@ -1128,6 +1421,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpos3rr
+#define mlpos3rr(XD, XS, XT)                                                \
+        hrpox_rr(W(XD), W(XS), W(XT), mulos)
+
+#undef  mlpos3ld
+#define mlpos3ld(XD, XS, MT, DT)                                            \
+        hrpox_ld(W(XD), W(XS), W(MT), W(DT), mulos)
+
+#undef  mlhos_rr
+#define mlhos_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzox_rr(W(XD), W(XS), mulos)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divos_rr(XG, XS)                                                    \
@@ -1222,7 +1527,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaos_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xB8)                 \
@@ -1239,7 +1544,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsos_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xBC)                 \
@@ -1274,6 +1579,18 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpos3rr
+#define mnpos3rr(XD, XS, XT)                                                \
+        hrpox_rr(W(XD), W(XS), W(XT), minos)
+
+#undef  mnpos3ld
+#define mnpos3ld(XD, XS, MT, DT)                                            \
+        hrpox_ld(W(XD), W(XS), W(MT), W(DT), minos)
+
+#undef  mnhos_rr
+#define mnhos_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzox_rr(W(XD), W(XS), minos)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxos_rr(XG, XS)                                                    \
@@ -1294,6 +1611,18 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpos3rr
+#define mxpos3rr(XD, XS, XT)                                                \
+        hrpox_rr(W(XD), W(XS), W(XT), maxos)
+
+#undef  mxpos3ld
+#define mxpos3ld(XD, XS, MT, DT)                                            \
+        hrpox_ld(W(XD), W(XS), W(MT), W(DT), maxos)
+
+#undef  mxhos_rr
+#define mxhos_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzox_rr(W(XD), W(XS), maxos)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqos_rr(XG, XS)                                                    \
@@ -1423,12 +1752,24 @@
         VEX(RXB(RD),       0,    0x00, 0, 0, 1) EMITB(0x93)                 \
         MRM(REG(RD),    0x03,    0x01)
 
+#define pc1wx_rx(RD)         /* not portable, do not use outside */         \
+        EMITB(0xF3) REX(RXB(RD),       0) EMITB(0x0F) EMITB(0xB8)           \
+        MRM(REG(RD),    0x03,    0x00)
+
 #define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
         mk1wx_rx(Reax)                                                      \
         cmpwx_ri(Reax, IH(S0(mask, 32, K)))                                 \
         jeqxx_lb(lb)
 
+/* mkc (D = number of active elements in mask S), kmov and popcnt */
+
+#undef  mkcox_rx
+#define mkcox_rx(XS, RD)        /* destroys Reax */                         \
+        ck1ox_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rx(W(RD))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1560,7 +1901,7 @@
         AUX(EMPTY,   EMPTY,   EMITB(RT_SIMD_MODE_##mode&3))
 
 #define cvros_rr(XD, XS, mode)                                              \
-        ERX(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x5B)\
+        ERX(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x5B) \
         MRM(REG(XD), MOD(XS), REG(XS))
 
 /* cvn (D = signed-int-to-fp S)
@@ -1607,6 +1948,21 @@
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvhos_ld
+#define cvhos_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  cvhos_st
+#define cvhos_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMITB(0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -1736,7 +2092,7 @@
         AUX(EMPTY,   EMPTY,   EMITB(RT_SIMD_MODE_##mode&3))
 
 #define curos_rr(XD, XS, mode)                                              \
-        ERX(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 0, 1) EMITB(0x79)\
+        ERX(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 0, 1) EMITB(0x79) \
         MRM(REG(XD), MOD(XS), REG(XS))
 
 /************   packed single-precision integer arithmetic/shifts   ***********/
@@ -1795,6 +2151,206 @@
         /* div, rem are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+/* div, rem by immediate use even/odd 32x32->64-bit vpmuludq (vpmuldq)
+ * products with broadcast magic number instead of per-element BASE loops */
+
+#undef  divox_ri
+#define divox_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        mhiox_rx(W(XG), IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF)), mhuox_ld)    \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        subox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrox_ri(W(XG), IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))               \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrox_ri(W(XG), IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#undef  divon_ri
+#define divon_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        mhiox_rx(W(XG), IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF)), mhnox_ld)    \
+        addox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        shron_ri(W(XG), IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        shrox_ri(W(XG), IB(31))                                             \
+        addox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#undef  remox_ri
+#define remox_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        divox_ri(W(XG), W(IS))                                              \
+        rmiox_rx(W(XG), W(IS))
+
+#undef  remon_ri
+#define remon_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        divon_ri(W(XG), W(IS))                                              \
+        rmiox_rx(W(XG), W(IS))
+
+#define rmiox_rx(XG, IS) /* not portable, do not use outside */             \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        rmiox_ld(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        subox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define rmiox_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR ERX(RXB(XG), RXB(MS), REN(XG), K, 1, 2) EMITB(0x40)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* mhi (G = mulhi(G, IS)) keeps G in inf_SCR01, clobbers inf_SCR02,
+ * odd elements are multiplied first, even ones are or-ed in,
+ * multiply takes only the lower half of each broadcast 64-bit element */
+
+#define mhiox_rx(XG, IS, op) /* not portable, do not use outside */         \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        shrqx_ri(W(XG), IB(32))                                             \
+        op(W(XG), Mebp, inf_SCR02(0))                                       \
+        shrqx_ri(W(XG), IB(32))                                             \
+        shlqx_ri(W(XG), IB(32))                                             \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movwx_mi(Mebp,  inf_SCR02(0x00), W(IS))                             \
+        movox_ld(W(XG), Mebp, inf_SCR01(0))                                 \
+        op(W(XG), Mebp, inf_SCR02(0))                                       \
+        shrqx_ri(W(XG), IB(32))                                             \
+        movwx_mi(Mebp,  inf_SCR02(0x00), IB(0))                             \
+        orrox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define mhuox_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR ERW(RXB(XG), RXB(MS), REN(XG), K, 1, 1) EMITB(0xF4)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define mhnox_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR ERW(RXB(XG), RXB(MS), REN(XG), K, 1, 2) EMITB(0x28)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* div, rem with variable divisor convert each half of the elements to fp64
+ * (vcvtdq2pd, vcvtudq2pd), where all 32-bit integer quotients are exact,
+ * instead of per-element BASE division loops, uses zmm30, zmm31 as temps
+ * (saved along with the other SIMD regs in sregs_sa/sregs_la);
+ * div by zero and signed INT_MIN/-1 don't trap: signed quotient is then
+ * 0x80000000 (integer indefinite), unsigned quotient is 0xFFFFFFFF,
+ * rem by zero returns 0x80000000 (signed) or 0xFFFFFFFF (unsigned) */
+
+#if (RT_SIMD == 512*1)
+
+#undef  divox3rr
+#define divox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvfox_rx(cvuoq_ld, cvuqo_rr, 0x00)                                  \
+        dvfox_rx(cvuoq_ld, cvuqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  divox3ld
+#define divox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfox_rx(cvuoq_ld, cvuqo_rr, 0x00)                                  \
+        dvfox_rx(cvuoq_ld, cvuqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  divon3rr
+#define divon3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        dvfox_rx(cvnoq_ld, cvnqo_rr, 0x00)                                  \
+        dvfox_rx(cvnoq_ld, cvnqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  divon3ld
+#define divon3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        dvfox_rx(cvnoq_ld, cvnqo_rr, 0x00)                                  \
+        dvfox_rx(cvnoq_ld, cvnqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  remox3rr
+#define remox3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmfox_rx(cvuoq_ld, cvuqo_rr, 0x00)                                  \
+        rmfox_rx(cvuoq_ld, cvuqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  remox3ld
+#define remox3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmfox_rx(cvuoq_ld, cvuqo_rr, 0x00)                                  \
+        rmfox_rx(cvuoq_ld, cvuqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  remon3rr
+#define remon3rr(XD, XS, XT)                                                \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        rmfox_rx(cvnoq_ld, cvnqo_rr, 0x00)                                  \
+        rmfox_rx(cvnoq_ld, cvnqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  remon3ld
+#define remon3ld(XD, XS, MT, DT)                                            \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_ld(W(XD), W(MT), W(DT))                                       \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        rmfox_rx(cvnoq_ld, cvnqo_rr, 0x00)                                  \
+        rmfox_rx(cvnoq_ld, cvnqo_rr, 0x20)                                  \
+        movox_ld(W(XD), Mebp, inf_SCR01(0))
+
+/* dvf (inf_SCR01 = inf_SCR01 / inf_SCR02) for one half at offset nx,
+ * cv, ct select signed or unsigned conversions to and from fp64 */
+
+#define dvfox_rx(cv, ct, nx) /* not portable, do not use outside */         \
+        cv(Tmm1, Mebp, inf_SCR01(nx))                                       \
+        cv(Tmm2, Mebp, inf_SCR02(nx))                                       \
+        divqs_rr(Tmm1, Tmm2)                                                \
+        ct(Tmm1, Tmm1)                                                      \
+        mvhox_st(Tmm1, Mebp, inf_SCR01(nx))
+
+/* rmf (inf_SCR01 = inf_SCR01 % inf_SCR02) for one half at offset nx,
+ * quotient is truncated and multiplied back in fp64, where it's exact */
+
+#define rmfox_rx(cv, ct, nx) /* not portable, do not use outside */         \
+        cv(Tmm1, Mebp, inf_SCR01(nx))                                       \
+        cv(Tmm2, Mebp, inf_SCR02(nx))                                       \
+        divqs_rr(Tmm1, Tmm2)                                                \
+        rnzqs_rr(Tmm1, Tmm1)                                                \
+        mulqs_rr(Tmm1, Tmm2)                                                \
+        cv(Tmm2, Mebp, inf_SCR01(nx))                                       \
+        subqs_rr(Tmm2, Tmm1)                                                \
+        ct(Tmm1, Tmm2)                                                      \
+        mvhox_st(Tmm1, Mebp, inf_SCR01(nx))
+
+#define cvnoq_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 2, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvuoq_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 2, 1) EMITB(0x7A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define cvnqo_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 1) EMITB(0xE6)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define cvuqo_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 0, 1) EMITB(0x78)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mvhox_st(XS, MD, DD) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K-1, 2, 1) EMITB(0x7F)               \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#endif /* RT_SIMD: 512*1 */
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -2182,87 +2738,145 @@
 
 #define RT_SIMD_WIDTH32_512     16
 
+#define Tmm1    0x1E, 0x03, EMPTY       /* zmm30, internal temp-reg */
+#define Tmm2    0x1F, 0x03, EMPTY       /* zmm31, internal temp-reg */
+
 #if (RT_AWEX1 == 2 || RT_AWEX1 == 8)
 
-#undef  muvox_ld
-#undef  muvox_st
+#undef  mrvox_ld
+#undef  mrvox_st
 
 #endif /* RT_AWEX1 == 2, 8 */
 
-#define muvox_ld(XD, MS, DS)                                                \
+#define mrvox_ld(XD, MS, DS)                                                \
     ADR EVX(RXB(XD), RXB(MS),    0x00, 2, 0, 1) EMITB(0x28)                 \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvox_st(XS, MD, DD)                                                \
+#define mrvox_st(XS, MD, DD)                                                \
     ADR EVX(RXB(XS), RXB(MD),    0x00, 2, 0, 1) EMITB(0x29)                 \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
 /* sregs */
 
+/* internal regs saved in ASM_ENTER_LITE/ASM_LEAVE_LITE (check rtarch.h),
+ * zmm30, zmm31 (temps in div, rem, horizontal ops), mask regs k1-k7 */
+
+#undef  sregs_sk
+#undef  sregs_lk
+
+#if RT_CODE_GEN == 0 && (defined __AVX512F__)
+
+#define sregs_ks() /* save mask regs, destroys Reax */                      \
+        sregs_kx(0x91, 0x01)                                                \
+        sregs_kx(0x91, 0x02)                                                \
+        sregs_kx(0x91, 0x03)                                                \
+        sregs_kx(0x91, 0x04)                                                \
+        sregs_kx(0x91, 0x05)                                                \
+        sregs_kx(0x91, 0x06)                                                \
+        sregs_kx(0x91, 0x07)
+
+#define sregs_kl() /* load mask regs, destroys Reax */                      \
+        sregs_kx(0x90, 0x01)                                                \
+        sregs_kx(0x90, 0x02)                                                \
+        sregs_kx(0x90, 0x03)                                                \
+        sregs_kx(0x90, 0x04)                                                \
+        sregs_kx(0x90, 0x05)                                                \
+        sregs_kx(0x90, 0x06)                                                \
+        sregs_kx(0x90, 0x07)
+
+#else  /* RT_CODE_GEN, __AVX512F__ */
+
+#define sregs_ks() /* mask regs are caller-saved in the native ABI */
+#define sregs_kl() /* mask regs are caller-saved in the native ABI */
+
+#endif /* RT_CODE_GEN, __AVX512F__ */
+
+#if RT_CODE_GEN != 0 || (defined __AVX512F__)
+
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        movox_st(Tmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        movox_st(Tmm2, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        sregs_ks()
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        movox_ld(Tmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        movox_ld(Tmm2, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IM(RT_SIMD_WIDTH32*4))                               \
+        sregs_kl()
+
+#endif /* RT_CODE_GEN, __AVX512F__ */
+
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_st(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm0, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        mrvox_st(Xmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        mrvox_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm8, Oeax, PLAIN)                                         \
+        mrvox_st(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(Xmm9, Oeax, PLAIN)                                         \
+        mrvox_st(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmA, Oeax, PLAIN)                                         \
+        mrvox_st(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmB, Oeax, PLAIN)                                         \
+        mrvox_st(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmC, Oeax, PLAIN)                                         \
+        mrvox_st(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmD, Oeax, PLAIN)                                         \
+        mrvox_st(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmE, Oeax, PLAIN)                                         \
+        mrvox_st(XmmG, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmF, Oeax, PLAIN)                                         \
+        mrvox_st(XmmH, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmG, Oeax, PLAIN)                                         \
+        mrvox_st(XmmI, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmH, Oeax, PLAIN)                                         \
+        mrvox_st(XmmJ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmI, Oeax, PLAIN)                                         \
+        mrvox_st(XmmK, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmJ, Oeax, PLAIN)                                         \
+        mrvox_st(XmmL, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmK, Oeax, PLAIN)                                         \
+        mrvox_st(XmmM, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmL, Oeax, PLAIN)                                         \
+        mrvox_st(XmmN, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmM, Oeax, PLAIN)                                         \
+        mrvox_st(XmmO, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmN, Oeax, PLAIN)                                         \
+        mrvox_st(XmmP, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmO, Oeax, PLAIN)                                         \
+        mrvox_st(XmmQ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmP, Oeax, PLAIN)                                         \
+        mrvox_st(XmmR, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmQ, Oeax, PLAIN)                                         \
+        mrvox_st(XmmS, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmR, Oeax, PLAIN)                                         \
+        mrvox_st(XmmT, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmS, Oeax, PLAIN)                                         \
+        mrvox_st(Tmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_st(XmmT, Oeax, PLAIN)                                         \
+        mrvox_st(Tmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -2324,65 +2938,69 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        mrvox_ld(Xmm1, Oeax, PLAIN)                                         \
+        addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
+        mrvox_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm8, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(Xmm9, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmA, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmB, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmC, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmD, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmE, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmG, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmF, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmH, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmG, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmI, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmH, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmJ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmI, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmK, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmJ, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmL, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmK, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmM, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmL, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmN, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmM, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmO, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmN, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmP, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmO, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmQ, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmP, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmR, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmQ, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmS, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmR, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmT, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmS, Oeax, PLAIN)                                         \
+        mrvox_ld(Tmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
-        muvox_ld(XmmT, Oeax, PLAIN)                                         \
+        mrvox_ld(Tmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_512*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -371,6 +371,78 @@
         MRM(REG(XD),    0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPX(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,0,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+        EPX(REP(PS), 0,       RMB(XG), RMB(XS), REM(XG), K,0,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define minosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPX(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,0,1) EMITB(0x5D) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EPX(REP(PS), 0,       RMB(XG), RXB(MS), REM(XG), K,0,1) EMITB(0x5D) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#define minosPrr(XG, PS, XS)                                                \
+        minos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minosPld(XG, PS, MS, DS)                                            \
+        minos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minos4rr(XD, PS, XS, XT)                                            \
+        EPX(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,0,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EPX(REP(PS), MOD(PS), RMB(XD), RMB(XT), REM(XS), K,0,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minos4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPX(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,0,1) EMITB(0x5D) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EPX(REP(PS), MOD(PS), RMB(XD), RXB(MT), REM(XS), K,0,1) EMITB(0x5D) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxosMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPX(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,0,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+        EPX(REP(PS), 0,       RMB(XG), RMB(XS), REM(XG), K,0,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxosMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPX(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,0,1) EMITB(0x5F) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EPX(REP(PS), 0,       RMB(XG), RXB(MS), REM(XG), K,0,1) EMITB(0x5F) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#define maxosPrr(XG, PS, XS)                                                \
+        maxos4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxosPld(XG, PS, MS, DS)                                            \
+        maxos4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxos4rr(XD, PS, XS, XT)                                            \
+        EPX(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,0,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EPX(REP(PS), MOD(PS), RMB(XD), RMB(XT), REM(XS), K,0,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxos4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPX(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,0,1) EMITB(0x5F) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EPX(REP(PS), MOD(PS), RMB(XD), RXB(MT), REM(XS), K,0,1) EMITB(0x5F) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqosPrr(PD, XS, XT)                                                \
@@ -600,6 +672,38 @@
         cmpwx_ri(Reax, IH(S0(mask, 32, K)))                                 \
         jeqxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlxx_rx(RS, lanes)  /* not portable, do not use outside */         \
+        REX(1,       RXB(RS)) EMITB(0x8B)                                   \
+        MRM(0x07,    MOD(RS), REG(RS))                                      \
+        movwx_ri(Reax, IB(lanes))                                           \
+        REX(1,             0) EMITB(0x3B)                                   \
+        MRM(0x07,       0x03, 0x00)                                         \
+        REX(1,             0) EMITB(0x0F) EMITB(0x4F)                       \
+        MRM(0x07,       0x03, 0x00)                                         \
+        xorwx_rr(Reax, Reax)                                                \
+        REX(1,             1) EMITB(0x85)                                   \
+        MRM(0x07,       0x03, 0x07)                                         \
+        REX(1,             0) EMITB(0x0F) EMITB(0x48)                       \
+        MRM(0x07,       0x03, 0x00)                                         \
+        notwx_rx(Reax)                                                      \
+        VEX(0,             0,    0x0F, 0, 0, 2) EMITB(0xF5)                 \
+        MRM(0x00,       0x03, 0x00)
+
+#define whlox_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        whlxx_rx(W(RS), (RT_SIMD/32))                                       \
+        REX(1,             0) EMITB(0x8B)                                   \
+        MRM(0x07,       0x03, 0x00)                                         \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x05,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(RT_SIMD/64))                            \
+        VEX(0,             1,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(REP(PD),    0x03, 0x07)                                         \
+        andwx_ri(Reax, IH((1 << (RT_SIMD/64)) - 1))                         \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(REG(PD),    0x03, 0x00)
+
 /* mov (D = S), predicated */
 
 #define mxvox_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -1170,6 +1274,38 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvox_ld
+#define muvox_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#undef  muvox_st
+#define muvox_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(RMB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movox_nt
+#define movox_nt(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(RMB(XS), RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1621,7 +1757,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaos_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xB8)                 \
@@ -1643,7 +1779,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsos_rr(XG, XS, XT)                                                \
         EVX(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xBC)                 \
@@ -2140,6 +2276,27 @@
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvhos_ld
+#define cvhos_ld(XD, MS, DS)                                                \
+    ADR EVX(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVX(RMB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS) + (0x08 << K)), EMPTY)
+
+#undef  cvhos_st
+#define cvhos_st(XS, MD, DD)                                                \
+    ADR EVX(RXB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMITB(0x00))                           \
+    ADR EVX(RMB(XS), RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD) + (0x08 << K)), EMITB(0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -2914,12 +3071,12 @@
 
 #if (RT_AWEX2 == 2)
 
-#undef  muvox_ld
-#undef  muvox_st
+#undef  mrvox_ld
+#undef  mrvox_st
 
 #endif /* RT_AWEX2 == 2 */
 
-#define muvox_ld(XD, MS, DS)                                                \
+#define mrvox_ld(XD, MS, DS)                                                \
     ADR EVX(RXB(XD), RXB(MS),    0x00, 2, 0, 1) EMITB(0x28)                 \
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
@@ -2927,7 +3084,7 @@
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
 
-#define muvox_st(XS, MD, DD)                                                \
+#define mrvox_st(XS, MD, DD)                                                \
     ADR EVX(RXB(XS), RXB(MD),    0x00, 2, 0, 1) EMITB(0x29)                 \
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
@@ -2937,40 +3094,68 @@
 
 /* sregs */
 
+/* internal regs saved in ASM_ENTER_LITE/ASM_LEAVE_LITE (check rtarch.h),
+ * mask regs k1-k7 */
+
+#undef  sregs_sk
+#undef  sregs_lk
+
+#if RT_CODE_GEN == 0 && (defined __AVX512F__)
+
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        sregs_kx(0x91, 0x01)                                                \
+        sregs_kx(0x91, 0x02)                                                \
+        sregs_kx(0x91, 0x03)                                                \
+        sregs_kx(0x91, 0x04)                                                \
+        sregs_kx(0x91, 0x05)                                                \
+        sregs_kx(0x91, 0x06)                                                \
+        sregs_kx(0x91, 0x07)
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        sregs_kx(0x90, 0x01)                                                \
+        sregs_kx(0x90, 0x02)                                                \
+        sregs_kx(0x90, 0x03)                                                \
+        sregs_kx(0x90, 0x04)                                                \
+        sregs_kx(0x90, 0x05)                                                \
+        sregs_kx(0x90, 0x06)                                                \
+        sregs_kx(0x90, 0x07)
+
+#endif /* RT_CODE_GEN, __AVX512F__ */
+
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_st(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm8, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(Xmm9, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(XmmA, Oeax, PLAIN)                                         \
+        mrvox_st(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(XmmB, Oeax, PLAIN)                                         \
+        mrvox_st(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(XmmC, Oeax, PLAIN)                                         \
+        mrvox_st(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(XmmD, Oeax, PLAIN)                                         \
+        mrvox_st(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(XmmE, Oeax, PLAIN)                                         \
+        mrvox_st(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_st(XmmF, Oeax, PLAIN)                                         \
+        mrvox_st(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -3032,37 +3217,37 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm8, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm8, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(Xmm9, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm9, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(XmmA, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmA, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(XmmB, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmB, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(XmmC, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmC, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(XmmD, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmD, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(XmmE, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmE, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
-        muvox_ld(XmmF, Oeax, PLAIN)                                         \
+        mrvox_ld(XmmF, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_1K4*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -239,6 +239,56 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VTL(DD)), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvox_ld
+#define muvox_ld(XD, MS, DS)                                                \
+    ADR EVX(0,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVX(1,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)                                 \
+    ADR EVX(2,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VSL(DS)), EMPTY)                                 \
+    ADR EVX(3,       RXB(MS),    0x00, K, 0, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VTL(DS)), EMPTY)
+
+#undef  muvox_st
+#define muvox_st(XS, MD, DD)                                                \
+    ADR EVX(0,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(1,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)                                 \
+    ADR EVX(2,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VSL(DD)), EMPTY)                                 \
+    ADR EVX(3,       RXB(MD),    0x00, K, 0, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VTL(DD)), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movox_nt
+#define movox_nt(XS, MD, DD)                                                \
+    ADR EVX(0,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVX(1,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)                                 \
+    ADR EVX(2,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VSL(DD)), EMPTY)                                 \
+    ADR EVX(3,       RXB(MD),    0x00, K, 0, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VTL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -858,7 +908,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaos_rr(XG, XS, XT)                                                \
         EVX(0,             0, REG(XS), K, 1, 2) EMITB(0xB8)                 \
@@ -890,7 +940,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsos_rr(XG, XS, XT)                                                \
         EVX(0,             0, REG(XS), K, 1, 2) EMITB(0xBC)                 \
@@ -1641,6 +1691,39 @@
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VTL(DS)), EMPTY)
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S)
+ * cvh is defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvhos_ld
+#define cvhos_ld(XD, MS, DS)                                                \
+    ADR EVX(0,       RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVX(1,       RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS) + (0x08 << K)), EMPTY)                   \
+    ADR EVX(2,       RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS) + (0x10 << K)), EMPTY)                   \
+    ADR EVX(3,       RXB(MS),    0x00, K, 1, 2) EMITB(0x13)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS) + (0x18 << K)), EMPTY)
+
+#undef  cvhos_st
+#define cvhos_st(XS, MD, DD)                                                \
+    ADR EVX(0,       RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMITB(0x00))                           \
+    ADR EVX(1,       RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD) + (0x08 << K)), EMITB(0x00))             \
+    ADR EVX(2,       RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD) + (0x10 << K)), EMITB(0x00))             \
+    ADR EVX(3,       RXB(MD),    0x00, K, 1, 3) EMITB(0x1D)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD) + (0x18 << K)), EMITB(0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -2809,12 +2892,12 @@
 
 #if (RT_512X4 == 2)
 
-#undef  muvox_ld
-#undef  muvox_st
+#undef  mrvox_ld
+#undef  mrvox_st
 
 #endif /* RT_512X4 == 2 */
 
-#define muvox_ld(XD, MS, DS)                                                \
+#define mrvox_ld(XD, MS, DS)                                                \
     ADR EVX(0,       RXB(MS),    0x00, 2, 0, 1) EMITB(0x28)                 \
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
@@ -2828,7 +2911,7 @@
         MRM(REG(XD),    0x02, REG(MS))                                      \
         AUX(SIB(MS), EMITW(VTL(DS)), EMPTY)
 
-#define muvox_st(XS, MD, DD)                                                \
+#define mrvox_st(XS, MD, DD)                                                \
     ADR EVX(0,       RXB(MD),    0x00, 2, 0, 1) EMITB(0x29)                 \
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
@@ -2844,24 +2927,52 @@
 
 /* sregs */
 
+/* internal regs saved in ASM_ENTER_LITE/ASM_LEAVE_LITE (check rtarch.h),
+ * mask regs k1-k7 */
+
+#undef  sregs_sk
+#undef  sregs_lk
+
+#if RT_CODE_GEN == 0 && (defined __AVX512F__)
+
+#define sregs_sk() /* save internal SIMD regs, destroys Reax */             \
+        sregs_kx(0x91, 0x01)                                                \
+        sregs_kx(0x91, 0x02)                                                \
+        sregs_kx(0x91, 0x03)                                                \
+        sregs_kx(0x91, 0x04)                                                \
+        sregs_kx(0x91, 0x05)                                                \
+        sregs_kx(0x91, 0x06)                                                \
+        sregs_kx(0x91, 0x07)
+
+#define sregs_lk() /* load internal SIMD regs, destroys Reax */             \
+        sregs_kx(0x90, 0x01)                                                \
+        sregs_kx(0x90, 0x02)                                                \
+        sregs_kx(0x90, 0x03)                                                \
+        sregs_kx(0x90, 0x04)                                                \
+        sregs_kx(0x90, 0x05)                                                \
+        sregs_kx(0x90, 0x06)                                                \
+        sregs_kx(0x90, 0x07)
+
+#endif /* RT_CODE_GEN, __AVX512F__ */
+
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_st(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_st(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_st(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_st(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_st(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_st(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_st(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_st(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_st(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x91)                 \
         MRM(0x01,       0x00,    0x00)                                      \
@@ -2923,21 +3034,21 @@
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvox_ld(Xmm0, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_ld(Xmm1, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_ld(Xmm2, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_ld(Xmm3, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_ld(Xmm4, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_ld(Xmm5, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_ld(Xmm6, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
-        muvox_ld(Xmm7, Oeax, PLAIN)                                         \
+        mrvox_ld(Xmm7, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IM(RT_SIMD_WIDTH32_2K8*4))                           \
         VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x90)                 \
         MRM(0x01,       0x00,    0x00)                                      \
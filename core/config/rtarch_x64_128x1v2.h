@@ -170,6 +170,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvjx_ld
+#define muvjx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, 0, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvjx_st
+#define muvjx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movjx_nt
+#define movjx_nt(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -325,6 +348,22 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+        /* shf (vpermilpd) keeps horizontal reductions in registers
+         * using Tmm1 (saved in sregs_sk) as temp, check hrzis_rr */
+
+#define shfjx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define hrzjs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        shfjx_rr(Tmm1, W(XS), IB(0x55))                                     \
+        op##3rr(W(XD), W(XS), Tmm1)
+
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzjs_rr(W(XD), W(XS), addjs)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjs_rr(XG, XS)                                                    \
@@ -362,6 +401,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzjs_rr(W(XD), W(XS), muljs)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -456,7 +499,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmajs_rr(XG, XS, XT)                                                \
         EVW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB8)                 \
@@ -473,7 +516,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsjs_rr(XG, XS, XT)                                                \
         EVW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBC)                 \
@@ -508,6 +551,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzjs_rr(W(XD), W(XS), minjs)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -528,6 +575,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzjs_rr(W(XD), W(XS), maxjs)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -842,6 +893,39 @@
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvljs_rr
+#define cvljs_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 0, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvujs_rr
+#define cvujs_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS), REN(XS), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvljs_rr(W(XD), W(XD))
+
+#undef  cvlis_rr
+#define cvlis_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuis_rr
+#define cvuis_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvlis_rr(W(XG), W(XS))                                              \
+        EVX(RXB(XG), RXB(XG), REN(XG), 0, 0, 1) EMITB(0x16)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        mlljx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mlljx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS), REN(XD), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -1554,7 +1638,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmats_rr(XG, XS, XT)                                                \
     ADR EVW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB9)                 \
@@ -1571,7 +1655,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsts_rr(XG, XS, XT)                                                \
     ADR EVW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBD)                 \
@@ -156,6 +156,29 @@ ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvjx_ld
+#define muvjx_ld(XD, MS, DS)                                                \
+ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvjx_st
+#define muvjx_st(XS, MD, DD)                                                \
+ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movjx_nt
+#define movjx_nt(XS, MD, DD)                                                \
+ADR ESC REX(RXB(XS), RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -192,6 +215,49 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x38) EMITB(0x15)           \
         orrjx_rr(Xmm0, W(XS))                                               \
         movjx_st(Xmm0, W(MG), W(DG))
 
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfjx_ri
+#define shfjx_ri(XD, XS, IT)                                                \
+        shfix_rr(W(XD), W(XS), IB((((VAL(IT))&1)*0x0A + 0x04) |             \
+                                 (((VAL(IT))&2)*0x50 + 0x40)))
+
+#undef  zipjx_rr
+#define zipjx_rr(XG, XS)     /* destroys scratch area */                    \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_rr(W(XS), W(XG))                                              \
+        unhjx_ld(W(XS), Mebp, inf_SCR01(0))                                 \
+        unljx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  bcxjx_ri
+#define bcxjx_ri(XD, XS, IT)                                                \
+        shfix_rr(W(XD), W(XS), IB(((VAL(IT))&1)*0xAA + 0x44))
+
+#undef  rotjx_ri
+#define rotjx_ri(XD, XS, IT)                                                \
+        shfix_rr(W(XD), W(XS), IB((((VAL(IT))&1)*0xAA) ^ 0xE4))
+
+#define unljx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x14)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define unhjx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x15)                       \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movjx_bc
+#define movjx_bc(XD, MS, DS)                                                \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        shfix_rr(W(XD), W(XD), IB(0x44))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -328,6 +394,56 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x58)                       \
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* hrz swaps halves of S (D = shf(S) op S), needs no temp-reg,
+         * if (#D == #S) S is spilled once and swapped in memory */
+
+#define hrzjs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzjs_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzjs_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x4E))                             \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#if (RT_SIMD_COMPAT_SSE < 4)
+
+#undef  adpjs3rr
+#define adpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        adpjs_rx(W(XD))
+
+#undef  adpjs3ld
+#define adpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        adpjs_rx(W(XD))
+
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzjs_rr(W(XD), W(XS), addjs)
+
+#undef  adhjs_ld
+#define adhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), addjs)
+
+#undef  adpjs_rx
+#define adpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        addjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        addjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
+#endif /* RT_SIMD_COMPAT_SSE < 4 */
+
 #if (RT_SIMD_COMPAT_SSE >= 4)
 
 #undef  adpjs_rr
@@ -394,6 +510,36 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x59)                       \
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpjs3rr
+#define mlpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlpjs_rx(W(XD))
+
+#undef  mlpjs3ld
+#define mlpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlpjs_rx(W(XD))
+
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzjs_rr(W(XD), W(XS), muljs)
+
+#undef  mlhjs_ld
+#define mlhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), muljs)
+
+#undef  mlpjs_rx
+#define mlpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        muljs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        muljs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -482,7 +628,7 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         addjs_rr(W(XG), W(XS))                                              \
         movjx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -560,7 +706,7 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         subjs_rr(W(XG), W(XS))                                              \
         movjx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -644,6 +790,36 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x5D)                       \
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpjs3rr
+#define mnpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mnpjs_rx(W(XD))
+
+#undef  mnpjs3ld
+#define mnpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mnpjs_rx(W(XD))
+
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzjs_rr(W(XD), W(XS), minjs)
+
+#undef  mnhjs_ld
+#define mnhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), minjs)
+
+#undef  mnpjs_rx
+#define mnpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        minjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        minjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -666,6 +842,36 @@ ADR ESC REX(RXB(XG), RXB(MS)) EMITB(0x0F) EMITB(0x5F)                       \
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpjs3rr
+#define mxpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mxpjs_rx(W(XD))
+
+#undef  mxpjs3ld
+#define mxpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mxpjs_rx(W(XD))
+
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzjs_rr(W(XD), W(XS), maxjs)
+
+#undef  mxhjs_ld
+#define mxhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), maxjs)
+
+#undef  mxpjs_rx
+#define mxpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        maxjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        maxjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -1131,6 +1337,41 @@ ADR ESC REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x09)           \
         movjx_ld(W(XD), W(MS), W(DS))                                       \
         cvtjx_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvljs_rr
+#define cvljs_rr(XD, XS)                                                    \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvujs_rr
+#define cvujs_rr(XD, XS)                                                    \
+        mhlix_rr(W(XD), W(XS))                                              \
+        cvljs_rr(W(XD), W(XD))
+
+#undef  cvlis_rr
+#define cvlis_rr(XD, XS)                                                    \
+    ESC REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuis_rr
+#define cvuis_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvlis_rr(W(XG), W(XS))                                              \
+        mlhjx_rr(W(XG), W(XG))                                              \
+        mlljx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mlhjx_rr(XD, XS) /* not portable, do not use outside */             \
+        REX(RXB(XD), RXB(XS)) EMITB(0x0F) EMITB(0x16)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mlljx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -2520,7 +2761,7 @@ ADR XF2 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         addts_rr(W(XG), W(XS))                                              \
         movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -2594,7 +2835,7 @@ ADR XF2 REX(RXB(XD), RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         subts_rr(W(XG), W(XS))                                              \
         movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -156,6 +156,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvjx_ld
+#define muvjx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvjx_st
+#define muvjx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movjx_nt
+#define movjx_nt(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 0, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -174,6 +197,14 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movjx_bc
+#define movjx_bc(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 0, 3, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andjx_rr(XG, XS)                                                    \
@@ -309,6 +340,27 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+        /* adh reduces with adp (vhaddpd) leaving the sum in all elements,
+         * hrz swaps halves of S (D = shf(S) op S), needs no temp-reg,
+         * if (#D == #S) S is spilled once and swapped in memory */
+
+#define hrzjs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzjs_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzjs_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x4E))                             \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        adpjs3rr(W(XD), W(XS), W(XS))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subjs_rr(XG, XS)                                                    \
@@ -346,6 +398,14 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzjs_rr(W(XD), W(XS), muljs)
+
+#undef  mlhjs_ld
+#define mlhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), muljs)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divjs_rr(XG, XS)                                                    \
@@ -434,7 +494,7 @@
         addjs_rr(W(XG), W(XS))                                              \
         movjx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -512,7 +572,7 @@
         subjs_rr(W(XG), W(XS))                                              \
         movjx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -578,7 +638,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmajs_rr(XG, XS, XT)                                                \
         VEW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB8)                 \
@@ -595,7 +655,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsjs_rr(XG, XS, XT)                                                \
         VEW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBC)                 \
@@ -632,6 +692,14 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzjs_rr(W(XD), W(XS), minjs)
+
+#undef  mnhjs_ld
+#define mnhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), minjs)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxjs_rr(XG, XS)                                                    \
@@ -652,6 +720,14 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzjs_rr(W(XD), W(XS), maxjs)
+
+#undef  mxhjs_ld
+#define mxhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), maxjs)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqjs_rr(XG, XS)                                                    \
@@ -998,6 +1074,39 @@
         movjx_ld(W(XD), W(MS), W(DS))                                       \
         cvtjx_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvljs_rr
+#define cvljs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvujs_rr
+#define cvujs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS), REN(XS), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        cvljs_rr(W(XD), W(XD))
+
+#undef  cvlis_rr
+#define cvlis_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 0, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuis_rr
+#define cvuis_rr(XG, XS)                                                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvlis_rr(W(XG), W(XS))                                              \
+        VEX(RXB(XG), RXB(XG), REN(XG), 0, 0, 1) EMITB(0x16)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        mlljx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mlljx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS), REN(XD), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -1901,7 +2010,7 @@
         addts_rr(W(XG), W(XS))                                              \
         movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -1975,7 +2084,7 @@
         subts_rr(W(XG), W(XS))                                              \
         movts_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -2037,7 +2146,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmats_rr(XG, XS, XT)                                                \
         VEW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xB9)                 \
@@ -2054,7 +2163,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsts_rr(XG, XS, XT)                                                \
         VEW(RXB(XG), RXB(XT), REN(XS), 0, 1, 2) EMITB(0xBD)                 \
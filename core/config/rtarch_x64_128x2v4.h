@@ -164,6 +164,38 @@ ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x29)                       \
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvdx_ld
+#define muvdx_ld(XD, MS, DS)                                                \
+ADR ESC REX(0,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x10)                       \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VYL(DS)), EMPTY)
+
+#undef  muvdx_st
+#define muvdx_st(XS, MD, DD)                                                \
+ADR ESC REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x11)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movdx_nt
+#define movdx_nt(XS, MD, DD)                                                \
+ADR ESC REX(0,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+ADR ESC REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x2B)                       \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VYL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -365,6 +397,26 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x58)                       \
 
 #endif /* RT_SIMD_COMPAT_SSE < 4 */
 
+        /* hrz reduces both halves of S into the 1st half of D,
+         * check hrzcs_rr for details */
+
+#define hrzds_rr(XD, XS, op) /* not portable, do not use outside */         \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(op)                         \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(1,             0) EMITB(0x0F) EMITB(0x70)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x4E))                                  \
+    ESC REX(0,             1) EMITB(0x0F) EMITB(op)                         \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+    ESC REX(1,             0) EMITB(0x0F) EMITB(0x28)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzds_rr(W(XD), W(XS), 0x58)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -416,6 +468,10 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x59)                       \
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzds_rr(W(XD), W(XS), 0x59)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -514,7 +570,7 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         addds_rr(W(XG), W(XS))                                              \
         movdx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -600,7 +656,7 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x51)                       \
         subds_rr(W(XG), W(XS))                                              \
         movdx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -697,6 +753,10 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x5D)                       \
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzds_rr(W(XD), W(XS), 0x5D)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -724,6 +784,10 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x5F)                       \
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzds_rr(W(XD), W(XS), 0x5F)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
@@ -1285,6 +1349,55 @@ ADR ESC REX(1,       RXB(MS)) EMITB(0x0F) EMITB(0x3A) EMITB(0x09)           \
         movdx_ld(W(XD), W(MS), W(DS))                                       \
         cvtdx_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvlds_rr
+#define cvlds_rr(XD, XS)                                                    \
+        REX(1,             0) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(0,             0) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuds_rr
+#define cvuds_rr(XD, XS)                                                    \
+        REX(0,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x12)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  cvlcs_rr
+#define cvlcs_rr(XD, XS)                                                    \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+    ESC REX(0,             0) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        REX(0,             1) EMITB(0x0F) EMITB(0x16)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        REX(1,             1) EMITB(0x0F) EMITB(0x57)                       \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  cvucs_rr
+#define cvucs_rr(XG, XS)                                                    \
+        cvucx_rx(W(XG), W(XS), Mebp, inf_SCR01(0))
+
+#define cvucx_rx(XG, XS, MD, DD) /* not portable, do not use outside */     \
+    ESC REX(1,             1) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x13)                       \
+        MRM(REG(XG),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ESC REX(1,             0) EMITB(0x0F) EMITB(0x5A)                       \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+    ADR REX(1,       RXB(MD)) EMITB(0x0F) EMITB(0x16)                       \
+        MRM(REG(XG),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -156,6 +156,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvdx_ld
+#define muvdx_ld(XD, MS, DS)                                                \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvdx_st
+#define muvdx_st(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movdx_nt
+#define movdx_nt(XS, MD, DD)                                                \
+    ADR VEX(RXB(XS), RXB(MD),    0x00, 1, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -174,6 +197,95 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#if (RT_256X1 >= 2) && (RT_SIMD == 256)
+
+/* gat (D = [S + T*8]), MS takes plain M*** modes, sca stays generic on AVX2
+ * vpcmpeqd sets all-ones mask in a temp reg distinct from D and T,
+ * which gets consumed by the instruction, then restored from scratch */
+
+#undef  gatqx_ld
+#define gatqx_ld(XD, MS, XT) /* indexed load, T holds 64-bit indices */     \
+        ASM_IFEQ(REN(XD), 0x00)                                             \
+        ASM_IFEQ(REN(XT), 0x01)                                             \
+        gtdxx_rx(W(XD), W(MS), W(XT), Xmm2)                                 \
+        ASM_ELSE                                                            \
+        gtdxx_rx(W(XD), W(MS), W(XT), Xmm1)                                 \
+        ASM_ENDI                                                            \
+        ASM_ELSE                                                            \
+        ASM_IFEQ(REN(XT), 0x00)                                             \
+        ASM_IFEQ(REN(XD), 0x01)                                             \
+        gtdxx_rx(W(XD), W(MS), W(XT), Xmm2)                                 \
+        ASM_ELSE                                                            \
+        gtdxx_rx(W(XD), W(MS), W(XT), Xmm1)                                 \
+        ASM_ENDI                                                            \
+        ASM_ELSE                                                            \
+        gtdxx_rx(W(XD), W(MS), W(XT), Xmm0)                                 \
+        ASM_ENDI                                                            \
+        ASM_ENDI
+
+#define gtdxx_rx(XD, MS, XT, XM) /* not portable, do not use outside */     \
+        movdx_st(W(XM), Mebp, inf_SCR01(0))                                 \
+        VEX(RXB(XM), RXB(XM), REN(XM), 1, 1, 1) EMITB(0x76)                 \
+        MRM(REG(XM), MOD(XM), REG(XM))                                      \
+    ADR VGW(RXB(XD), R1B(MS)|R1B(XT)<<1, REN(XM), 1, 1, 2) EMITB(0x93)      \
+        MRM(REG(XD),    0x01,    0x04)                                      \
+        EMITB(0x3<<6|REG(XT)<<3|REG(MS)) /* <- VSIB */                      \
+        EMITB(0x00)                                                         \
+        movdx_ld(W(XM), Mebp, inf_SCR01(0))
+
+#endif /* RT_256X1 >= 2, RT_SIMD: 256 */
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfdx_ri
+#define shfdx_ri(XD, XS, IT)                                                \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(((VAL(IT))&3)*0x05))
+
+#undef  zipdx_rr
+#define zipdx_rr(XG, XS)     /* destroys scratch area */                    \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        VEX(RXB(XS), RXB(XS), REN(XG), 1, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XS), MOD(XS), REG(XS))                                      \
+        unldx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  bcxdx_ri
+#define bcxdx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        bcsdx_ld(W(XD), Mebp, inf_SCR01(((VAL(IT))&3)*8))
+
+#define unldx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XG), RXB(MS), REN(XG), 1, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define bcsdx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 2) EMITB(0x19)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#if (RT_256X1 >= 2)
+
+#undef  rotdx_ri
+#define rotdx_ri(XD, XS, IT)                                                \
+        rtqcx_rx(W(XD), W(XS), (VAL(IT))&3)
+
+#endif /* RT_256X1 >= 2, AVX2 */
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movdx_bc
+#define movdx_bc(XD, MS, DS)                                                \
+        bcsdx_ld(W(XD), W(MS), W(DS))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -298,6 +410,64 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* hrz walks lanes of S in Gray-code order (D = shf(D) op S),
+         * thus needs no temp-reg, if (#D == #S) S is spilled once,
+         * lane 0 is broadcast for mul as lanes round differently,
+         * add swaps halves of S first and then uses had (vhaddpd) */
+
+#define shfdx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfdx_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+    ADR VEX(RXB(XD), RXB(MS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define hadds_rr(XD, XS) /* not portable, do not use outside */             \
+        VEX(RXB(XD), RXB(XS), REN(XS), 1, 1, 1) EMITB(0x7C)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define hrzds_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzds_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfdx_rr(W(XD), W(XS), IB(0x05))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        prmcx_rr(W(XD), W(XD), IB(0x01))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfdx_rr(W(XD), W(XD), IB(0x05))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzds_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfdx_ld(W(XD), W(MS), W(DS), IB(0x05))                             \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        prmcx_rr(W(XD), W(XD), IB(0x01))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfdx_rr(W(XD), W(XD), IB(0x05))                                    \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        ASM_IFEQ(REN(XD), REN(XS))                                          \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        adhds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        ASM_ELSE                                                            \
+        prmcx_rr(W(XD), W(XS), IB(0x23))                                    \
+        addds_rr(W(XD), W(XS))                                              \
+        hadds_rr(W(XD), W(XD))                                              \
+        ASM_ENDI
+
+#undef  adhds_ld
+#define adhds_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))                                       \
+        prmcx_rr(W(XD), W(XD), IB(0x01))                                    \
+        addds_ld(W(XD), W(MS), W(DS))                                       \
+        hadds_rr(W(XD), W(XD))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -335,6 +505,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzds_rr(W(XD), W(XS), mulds)                                       \
+        shfdx_rr(W(XD), W(XD), IB(0x00))                                    \
+        prmcx_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlhds_ld
+#define mlhds_ld(XD, MS, DS)                                                \
+        hrzds_ld(W(XD), W(MS), W(DS), mulds)                                \
+        shfdx_rr(W(XD), W(XD), IB(0x00))                                    \
+        prmcx_rr(W(XD), W(XD), IB(0x00))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -423,7 +605,7 @@
         addds_rr(W(XG), W(XS))                                              \
         movdx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -509,7 +691,7 @@
         subds_rr(W(XG), W(XS))                                              \
         movdx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -583,7 +765,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmads_rr(XG, XS, XT)                                                \
         VEW(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xB8)                 \
@@ -600,7 +782,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsds_rr(XG, XS, XT)                                                \
         VEW(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xBC)                 \
@@ -637,6 +819,14 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzds_rr(W(XD), W(XS), minds)
+
+#undef  mnhds_ld
+#define mnhds_ld(XD, MS, DS)                                                \
+        hrzds_ld(W(XD), W(MS), W(DS), minds)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -657,6 +847,14 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzds_rr(W(XD), W(XS), maxds)
+
+#undef  mxhds_ld
+#define mxhds_ld(XD, MS, DS)                                                \
+        hrzds_ld(W(XD), W(MS), W(DS), maxds)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
@@ -1013,6 +1211,41 @@
         movdx_ld(W(XD), W(MS), W(DS))                                       \
         cvtdx_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvlds_rr
+#define cvlds_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuds_rr
+#define cvuds_rr(XD, XS)                                                    \
+        VEX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvlds_rr(W(XD), W(XD))
+
+#undef  cvlcs_rr
+#define cvlcs_rr(XD, XS)                                                    \
+        VEX(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvucs_rr
+#define cvucs_rr(XG, XS)                                                    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvlcs_rr(W(XG), W(XS))                                              \
+        VEX(RXB(XG), RXB(XG), REN(XG), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        mlldx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mlldx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR VEX(RXB(XD), RXB(MS), REN(XD), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
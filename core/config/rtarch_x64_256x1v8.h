@@ -165,6 +165,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvdx_ld
+#define muvdx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, 1, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvdx_st
+#define muvdx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, 1, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movdx_nt
+#define movdx_nt(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, 1, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -185,6 +208,33 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#if (RT_SIMD == 256)
+
+/* gat (D = [S + T*8]), sca ([D + T*8] = S), MS/MD take plain M*** modes
+ * kxnorw sets all-ones k1 mask, which gets consumed by the instruction */
+
+#undef  gatqx_ld
+#define gatqx_ld(XD, MS, XT) /* indexed load, T holds 64-bit indices */     \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKW(RXB(XD), R1B(MS)|R1B(XT)<<1, RE2(XT), 1, 1, 2) EMITB(0x93)      \
+        MRM(REG(XD),    0x01,    0x04)                                      \
+        EMITB(0x3<<6|REG(XT)<<3|REG(MS)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+#undef  scaqx_st
+#define scaqx_st(XS, MD, XT) /* indexed store, T holds 64-bit indices */    \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKW(RXB(XS), R1B(MD)|R1B(XT)<<1, RE2(XT), 1, 1, 2) EMITB(0xA3)      \
+        MRM(REG(XS),    0x01,    0x04)                                      \
+        EMITB(0x3<<6|REG(XT)<<3|REG(MD)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+#endif /* RT_SIMD: 256 */
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define anddx_rr(XG, XS)                                                    \
@@ -309,6 +359,24 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (vpermilpd) shares prm (vshuff32x4) with fp32 ops,
+         * check hrzcs_rr for details */
+
+#define shfdx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define hrzds_rr(XD, XS, op) /* not portable, do not use outside */         \
+        shfdx_rr(Tmm1, W(XS), IB(0x55))                                     \
+        op##3rr(W(XD), W(XS), Tmm1)                                         \
+        prmcx_rr(Tmm1, W(XD), IB(0x01))                                     \
+        op##3rr(W(XD), W(XD), Tmm1)
+
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzds_rr(W(XD), W(XS), addds)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subds_rr(XG, XS)                                                    \
@@ -346,6 +414,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzds_rr(W(XD), W(XS), mulds)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divds_rr(XG, XS)                                                    \
@@ -440,7 +512,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmads_rr(XG, XS, XT)                                                \
     ADR EVW(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xB8)                 \
@@ -457,7 +529,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsds_rr(XG, XS, XT)                                                \
     ADR EVW(RXB(XG), RXB(XT), REN(XS), 1, 1, 2) EMITB(0xBC)                 \
@@ -492,6 +564,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzds_rr(W(XD), W(XS), minds)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxds_rr(XG, XS)                                                    \
@@ -512,6 +588,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzds_rr(W(XD), W(XS), maxds)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqds_rr(XG, XS)                                                    \
@@ -826,6 +906,41 @@
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvlds_rr
+#define cvlds_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuds_rr
+#define cvuds_rr(XD, XS)                                                    \
+        EVX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        cvlds_rr(W(XD), W(XD))
+
+#undef  cvlcs_rr
+#define cvlcs_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvucs_rr
+#define cvucs_rr(XG, XS)                                                    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvlcs_rr(W(XG), W(XS))                                              \
+        EVX(RXB(XG), RXB(XG), REN(XG), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XG), MOD(XG), REG(XG))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        mlldx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mlldx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS), REN(XD), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x00))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -164,6 +164,38 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvqx_ld
+#define muvqx_ld(XD, MS, DS)                                                \
+    ADR VEX(0,       RXB(MS),    0x00, 1, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MS),    0x00, 1, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VXL(DS)), EMPTY)
+
+#undef  muvqx_st
+#define muvqx_st(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movqx_nt
+#define movqx_nt(XS, MD, DD)                                                \
+    ADR VEX(0,       RXB(MD),    0x00, 1, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR VEX(1,       RXB(MD),    0x00, 1, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VXL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -340,6 +372,29 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* hrz reduces both halves of S into the 1st half of D,
+         * check hrzos_rr for details */
+
+#define hrzqs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        VEX(0,             1, REG(XS), 1, 1, 1) EMITB(op)                   \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        VEX(1,             0, REG(XD), 1, 1, 3) EMITB(0x06)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(0,             1, REG(XD), 1, 1, 1) EMITB(op)                   \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(1,             0,    0x00, 1, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x05))                                  \
+        VEX(0,             1, REG(XD), 1, 1, 1) EMITB(op)                   \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0x28)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  adhqs_rr
+#define adhqs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzqs_rr(W(XD), W(XS), 0x58)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subqs_rr(XG, XS)                                                    \
@@ -387,6 +442,10 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhqs_rr
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzqs_rr(W(XD), W(XS), 0x59)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divqs_rr(XG, XS)                                                    \
@@ -485,7 +544,7 @@
         addqs_rr(W(XG), W(XS))                                              \
         movqx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -587,7 +646,7 @@
         subqs_rr(W(XG), W(XS))                                              \
         movqx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -677,7 +736,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaqs_rr(XG, XS, XT)                                                \
         VEW(0,             0, REG(XS), 1, 1, 2) EMITB(0xB8)                 \
@@ -699,7 +758,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsqs_rr(XG, XS, XT)                                                \
         VEW(0,             0, REG(XS), 1, 1, 2) EMITB(0xBC)                 \
@@ -746,6 +805,10 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhqs_rr
+#define mnhqs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzqs_rr(W(XD), W(XS), 0x5D)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxqs_rr(XG, XS)                                                    \
@@ -771,6 +834,10 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhqs_rr
+#define mxhqs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzqs_rr(W(XD), W(XS), 0x5F)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqqs_rr(XG, XS)                                                    \
@@ -1245,6 +1312,58 @@
         movqx_ld(W(XD), W(MS), W(DS))                                       \
         cvtqx_rr(W(XD), W(XD))
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  cvlqs_rr
+#define cvlqs_rr(XD, XS)                                                    \
+        VEX(0,             1,    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(1,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        VEX(0,             0,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuqs_rr
+#define cvuqs_rr(XD, XS)                                                    \
+        VEX(0,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        VEX(1,             1,    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(1,             1,    0x00, 1, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  cvlos_rr
+#define cvlos_rr(XD, XS)                                                    \
+        VEX(1,             1,    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        VEX(0,             0,    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        VEX(0,             1, REG(XD), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))                                  \
+        VEX(1,             1, REH(XD), 1, 0, 1) EMITB(0x57)                 \
+        MRM(REG(XD), MOD(XD), REG(XD))
+
+#undef  cvuos_rr
+#define cvuos_rr(XG, XS)                                                    \
+        cvuox_rx(W(XG), W(XS), Mebp, inf_SCR01(0))
+
+#define cvuox_rx(XG, XS, MD, DD) /* not portable, do not use outside */     \
+        VEX(1,             1,    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+    ADR VEX(1,       RXB(MD),    0x00, 0, 0, 1) EMITB(0x29)                 \
+        MRM(REG(XG),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+        VEX(1,             0,    0x00, 1, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+    ADR VEX(1,       RXB(MD), REH(XG), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XG),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMITB(0x01))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -278,6 +278,58 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPW(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,1,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define minqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPW(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,1,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define minqsPrr(XG, PS, XS)                                                \
+        minqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minqsPld(XG, PS, MS, DS)                                            \
+        minqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minqs4rr(XD, PS, XS, XT)                                            \
+        EPW(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,1,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minqs4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPW(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,1,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPW(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,1,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPW(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,1,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define maxqsPrr(XG, PS, XS)                                                \
+        maxqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxqsPld(XG, PS, MS, DS)                                            \
+        maxqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxqs4rr(XD, PS, XS, XT)                                            \
+        EPW(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,1,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxqs4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPW(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,1,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMPTY)
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqqsPrr(PD, XS, XT)                                                \
@@ -427,6 +479,15 @@
         cmpwx_ri(Reax, IH(S0(mask, 64, K)))                                 \
         jeqxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+/* #define whlxx_rx(RS, lanes)             (defined in 32_512-bit header) */
+
+#define whlqx_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        whlxx_rx(W(RS), (RT_SIMD/64))                                       \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(REG(PD),    0x03, 0x00)
+
 /* mov (D = S), predicated */
 
 #define mxvqx_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -812,6 +873,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvqx_ld
+#define muvqx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, K, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvqx_st
+#define muvqx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movqx_nt
+#define movqx_nt(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -832,6 +916,97 @@
         MRM(REG(XS), MOD(MG), REG(MG))                                      \
         AUX(SIB(MG), CMD(DG), EMPTY)
 
+        /* cmp, exp are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* cmp ([D] = active elements of S packed), exp (G = unpacked from [S])
+ * use Xmm0 implicitly as a mask register, vcompress stores only the active
+ * elements, vexpand merges them into G leaving inactive elements intact */
+
+#undef  cmpqx_st
+#define cmpqx_st(XS, MD, DD)                                                \
+        ck1qx_rm(Xmm0, Mebp, inf_GPC07)                                     \
+    ADR EKW(RXB(XS), RXB(MD),    0x00, K, 1, 2) EMITB(0x8A)                 \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+#undef  expqx_ld
+#define expqx_ld(XG, MS, DS)                                                \
+        ck1qx_rm(Xmm0, Mebp, inf_GPC07)                                     \
+    ADR EKW(RXB(XG), RXB(MS),    0x00, K, 1, 2) EMITB(0x88)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+        /* gat, sca are defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+/* gat (D = [S + T*8]), sca ([D + T*8] = S), MS/MD take plain M*** modes
+ * kxnorw sets all-ones k1 mask, which gets consumed by the instruction */
+
+#undef  gatqx_ld
+#define gatqx_ld(XD, MS, XT) /* indexed load, T holds 64-bit indices */     \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKW(RXB(XD), R1B(MS)|R1B(XT)<<1, RE2(XT), K, 1, 2) EMITB(0x93)      \
+        MRM(REG(XD),    0x01,    0x04)                                      \
+        EMITB(0x3<<6|REG(XT)<<3|REG(MS)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+#undef  scaqx_st
+#define scaqx_st(XS, MD, XT) /* indexed store, T holds 64-bit indices */    \
+        VEX(0,             0,    0x01, 1, 0, 1) EMITB(0x46)                 \
+        MRM(0x01,       0x03,    0x01)                                      \
+    ADR EKW(RXB(XS), R1B(MD)|R1B(XT)<<1, RE2(XT), K, 1, 2) EMITB(0xA3)      \
+        MRM(REG(XS),    0x01,    0x04)                                      \
+        EMITB(0x3<<6|REG(XT)<<3|REG(MD)) /* <- VSIB */                      \
+        EMITB(0x00)
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#undef  shfqx_ri
+#define shfqx_ri(XD, XS, IT)                                                \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(((VAL(IT))&3)*0x55))
+
+#undef  zipqx_rr
+#define zipqx_rr(XG, XS)     /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        EVW(RXB(XS), RXB(XS), REN(XG), K, 1, 1) EMITB(0x15)                 \
+        MRM(REG(XS), MOD(XS), REG(XS))                                      \
+        unlqx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#undef  bcxqx_ri
+#define bcxqx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        bcsqx_ld(W(XD), Mebp, inf_SCR01(((VAL(IT))&(RT_SIMD/64-1))*8))
+
+#undef  rotqx_ri
+#define rotqx_ri(XD, XS, IT)                                                \
+        EVW(RXB(XD), RXB(XS), REN(XS), K, 1, 3) EMITB(0x03)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB((VAL(IT))&(RT_SIMD/64-1)))
+
+#define unlqx_ld(XG, MS, DS) /* not portable, do not use outside */         \
+    ADR EVW(RXB(XG), RXB(MS), REN(XG), K, 1, 1) EMITB(0x14)                 \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define bcsqx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, K, 1, 2) EMITB(0x59)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#undef  movqx_bc
+#define movqx_bc(XD, MS, DS)                                                \
+        bcsqx_ld(W(XD), W(MS), W(DS))
+
 #if (RT_AWEX1 == 1 || RT_AWEX1 == 4)
 
 /* and (G = G & S), (D = S & T) if (#D != #T) */
@@ -1048,6 +1223,53 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (vpermilpd), shp (vshufpd) share hrlox_rr, prpox_rr
+         * with fp32 ops, check hrzox_rr, hrpox_rr for details */
+
+#define shfqx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 3) EMITB(0x05)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shpqx3rr(XD, XS, XT, IT) /* not portable, do not use outside */     \
+        EVW(RXB(XD), RXB(XT), REN(XS), K, 1, 1) EMITB(0xC6)                 \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shpqx3ld(XD, XS, MT, DT, IT) /* not portable, do not use outside */ \
+    ADR EVW(RXB(XD), RXB(MT), REN(XS), K, 1, 1) EMITB(0xC6)                 \
+        MRM(REG(XD), MOD(MT), REG(MT))                                      \
+        AUX(SIB(MT), CMD(DT), EMITB(VAL(IT)))
+
+#define hrzqx_rr(XD, XS, op) /* not portable, do not use outside */         \
+        shfqx_rr(Tmm1, W(XS), IB(0x55))                                     \
+        op##3rr(W(XD), W(XS), Tmm1)                                         \
+        hrlox_rr(W(XD), op)
+
+#define hrpqx_rr(XD, XS, XT, op) /* not portable, do not use outside */     \
+        shpqx3rr(Tmm1, W(XS), W(XT), IB(0x00))                              \
+        shpqx3rr(Tmm2, W(XS), W(XT), IB(0xFF))                              \
+        op##3rr(W(XD), Tmm1, Tmm2)                                          \
+        prpox_rr(W(XD))
+
+#define hrpqx_ld(XD, XS, MT, DT, op) /* not portable, do not use outside */ \
+        shpqx3ld(Tmm1, W(XS), W(MT), W(DT), IB(0x00))                       \
+        shpqx3ld(Tmm2, W(XS), W(MT), W(DT), IB(0xFF))                       \
+        op##3rr(W(XD), Tmm1, Tmm2)                                          \
+        prpox_rr(W(XD))
+
+#undef  adpqs3rr
+#define adpqs3rr(XD, XS, XT)                                                \
+        hrpqx_rr(W(XD), W(XS), W(XT), addqs)
+
+#undef  adpqs3ld
+#define adpqs3ld(XD, XS, MT, DT)                                            \
+        hrpqx_ld(W(XD), W(XS), W(MT), W(DT), addqs)
+
+#undef  adhqs_rr
+#define adhqs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzqx_rr(W(XD), W(XS), addqs)
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subqs_rr(XG, XS)                                                    \
@@ -1085,6 +1307,18 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpqs3rr
+#define mlpqs3rr(XD, XS, XT)                                                \
+        hrpqx_rr(W(XD), W(XS), W(XT), mulqs)
+
+#undef  mlpqs3ld
+#define mlpqs3ld(XD, XS, MT, DT)                                            \
+        hrpqx_ld(W(XD), W(XS), W(MT), W(DT), mulqs)
+
+#undef  mlhqs_rr
+#define mlhqs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzqx_rr(W(XD), W(XS), mulqs)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divqs_rr(XG, XS)                                                    \
@@ -1179,7 +1413,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaqs_rr(XG, XS, XT)                                                \
         EVW(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xB8)                 \
@@ -1196,7 +1430,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsqs_rr(XG, XS, XT)                                                \
         EVW(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xBC)                 \
@@ -1231,6 +1465,18 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpqs3rr
+#define mnpqs3rr(XD, XS, XT)                                                \
+        hrpqx_rr(W(XD), W(XS), W(XT), minqs)
+
+#undef  mnpqs3ld
+#define mnpqs3ld(XD, XS, MT, DT)                                            \
+        hrpqx_ld(W(XD), W(XS), W(MT), W(DT), minqs)
+
+#undef  mnhqs_rr
+#define mnhqs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzqx_rr(W(XD), W(XS), minqs)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxqs_rr(XG, XS)                                                    \
@@ -1251,6 +1497,18 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpqs3rr
+#define mxpqs3rr(XD, XS, XT)                                                \
+        hrpqx_rr(W(XD), W(XS), W(XT), maxqs)
+
+#undef  mxpqs3ld
+#define mxpqs3ld(XD, XS, MT, DT)                                            \
+        hrpqx_ld(W(XD), W(XS), W(MT), W(DT), maxqs)
+
+#undef  mxhqs_rr
+#define mxhqs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzqx_rr(W(XD), W(XS), maxqs)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqqs_rr(XG, XS)                                                    \
@@ -1377,6 +1635,7 @@
 #define RT_SIMD_MASK_FULL64_512    0x00FF   /*  all satisfy the condition */
 
 /* #define mk1wx_rx(RD)                    (defined in 32_512-bit header) */
+/* #define pc1wx_rx(RD)                    (defined in 32_512-bit header) */
 
 #define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
@@ -1384,6 +1643,14 @@
         cmpwx_ri(Reax, IH(S0(mask, 64, K)))                                 \
         jeqxx_lb(lb)
 
+/* mkc (D = number of active elements in mask S), kmov and popcnt */
+
+#undef  mkcqx_rx
+#define mkcqx_rx(XS, RD)        /* destroys Reax */                         \
+        ck1qx_rm(W(XS), Mebp, inf_GPC07)                                    \
+        mk1wx_rx(Reax)                                                      \
+        pc1wx_rx(W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -1628,7 +1895,7 @@
 #else /* RT_AWEX1 == 2, 8 */
 
 #define cvrqs_rr(XD, XS, mode)                                              \
-        ERW(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x7B)\
+        ERW(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x7B) \
         MRM(REG(XD), MOD(XS), REG(XS))
 
 #endif /* RT_AWEX1 == 2, 8 */
@@ -1808,6 +2075,84 @@
 
 #endif /* RT_AWEX1 == 2, 8 */
 
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * cvl/cvu are defined in rtbase.h under "COMMON SIMD INSTRUCTIONS" section
+ * the upper half is moved with K-specific ops for 128/256/512-bit subsets */
+
+#undef  cvlqs_rr
+#define cvlqs_rr(XD, XS)                                                    \
+        EVX(RXB(XD), RXB(XS),    0x00, K, 0, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuqs_rr
+#define cvuqs_rr(XD, XS)                                                    \
+        mhlqx_rr(W(XD), W(XS))                                              \
+        cvlqs_rr(W(XD), W(XD))
+
+#undef  cvlos_rr
+#define cvlos_rr(XD, XS)                                                    \
+        EVW(RXB(XD), RXB(XS),    0x00, K, 1, 1) EMITB(0x5A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#undef  cvuos_rr
+#define cvuos_rr(XG, XS)                                                    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        cvlos_rr(W(XG), W(XS))                                              \
+        mlhqx_rr(W(XG), W(XG))                                              \
+        mllqx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#if   (RT_SIMD == 128*1)
+
+#define mhlqx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS), REN(XS), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mlhqx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS), REN(XD), 0, 0, 1) EMITB(0x16)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))
+
+#define mllqx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS), REN(XD), 0, 0, 1) EMITB(0x12)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#elif (RT_SIMD == 256*1)
+
+#define mhlqx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XS), RXB(XD),    0x00, 1, 1, 3) EMITB(0x19)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define mlhqx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVX(RXB(XD), RXB(XS), REN(XD), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define mllqx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVX(RXB(XD), RXB(MS), REN(XD), 1, 1, 3) EMITB(0x18)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x00))
+
+#elif (RT_SIMD == 512*1)
+
+#define mhlqx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XS), RXB(XD),    0x00, 2, 1, 3) EMITB(0x1B)                 \
+        MRM(REG(XS), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define mlhqx_rr(XD, XS) /* not portable, do not use outside */             \
+        EVW(RXB(XD), RXB(XS), REN(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(0x01))
+
+#define mllqx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+    ADR EVW(RXB(XD), RXB(MS), REN(XD), 2, 1, 3) EMITB(0x1A)                 \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(0x00))
+
+#endif /* RT_SIMD: 512, 256, 128 */
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp64 SIMD fp-to-int
@@ -2152,7 +2497,7 @@
 #else /* RT_AWEX1 == 2, 8 */
 
 #define curqs_rr(XD, XS, mode)                                              \
-        ERW(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x79)\
+        ERW(RXB(XD), RXB(XS), 0x00, RT_SIMD_MODE_##mode&3, 1, 1) EMITB(0x79) \
         MRM(REG(XD), MOD(XS), REG(XS))
 
 #endif /* RT_AWEX1 == 2, 8 */
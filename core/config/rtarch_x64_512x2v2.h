@@ -328,6 +328,78 @@
         MRM(REG(XD),    0x02, REG(MT))                                      \
         AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPW(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,1,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+        EPW(REP(PS), 0,       RMB(XG), RMB(XS), REM(XG), K,1,1) EMITB(0x5D) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define minqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPW(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,1,1) EMITB(0x5D) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EPW(REP(PS), 0,       RMB(XG), RXB(MS), REM(XG), K,1,1) EMITB(0x5D) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#define minqsPrr(XG, PS, XS)                                                \
+        minqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define minqsPld(XG, PS, MS, DS)                                            \
+        minqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define minqs4rr(XD, PS, XS, XT)                                            \
+        EPW(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,1,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EPW(REP(PS), MOD(PS), RMB(XD), RMB(XT), REM(XS), K,1,1) EMITB(0x5D) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define minqs4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPW(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,1,1) EMITB(0x5D) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EPW(REP(PS), MOD(PS), RMB(XD), RXB(MT), REM(XS), K,1,1) EMITB(0x5D) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxqsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        EPW(REG(PS), 0,       RXB(XG), RXB(XS), REN(XG), K,1,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(XS), REG(XS))                                      \
+        EPW(REP(PS), 0,       RMB(XG), RMB(XS), REM(XG), K,1,1) EMITB(0x5F) \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxqsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+    ADR EPW(REG(PS), 0,       RXB(XG), RXB(MS), REN(XG), K,1,1) EMITB(0x5F) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EPW(REP(PS), 0,       RMB(XG), RXB(MS), REM(XG), K,1,1) EMITB(0x5F) \
+        MRM(REG(XG),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#define maxqsPrr(XG, PS, XS)                                                \
+        maxqs4rr(W(XG), W(PS), W(XG), W(XS))
+
+#define maxqsPld(XG, PS, MS, DS)                                            \
+        maxqs4ld(W(XG), W(PS), W(XG), W(MS), W(DS))
+
+#define maxqs4rr(XD, PS, XS, XT)                                            \
+        EPW(REG(PS), MOD(PS), RXB(XD), RXB(XT), REN(XS), K,1,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(XT), REG(XT))                                      \
+        EPW(REP(PS), MOD(PS), RMB(XD), RMB(XT), REM(XS), K,1,1) EMITB(0x5F) \
+        MRM(REG(XD), MOD(XT), REG(XT))
+
+#define maxqs4ld(XD, PS, XS, MT, DT)                                        \
+    ADR EPW(REG(PS), MOD(PS), RXB(XD), RXB(MT), REN(XS), K,1,1) EMITB(0x5F) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VAL(DT)), EMPTY)                                 \
+    ADR EPW(REP(PS), MOD(PS), RMB(XD), RXB(MT), REM(XS), K,1,1) EMITB(0x5F) \
+        MRM(REG(XD),    0x02, REG(MT))                                      \
+        AUX(SIB(MT), EMITW(VZL(DT)), EMPTY)
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqqsPrr(PD, XS, XT)                                                \
@@ -555,6 +627,23 @@
         cmpwx_ri(Reax, IH(S0(mask, 64, K)))                                 \
         jeqxx_lb(lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+/* #define whlxx_rx(RS, lanes)             (defined in 32_512-bit header) */
+
+#define whlqx_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        whlxx_rx(W(RS), (RT_SIMD/64))                                       \
+        REX(1,             0) EMITB(0x8B)                                   \
+        MRM(0x07,       0x03, 0x00)                                         \
+        REX(0,             1) EMITB(0xC1)                                   \
+        MRM(0x05,       0x03, 0x07)                                         \
+        AUX(EMPTY,   EMPTY,   EMITB(RT_SIMD/128))                           \
+        VEX(0,             1,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(REP(PD),    0x03, 0x07)                                         \
+        andwx_ri(Reax, IH((1 << (RT_SIMD/128)) - 1))                        \
+        VEX(0,             0,    0x00, 0, 0, 1) EMITB(0x92)                 \
+        MRM(REG(PD),    0x03, 0x00)
+
 /* mov (D = S), predicated */
 
 #define mxvqx_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -574,10 +663,10 @@
 #define mxvqx_st(XS, PS, MD, DD) /* merging-masking only */                 \
     ADR EPW(REG(PS), 0,       RXB(XS), RXB(MD), 0x00, K,1,1) EMITB(0x29)    \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
-        AUX(SIB(MD), EMITW(VAL(DS)), EMPTY)                                 \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
     ADR EPW(REP(PS), 0,       RMB(XS), RXB(MD), 0x00, K,1,1) EMITB(0x29)    \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
-        AUX(SIB(MD), EMITW(VZL(DS)), EMPTY)
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
 
 #define selqx_rr(XD, PS, XS, XT) /* (D = P == 0 ? S : T) */                 \
         EPW(REG(PS), 0,       RXB(XD), RXB(XT), REN(XS), K,1,2) EMITB(0x65) \
@@ -1131,6 +1220,38 @@
         MRM(REG(XS),    0x02, REG(MD))                                      \
         AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvqx_ld
+#define muvqx_ld(XD, MS, DS)                                                \
+    ADR EVW(RXB(XD), RXB(MS),    0x00, K, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VAL(DS)), EMPTY)                                 \
+    ADR EVW(RMB(XD), RXB(MS),    0x00, K, 1, 1) EMITB(0x10)                 \
+        MRM(REG(XD),    0x02, REG(MS))                                      \
+        AUX(SIB(MS), EMITW(VZL(DS)), EMPTY)
+
+#undef  muvqx_st
+#define muvqx_st(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVW(RMB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x11)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movqx_nt
+#define movqx_nt(XS, MD, DD)                                                \
+    ADR EVW(RXB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VAL(DD)), EMPTY)                                 \
+    ADR EVW(RMB(XS), RXB(MD),    0x00, K, 1, 1) EMITB(0x2B)                 \
+        MRM(REG(XS),    0x02, REG(MD))                                      \
+        AUX(SIB(MD), EMITW(VZL(DD)), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -1582,7 +1703,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmaqs_rr(XG, XS, XT)                                                \
         EVW(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xB8)                 \
@@ -1604,7 +1725,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsqs_rr(XG, XS, XT)                                                \
         EVW(RXB(XG), RXB(XT), REN(XS), K, 1, 2) EMITB(0xBC)                 \
@@ -1769,6 +1769,26 @@
         MRM(REG(RD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
+/* prf (prefetch cache line at adr S into cache level given by hint)
+ * set-flags: no
+ * hint: L1 - all levels, L2 - outer levels, NT - non-temporal (streaming)
+ * never faults, treated as a no-op where the hint is not supported */
+
+#define RT_BASE_HINT_L1     0x01    /* prefetcht0 */
+#define RT_BASE_HINT_L2     0x02    /* prefetcht1 */
+#define RT_BASE_HINT_NT     0x00    /* prefetchnta */
+
+#define prfxx_ld(MS, DS, hint)                                              \
+        EMITB(0x0F) EMITB(0x18)                                             \
+        MRM(RT_BASE_HINT_##hint, MOD(MS), REG(MS))                          \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+/* fence (orders preceding non-temporal stores before subsequent stores)
+ * set-flags: no */
+
+#define fence_xx()                                                          \
+        EMITB(0x0F) EMITB(0xAE) EMITB(0xF8)   /* sfence */
+
 /************************* pointer-sized instructions *************************/
 
 /* label (D = Reax = adr lb)
@@ -176,6 +176,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+        EMITB(0x0F) EMITB(0x10)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+        EMITB(0x0F) EMITB(0x11)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movix_nt
+#define movix_nt(XS, MD, DD)                                                \
+        EMITB(0x0F) EMITB(0x2B)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 
 #define movjx_rr(XD, XS)                                                    \
     ESC EMITB(0x0F) EMITB(0x28)                                             \
@@ -191,6 +214,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvjx_ld
+#define muvjx_ld(XD, MS, DS)                                                \
+    ESC EMITB(0x0F) EMITB(0x10)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvjx_st
+#define muvjx_st(XS, MD, DD)                                                \
+    ESC EMITB(0x0F) EMITB(0x11)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movjx_nt
+#define movjx_nt(XS, MD, DD)                                                \
+    ESC EMITB(0x0F) EMITB(0x2B)                                             \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -516,6 +562,145 @@
         /* adp, adh are defined in rtbase.h (first 15-regs only)
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+        /* shf (pshufd), shp (shufps) keep horizontal ops in registers,
+         * replacing per-element scalar round-trips via scratch area,
+         * hrz walks lanes of S in Gray-code order (D = shf(D) op S),
+         * thus needs no temp-reg, if (#D == #S) S is spilled once,
+         * lane 0 is broadcast for add/mul as lanes round differently */
+
+#if (RT_128X1 < 2)
+
+#define shfix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        movix_rr(W(XD), W(XS))                                              \
+        EMITB(0x0F) EMITB(0xC6)                                             \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfix_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+        movix_ld(W(XD), W(MS), W(DS))                                       \
+        EMITB(0x0F) EMITB(0xC6)                                             \
+        MRM(REG(XD), MOD(XD), REG(XD))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#else /* RT_128X1 >= 2 */
+
+#define shfix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+    ESC EMITB(0x0F) EMITB(0x70)                                             \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfix_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+    ESC EMITB(0x0F) EMITB(0x70)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#endif /* RT_128X1 >= 2 */
+
+#define shpis_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+        EMITB(0x0F) EMITB(0xC6)                                             \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REG(XD), REG(XS))                                          \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzis_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzis_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0xB1))                             \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#define hrzjs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REG(XD), REG(XS))                                          \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzjs_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzjs_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x4E))                             \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#if (RT_128X1 < 4)
+
+#undef  adpis3rr
+#define adpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        adpis_rx(W(XD))
+
+#undef  adpis3ld
+#define adpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        adpis_rx(W(XD))
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzis_rr(W(XD), W(XS), addis)                                       \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  adhis_ld
+#define adhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), addis)                                \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  adpis_rx
+#define adpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        addis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        addis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
+#undef  adpjs3rr
+#define adpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        adpjs_rx(W(XD))
+
+#undef  adpjs3ld
+#define adpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        adpjs_rx(W(XD))
+
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        hrzjs_rr(W(XD), W(XS), addjs)
+
+#undef  adhjs_ld
+#define adhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), addjs)
+
+#undef  adpjs_rx
+#define adpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        addjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        addjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
+#endif /* RT_128X1 < 4 */
+
 #if (RT_128X1 >= 4)
 
 #undef  adpis_rr
@@ -640,6 +825,68 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlpis3rr
+#define mlpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlpis_rx(W(XD))
+
+#undef  mlpis3ld
+#define mlpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlpis_rx(W(XD))
+
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzis_rr(W(XD), W(XS), mulis)                                       \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlhis_ld
+#define mlhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), mulis)                                \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlpis_rx
+#define mlpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        mulis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        mulis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
+#undef  mlpjs3rr
+#define mlpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mlpjs_rx(W(XD))
+
+#undef  mlpjs3ld
+#define mlpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mlpjs_rx(W(XD))
+
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzjs_rr(W(XD), W(XS), muljs)
+
+#undef  mlhjs_ld
+#define mlhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), muljs)
+
+#undef  mlpjs_rx
+#define mlpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        muljs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        muljs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -762,7 +1009,7 @@
         addis_rr(W(XG), W(XS))                                              \
         movix_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -848,7 +1095,7 @@
         subis_rr(W(XG), W(XS))                                              \
         movix_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -937,9 +1184,86 @@
         movix_rr(W(XD), W(XS))                                              \
         minis_ld(W(XD), W(MT), W(DT))
 
+#define minjs_rr(XG, XS)                                                    \
+    ESC EMITB(0x0F) EMITB(0x5D)                                             \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define minjs_ld(XG, MS, DS)                                                \
+    ESC EMITB(0x0F) EMITB(0x5D)                                             \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define minjs3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        minjs_rr(W(XD), W(XT))
+
+#define minjs3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        minjs_ld(W(XD), W(MT), W(DT))
+
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnpis3rr
+#define mnpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mnpis_rx(W(XD))
+
+#undef  mnpis3ld
+#define mnpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mnpis_rx(W(XD))
+
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), minis)
+
+#undef  mnhis_ld
+#define mnhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), minis)
+
+#undef  mnpis_rx
+#define mnpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        minis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        minis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
+#undef  mnpjs3rr
+#define mnpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mnpjs_rx(W(XD))
+
+#undef  mnpjs3ld
+#define mnpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mnpjs_rx(W(XD))
+
+#undef  mnhjs_rr
+#define mnhjs_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzjs_rr(W(XD), W(XS), minjs)
+
+#undef  mnhjs_ld
+#define mnhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), minjs)
+
+#undef  mnpjs_rx
+#define mnpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        minjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        minjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -959,9 +1283,86 @@
         movix_rr(W(XD), W(XS))                                              \
         maxis_ld(W(XD), W(MT), W(DT))
 
+#define maxjs_rr(XG, XS)                                                    \
+    ESC EMITB(0x0F) EMITB(0x5F)                                             \
+        MRM(REG(XG), MOD(XS), REG(XS))
+
+#define maxjs_ld(XG, MS, DS)                                                \
+    ESC EMITB(0x0F) EMITB(0x5F)                                             \
+        MRM(REG(XG), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#define maxjs3rr(XD, XS, XT)                                                \
+        movjx_rr(W(XD), W(XS))                                              \
+        maxjs_rr(W(XD), W(XT))
+
+#define maxjs3ld(XD, XS, MT, DT)                                            \
+        movjx_rr(W(XD), W(XS))                                              \
+        maxjs_ld(W(XD), W(MT), W(DT))
+
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxpis3rr
+#define mxpis3rr(XD, XS, XT)                                                \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mxpis_rx(W(XD))
+
+#undef  mxpis3ld
+#define mxpis3ld(XD, XS, MT, DT)                                            \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_ld(W(XD), W(MT), W(DT))                                       \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mxpis_rx(W(XD))
+
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), maxis)
+
+#undef  mxhis_ld
+#define mxhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), maxis)
+
+#undef  mxpis_rx
+#define mxpis_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0xB1))                       \
+        maxis_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0xB1))                       \
+        maxis_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x88))
+
+#undef  mxpjs3rr
+#define mxpjs3rr(XD, XS, XT)                                                \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XT), Mebp, inf_SCR02(0))                                 \
+        mxpjs_rx(W(XD))
+
+#undef  mxpjs3ld
+#define mxpjs3ld(XD, XS, MT, DT)                                            \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_ld(W(XD), W(MT), W(DT))                                       \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        mxpjs_rx(W(XD))
+
+#undef  mxhjs_rr
+#define mxhjs_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzjs_rr(W(XD), W(XS), maxjs)
+
+#undef  mxhjs_ld
+#define mxhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), maxjs)
+
+#undef  mxpjs_rx
+#define mxpjs_rx(XD) /* not portable, do not use outside */                 \
+        shfix_ld(W(XD), Mebp, inf_SCR02(0), IB(0x4E))                       \
+        maxjs_ld(W(XD), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        shfix_ld(W(XD), Mebp, inf_SCR01(0), IB(0x4E))                       \
+        maxjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        shpis_ld(W(XD), Mebp, inf_SCR02(0), IB(0x44))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -5297,7 +5698,7 @@
         addrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -5371,7 +5772,7 @@
         subrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -5633,7 +6034,7 @@
 #if RT_SIMD_FAST_FCTRL == 0
 
 #define FCTRL_SET(mode)   /* sets given mode into fp control register */    \
-        movwx_mi(Mebp, inf_SCR02(4), IH(RT_SIMD_MODE_##mode << 13 | 0x1F80))\
+        movwx_mi(Mebp, inf_SCR02(4), IH(RT_SIMD_MODE_##mode << 13 | 0x1F80)) \
         mxcsr_ld(Mebp, inf_SCR02(4))
 
 #define FCTRL_RESET()     /* resumes default mode (ROUNDN) upon leave */    \
@@ -168,6 +168,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvix_ld
+#define muvix_ld(XD, MS, DS)                                                \
+        V2X(0x00,    0, 0) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvix_st
+#define muvix_st(XS, MD, DD)                                                \
+        V2X(0x00,    0, 0) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movix_nt
+#define movix_nt(XS, MD, DD)                                                \
+        V2X(0x00,    0, 0) EMITB(0x2B)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 
 #define movjx_rr(XD, XS)                                                    \
         V2X(0x00,    0, 1) EMITB(0x28)                                      \
@@ -183,6 +206,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvjx_ld
+#define muvjx_ld(XD, MS, DS)                                                \
+        V2X(0x00,    0, 1) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvjx_st
+#define muvjx_st(XS, MD, DD)                                                \
+        V2X(0x00,    0, 1) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movjx_nt
+#define movjx_nt(XS, MD, DD)                                                \
+        V2X(0x00,    0, 1) EMITB(0x2B)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -475,6 +521,66 @@
         MRM(REG(XD), MOD(MT), REG(MT))                                      \
         AUX(SIB(MT), CMD(DT), EMPTY)
 
+        /* shf (vpermilps) keeps horizontal ops in registers, replacing
+         * per-element scalar round-trips via scratch area, adh reduces
+         * with adp (vhaddps/pd) leaving the sum in all elements,
+         * hrz walks lanes of S in Gray-code order (D = shf(D) op S),
+         * thus needs no temp-reg, if (#D == #S) S is spilled once,
+         * lane 0 is broadcast for mul as lanes round differently */
+
+#define shfix_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(0x00,    0, 1, 3) EMITB(0x04)                                   \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfix_ld(XD, MS, DS, IT) /* not portable, do not use outside */     \
+        VEX(0x00,    0, 1, 3) EMITB(0x04)                                   \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMITB(VAL(IT)))
+
+#define hrzis_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REG(XD), REG(XS))                                          \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzis_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzis_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0xB1))                             \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0x4E))                                    \
+        op##_ld(W(XD), W(MS), W(DS))                                        \
+        shfix_rr(W(XD), W(XD), IB(0xB1))                                    \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#define hrzjs_rr(XD, XS, op) /* not portable, do not use outside */         \
+        ASM_IFEQ(REG(XD), REG(XS))                                          \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        hrzjs_ld(W(XD), Mebp, inf_SCR01(0), op)                             \
+        ASM_ELSE                                                            \
+        shfix_rr(W(XD), W(XS), IB(0x4E))                                    \
+        op##_rr(W(XD), W(XS))                                               \
+        ASM_ENDI
+
+#define hrzjs_ld(XD, MS, DS, op) /* not portable, do not use outside */     \
+        shfix_ld(W(XD), W(MS), W(DS), IB(0x4E))                             \
+        op##_ld(W(XD), W(MS), W(DS))
+
+#undef  adhis_rr
+#define adhis_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        adpis3rr(W(XD), W(XS), W(XS))                                       \
+        adpis3rr(W(XD), W(XD), W(XD))
+
+#undef  adhjs_rr
+#define adhjs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        adpjs3rr(W(XD), W(XS), W(XS))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subis_rr(XG, XS)                                                    \
@@ -544,6 +650,24 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhis_rr
+#define mlhis_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzis_rr(W(XD), W(XS), mulis)                                       \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlhis_ld
+#define mlhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), mulis)                                \
+        shfix_rr(W(XD), W(XD), IB(0x00))
+
+#undef  mlhjs_rr
+#define mlhjs_rr(XD, XS) /* horizontal reductive mul */                     \
+        hrzjs_rr(W(XD), W(XS), muljs)
+
+#undef  mlhjs_ld
+#define mlhjs_ld(XD, MS, DS)                                                \
+        hrzjs_ld(W(XD), W(MS), W(DS), muljs)
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divis_rr(XG, XS)                                                    \
@@ -664,7 +788,7 @@
         addis_rr(W(XG), W(XS))                                              \
         movix_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -708,7 +832,7 @@
         subis_rr(W(XG), W(XS))                                              \
         movix_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -740,7 +864,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmais_rr(XG, XS, XT)                                                \
         VEX(REG(XS), 0, 1, 2) EMITB(0xB8)                                   \
@@ -757,7 +881,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsis_rr(XG, XS, XT)                                                \
         VEX(REG(XS), 0, 1, 2) EMITB(0xBC)                                   \
@@ -794,6 +918,14 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhis_rr
+#define mnhis_rr(XD, XS) /* horizontal reductive min */                     \
+        hrzis_rr(W(XD), W(XS), minis)
+
+#undef  mnhis_ld
+#define mnhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), minis)
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxis_rr(XG, XS)                                                    \
@@ -814,6 +946,14 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhis_rr
+#define mxhis_rr(XD, XS) /* horizontal reductive max */                     \
+        hrzis_rr(W(XD), W(XS), maxis)
+
+#undef  mxhis_ld
+#define mxhis_ld(XD, MS, DS)                                                \
+        hrzis_ld(W(XD), W(MS), W(DS), maxis)
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqis_rr(XG, XS)                                                    \
@@ -3416,7 +3556,7 @@
         addrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -3490,7 +3630,7 @@
         subrs_rr(W(XG), W(XS))                                              \
         movrs_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #if RT_SIMD_COMPAT_FMR == 0
 
@@ -3552,7 +3692,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmars_rr(XG, XS, XT)                                                \
         VEX(REG(XS), 0, 1, 2) EMITB(0xB9)                                   \
@@ -3569,7 +3709,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmsrs_rr(XG, XS, XT)                                                \
         VEX(REG(XS), 0, 1, 2) EMITB(0xBD)                                   \
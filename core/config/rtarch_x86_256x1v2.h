@@ -163,6 +163,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvcx_ld
+#define muvcx_ld(XD, MS, DS)                                                \
+        V2X(0x00,    1, 0) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvcx_st
+#define muvcx_st(XS, MD, DD)                                                \
+        V2X(0x00,    1, 0) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movcx_nt
+#define movcx_nt(XS, MD, DD)                                                \
+        V2X(0x00,    1, 0) EMITB(0x2B)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 
 #define movdx_rr(XD, XS)                                                    \
         V2X(0x00,    1, 1) EMITB(0x28)                                      \
@@ -178,6 +201,29 @@
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#undef  muvdx_ld
+#define muvdx_ld(XD, MS, DS)                                                \
+        V2X(0x00,    1, 1) EMITB(0x10)                                      \
+        MRM(REG(XD), MOD(MS), REG(MS))                                      \
+        AUX(SIB(MS), CMD(DS), EMPTY)
+
+#undef  muvdx_st
+#define muvdx_st(XS, MD, DD)                                                \
+        V2X(0x00,    1, 1) EMITB(0x11)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
+        /* mov-nt is defined in rtbase.h
+         * under "COMMON SIMD INSTRUCTIONS" section */
+
+#undef  movdx_nt
+#define movdx_nt(XS, MD, DD)                                                \
+        V2X(0x00,    1, 1) EMITB(0x2B)                                      \
+        MRM(REG(XS), MOD(MD), REG(MD))                                      \
+        AUX(SIB(MD), CMD(DD), EMPTY)
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -466,6 +512,40 @@
         adpjs_ld(W(XD), Mebp, inf_SCR02(0x10))                              \
         movjx_st(W(XD), Mebp, inf_SCR01(0x10))
 
+        /* shf (vpermilps/pd), prm (vperm2f128) keep horizontal ops
+         * in registers, replacing scalar round-trips via scratch area */
+
+#define shfcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(0x00,    1, 1, 3) EMITB(0x04)                                   \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#define shfdx_rr(XD, XS, IT) /* not portable, do not use outside */         \
+        VEX(0x00,    1, 1, 3) EMITB(0x05)                                   \
+        MRM(REG(XD), MOD(XS), REG(XS))                                      \
+        AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
+
+#undef  adhcs_rr
+#define adhcs_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XS), IB(0xB1))                                    \
+        addcs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        addcs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        addcs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  adhds_rr
+#define adhds_rr(XD, XS) /* horizontal reductive add, first 15-regs only */ \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfdx_rr(W(XD), W(XS), IB(0x05))                                    \
+        addds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        addds_ld(W(XD), Mebp, inf_SCR01(0))
+
 /* sub (G = G - S), (D = S - T) if (#D != #T) */
 
 #define subcs_rr(XG, XS)                                                    \
@@ -535,6 +615,27 @@
         /* mlp, mlh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mlhcs_rr
+#define mlhcs_rr(XD, XS) /* horizontal reductive mul */                     \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XS), IB(0xB1))                                    \
+        mulcs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        mulcs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        mulcs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mlhds_rr
+#define mlhds_rr(XD, XS) /* horizontal reductive mul */                     \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfdx_rr(W(XD), W(XS), IB(0x05))                                    \
+        mulds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        mulds_ld(W(XD), Mebp, inf_SCR01(0))
+
 /* div (G = G / S), (D = S / T) if (#D != #T) and on ARMv7 if (#D != #S) */
 
 #define divcs_rr(XG, XS)                                                    \
@@ -635,13 +736,13 @@
         /* rse, rss, rsq are defined in rtconf.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
-#if (RT_256X1 < 2) && !(RT_SIMD == 128 && RT_128X1 == 16)
-
 #define prmcx_rr(XD, XS, IT) /* not portable, do not use outside */         \
         VEX(REG(XD), 1, 1, 3) EMITB(0x06)                                   \
         MRM(REG(XD), MOD(XS), REG(XS))                                      \
         AUX(EMPTY,   EMPTY,   EMITB(VAL(IT)))
 
+#if (RT_256X1 < 2) && !(RT_SIMD == 128 && RT_128X1 == 16)
+
 #define cvycs_rr(XD, XS)     /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x5A)                                      \
         MRM(REG(XD), MOD(XS), REG(XS))
@@ -675,7 +776,7 @@
         addcs_rr(W(XG), W(XS))                                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMA == 1
+#elif RT_SIMD_COMPAT_FMA != 2
 
 #define fmacs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -740,7 +841,7 @@
         subcs_rr(W(XG), W(XS))                                              \
         movcx_ld(W(XS), Mebp, inf_SCR01(0))
 
-#elif RT_SIMD_COMPAT_FMS == 1
+#elif RT_SIMD_COMPAT_FMS != 2
 
 #define fmscs_rr(XG, XS, XT)                                                \
         movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
@@ -793,7 +894,7 @@
  * NOTE: x87 fpu-fallbacks for fma/fms use round-to-nearest mode by default,
  * enable RT_SIMD_COMPAT_FMR for current SIMD rounding mode to be honoured */
 
-#if RT_SIMD_COMPAT_FMA <= 1
+#if RT_SIMD_COMPAT_FMA != 2
 
 #define fmacs_rr(XG, XS, XT)                                                \
         VEX(REG(XS), 1, 1, 2) EMITB(0xB8)                                   \
@@ -810,7 +911,7 @@
  * NOTE: due to final negation being outside of rounding on all POWER systems
  * only symmetric rounding modes (RN, RZ) are compatible across all targets */
 
-#if RT_SIMD_COMPAT_FMS <= 1
+#if RT_SIMD_COMPAT_FMS != 2
 
 #define fmscs_rr(XG, XS, XT)                                                \
         VEX(REG(XS), 1, 1, 2) EMITB(0xBC)                                   \
@@ -847,6 +948,27 @@
         /* mnp, mnh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mnhcs_rr
+#define mnhcs_rr(XD, XS) /* horizontal reductive min */                     \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XS), IB(0xB1))                                    \
+        mincs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        mincs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        mincs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mnhds_rr
+#define mnhds_rr(XD, XS) /* horizontal reductive min */                     \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfdx_rr(W(XD), W(XS), IB(0x05))                                    \
+        minds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        minds_ld(W(XD), Mebp, inf_SCR01(0))
+
 /* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
 
 #define maxcs_rr(XG, XS)                                                    \
@@ -867,6 +989,27 @@
         /* mxp, mxh are defined in rtbase.h
          * under "COMMON SIMD INSTRUCTIONS" section */
 
+#undef  mxhcs_rr
+#define mxhcs_rr(XD, XS) /* horizontal reductive max */                     \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XS), IB(0xB1))                                    \
+        maxcs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfcx_rr(W(XD), W(XD), IB(0x4E))                                    \
+        maxcs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        maxcs_ld(W(XD), Mebp, inf_SCR01(0))
+
+#undef  mxhds_rr
+#define mxhds_rr(XD, XS) /* horizontal reductive max */                     \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfdx_rr(W(XD), W(XS), IB(0x05))                                    \
+        maxds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        prmcx_rr(W(XD), W(XD), IB(1))                                       \
+        maxds_ld(W(XD), Mebp, inf_SCR01(0))
+
 /* ceq (G = G == S ? -1 : 0), (D = S == T ? -1 : 0) if (#D != #T) */
 
 #define ceqcs_rr(XG, XS)                                                    \
@@ -4861,24 +5004,24 @@
 
 #if   (RT_SIMD == 256)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define mrvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x28)                                      \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define mrvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x29)                                      \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
 
 #elif (RT_SIMD == 128)
 
-#define muvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+#define mrvcx_ld(XD, MS, DS) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x10)                                      \
         MRM(REG(XD), MOD(MS), REG(MS))                                      \
         AUX(SIB(MS), CMD(DS), EMPTY)
 
-#define muvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
+#define mrvcx_st(XS, MD, DD) /* not portable, do not use outside */         \
         V2X(0x00,    1, 0) EMITB(0x11)                                      \
         MRM(REG(XS), MOD(MD), REG(MD))                                      \
         AUX(SIB(MD), CMD(DD), EMPTY)
@@ -4890,40 +5033,40 @@
 #undef  sregs_sa
 #define sregs_sa() /* save all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_st(Xmm0, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm1, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm2, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm3, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm4, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm5, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm6, Oeax, PLAIN)                                         \
+        mrvcx_st(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_st(Xmm7, Oeax, PLAIN)
+        mrvcx_st(Xmm7, Oeax, PLAIN)
 
 #undef  sregs_la
 #define sregs_la() /* load all SIMD regs, destroys Reax */                  \
         movxx_ld(Reax, Mebp, inf_REGS)                                      \
-        muvcx_ld(Xmm0, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm0, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm1, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm1, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm2, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm2, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm3, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm3, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm4, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm4, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm5, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm5, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm6, Oeax, PLAIN)                                         \
+        mrvcx_ld(Xmm6, Oeax, PLAIN)                                         \
         addxx_ri(Reax, IB(RT_SIMD_WIDTH32_256*4))                           \
-        muvcx_ld(Xmm7, Oeax, PLAIN)
+        mrvcx_ld(Xmm7, Oeax, PLAIN)
 
 #endif /* RT_256X1 */
 
@@ -11,6 +11,26 @@
 #include <float.h>
 #include <stdlib.h>
 
+#if RT_CODE_GEN != 0 /* runtime code generation, check rtcode.h for details */
+
+#include <string.h>
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+#include <windows.h>
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <sys/mman.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
+#endif /* MAP_ANONYMOUS */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+#endif /* RT_CODE_GEN */
+
 #include "rtzero.h"
 
 /******************************************************************************/
@@ -160,7 +180,8 @@
  * 4 - means 1/4  DP-level (10-bit displacements) has not been exceeded (Q=1).
  * 8 - means 1/8  DP-level  (9-bit displacements) has not been exceeded (Q=1).
  * 16  means 1/16 DP-level  (8-bit displacements) has not been exceeded (Q=1).
- * NOTE: the built-in rt_SIMD_INFO structure is already filled at full 1/16th.
+ * NOTE: the built-in rt_SIMD_INFO structure is filled a bit over 1/16th,
+ * so 8 is the highest level available for all backend structures.
  */
 #ifndef RT_DATA
 #define RT_DATA 1
@@ -855,6 +876,8 @@ typedef const char         *rt_pstr;
                              (a)  >=  +1.0f ?  0.0f :                       \
                              acosf(a))
 
+#define RT_ATAN32(a, b)     (atan2f(a, b))
+
 #define RT_SINA32(a)        ((a) == -270.0f ? +1.0f :                       \
                              (a) == -180.0f ?  0.0f :                       \
                              (a) ==  -90.0f ? -1.0f :                       \
@@ -909,6 +932,8 @@ typedef const char         *rt_pstr;
                              (a)  >=  +1.0 ?  0.0 :                         \
                              acos(a))
 
+#define RT_ATAN64(a, b)     (atan2(a, b))
+
 #define RT_SINA64(a)        ((a) == -270.0 ? +1.0 :                         \
                              (a) == -180.0 ?  0.0 :                         \
                              (a) ==  -90.0 ? -1.0 :                         \
@@ -943,6 +968,7 @@ typedef const char         *rt_pstr;
 #define RT_COS(a)           RT_COS32(a)
 #define RT_ASIN(a)          RT_ASIN32(a)
 #define RT_ACOS(a)          RT_ACOS32(a)
+#define RT_ATAN(a, b)       RT_ATAN32(a, b)
 #define RT_SINA(a)          RT_SINA32(a)
 #define RT_COSA(a)          RT_COSA32(a)
 
@@ -962,6 +988,7 @@ typedef const char         *rt_pstr;
 #define RT_COS(a)           RT_COS64(a)
 #define RT_ASIN(a)          RT_ASIN64(a)
 #define RT_ACOS(a)          RT_ACOS64(a)
+#define RT_ATAN(a, b)       RT_ATAN64(a, b)
 #define RT_SINA(a)          RT_SINA64(a)
 #define RT_COSA(a)          RT_COSA64(a)
 
@@ -971,6 +998,23 @@ typedef const char         *rt_pstr;
 /*************************   SIMD BACKEND STRUCTURE   *************************/
 /******************************************************************************/
 
+/*
+ * RT_MATH_SCALAR selects storage of elementary math constants in rt_SIMD_MATH.
+ * 0 - means full SIMD-width copies are stored and used by load-op forms.
+ * 1 - means only scalars are stored and broadcast with movpx_bc when used,
+ *     math functions then touch one vector (mat_SCR05) and 8 bytes per
+ *     constant instead of 45 vectors, the structure shrinks accordingly.
+ * General purpose constants (inf_GPC*) are kept as full vectors in both
+ * modes as backends consume them directly via load-op forms.
+ * Math constants are kept outside of rt_SIMD_INFO (in rt_SIMD_REGS),
+ * derived structures should start at RT_SIMD_INFO_SIZE (vector aligned).
+ */
+#ifndef RT_MATH_SCALAR
+#define RT_MATH_SCALAR 0
+#endif /* RT_MATH_SCALAR */
+
+#define RT_SIMD_INFO_SIZE   (Q*0x130)
+
 /*
  * SIMD info structure for ASM_ENTER/ASM_LEAVE contains internal variables
  * and general purpose constants used internally by some instructions.
@@ -1043,8 +1087,333 @@ struct rt_SIMD_INFO
     rt_si64 gpc06_64[T];    /* 0x8000000000000000 */
 #define inf_GPC06_64        DP(Q*0x0F0)
 
+    /* internal variables */
+
+    rt_elem scr03[S];       /* scratchpad3, internal */
+#define inf_SCR03(nx)       DP(Q*0x100 + nx)
+
+    rt_elem scr04[S];       /* scratchpad4, internal */
+#define inf_SCR04(nx)       DP(Q*0x110 + nx)
+
+    rt_ui64 mat;            /* math constants storage <- rt_SIMD_MATH */
+#define inf_MAT             DP(Q*0x120+C)
+
+    rt_ui32 pad01[R-2];     /* reserved, do not use! */
+#define inf_PAD01(nx)       DP(Q*0x120 + 0x008 + nx)
+
+};
+
+/*
+ * SIMD math structure for elementary math meta-instructions (expps_rr, ...)
+ * contains polynomial coefficients and reduction constants set by ASM_INIT,
+ * it's kept at the end of rt_SIMD_REGS and its address is stored in inf_MAT,
+ * math meta-instructions load it into Redi (saved on the stack) and use
+ * MAT offsets below relative to it, leaving rt_SIMD_INFO compact.
+ * As the size of the structure is fixed, its displacements (DM) don't depend
+ * on RT_DATA and are chosen to fit 45 full vectors at a given Q.
+ * Structure is read-write in backend (scalar mode uses mat_SCR05).
+ */
+#if   RT_MATH_SCALAR == 0 && Q == 16
+#define DM(dp) _DF(dp)
+#elif RT_MATH_SCALAR == 0 && Q == 8
+#define DM(dp) _DE(dp)
+#else  /* Q <= 4 or RT_MATH_SCALAR == 1 */
+#define DM(dp) _DP(dp)
+#endif /* Q: 16, 8, 4, 2, 1 */
+
+struct rt_SIMD_MATH
+{
+#if RT_MATH_SCALAR == 0
+
+    /* elementary math constants (configurable element) */
+
+    rt_real exp01[S];       /* log2(e) */
+#define mat_EXP01           DM(Q*0x000)
+
+    rt_real exp02[S];       /* ln(2) hi */
+#define mat_EXP02           DM(Q*0x010)
+
+    rt_real exp03[S];       /* ln(2) lo */
+#define mat_EXP03           DM(Q*0x020)
+
+    rt_real exp04[S];       /* exp upper clamp */
+#define mat_EXP04           DM(Q*0x030)
+
+    rt_real exp05[S];       /* exp lower clamp */
+#define mat_EXP05           DM(Q*0x040)
+
+    rt_real exp06[S];       /* exp poly P1 */
+#define mat_EXP06           DM(Q*0x050)
+
+    rt_real exp07[S];       /* exp poly P2 */
+#define mat_EXP07           DM(Q*0x060)
+
+    rt_real exp08[S];       /* exp poly P3 */
+#define mat_EXP08           DM(Q*0x070)
+
+    rt_real exp09[S];       /* exp poly P4 */
+#define mat_EXP09           DM(Q*0x080)
+
+    rt_real exp10[S];       /* exp poly P5 */
+#define mat_EXP10           DM(Q*0x090)
+
+    rt_real log01[S];       /* sqrt(2) */
+#define mat_LOG01           DM(Q*0x0A0)
+
+    rt_real log02[S];       /* log poly Lg1 */
+#define mat_LOG02           DM(Q*0x0B0)
+
+    rt_real log03[S];       /* log poly Lg2 */
+#define mat_LOG03           DM(Q*0x0C0)
+
+    rt_real log04[S];       /* log poly Lg3 */
+#define mat_LOG04           DM(Q*0x0D0)
+
+    rt_real log05[S];       /* log poly Lg4 */
+#define mat_LOG05           DM(Q*0x0E0)
+
+    rt_real log06[S];       /* log poly Lg5 */
+#define mat_LOG06           DM(Q*0x0F0)
+
+    rt_real log07[S];       /* log poly Lg6 */
+#define mat_LOG07           DM(Q*0x100)
+
+    rt_real log08[S];       /* log poly Lg7 */
+#define mat_LOG08           DM(Q*0x110)
+
+    rt_real trg01[S];       /* 2/pi */
+#define mat_TRG01           DM(Q*0x120)
+
+    rt_real trg02[S];       /* pi/2 part1 */
+#define mat_TRG02           DM(Q*0x130)
+
+    rt_real trg03[S];       /* pi/2 part2 */
+#define mat_TRG03           DM(Q*0x140)
+
+    rt_real trg04[S];       /* pi/2 part3 */
+#define mat_TRG04           DM(Q*0x150)
+
+    rt_real trg05[S];       /* sin poly S1 */
+#define mat_TRG05           DM(Q*0x160)
+
+    rt_real trg06[S];       /* sin poly S2 */
+#define mat_TRG06           DM(Q*0x170)
+
+    rt_real trg07[S];       /* sin poly S3 */
+#define mat_TRG07           DM(Q*0x180)
+
+    rt_real trg08[S];       /* sin poly S4 */
+#define mat_TRG08           DM(Q*0x190)
+
+    rt_real trg09[S];       /* sin poly S5 */
+#define mat_TRG09           DM(Q*0x1A0)
+
+    rt_real trg10[S];       /* sin poly S6 */
+#define mat_TRG10           DM(Q*0x1B0)
+
+    rt_real trg11[S];       /* cos poly C1 */
+#define mat_TRG11           DM(Q*0x1C0)
+
+    rt_real trg12[S];       /* cos poly C2 */
+#define mat_TRG12           DM(Q*0x1D0)
+
+    rt_real trg13[S];       /* cos poly C3 */
+#define mat_TRG13           DM(Q*0x1E0)
+
+    rt_real trg14[S];       /* cos poly C4 */
+#define mat_TRG14           DM(Q*0x1F0)
+
+    rt_real trg15[S];       /* cos poly C5 */
+#define mat_TRG15           DM(Q*0x200)
+
+    rt_real trg16[S];       /* cos poly C6 */
+#define mat_TRG16           DM(Q*0x210)
+
+    rt_real atn01[S];       /* atan poly aT0 */
+#define mat_ATN01           DM(Q*0x220)
+
+    rt_real atn02[S];       /* atan poly aT1 */
+#define mat_ATN02           DM(Q*0x230)
+
+    rt_real atn03[S];       /* atan poly aT2 */
+#define mat_ATN03           DM(Q*0x240)
+
+    rt_real atn04[S];       /* atan poly aT3 */
+#define mat_ATN04           DM(Q*0x250)
+
+    rt_real atn05[S];       /* atan poly aT4 */
+#define mat_ATN05           DM(Q*0x260)
+
+    rt_real atn06[S];       /* atan poly aT5 */
+#define mat_ATN06           DM(Q*0x270)
+
+    rt_real atn07[S];       /* atan poly aT6 */
+#define mat_ATN07           DM(Q*0x280)
+
+    rt_real atn08[S];       /* atan poly aT7 */
+#define mat_ATN08           DM(Q*0x290)
+
+    rt_real atn09[S];       /* atan poly aT8 */
+#define mat_ATN09           DM(Q*0x2A0)
+
+    rt_real atn10[S];       /* atan poly aT9 */
+#define mat_ATN10           DM(Q*0x2B0)
+
+    rt_real atn11[S];       /* atan poly aT10 */
+#define mat_ATN11           DM(Q*0x2C0)
+
+#else  /* RT_MATH_SCALAR == 1 */
+
+    /* elementary math constants (configurable element), scalars */
+
+    rt_real scr05[S];       /* scratchpad5, math only */
+#define mat_SCR05(nx)       DM(Q*0x000 + nx)
+
+    rt_real exp01[2*S/R];   /* log2(e) */
+#define mat_EXP01           DM(Q*0x010 + 0x000)
+
+    rt_real exp02[2*S/R];   /* ln(2) hi */
+#define mat_EXP02           DM(Q*0x010 + 0x008)
+
+    rt_real exp03[2*S/R];   /* ln(2) lo */
+#define mat_EXP03           DM(Q*0x010 + 0x010)
+
+    rt_real exp04[2*S/R];   /* exp upper clamp */
+#define mat_EXP04           DM(Q*0x010 + 0x018)
+
+    rt_real exp05[2*S/R];   /* exp lower clamp */
+#define mat_EXP05           DM(Q*0x010 + 0x020)
+
+    rt_real exp06[2*S/R];   /* exp poly P1 */
+#define mat_EXP06           DM(Q*0x010 + 0x028)
+
+    rt_real exp07[2*S/R];   /* exp poly P2 */
+#define mat_EXP07           DM(Q*0x010 + 0x030)
+
+    rt_real exp08[2*S/R];   /* exp poly P3 */
+#define mat_EXP08           DM(Q*0x010 + 0x038)
+
+    rt_real exp09[2*S/R];   /* exp poly P4 */
+#define mat_EXP09           DM(Q*0x010 + 0x040)
+
+    rt_real exp10[2*S/R];   /* exp poly P5 */
+#define mat_EXP10           DM(Q*0x010 + 0x048)
+
+    rt_real log01[2*S/R];   /* sqrt(2) */
+#define mat_LOG01           DM(Q*0x010 + 0x050)
+
+    rt_real log02[2*S/R];   /* log poly Lg1 */
+#define mat_LOG02           DM(Q*0x010 + 0x058)
+
+    rt_real log03[2*S/R];   /* log poly Lg2 */
+#define mat_LOG03           DM(Q*0x010 + 0x060)
+
+    rt_real log04[2*S/R];   /* log poly Lg3 */
+#define mat_LOG04           DM(Q*0x010 + 0x068)
+
+    rt_real log05[2*S/R];   /* log poly Lg4 */
+#define mat_LOG05           DM(Q*0x010 + 0x070)
+
+    rt_real log06[2*S/R];   /* log poly Lg5 */
+#define mat_LOG06           DM(Q*0x010 + 0x078)
+
+    rt_real log07[2*S/R];   /* log poly Lg6 */
+#define mat_LOG07           DM(Q*0x010 + 0x080)
+
+    rt_real log08[2*S/R];   /* log poly Lg7 */
+#define mat_LOG08           DM(Q*0x010 + 0x088)
+
+    rt_real trg01[2*S/R];   /* 2/pi */
+#define mat_TRG01           DM(Q*0x010 + 0x090)
+
+    rt_real trg02[2*S/R];   /* pi/2 part1 */
+#define mat_TRG02           DM(Q*0x010 + 0x098)
+
+    rt_real trg03[2*S/R];   /* pi/2 part2 */
+#define mat_TRG03           DM(Q*0x010 + 0x0A0)
+
+    rt_real trg04[2*S/R];   /* pi/2 part3 */
+#define mat_TRG04           DM(Q*0x010 + 0x0A8)
+
+    rt_real trg05[2*S/R];   /* sin poly S1 */
+#define mat_TRG05           DM(Q*0x010 + 0x0B0)
+
+    rt_real trg06[2*S/R];   /* sin poly S2 */
+#define mat_TRG06           DM(Q*0x010 + 0x0B8)
+
+    rt_real trg07[2*S/R];   /* sin poly S3 */
+#define mat_TRG07           DM(Q*0x010 + 0x0C0)
+
+    rt_real trg08[2*S/R];   /* sin poly S4 */
+#define mat_TRG08           DM(Q*0x010 + 0x0C8)
+
+    rt_real trg09[2*S/R];   /* sin poly S5 */
+#define mat_TRG09           DM(Q*0x010 + 0x0D0)
+
+    rt_real trg10[2*S/R];   /* sin poly S6 */
+#define mat_TRG10           DM(Q*0x010 + 0x0D8)
+
+    rt_real trg11[2*S/R];   /* cos poly C1 */
+#define mat_TRG11           DM(Q*0x010 + 0x0E0)
+
+    rt_real trg12[2*S/R];   /* cos poly C2 */
+#define mat_TRG12           DM(Q*0x010 + 0x0E8)
+
+    rt_real trg13[2*S/R];   /* cos poly C3 */
+#define mat_TRG13           DM(Q*0x010 + 0x0F0)
+
+    rt_real trg14[2*S/R];   /* cos poly C4 */
+#define mat_TRG14           DM(Q*0x010 + 0x0F8)
+
+    rt_real trg15[2*S/R];   /* cos poly C5 */
+#define mat_TRG15           DM(Q*0x010 + 0x100)
+
+    rt_real trg16[2*S/R];   /* cos poly C6 */
+#define mat_TRG16           DM(Q*0x010 + 0x108)
+
+    rt_real atn01[2*S/R];   /* atan poly aT0 */
+#define mat_ATN01           DM(Q*0x010 + 0x110)
+
+    rt_real atn02[2*S/R];   /* atan poly aT1 */
+#define mat_ATN02           DM(Q*0x010 + 0x118)
+
+    rt_real atn03[2*S/R];   /* atan poly aT2 */
+#define mat_ATN03           DM(Q*0x010 + 0x120)
+
+    rt_real atn04[2*S/R];   /* atan poly aT3 */
+#define mat_ATN04           DM(Q*0x010 + 0x128)
+
+    rt_real atn05[2*S/R];   /* atan poly aT4 */
+#define mat_ATN05           DM(Q*0x010 + 0x130)
+
+    rt_real atn06[2*S/R];   /* atan poly aT5 */
+#define mat_ATN06           DM(Q*0x010 + 0x138)
+
+    rt_real atn07[2*S/R];   /* atan poly aT6 */
+#define mat_ATN07           DM(Q*0x010 + 0x140)
+
+    rt_real atn08[2*S/R];   /* atan poly aT7 */
+#define mat_ATN08           DM(Q*0x010 + 0x148)
+
+    rt_real atn09[2*S/R];   /* atan poly aT8 */
+#define mat_ATN09           DM(Q*0x010 + 0x150)
+
+    rt_real atn10[2*S/R];   /* atan poly aT9 */
+#define mat_ATN10           DM(Q*0x010 + 0x158)
+
+    rt_real atn11[2*S/R];   /* atan poly aT10 */
+#define mat_ATN11           DM(Q*0x010 + 0x160)
+
+#endif /* RT_MATH_SCALAR */
+
 };
 
+#if RT_MATH_SCALAR == 0
+#define RT_MATH_SET(s, v)   RT_SIMD_SET(s, v)
+#else  /* RT_MATH_SCALAR == 1 */
+#define RT_MATH_SET(s, v)   s[0]=v
+#endif /* RT_MATH_SCALAR */
+
 #if   RT_ELEMENT == 32
 
 #define inf_GPC01           inf_GPC01_32
@@ -1057,6 +1426,55 @@ struct rt_SIMD_INFO
 #define RT_SIMD_WIDTH       RT_SIMD_WIDTH32
 #define RT_SIMD_SET(s, v)   RT_SIMD_SET32(s, v)
 
+#define RT_SIMD_MANT        23
+
+#define ASM_INIT_MATH(__Math__)                                             \
+    RT_MATH_SET((__Math__)->exp01, +1.442695022e+00f);                      \
+    RT_MATH_SET((__Math__)->exp02, +6.931152344e-01f);                      \
+    RT_MATH_SET((__Math__)->exp03, +3.194618330e-05f);                      \
+    RT_MATH_SET((__Math__)->exp04, +8.837626000e+01f);                      \
+    RT_MATH_SET((__Math__)->exp05, -8.733654785e+01f);                      \
+    RT_MATH_SET((__Math__)->exp06, +1.666666716e-01f);                      \
+    RT_MATH_SET((__Math__)->exp07, -2.777777845e-03f);                      \
+    RT_MATH_SET((__Math__)->exp08, +6.613755977e-05f);                      \
+    RT_MATH_SET((__Math__)->exp09, -1.653390200e-06f);                      \
+    RT_MATH_SET((__Math__)->exp10, +4.138136944e-08f);                      \
+    RT_MATH_SET((__Math__)->log01, +1.414213538e+00f);                      \
+    RT_MATH_SET((__Math__)->log02, +6.666666865e-01f);                      \
+    RT_MATH_SET((__Math__)->log03, +4.000000060e-01f);                      \
+    RT_MATH_SET((__Math__)->log04, +2.857142985e-01f);                      \
+    RT_MATH_SET((__Math__)->log05, +2.222219855e-01f);                      \
+    RT_MATH_SET((__Math__)->log06, +1.818357259e-01f);                      \
+    RT_MATH_SET((__Math__)->log07, +1.531383842e-01f);                      \
+    RT_MATH_SET((__Math__)->log08, +1.479819864e-01f);                      \
+    RT_MATH_SET((__Math__)->trg01, +6.366197467e-01f);                      \
+    RT_MATH_SET((__Math__)->trg02, +1.570312500e+00f);                      \
+    RT_MATH_SET((__Math__)->trg03, +4.837512970e-04f);                      \
+    RT_MATH_SET((__Math__)->trg04, +7.549790126e-08f);                      \
+    RT_MATH_SET((__Math__)->trg05, -1.666666716e-01f);                      \
+    RT_MATH_SET((__Math__)->trg06, +8.333333768e-03f);                      \
+    RT_MATH_SET((__Math__)->trg07, -1.984127011e-04f);                      \
+    RT_MATH_SET((__Math__)->trg08, +2.755731430e-06f);                      \
+    RT_MATH_SET((__Math__)->trg09, -2.505075969e-08f);                      \
+    RT_MATH_SET((__Math__)->trg10, +1.589691018e-10f);                      \
+    RT_MATH_SET((__Math__)->trg11, +4.166666791e-02f);                      \
+    RT_MATH_SET((__Math__)->trg12, -1.388888923e-03f);                      \
+    RT_MATH_SET((__Math__)->trg13, +2.480158764e-05f);                      \
+    RT_MATH_SET((__Math__)->trg14, -2.755731430e-07f);                      \
+    RT_MATH_SET((__Math__)->trg15, +2.087572337e-09f);                      \
+    RT_MATH_SET((__Math__)->trg16, -1.135964760e-11f);                      \
+    RT_MATH_SET((__Math__)->atn01, +3.333333433e-01f);                      \
+    RT_MATH_SET((__Math__)->atn02, -2.000000030e-01f);                      \
+    RT_MATH_SET((__Math__)->atn03, +1.428571492e-01f);                      \
+    RT_MATH_SET((__Math__)->atn04, -1.111111045e-01f);                      \
+    RT_MATH_SET((__Math__)->atn05, +9.090887010e-02f);                      \
+    RT_MATH_SET((__Math__)->atn06, -7.691875845e-02f);                      \
+    RT_MATH_SET((__Math__)->atn07, +6.661073118e-02f);                      \
+    RT_MATH_SET((__Math__)->atn08, -5.833570287e-02f);                      \
+    RT_MATH_SET((__Math__)->atn09, +4.976877943e-02f);                      \
+    RT_MATH_SET((__Math__)->atn10, -3.653157130e-02f);                      \
+    RT_MATH_SET((__Math__)->atn11, +1.628581993e-02f);
+
 #elif RT_ELEMENT == 64
 
 #define inf_GPC01           inf_GPC01_64
@@ -1069,6 +1487,55 @@ struct rt_SIMD_INFO
 #define RT_SIMD_WIDTH       RT_SIMD_WIDTH64
 #define RT_SIMD_SET(s, v)   RT_SIMD_SET64(s, v)
 
+#define RT_SIMD_MANT        52
+
+#define ASM_INIT_MATH(__Math__)                                             \
+    RT_MATH_SET((__Math__)->exp01, +1.44269504088896339e+00);               \
+    RT_MATH_SET((__Math__)->exp02, +6.93147180369123816e-01);               \
+    RT_MATH_SET((__Math__)->exp03, +1.90821492927058770e-10);               \
+    RT_MATH_SET((__Math__)->exp04, +7.09436139303103346e+02);               \
+    RT_MATH_SET((__Math__)->exp05, -7.08396418532264079e+02);               \
+    RT_MATH_SET((__Math__)->exp06, +1.66666666666666019e-01);               \
+    RT_MATH_SET((__Math__)->exp07, -2.77777777770155934e-03);               \
+    RT_MATH_SET((__Math__)->exp08, +6.61375632143793436e-05);               \
+    RT_MATH_SET((__Math__)->exp09, -1.65339022054652515e-06);               \
+    RT_MATH_SET((__Math__)->exp10, +4.13813679705723846e-08);               \
+    RT_MATH_SET((__Math__)->log01, +1.41421356237309515e+00);               \
+    RT_MATH_SET((__Math__)->log02, +6.66666666666673513e-01);               \
+    RT_MATH_SET((__Math__)->log03, +3.99999999994094191e-01);               \
+    RT_MATH_SET((__Math__)->log04, +2.85714287436623915e-01);               \
+    RT_MATH_SET((__Math__)->log05, +2.22221984321497840e-01);               \
+    RT_MATH_SET((__Math__)->log06, +1.81835721616180501e-01);               \
+    RT_MATH_SET((__Math__)->log07, +1.53138376992093733e-01);               \
+    RT_MATH_SET((__Math__)->log08, +1.47981986051165859e-01);               \
+    RT_MATH_SET((__Math__)->trg01, +6.36619772367581382e-01);               \
+    RT_MATH_SET((__Math__)->trg02, +1.57079632673412561e+00);               \
+    RT_MATH_SET((__Math__)->trg03, +6.07710050630396598e-11);               \
+    RT_MATH_SET((__Math__)->trg04, +2.02226624879595063e-21);               \
+    RT_MATH_SET((__Math__)->trg05, -1.66666666666666324e-01);               \
+    RT_MATH_SET((__Math__)->trg06, +8.33333333332248946e-03);               \
+    RT_MATH_SET((__Math__)->trg07, -1.98412698298579493e-04);               \
+    RT_MATH_SET((__Math__)->trg08, +2.75573137070700677e-06);               \
+    RT_MATH_SET((__Math__)->trg09, -2.50507602534068634e-08);               \
+    RT_MATH_SET((__Math__)->trg10, +1.58969099521155010e-10);               \
+    RT_MATH_SET((__Math__)->trg11, +4.16666666666666019e-02);               \
+    RT_MATH_SET((__Math__)->trg12, -1.38888888888741096e-03);               \
+    RT_MATH_SET((__Math__)->trg13, +2.48015872894767294e-05);               \
+    RT_MATH_SET((__Math__)->trg14, -2.75573143513906633e-07);               \
+    RT_MATH_SET((__Math__)->trg15, +2.08757232129817483e-09);               \
+    RT_MATH_SET((__Math__)->trg16, -1.13596475577881948e-11);               \
+    RT_MATH_SET((__Math__)->atn01, +3.33333333333329318e-01);               \
+    RT_MATH_SET((__Math__)->atn02, -1.99999999998764832e-01);               \
+    RT_MATH_SET((__Math__)->atn03, +1.42857142725034664e-01);               \
+    RT_MATH_SET((__Math__)->atn04, -1.11111104054623558e-01);               \
+    RT_MATH_SET((__Math__)->atn05, +9.09088713343650656e-02);               \
+    RT_MATH_SET((__Math__)->atn06, -7.69187620504482999e-02);               \
+    RT_MATH_SET((__Math__)->atn07, +6.66107313738753121e-02);               \
+    RT_MATH_SET((__Math__)->atn08, -5.83357013379057349e-02);               \
+    RT_MATH_SET((__Math__)->atn09, +4.97687799461593236e-02);               \
+    RT_MATH_SET((__Math__)->atn10, -3.65315727442169155e-02);               \
+    RT_MATH_SET((__Math__)->atn11, +1.62858201153657824e-02);
+
 #endif /* RT_ELEMENT */
 
 
@@ -1079,6 +1546,10 @@ struct rt_SIMD_REGS
     rt_ui32 file[64*64];
 #define reg_FILE            DP(Q*0x000)
 
+    /* elementary math constants (see inf_MAT) */
+
+    rt_SIMD_MATH math;
+
 };
 
 #define ASM_INIT(__Info__, __Regs__)                                        \
@@ -1095,6 +1566,8 @@ struct rt_SIMD_REGS
     RT_SIMD_SET64((__Info__)->gpc04_64, LL(0x7FFFFFFFFFFFFFFF));            \
     RT_SIMD_SET64((__Info__)->gpc05_64, LL(0x3FF0000000000000));            \
     RT_SIMD_SET64((__Info__)->gpc06_64, LL(0x8000000000000000));            \
+    ASM_INIT_MATH(&(__Regs__)->math)                                        \
+    __Info__->mat = (rt_ui64)(rt_uptr)(&(__Regs__)->math);                  \
     __Info__->regs = (rt_ui64)(rt_uptr)(__Regs__);
 
 #define ASM_DONE(__Info__)
@@ -1107,7 +1580,7 @@ struct rt_SIMD_REGS
  * SIMD regs (8, 15, 16, 30) in 3rd (highest) byte  <- logical vector registers
  * For interpretation of SIMD target mask check compatibility layer in rtzero.h
  */
-static
+static inline
 rt_si32 mask_init(rt_si32 simd)
 {
     rt_si32 n_simd = (simd >> 0) & 0xFF;
@@ -1285,7 +1758,7 @@ rt_si32 mask_init(rt_si32 simd)
  * SIMD regs (8, 15, 16, 30) in 3rd (highest) byte  <- logical vector registers
  * For interpretation of SIMD target mask check compatibility layer in rtzero.h
  */
-static
+static inline
 rt_si32 from_mask(rt_si32 mask)
 {
     rt_si32 n_simd, s_type, k_size, v_regs;
@@ -3398,385 +3871,385 @@ rt_si32 from_mask(rt_si32 mask)
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x00))                                     \
         remwx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x04))                                     \
         remwx_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x08))                                     \
         remwx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x10))                                     \
         remwx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x14))                                     \
         remwx_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x18))                                     \
         remwx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x20))                                     \
         remwx_xm(Mebp, inf_SCR02(0x20))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x24))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x24))                                     \
         remwx_xm(Mebp, inf_SCR02(0x24))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x24))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x24))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x28))                                     \
         remwx_xm(Mebp, inf_SCR02(0x28))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x2C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x2C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x2C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x2C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x2C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x30))                                     \
         remwx_xm(Mebp, inf_SCR02(0x30))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x34))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x34))                                     \
         remwx_xm(Mebp, inf_SCR02(0x34))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x34))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x34))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x38))                                     \
         remwx_xm(Mebp, inf_SCR02(0x38))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x3C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x3C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x3C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x3C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x3C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x40))                                     \
         remwx_xm(Mebp, inf_SCR02(0x40))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x44))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x44))                                     \
         remwx_xm(Mebp, inf_SCR02(0x44))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x44))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x44))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x48))                                     \
         remwx_xm(Mebp, inf_SCR02(0x48))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x4C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x4C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x4C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x4C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x4C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x50))                                     \
         remwx_xm(Mebp, inf_SCR02(0x50))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x54))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x54))                                     \
         remwx_xm(Mebp, inf_SCR02(0x54))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x54))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x54))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x58))                                     \
         remwx_xm(Mebp, inf_SCR02(0x58))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x5C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x5C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x5C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x5C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x5C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x60))                                     \
         remwx_xm(Mebp, inf_SCR02(0x60))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x64))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x64))                                     \
         remwx_xm(Mebp, inf_SCR02(0x64))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x64))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x64))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x68))                                     \
         remwx_xm(Mebp, inf_SCR02(0x68))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x6C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x6C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x6C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x6C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x6C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x70))                                     \
         remwx_xm(Mebp, inf_SCR02(0x70))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x74))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x74))                                     \
         remwx_xm(Mebp, inf_SCR02(0x74))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x74))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x74))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x78))                                     \
         remwx_xm(Mebp, inf_SCR02(0x78))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x7C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x7C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x7C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x7C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x7C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x80))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x80))                                     \
         remwx_xm(Mebp, inf_SCR02(0x80))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x80))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x80))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x84))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x84))                                     \
         remwx_xm(Mebp, inf_SCR02(0x84))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x84))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x84))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x88))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x88))                                     \
         remwx_xm(Mebp, inf_SCR02(0x88))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x88))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x88))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x8C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x8C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x8C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x8C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x8C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x90))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x90))                                     \
         remwx_xm(Mebp, inf_SCR02(0x90))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x90))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x90))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x94))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x94))                                     \
         remwx_xm(Mebp, inf_SCR02(0x94))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x94))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x94))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x98))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x98))                                     \
         remwx_xm(Mebp, inf_SCR02(0x98))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x98))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x98))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x9C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x9C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x9C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x9C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x9C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xA0))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xA0))                                     \
         remwx_xm(Mebp, inf_SCR02(0xA0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xA0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xA0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xA4))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xA4))                                     \
         remwx_xm(Mebp, inf_SCR02(0xA4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xA4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xA4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xA8))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xA8))                                     \
         remwx_xm(Mebp, inf_SCR02(0xA8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xA8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xA8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xAC))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xAC))                                     \
         remwx_xm(Mebp, inf_SCR02(0xAC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xAC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xAC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xB0))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xB0))                                     \
         remwx_xm(Mebp, inf_SCR02(0xB0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xB0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xB0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xB4))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xB4))                                     \
         remwx_xm(Mebp, inf_SCR02(0xB4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xB4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xB4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xB8))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xB8))                                     \
         remwx_xm(Mebp, inf_SCR02(0xB8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xB8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xB8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xBC))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xBC))                                     \
         remwx_xm(Mebp, inf_SCR02(0xBC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xBC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xBC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xC0))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xC0))                                     \
         remwx_xm(Mebp, inf_SCR02(0xC0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xC0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xC0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xC4))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xC4))                                     \
         remwx_xm(Mebp, inf_SCR02(0xC4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xC4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xC4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xC8))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xC8))                                     \
         remwx_xm(Mebp, inf_SCR02(0xC8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xC8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xC8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xCC))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xCC))                                     \
         remwx_xm(Mebp, inf_SCR02(0xCC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xCC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xCC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xD0))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xD0))                                     \
         remwx_xm(Mebp, inf_SCR02(0xD0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xD0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xD0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xD4))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xD4))                                     \
         remwx_xm(Mebp, inf_SCR02(0xD4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xD4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xD4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xD8))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xD8))                                     \
         remwx_xm(Mebp, inf_SCR02(0xD8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xD8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xD8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xDC))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xDC))                                     \
         remwx_xm(Mebp, inf_SCR02(0xDC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xDC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xDC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xE0))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xE0))                                     \
         remwx_xm(Mebp, inf_SCR02(0xE0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xE0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xE0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xE4))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xE4))                                     \
         remwx_xm(Mebp, inf_SCR02(0xE4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xE4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xE4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xE8))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xE8))                                     \
         remwx_xm(Mebp, inf_SCR02(0xE8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xE8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xE8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xEC))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xEC))                                     \
         remwx_xm(Mebp, inf_SCR02(0xEC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xEC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xEC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xF0))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xF0))                                     \
         remwx_xm(Mebp, inf_SCR02(0xF0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xF0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xF0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xF4))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xF4))                                     \
         remwx_xm(Mebp, inf_SCR02(0xF4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xF4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xF4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xF8))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xF8))                                     \
         remwx_xm(Mebp, inf_SCR02(0xF8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xF8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xF8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xFC))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0xFC))                                     \
         remwx_xm(Mebp, inf_SCR02(0xFC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xFC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xFC))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -3807,385 +4280,385 @@ rt_si32 from_mask(rt_si32 mask)
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x00))                                     \
         remwn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x04))                                     \
         remwn_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x08))                                     \
         remwn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x10))                                     \
         remwn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x14))                                     \
         remwn_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x18))                                     \
         remwn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x20))                                     \
         remwn_xm(Mebp, inf_SCR02(0x20))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x24))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x24))                                     \
         remwn_xm(Mebp, inf_SCR02(0x24))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x24))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x24))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x28))                                     \
         remwn_xm(Mebp, inf_SCR02(0x28))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x2C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x2C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x2C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x2C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x2C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x30))                                     \
         remwn_xm(Mebp, inf_SCR02(0x30))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x34))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x34))                                     \
         remwn_xm(Mebp, inf_SCR02(0x34))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x34))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x34))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x38))                                     \
         remwn_xm(Mebp, inf_SCR02(0x38))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x3C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x3C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x3C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x3C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x3C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x40))                                     \
         remwn_xm(Mebp, inf_SCR02(0x40))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x44))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x44))                                     \
         remwn_xm(Mebp, inf_SCR02(0x44))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x44))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x44))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x48))                                     \
         remwn_xm(Mebp, inf_SCR02(0x48))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x4C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x4C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x4C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x4C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x4C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x50))                                     \
         remwn_xm(Mebp, inf_SCR02(0x50))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x54))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x54))                                     \
         remwn_xm(Mebp, inf_SCR02(0x54))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x54))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x54))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x58))                                     \
         remwn_xm(Mebp, inf_SCR02(0x58))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x5C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x5C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x5C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x5C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x5C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x60))                                     \
         remwn_xm(Mebp, inf_SCR02(0x60))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x64))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x64))                                     \
         remwn_xm(Mebp, inf_SCR02(0x64))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x64))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x64))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x68))                                     \
         remwn_xm(Mebp, inf_SCR02(0x68))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x6C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x6C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x6C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x6C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x6C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x70))                                     \
         remwn_xm(Mebp, inf_SCR02(0x70))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x74))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x74))                                     \
         remwn_xm(Mebp, inf_SCR02(0x74))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x74))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x74))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x78))                                     \
         remwn_xm(Mebp, inf_SCR02(0x78))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x7C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x7C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x7C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x7C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x7C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x80))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x80))                                     \
         remwn_xm(Mebp, inf_SCR02(0x80))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x80))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x80))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x84))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x84))                                     \
         remwn_xm(Mebp, inf_SCR02(0x84))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x84))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x84))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x88))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x88))                                     \
         remwn_xm(Mebp, inf_SCR02(0x88))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x88))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x88))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x8C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x8C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x8C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x8C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x8C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x90))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x90))                                     \
         remwn_xm(Mebp, inf_SCR02(0x90))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x90))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x90))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x94))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x94))                                     \
         remwn_xm(Mebp, inf_SCR02(0x94))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x94))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x94))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x98))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x98))                                     \
         remwn_xm(Mebp, inf_SCR02(0x98))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x98))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x98))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x9C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x9C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x9C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x9C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x9C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xA0))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xA0))                                     \
         remwn_xm(Mebp, inf_SCR02(0xA0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xA0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xA0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xA4))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xA4))                                     \
         remwn_xm(Mebp, inf_SCR02(0xA4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xA4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xA4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xA8))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xA8))                                     \
         remwn_xm(Mebp, inf_SCR02(0xA8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xA8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xA8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xAC))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xAC))                                     \
         remwn_xm(Mebp, inf_SCR02(0xAC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xAC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xAC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xB0))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xB0))                                     \
         remwn_xm(Mebp, inf_SCR02(0xB0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xB0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xB0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xB4))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xB4))                                     \
         remwn_xm(Mebp, inf_SCR02(0xB4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xB4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xB4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xB8))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xB8))                                     \
         remwn_xm(Mebp, inf_SCR02(0xB8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xB8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xB8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xBC))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xBC))                                     \
         remwn_xm(Mebp, inf_SCR02(0xBC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xBC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xBC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xC0))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xC0))                                     \
         remwn_xm(Mebp, inf_SCR02(0xC0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xC0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xC0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xC4))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xC4))                                     \
         remwn_xm(Mebp, inf_SCR02(0xC4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xC4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xC4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xC8))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xC8))                                     \
         remwn_xm(Mebp, inf_SCR02(0xC8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xC8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xC8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xCC))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xCC))                                     \
         remwn_xm(Mebp, inf_SCR02(0xCC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xCC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xCC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xD0))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xD0))                                     \
         remwn_xm(Mebp, inf_SCR02(0xD0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xD0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xD0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xD4))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xD4))                                     \
         remwn_xm(Mebp, inf_SCR02(0xD4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xD4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xD4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xD8))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xD8))                                     \
         remwn_xm(Mebp, inf_SCR02(0xD8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xD8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xD8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xDC))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xDC))                                     \
         remwn_xm(Mebp, inf_SCR02(0xDC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xDC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xDC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xE0))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xE0))                                     \
         remwn_xm(Mebp, inf_SCR02(0xE0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xE0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xE0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xE4))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xE4))                                     \
         remwn_xm(Mebp, inf_SCR02(0xE4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xE4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xE4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xE8))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xE8))                                     \
         remwn_xm(Mebp, inf_SCR02(0xE8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xE8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xE8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xEC))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xEC))                                     \
         remwn_xm(Mebp, inf_SCR02(0xEC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xEC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xEC))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xF0))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xF0))                                     \
         remwn_xm(Mebp, inf_SCR02(0xF0))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xF0))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xF0))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xF4))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xF4))                                     \
         remwn_xm(Mebp, inf_SCR02(0xF4))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xF4))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xF4))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xF8))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xF8))                                     \
         remwn_xm(Mebp, inf_SCR02(0xF8))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xF8))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xF8))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0xFC))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0xFC))                                     \
         remwn_xm(Mebp, inf_SCR02(0xFC))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0xFC))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0xFC))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -5070,193 +5543,193 @@ rt_si32 from_mask(rt_si32 mask)
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x00))                                     \
         remwx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x04))                                     \
         remwx_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x08))                                     \
         remwx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x10))                                     \
         remwx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x14))                                     \
         remwx_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x18))                                     \
         remwx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x20))                                     \
         remwx_xm(Mebp, inf_SCR02(0x20))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x24))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x24))                                     \
         remwx_xm(Mebp, inf_SCR02(0x24))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x24))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x24))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x28))                                     \
         remwx_xm(Mebp, inf_SCR02(0x28))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x2C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x2C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x2C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x2C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x2C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x30))                                     \
         remwx_xm(Mebp, inf_SCR02(0x30))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x34))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x34))                                     \
         remwx_xm(Mebp, inf_SCR02(0x34))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x34))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x34))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x38))                                     \
         remwx_xm(Mebp, inf_SCR02(0x38))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x3C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x3C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x3C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x3C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x3C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x40))                                     \
         remwx_xm(Mebp, inf_SCR02(0x40))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x44))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x44))                                     \
         remwx_xm(Mebp, inf_SCR02(0x44))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x44))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x44))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x48))                                     \
         remwx_xm(Mebp, inf_SCR02(0x48))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x4C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x4C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x4C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x4C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x4C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x50))                                     \
         remwx_xm(Mebp, inf_SCR02(0x50))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x54))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x54))                                     \
         remwx_xm(Mebp, inf_SCR02(0x54))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x54))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x54))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x58))                                     \
         remwx_xm(Mebp, inf_SCR02(0x58))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x5C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x5C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x5C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x5C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x5C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x60))                                     \
         remwx_xm(Mebp, inf_SCR02(0x60))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x64))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x64))                                     \
         remwx_xm(Mebp, inf_SCR02(0x64))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x64))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x64))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x68))                                     \
         remwx_xm(Mebp, inf_SCR02(0x68))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x6C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x6C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x6C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x6C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x6C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x70))                                     \
         remwx_xm(Mebp, inf_SCR02(0x70))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x74))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x74))                                     \
         remwx_xm(Mebp, inf_SCR02(0x74))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x74))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x74))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x78))                                     \
         remwx_xm(Mebp, inf_SCR02(0x78))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x7C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x7C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x7C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x7C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x7C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -5287,193 +5760,193 @@ rt_si32 from_mask(rt_si32 mask)
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x00))                                     \
         remwn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x04))                                     \
         remwn_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x08))                                     \
         remwn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x10))                                     \
         remwn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x14))                                     \
         remwn_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x18))                                     \
         remwn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x20))                                     \
         remwn_xm(Mebp, inf_SCR02(0x20))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x24))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x24))                                     \
         remwn_xm(Mebp, inf_SCR02(0x24))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x24))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x24))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x28))                                     \
         remwn_xm(Mebp, inf_SCR02(0x28))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x2C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x2C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x2C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x2C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x2C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x30))                                     \
         remwn_xm(Mebp, inf_SCR02(0x30))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x34))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x34))                                     \
         remwn_xm(Mebp, inf_SCR02(0x34))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x34))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x34))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x38))                                     \
         remwn_xm(Mebp, inf_SCR02(0x38))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x3C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x3C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x3C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x3C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x3C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x40))                                     \
         remwn_xm(Mebp, inf_SCR02(0x40))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x44))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x44))                                     \
         remwn_xm(Mebp, inf_SCR02(0x44))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x44))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x44))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x48))                                     \
         remwn_xm(Mebp, inf_SCR02(0x48))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x4C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x4C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x4C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x4C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x4C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x50))                                     \
         remwn_xm(Mebp, inf_SCR02(0x50))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x54))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x54))                                     \
         remwn_xm(Mebp, inf_SCR02(0x54))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x54))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x54))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x58))                                     \
         remwn_xm(Mebp, inf_SCR02(0x58))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x5C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x5C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x5C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x5C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x5C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x60))                                     \
         remwn_xm(Mebp, inf_SCR02(0x60))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x64))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x64))                                     \
         remwn_xm(Mebp, inf_SCR02(0x64))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x64))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x64))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x68))                                     \
         remwn_xm(Mebp, inf_SCR02(0x68))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x6C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x6C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x6C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x6C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x6C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x70))                                     \
         remwn_xm(Mebp, inf_SCR02(0x70))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x74))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x74))                                     \
         remwn_xm(Mebp, inf_SCR02(0x74))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x74))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x74))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x78))                                     \
         remwn_xm(Mebp, inf_SCR02(0x78))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x7C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x7C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x7C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x7C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x7C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -6022,97 +6495,97 @@ rt_si32 from_mask(rt_si32 mask)
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x00))                                     \
         remwx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x04))                                     \
         remwx_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x08))                                     \
         remwx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x10))                                     \
         remwx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x14))                                     \
         remwx_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x18))                                     \
         remwx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x20))                                     \
         remwx_xm(Mebp, inf_SCR02(0x20))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x24))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x24))                                     \
         remwx_xm(Mebp, inf_SCR02(0x24))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x24))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x24))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x28))                                     \
         remwx_xm(Mebp, inf_SCR02(0x28))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x2C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x2C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x2C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x2C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x2C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x30))                                     \
         remwx_xm(Mebp, inf_SCR02(0x30))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x34))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x34))                                     \
         remwx_xm(Mebp, inf_SCR02(0x34))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x34))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x34))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x38))                                     \
         remwx_xm(Mebp, inf_SCR02(0x38))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x3C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x3C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x3C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x3C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x3C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -6143,97 +6616,97 @@ rt_si32 from_mask(rt_si32 mask)
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x00))                                     \
         remwn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x04))                                     \
         remwn_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x08))                                     \
         remwn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x10))                                     \
         remwn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x14))                                     \
         remwn_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x18))                                     \
         remwn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x20))                                     \
         remwn_xm(Mebp, inf_SCR02(0x20))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x24))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x24))                                     \
         remwn_xm(Mebp, inf_SCR02(0x24))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x24))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x24))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x28))                                     \
         remwn_xm(Mebp, inf_SCR02(0x28))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x2C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x2C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x2C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x2C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x2C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x30))                                     \
         remwn_xm(Mebp, inf_SCR02(0x30))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x34))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x34))                                     \
         remwn_xm(Mebp, inf_SCR02(0x34))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x34))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x34))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x38))                                     \
         remwn_xm(Mebp, inf_SCR02(0x38))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x3C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x3C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x3C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x3C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x3C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -6812,49 +7285,49 @@ rt_si32 from_mask(rt_si32 mask)
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x00))                                     \
         remwx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x04))                                     \
         remwx_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x08))                                     \
         remwx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x10))                                     \
         remwx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x14))                                     \
         remwx_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x18))                                     \
         remwx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -6885,49 +7358,49 @@ rt_si32 from_mask(rt_si32 mask)
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x00))                                     \
         remwn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x04))                                     \
         remwn_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x08))                                     \
         remwn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x10))                                     \
         remwn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x14))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x14))                                     \
         remwn_xm(Mebp, inf_SCR02(0x14))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x14))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x14))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x18))                                     \
         remwn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x1C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x1C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x1C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x1C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x1C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -7402,25 +7875,25 @@ rt_si32 from_mask(rt_si32 mask)
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x00))                                     \
         remwx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x04))                                     \
         remwx_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x08))                                     \
         remwx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewx_xx() /* Redx <- 0 */                                          \
         remwx_xx() /* prep  rem */                                          \
         divwx_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwx_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -7451,25 +7924,25 @@ rt_si32 from_mask(rt_si32 mask)
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x00))                                     \
         remwn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x04))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x04))                                     \
         remwn_xm(Mebp, inf_SCR02(0x04))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x04))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x04))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x08))                                     \
         remwn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movwx_ld(Reax, Mebp, inf_SCR01(0x0C))                               \
         prewn_xx() /* Redx sign */                                          \
         remwn_xx() /* prep  rem */                                          \
         divwn_xm(Mebp, inf_SCR02(0x0C))                                     \
         remwn_xm(Mebp, inf_SCR02(0x0C))                                     \
-        movwx_st(Reax, Mebp, inf_SCR01(0x0C))                               \
+        movwx_st(Redx, Mebp, inf_SCR01(0x0C))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -8382,193 +8855,193 @@ rt_si32 from_mask(rt_si32 mask)
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x00))                                     \
         remzx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x08))                                     \
         remzx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x10))                                     \
         remzx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x18))                                     \
         remzx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x20))                                     \
         remzx_xm(Mebp, inf_SCR02(0x20))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x28))                                     \
         remzx_xm(Mebp, inf_SCR02(0x28))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x30))                                     \
         remzx_xm(Mebp, inf_SCR02(0x30))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x38))                                     \
         remzx_xm(Mebp, inf_SCR02(0x38))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x40))                                     \
         remzx_xm(Mebp, inf_SCR02(0x40))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x48))                                     \
         remzx_xm(Mebp, inf_SCR02(0x48))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x50))                                     \
         remzx_xm(Mebp, inf_SCR02(0x50))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x58))                                     \
         remzx_xm(Mebp, inf_SCR02(0x58))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x60))                                     \
         remzx_xm(Mebp, inf_SCR02(0x60))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x68))                                     \
         remzx_xm(Mebp, inf_SCR02(0x68))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x70))                                     \
         remzx_xm(Mebp, inf_SCR02(0x70))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x78))                                     \
         remzx_xm(Mebp, inf_SCR02(0x78))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x80))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x80))                                     \
         remzx_xm(Mebp, inf_SCR02(0x80))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x80))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x80))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x88))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x88))                                     \
         remzx_xm(Mebp, inf_SCR02(0x88))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x88))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x88))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x90))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x90))                                     \
         remzx_xm(Mebp, inf_SCR02(0x90))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x90))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x90))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x98))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x98))                                     \
         remzx_xm(Mebp, inf_SCR02(0x98))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x98))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x98))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xA0))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xA0))                                     \
         remzx_xm(Mebp, inf_SCR02(0xA0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xA0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xA0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xA8))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xA8))                                     \
         remzx_xm(Mebp, inf_SCR02(0xA8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xA8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xA8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xB0))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xB0))                                     \
         remzx_xm(Mebp, inf_SCR02(0xB0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xB0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xB0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xB8))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xB8))                                     \
         remzx_xm(Mebp, inf_SCR02(0xB8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xB8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xB8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xC0))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xC0))                                     \
         remzx_xm(Mebp, inf_SCR02(0xC0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xC0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xC0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xC8))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xC8))                                     \
         remzx_xm(Mebp, inf_SCR02(0xC8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xC8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xC8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xD0))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xD0))                                     \
         remzx_xm(Mebp, inf_SCR02(0xD0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xD0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xD0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xD8))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xD8))                                     \
         remzx_xm(Mebp, inf_SCR02(0xD8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xD8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xD8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xE0))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xE0))                                     \
         remzx_xm(Mebp, inf_SCR02(0xE0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xE0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xE0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xE8))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xE8))                                     \
         remzx_xm(Mebp, inf_SCR02(0xE8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xE8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xE8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xF0))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xF0))                                     \
         remzx_xm(Mebp, inf_SCR02(0xF0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xF0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xF0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xF8))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0xF8))                                     \
         remzx_xm(Mebp, inf_SCR02(0xF8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xF8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xF8))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -8599,193 +9072,193 @@ rt_si32 from_mask(rt_si32 mask)
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x00))                                     \
         remzn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x08))                                     \
         remzn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x10))                                     \
         remzn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x18))                                     \
         remzn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x20))                                     \
         remzn_xm(Mebp, inf_SCR02(0x20))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x28))                                     \
         remzn_xm(Mebp, inf_SCR02(0x28))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x30))                                     \
         remzn_xm(Mebp, inf_SCR02(0x30))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x38))                                     \
         remzn_xm(Mebp, inf_SCR02(0x38))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x40))                                     \
         remzn_xm(Mebp, inf_SCR02(0x40))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x48))                                     \
         remzn_xm(Mebp, inf_SCR02(0x48))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x50))                                     \
         remzn_xm(Mebp, inf_SCR02(0x50))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x58))                                     \
         remzn_xm(Mebp, inf_SCR02(0x58))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x60))                                     \
         remzn_xm(Mebp, inf_SCR02(0x60))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x68))                                     \
         remzn_xm(Mebp, inf_SCR02(0x68))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x70))                                     \
         remzn_xm(Mebp, inf_SCR02(0x70))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x78))                                     \
         remzn_xm(Mebp, inf_SCR02(0x78))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x80))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x80))                                     \
         remzn_xm(Mebp, inf_SCR02(0x80))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x80))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x80))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x88))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x88))                                     \
         remzn_xm(Mebp, inf_SCR02(0x88))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x88))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x88))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x90))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x90))                                     \
         remzn_xm(Mebp, inf_SCR02(0x90))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x90))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x90))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x98))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x98))                                     \
         remzn_xm(Mebp, inf_SCR02(0x98))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x98))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x98))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xA0))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xA0))                                     \
         remzn_xm(Mebp, inf_SCR02(0xA0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xA0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xA0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xA8))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xA8))                                     \
         remzn_xm(Mebp, inf_SCR02(0xA8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xA8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xA8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xB0))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xB0))                                     \
         remzn_xm(Mebp, inf_SCR02(0xB0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xB0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xB0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xB8))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xB8))                                     \
         remzn_xm(Mebp, inf_SCR02(0xB8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xB8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xB8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xC0))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xC0))                                     \
         remzn_xm(Mebp, inf_SCR02(0xC0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xC0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xC0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xC8))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xC8))                                     \
         remzn_xm(Mebp, inf_SCR02(0xC8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xC8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xC8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xD0))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xD0))                                     \
         remzn_xm(Mebp, inf_SCR02(0xD0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xD0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xD0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xD8))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xD8))                                     \
         remzn_xm(Mebp, inf_SCR02(0xD8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xD8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xD8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xE0))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xE0))                                     \
         remzn_xm(Mebp, inf_SCR02(0xE0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xE0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xE0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xE8))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xE8))                                     \
         remzn_xm(Mebp, inf_SCR02(0xE8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xE8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xE8))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xF0))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xF0))                                     \
         remzn_xm(Mebp, inf_SCR02(0xF0))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xF0))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xF0))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0xF8))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0xF8))                                     \
         remzn_xm(Mebp, inf_SCR02(0xF8))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0xF8))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0xF8))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -9346,97 +9819,97 @@ rt_si32 from_mask(rt_si32 mask)
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x00))                                     \
         remzx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x08))                                     \
         remzx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x10))                                     \
         remzx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x18))                                     \
         remzx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x20))                                     \
         remzx_xm(Mebp, inf_SCR02(0x20))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x28))                                     \
         remzx_xm(Mebp, inf_SCR02(0x28))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x30))                                     \
         remzx_xm(Mebp, inf_SCR02(0x30))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x38))                                     \
         remzx_xm(Mebp, inf_SCR02(0x38))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x40))                                     \
         remzx_xm(Mebp, inf_SCR02(0x40))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x48))                                     \
         remzx_xm(Mebp, inf_SCR02(0x48))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x50))                                     \
         remzx_xm(Mebp, inf_SCR02(0x50))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x58))                                     \
         remzx_xm(Mebp, inf_SCR02(0x58))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x60))                                     \
         remzx_xm(Mebp, inf_SCR02(0x60))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x68))                                     \
         remzx_xm(Mebp, inf_SCR02(0x68))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x70))                                     \
         remzx_xm(Mebp, inf_SCR02(0x70))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x78))                                     \
         remzx_xm(Mebp, inf_SCR02(0x78))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -9467,97 +9940,97 @@ rt_si32 from_mask(rt_si32 mask)
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x00))                                     \
         remzn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x08))                                     \
         remzn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x10))                                     \
         remzn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x18))                                     \
         remzn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x20))                                     \
         remzn_xm(Mebp, inf_SCR02(0x20))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x28))                                     \
         remzn_xm(Mebp, inf_SCR02(0x28))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x30))                                     \
         remzn_xm(Mebp, inf_SCR02(0x30))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x38))                                     \
         remzn_xm(Mebp, inf_SCR02(0x38))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x40))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x40))                                     \
         remzn_xm(Mebp, inf_SCR02(0x40))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x40))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x40))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x48))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x48))                                     \
         remzn_xm(Mebp, inf_SCR02(0x48))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x48))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x48))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x50))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x50))                                     \
         remzn_xm(Mebp, inf_SCR02(0x50))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x50))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x50))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x58))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x58))                                     \
         remzn_xm(Mebp, inf_SCR02(0x58))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x58))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x58))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x60))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x60))                                     \
         remzn_xm(Mebp, inf_SCR02(0x60))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x60))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x60))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x68))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x68))                                     \
         remzn_xm(Mebp, inf_SCR02(0x68))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x68))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x68))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x70))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x70))                                     \
         remzn_xm(Mebp, inf_SCR02(0x70))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x70))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x70))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x78))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x78))                                     \
         remzn_xm(Mebp, inf_SCR02(0x78))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x78))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x78))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -9942,49 +10415,49 @@ rt_si32 from_mask(rt_si32 mask)
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x00))                                     \
         remzx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x08))                                     \
         remzx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x10))                                     \
         remzx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x18))                                     \
         remzx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x20))                                     \
         remzx_xm(Mebp, inf_SCR02(0x20))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x28))                                     \
         remzx_xm(Mebp, inf_SCR02(0x28))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x30))                                     \
         remzx_xm(Mebp, inf_SCR02(0x30))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x38))                                     \
         remzx_xm(Mebp, inf_SCR02(0x38))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -10015,49 +10488,49 @@ rt_si32 from_mask(rt_si32 mask)
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x00))                                     \
         remzn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x08))                                     \
         remzn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x10))                                     \
         remzn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x18))                                     \
         remzn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x20))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x20))                                     \
         remzn_xm(Mebp, inf_SCR02(0x20))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x20))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x20))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x28))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x28))                                     \
         remzn_xm(Mebp, inf_SCR02(0x28))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x28))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x28))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x30))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x30))                                     \
         remzn_xm(Mebp, inf_SCR02(0x30))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x30))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x30))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x38))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x38))                                     \
         remzn_xm(Mebp, inf_SCR02(0x38))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x38))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x38))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -10548,25 +11021,25 @@ rt_si32 from_mask(rt_si32 mask)
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x00))                                     \
         remzx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x08))                                     \
         remzx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x10))                                     \
         remzx_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x18))                                     \
         remzx_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -10597,25 +11070,25 @@ rt_si32 from_mask(rt_si32 mask)
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x00))                                     \
         remzn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x08))                                     \
         remzn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x10))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x10))                                     \
         remzn_xm(Mebp, inf_SCR02(0x10))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x10))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x10))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x18))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x18))                                     \
         remzn_xm(Mebp, inf_SCR02(0x18))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x18))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x18))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -11042,13 +11515,13 @@ rt_si32 from_mask(rt_si32 mask)
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x00))                                     \
         remzx_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezx_xx() /* Redx <- 0 */                                          \
         remzx_xx() /* prep  rem */                                          \
         divzx_xm(Mebp, inf_SCR02(0x08))                                     \
         remzx_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
         stack_ld(Redx)                                                      \
         stack_ld(Reax)
 
@@ -11079,16 +11552,2056 @@ rt_si32 from_mask(rt_si32 mask)
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x00))                                     \
         remzn_xm(Mebp, inf_SCR02(0x00))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x00))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x00))                               \
         movzx_ld(Reax, Mebp, inf_SCR01(0x08))                               \
         prezn_xx() /* Redx sign */                                          \
         remzn_xx() /* prep  rem */                                          \
         divzn_xm(Mebp, inf_SCR02(0x08))                                     \
         remzn_xm(Mebp, inf_SCR02(0x08))                                     \
-        movzx_st(Reax, Mebp, inf_SCR01(0x08))                               \
+        movzx_st(Redx, Mebp, inf_SCR01(0x08))                               \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)
+
+/******************************************************************************/
+/**** var-len **** (gather/scatter SIMD) with fixed-32/64-bit element *********/
+/******************************************************************************/
+
+/* gat (D = [S + T*elem-size]) gather elements from base S indexed by T
+ * sca ([D + T*elem-size] = S) scatter elements of S to base D indexed by T
+ * MS/MD take plain M*** addressing modes (base register, no displacement),
+ * indices are counted in elements and must be within non-negative 31-bit,
+ * gather requires (#D != #T), overlapping scatter indices are written
+ * in ascending element order (the last element wins), generic forms below
+ * go through the scratch area element-by-element using BASE ops,
+ * predicated targets (AVX-512, SVE) override them with native ops,
+ * AVX2 overrides gather only (using a saved temp reg for the mask) */
+
+#define gatox_ld(XD, MS, XT) /* indexed load, T holds 32-bit indices */     \
+        movox_st(W(XT), Mebp, inf_SCR01(0))                                 \
+        gsoxx_rx(W(MS), gsvxx_rx(gsixx_rx, gatwx_rx))                       \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define scaox_st(XS, MD, XT) /* indexed store, T holds 32-bit indices */    \
+        movox_st(W(XT), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        gsoxx_rx(W(MD), gsvxx_rx(gsixx_rx, scawx_rx))
+
+#define gatqx_ld(XD, MS, XT) /* indexed load, T holds 64-bit indices */     \
+        movqx_st(W(XT), Mebp, inf_SCR01(0))                                 \
+        gsoxx_rx(W(MS), gsvxx_rx(gsjxx_rx, gatdx_rx))                       \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define scaqx_st(XS, MD, XT) /* indexed store, T holds 64-bit indices */    \
+        movqx_st(W(XT), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        gsoxx_rx(W(MD), gsvxx_rx(gsjxx_rx, scadx_rx))
+
+/* Recx holds the base address, Reax the index, Redx the element data */
+
+#define gsoxx_rx(MS, ops) /* not portable, do not use outside */            \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        adrxx_ld(Recx, W(MS), DP(0x00))                                     \
+        ops                                                                 \
         stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
         stack_ld(Reax)
 
+#if   (RT_SIMD == 2048)
+
+#define gsvxx_rx(ch, op) /* not portable, do not use outside */             \
+        ch(op, 0x000) ch(op, 0x010) ch(op, 0x020) ch(op, 0x030)             \
+        ch(op, 0x040) ch(op, 0x050) ch(op, 0x060) ch(op, 0x070)             \
+        ch(op, 0x080) ch(op, 0x090) ch(op, 0x0A0) ch(op, 0x0B0)             \
+        ch(op, 0x0C0) ch(op, 0x0D0) ch(op, 0x0E0) ch(op, 0x0F0)
+
+#elif (RT_SIMD == 1024)
+
+#define gsvxx_rx(ch, op) /* not portable, do not use outside */             \
+        ch(op, 0x000) ch(op, 0x010) ch(op, 0x020) ch(op, 0x030)             \
+        ch(op, 0x040) ch(op, 0x050) ch(op, 0x060) ch(op, 0x070)
+
+#elif (RT_SIMD == 512)
+
+#define gsvxx_rx(ch, op) /* not portable, do not use outside */             \
+        ch(op, 0x000) ch(op, 0x010) ch(op, 0x020) ch(op, 0x030)
+
+#elif (RT_SIMD == 256)
+
+#define gsvxx_rx(ch, op) /* not portable, do not use outside */             \
+        ch(op, 0x000) ch(op, 0x010)
+
+#elif (RT_SIMD == 128)
+
+#define gsvxx_rx(ch, op) /* not portable, do not use outside */             \
+        ch(op, 0x000)
+
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#define gsixx_rx(op, nx) /* not portable, do not use outside */             \
+        op(nx+0x00) op(nx+0x04) op(nx+0x08) op(nx+0x0C)
+
+#define gsjxx_rx(op, nx) /* not portable, do not use outside */             \
+        op(nx+0x00) op(nx+0x08)
+
+#define gatwx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        movwx_ld(Redx,  Kecx, DP(0x00))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx))
+
+#define scawx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        movwx_ld(Redx,  Mebp, inf_SCR02(nx))                                \
+        movwx_st(Redx,  Kecx, DP(0x00))
+
+#define gatdx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+B))                              \
+        movwx_ld(Redx,  Lecx, DP(0x00))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_ld(Redx,  Lecx, DP(0x04))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx+0x04))
+
+#define scadx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+B))                              \
+        movwx_ld(Redx,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_st(Redx,  Lecx, DP(0x00))                                     \
+        movwx_ld(Redx,  Mebp, inf_SCR02(nx+0x04))                           \
+        movwx_st(Redx,  Lecx, DP(0x04))
+
+
+/******************************************************************************/
+/**** var-len **** (non-temporal store) with fixed-32/64-bit element **********/
+/******************************************************************************/
+
+/* mov (D = S), non-temporal store (nt) hints that D won't be read back soon
+ * bypassing the caches where supported, requires SIMD-aligned D,
+ * issue fence_xx() after the last nt-store before D is read by others,
+ * generic forms below fall back to regular stores, targets with native
+ * streaming stores (SSE/AVX/AVX-512, SVE, AArch64 NEON) override them,
+ * 128-bit NEON issues stnp on the two D-halves of the register */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define movox_nt(XS, MD, DD)                                                \
+        movox_st(W(XS), W(MD), W(DD))
+
+#define movqx_nt(XS, MD, DD)                                                \
+        movqx_st(W(XS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/******************************************************************************/
+/**** 256-bit **** (non-temporal store) with fixed-32/64-bit element **********/
+/******************************************************************************/
+
+#define movcx_nt(XS, MD, DD)                                                \
+        movcx_st(W(XS), W(MD), W(DD))
+
+#define movdx_nt(XS, MD, DD)                                                \
+        movdx_st(W(XS), W(MD), W(DD))
+
+/******************************************************************************/
+/**** 128-bit **** (non-temporal store) with fixed-32/64-bit element **********/
+/******************************************************************************/
+
+#define movix_nt(XS, MD, DD)                                                \
+        movix_st(W(XS), W(MD), W(DD))
+
+#define movjx_nt(XS, MD, DD)                                                \
+        movjx_st(W(XS), W(MD), W(DD))
+
+/******************************************************************************/
+/**** var-len **** (unaligned load/store) with fixed-32/64-bit element ********/
+/******************************************************************************/
+
+/* muv (D = S), unaligned load/store (muv) accept any element-aligned address
+ * for D/S in memory, to be used on sub-views of larger arrays in place
+ * of copying them to SIMD-aligned buffers, misalignment is expected to come
+ * from the base register as displacements follow the same rules as in other
+ * SIMD ops, mov-forms remain the fast path for SIMD-aligned data,
+ * generic forms below map to regular load/store on targets tolerating
+ * misaligned SIMD accesses (AArch64 NEON and SVE, MIPS MSA, POWER VSX),
+ * targets enforcing alignment (SSE/AVX/AVX-512, ARMv7 NEON, pre-VSX VMX)
+ * override them, VMX realigns loads with lvsl/vperm and stores with
+ * lvsr/vperm followed by element stores */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define muvox_ld(XD, MS, DS)                                                \
+        movox_ld(W(XD), W(MS), W(DS))
+
+#define muvox_st(XS, MD, DD)                                                \
+        movox_st(W(XS), W(MD), W(DD))
+
+#define muvqx_ld(XD, MS, DS)                                                \
+        movqx_ld(W(XD), W(MS), W(DS))
+
+#define muvqx_st(XS, MD, DD)                                                \
+        movqx_st(W(XS), W(MD), W(DD))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/******************************************************************************/
+/**** 256-bit **** (unaligned load/store) with fixed-32/64-bit element ********/
+/******************************************************************************/
+
+#define muvcx_ld(XD, MS, DS)                                                \
+        movcx_ld(W(XD), W(MS), W(DS))
+
+#define muvcx_st(XS, MD, DD)                                                \
+        movcx_st(W(XS), W(MD), W(DD))
+
+#define muvdx_ld(XD, MS, DS)                                                \
+        movdx_ld(W(XD), W(MS), W(DS))
+
+#define muvdx_st(XS, MD, DD)                                                \
+        movdx_st(W(XS), W(MD), W(DD))
+
+/******************************************************************************/
+/**** 128-bit **** (unaligned load/store) with fixed-32/64-bit element ********/
+/******************************************************************************/
+
+#define muvix_ld(XD, MS, DS)                                                \
+        movix_ld(W(XD), W(MS), W(DS))
+
+#define muvix_st(XS, MD, DD)                                                \
+        movix_st(W(XS), W(MD), W(DD))
+
+#define muvjx_ld(XD, MS, DS)                                                \
+        movjx_ld(W(XD), W(MS), W(DS))
+
+#define muvjx_st(XS, MD, DD)                                                \
+        movjx_st(W(XS), W(MD), W(DD))
+
+/******************************************************************************/
+/**** var-len **** (fp16 storage converters) with fixed-32-bit element ********/
+/******************************************************************************/
+
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S) keep data in memory
+ * in IEEE half-precision while computing in fp32, halving memory traffic,
+ * cvhos_ld widens fp16 elements from [MS + DS] into fp32 elements of D,
+ * cvhos_st narrows fp32 elements of S into fp16 elements at [MD + DD]
+ * with round-to-nearest-even (S is not modified), memory side is half
+ * of the SIMD width and requires only fp16 alignment, NaN payloads
+ * are not guaranteed to survive, generic forms below go through
+ * the scratch area using BASE ops (widening flushes fp16 denormals
+ * in flush-to-zero mode), targets with native converters (F16C,
+ * AVX-512, NEON) override them */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define cvhos_ld(XD, MS, DS) /* fp16-to-fp32, destroys scratch area */      \
+        cvhxx_rx(W(MS), W(DS), gsvxx_rx(gsixx_rx, cvhlx_rx))                \
+        movox_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andox_ld(W(XD), Mebp, inf_GPC04_32)                                 \
+        shrox_ri(W(XD), IB(3))                                              \
+        mulos_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        movox_st(W(XD), Mebp, inf_SCR04(0))                                 \
+        cvhox_rx(W(XD))                                                     \
+        movox_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andox_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        orrox_ld(W(XD), Mebp, inf_SCR04(0))
+
+#define cvhox_rx(XD) /* not portable, do not use outside */                 \
+        movox_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        shlox_ri(W(XD), IB(1))                                              \
+        shrox_ri(W(XD), IB(27))                                             \
+        subox_ld(W(XD), Mebp, inf_GPC07)                                    \
+        shlox_ri(W(XD), IB(26))                                             \
+        shron_ri(W(XD), IB(31))                                             \
+        shlox_ri(W(XD), IB(24))                                             \
+        shrox_ri(W(XD), IB(1))                                              \
+        orrox_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        movox_st(W(XD), Mebp, inf_SCR04(0))
+
+#define cvhos_st(XS, MD, DD) /* fp32-to-fp16, destroys scratch area */      \
+        movox_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        andox_ld(W(XS), Mebp, inf_GPC04_32)                                 \
+        subos_ld(W(XS), Mebp, inf_GPC02_32)                                 \
+        movox_st(W(XS), Mebp, inf_SCR04(0))                                 \
+        movox_ld(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvhxx_rx(W(MD), W(DD), gsvxx_rx(gsixx_rx, cvhsx_rx))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/* Recx holds the fp16 address, other BASE regs are used as temporaries,
+ * widening puts (fp16 << 16) to SCR03 and 2^112 to SCR04 for rebiasing,
+ * narrowing takes S from SCR03 and (|S| + 0.5f) from SCR04 for denormals */
+
+#define cvhxx_rx(MS, DS, ops) /* not portable, do not use outside */        \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        stack_st(Rebx)                                                      \
+        stack_st(Resi)                                                      \
+        adrxx_ld(Recx, W(MS), W(DS))                                        \
+        ops                                                                 \
+        stack_ld(Resi)                                                      \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)
+
+#define cvhlx_rx(nx) /* not portable, do not use outside */                 \
+        movhz_ld(Reax,  Mecx, DP((nx)>>1))                                  \
+        shlwx_ri(Reax,  IB(16))                                             \
+        movwx_st(Reax,  Mebp, inf_SCR03(nx))                                \
+        movwx_mi(Mebp,  inf_SCR04(nx), IW(0x77800000))
+
+#define cvhsx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Redx,  Mebp, inf_SCR03(nx))                                \
+        andwx_ri(Redx,  IW(0x7FFFFFFF))                                     \
+        movwx_rr(Rebx,  Redx)                                               \
+        shrwx_ri(Rebx,  IB(13))                                             \
+        andwx_ri(Rebx,  IB(1))                                              \
+        addwx_rr(Rebx,  Redx)                                               \
+        addwx_ri(Rebx,  IW(0xC8000FFF))                                     \
+        shrwx_ri(Rebx,  IB(13))                                             \
+        movwx_ld(Resi,  Mebp, inf_SCR04(nx))                                \
+        subwx_ri(Resi,  IW(0x3F000000))                                     \
+        xorwx_rr(Resi,  Rebx)                                               \
+        movwx_rr(Reax,  Redx)                                               \
+        subwx_ri(Reax,  IW(0x38800000))                                     \
+        shrwn_ri(Reax,  IB(31))                                             \
+        andwx_rr(Resi,  Reax)                                               \
+        xorwx_rr(Rebx,  Resi)                                               \
+        movwx_rr(Reax,  Redx)                                               \
+        subwx_ri(Reax,  IW(0x47800000))                                     \
+        shrwn_ri(Reax,  IB(31))                                             \
+        andwx_rr(Rebx,  Reax)                                               \
+        notwx_rx(Reax)                                                      \
+        movwx_ri(Resi,  IW(0x7F800000))                                     \
+        subwx_rr(Resi,  Redx)                                               \
+        shrwn_ri(Resi,  IB(31))                                             \
+        andwx_ri(Resi,  IH(0x0200))                                         \
+        orrwx_ri(Resi,  IH(0x7C00))                                         \
+        andwx_rr(Resi,  Reax)                                               \
+        orrwx_rr(Rebx,  Resi)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR03(nx))                                \
+        shrwx_ri(Reax,  IB(16))                                             \
+        andwx_ri(Reax,  IH(0x8000))                                         \
+        orrwx_rr(Rebx,  Reax)                                               \
+        movhx_st(Rebx,  Mecx, DP((nx)>>1))
+
+/******************************************************************************/
+/**** 256-bit **** (fp16 storage converters) with fixed-32-bit element ********/
+/******************************************************************************/
+
+#define cvhcs_ld(XD, MS, DS) /* fp16-to-fp32, destroys scratch area */      \
+        cvhxx_rx(W(MS), W(DS), gsixx_rx(cvhlx_rx, 0x000)                    \
+                               gsixx_rx(cvhlx_rx, 0x010))                   \
+        movcx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andcx_ld(W(XD), Mebp, inf_GPC04_32)                                 \
+        shrcx_ri(W(XD), IB(3))                                              \
+        mulcs_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR04(0))                                 \
+        cvhcx_rx(W(XD))                                                     \
+        movcx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andcx_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        orrcx_ld(W(XD), Mebp, inf_SCR04(0))
+
+#define cvhcx_rx(XD) /* not portable, do not use outside */                 \
+        movcx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        shlcx_ri(W(XD), IB(1))                                              \
+        shrcx_ri(W(XD), IB(27))                                             \
+        subcx_ld(W(XD), Mebp, inf_GPC07)                                    \
+        shlcx_ri(W(XD), IB(26))                                             \
+        shrcn_ri(W(XD), IB(31))                                             \
+        shlcx_ri(W(XD), IB(24))                                             \
+        shrcx_ri(W(XD), IB(1))                                              \
+        orrcx_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        movcx_st(W(XD), Mebp, inf_SCR04(0))
+
+#define cvhcs_st(XS, MD, DD) /* fp32-to-fp16, destroys scratch area */      \
+        movcx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        andcx_ld(W(XS), Mebp, inf_GPC04_32)                                 \
+        subcs_ld(W(XS), Mebp, inf_GPC02_32)                                 \
+        movcx_st(W(XS), Mebp, inf_SCR04(0))                                 \
+        movcx_ld(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvhxx_rx(W(MD), W(DD), gsixx_rx(cvhsx_rx, 0x000)                    \
+                               gsixx_rx(cvhsx_rx, 0x010))
+
+/******************************************************************************/
+/**** 128-bit **** (fp16 storage converters) with fixed-32-bit element ********/
+/******************************************************************************/
+
+#define cvhis_ld(XD, MS, DS) /* fp16-to-fp32, destroys scratch area */      \
+        cvhxx_rx(W(MS), W(DS), gsixx_rx(cvhlx_rx, 0x000))                   \
+        movix_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andix_ld(W(XD), Mebp, inf_GPC04_32)                                 \
+        shrix_ri(W(XD), IB(3))                                              \
+        mulis_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR04(0))                                 \
+        cvhix_rx(W(XD))                                                     \
+        movix_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andix_ld(W(XD), Mebp, inf_GPC06_32)                                 \
+        orrix_ld(W(XD), Mebp, inf_SCR04(0))
+
+#define cvhix_rx(XD) /* not portable, do not use outside */                 \
+        movix_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        shlix_ri(W(XD), IB(1))                                              \
+        shrix_ri(W(XD), IB(27))                                             \
+        subix_ld(W(XD), Mebp, inf_GPC07)                                    \
+        shlix_ri(W(XD), IB(26))                                             \
+        shrin_ri(W(XD), IB(31))                                             \
+        shlix_ri(W(XD), IB(24))                                             \
+        shrix_ri(W(XD), IB(1))                                              \
+        orrix_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        movix_st(W(XD), Mebp, inf_SCR04(0))
+
+#define cvhis_st(XS, MD, DD) /* fp32-to-fp16, destroys scratch area */      \
+        movix_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        andix_ld(W(XS), Mebp, inf_GPC04_32)                                 \
+        subis_ld(W(XS), Mebp, inf_GPC02_32)                                 \
+        movix_st(W(XS), Mebp, inf_SCR04(0))                                 \
+        movix_ld(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvhxx_rx(W(MD), W(DD), gsixx_rx(cvhsx_rx, 0x000))
+
+/******************************************************************************/
+/**** var-len **** (fp32/fp64 converters) with fixed-32/64-bit element ********/
+/******************************************************************************/
+
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * handle the 2:1 lane-count mismatch of mixed-precision code,
+ * cvlqs_rr/cvuqs_rr widen the lower/upper half of fp32 elements of S
+ * into fp64 elements of D (exact), cvlos_rr narrows fp64 elements of S
+ * into the lower half of fp32 elements of D zeroing the upper half,
+ * cvuos_rr narrows fp64 elements of S into the upper half of G keeping
+ * the lower half of G intact, narrowing is round-to-nearest-even,
+ * NaN payloads are not guaranteed to survive, generic forms below go
+ * through the scratch area using BASE ops (denormals are subject to
+ * flush-to-zero mode), targets with native converters override them */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define cvlqs_rr(XD, XS)     /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsvxx_rx(gsjxx_rx, cvlwx_rx))                              \
+        cvwqx_rx(W(XD))
+
+#define cvuqs_rr(XD, XS)     /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsvxx_rx(gsjxx_rx, cvuwx_rx))                              \
+        cvwqx_rx(W(XD))
+
+#define cvwqx_rx(XD) /* not portable, do not use outside */                 \
+        movqx_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        mulqs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        shlqx_ri(W(XD), IB(1))                                              \
+        shrqx_ri(W(XD), IB(53))                                             \
+        subqx_ld(W(XD), Mebp, inf_GPC07)                                    \
+        shrqx_ri(W(XD), IB(8))                                              \
+        shlqx_ri(W(XD), IB(63))                                             \
+        shrqn_ri(W(XD), IB(10))                                             \
+        shrqx_ri(W(XD), IB(1))                                              \
+        orrqx_ld(W(XD), Mebp, inf_SCR03(0))
+
+#define cvlos_rr(XD, XS)     /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsvxx_rx(gsjxx_rx, cvskx_rx))                              \
+        cvsqx_rx(W(XD))                                                     \
+        xorox_rr(W(XD), W(XD))                                              \
+        movox_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvlxx_rx(gsvxx_rx(gsjxx_rx, cvlsx_rx))                              \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvuos_rr(XG, XS)     /* destroys scratch area */                    \
+        movox_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsvxx_rx(gsjxx_rx, cvskx_rx))                              \
+        cvsqx_rx(W(XG))                                                     \
+        cvlxx_rx(gsvxx_rx(gsjxx_rx, cvusx_rx))                              \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define cvsqx_rx(XD) /* not portable, do not use outside */                 \
+        movqx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andqx_ld(W(XD), Mebp, inf_GPC04_64)                                 \
+        mulqs_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        minqs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XD), Mebp, inf_SCR04(0))                                 \
+        movqx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ceqqs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        movqx_st(W(XD), Mebp, inf_SCR01(0))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/* Reax, Redx, Rebx are used as temporaries, widening puts fp32 elements
+ * repacked into fp64 fields to SCR04 and 2^896 to SCR01 for rebiasing,
+ * narrowing takes S from SCR03, |S| * 2^-896 clamped to fp32 infinity
+ * from SCR04, non-NaN mask from SCR01 and assembles the result in SCR02,
+ * half offsets follow RT_SIMD as 256/128-bit forms are only used there */
+
+#define cvlxx_rx(ops) /* not portable, do not use outside */                \
+        stack_st(Reax)                                                      \
+        stack_st(Redx)                                                      \
+        stack_st(Rebx)                                                      \
+        ops                                                                 \
+        stack_ld(Rebx)                                                      \
+        stack_ld(Redx)                                                      \
+        stack_ld(Reax)
+
+#define cvlwx_rx(nx) /* not portable, do not use outside */                 \
+        cvwxx_rx(nx, ((nx)>>1))
+
+#define cvuwx_rx(nx) /* not portable, do not use outside */                 \
+        cvwxx_rx(nx, (((nx)>>1)+RT_SIMD/16))
+
+#define cvwxx_rx(nx, sx) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, inf_SCR03(sx))                                \
+        movwx_rr(Redx,  Reax)                                               \
+        shlwx_ri(Redx,  IB(29))                                             \
+        movwx_st(Redx,  Mebp, inf_SCR04(nx+B))                              \
+        movwx_rr(Redx,  Reax)                                               \
+        andwx_ri(Redx,  IW(0x7FFFFFFF))                                     \
+        shrwx_ri(Redx,  IB(3))                                              \
+        andwx_ri(Reax,  IW(0x80000000))                                     \
+        orrwx_rr(Redx,  Reax)                                               \
+        movwx_st(Redx,  Mebp, inf_SCR04(nx+0x04-B))                         \
+        movwx_mi(Mebp,  inf_SCR01(nx+B), IB(0))                             \
+        movwx_mi(Mebp,  inf_SCR01(nx+0x04-B), IW(0x77F00000))
+
+#define cvskx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_mi(Mebp,  inf_SCR04(nx+B), IB(0))                             \
+        movwx_mi(Mebp,  inf_SCR04(nx+0x04-B), IW(0x07F00000))               \
+        movwx_mi(Mebp,  inf_SCR01(nx+B), IB(0))                             \
+        movwx_mi(Mebp,  inf_SCR01(nx+0x04-B), IW(0x0FF00000))
+
+#define cvlsx_rx(nx) /* not portable, do not use outside */                 \
+        cvsxx_rx(nx, ((nx)>>1))
+
+#define cvusx_rx(nx) /* not portable, do not use outside */                 \
+        cvsxx_rx(nx, (((nx)>>1)+RT_SIMD/16))
+
+#define cvsxx_rx(nx, dx) /* not portable, do not use outside */             \
+        movwx_ld(Redx,  Mebp, inf_SCR04(nx+0x04-B))                         \
+        movwx_ld(Reax,  Mebp, inf_SCR04(nx+B))                              \
+        shlwx_ri(Redx,  IB(3))                                              \
+        movwx_rr(Rebx,  Reax)                                               \
+        shrwx_ri(Rebx,  IB(29))                                             \
+        orrwx_rr(Redx,  Rebx)                                               \
+        andwx_ri(Reax,  IW(0x1FFFFFFF))                                     \
+        movwx_rr(Rebx,  Redx)                                               \
+        andwx_ri(Rebx,  IB(1))                                              \
+        addwx_rr(Reax,  Rebx)                                               \
+        addwx_ri(Reax,  IW(0x0FFFFFFF))                                     \
+        shrwx_ri(Reax,  IB(29))                                             \
+        addwx_rr(Redx,  Reax)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx+B))                              \
+        andwx_rr(Redx,  Reax)                                               \
+        notwx_rx(Reax)                                                      \
+        andwx_ri(Reax,  IW(0x7FC00000))                                     \
+        orrwx_rr(Redx,  Reax)                                               \
+        movwx_ld(Reax,  Mebp, inf_SCR03(nx+0x04-B))                         \
+        andwx_ri(Reax,  IW(0x80000000))                                     \
+        orrwx_rr(Redx,  Reax)                                               \
+        movwx_st(Redx,  Mebp, inf_SCR02(dx))
+
+/******************************************************************************/
+/**** 256-bit **** (fp32/fp64 converters) with fixed-32/64-bit element ********/
+/******************************************************************************/
+
+#define cvlds_rr(XD, XS)     /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvlwx_rx, 0x000)                                  \
+                 gsjxx_rx(cvlwx_rx, 0x010))                                 \
+        cvwdx_rx(W(XD))
+
+#define cvuds_rr(XD, XS)     /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvuwx_rx, 0x000)                                  \
+                 gsjxx_rx(cvuwx_rx, 0x010))                                 \
+        cvwdx_rx(W(XD))
+
+#define cvwdx_rx(XD) /* not portable, do not use outside */                 \
+        movdx_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        mulds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        movdx_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        shldx_ri(W(XD), IB(1))                                              \
+        shrdx_ri(W(XD), IB(53))                                             \
+        subdx_ld(W(XD), Mebp, inf_GPC07)                                    \
+        shrdx_ri(W(XD), IB(8))                                              \
+        shldx_ri(W(XD), IB(63))                                             \
+        shrdn_ri(W(XD), IB(10))                                             \
+        shrdx_ri(W(XD), IB(1))                                              \
+        orrdx_ld(W(XD), Mebp, inf_SCR03(0))
+
+#define cvlcs_rr(XD, XS)     /* destroys scratch area */                    \
+        movdx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvskx_rx, 0x000)                                  \
+                 gsjxx_rx(cvskx_rx, 0x010))                                 \
+        cvsdx_rx(W(XD))                                                     \
+        xorcx_rr(W(XD), W(XD))                                              \
+        movcx_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvlsx_rx, 0x000)                                  \
+                 gsjxx_rx(cvlsx_rx, 0x010))                                 \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvucs_rr(XG, XS)     /* destroys scratch area */                    \
+        movcx_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movdx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvskx_rx, 0x000)                                  \
+                 gsjxx_rx(cvskx_rx, 0x010))                                 \
+        cvsdx_rx(W(XG))                                                     \
+        cvlxx_rx(gsjxx_rx(cvusx_rx, 0x000)                                  \
+                 gsjxx_rx(cvusx_rx, 0x010))                                 \
+        movcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define cvsdx_rx(XD) /* not portable, do not use outside */                 \
+        movdx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        anddx_ld(W(XD), Mebp, inf_GPC04_64)                                 \
+        mulds_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        minds_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR04(0))                                 \
+        movdx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ceqds_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        movdx_st(W(XD), Mebp, inf_SCR01(0))
+
+/******************************************************************************/
+/**** 128-bit **** (fp32/fp64 converters) with fixed-32/64-bit element ********/
+/******************************************************************************/
+
+#define cvljs_rr(XD, XS)     /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvlwx_rx, 0x000))                                 \
+        cvwjx_rx(W(XD))
+
+#define cvujs_rr(XD, XS)     /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvuwx_rx, 0x000))                                 \
+        cvwjx_rx(W(XD))
+
+#define cvwjx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        muljs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        shljx_ri(W(XD), IB(1))                                              \
+        shrjx_ri(W(XD), IB(53))                                             \
+        subjx_ld(W(XD), Mebp, inf_GPC07)                                    \
+        shrjx_ri(W(XD), IB(8))                                              \
+        shljx_ri(W(XD), IB(63))                                             \
+        shrjn_ri(W(XD), IB(10))                                             \
+        shrjx_ri(W(XD), IB(1))                                              \
+        orrjx_ld(W(XD), Mebp, inf_SCR03(0))
+
+#define cvlis_rr(XD, XS)     /* destroys scratch area */                    \
+        movjx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvskx_rx, 0x000))                                 \
+        cvsjx_rx(W(XD))                                                     \
+        xorix_rr(W(XD), W(XD))                                              \
+        movix_st(W(XD), Mebp, inf_SCR02(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvlsx_rx, 0x000))                                 \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define cvuis_rr(XG, XS)     /* destroys scratch area */                    \
+        movix_st(W(XG), Mebp, inf_SCR02(0))                                 \
+        movjx_st(W(XS), Mebp, inf_SCR03(0))                                 \
+        cvlxx_rx(gsjxx_rx(cvskx_rx, 0x000))                                 \
+        cvsjx_rx(W(XG))                                                     \
+        cvlxx_rx(gsjxx_rx(cvusx_rx, 0x000))                                 \
+        movix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define cvsjx_rx(XD) /* not portable, do not use outside */                 \
+        movjx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        andjx_ld(W(XD), Mebp, inf_GPC04_64)                                 \
+        muljs_ld(W(XD), Mebp, inf_SCR04(0))                                 \
+        minjs_ld(W(XD), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR04(0))                                 \
+        movjx_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        ceqjs_ld(W(XD), Mebp, inf_SCR03(0))                                 \
+        movjx_st(W(XD), Mebp, inf_SCR01(0))
+
+/******************************************************************************/
+/**** var-len **** (int-div/rem by immediate) with fixed-32/64-bit element ****/
+/******************************************************************************/
+
+/* div, rem by immediate replace per-element scalar division by multiply-high
+ * by a magic number followed by shifts (Granlund-Montgomery, PLDI 1994),
+ * magic numbers and shift counts are derived from the immediate divisor
+ * at compile time by the expressions below, which are evaluated either
+ * by the assembler (inline asm) or in C (runtime code generation),
+ * the assembler needs to evaluate expressions in 64-bit (64-bit hosts),
+ * M(cond) & 1 normalizes true to 1 for both evaluators (see rtarch.h) */
+
+/* ceil(log2(d)) for 1 <= d < 2^32 */
+
+#define RT_DVLOG(d)                                                         \
+        ((M((d) > 0x00000001) & 1) + (M((d) > 0x00000002) & 1) +            \
+         (M((d) > 0x00000004) & 1) + (M((d) > 0x00000008) & 1) +            \
+         (M((d) > 0x00000010) & 1) + (M((d) > 0x00000020) & 1) +            \
+         (M((d) > 0x00000040) & 1) + (M((d) > 0x00000080) & 1) +            \
+         (M((d) > 0x00000100) & 1) + (M((d) > 0x00000200) & 1) +            \
+         (M((d) > 0x00000400) & 1) + (M((d) > 0x00000800) & 1) +            \
+         (M((d) > 0x00001000) & 1) + (M((d) > 0x00002000) & 1) +            \
+         (M((d) > 0x00004000) & 1) + (M((d) > 0x00008000) & 1) +            \
+         (M((d) > 0x00010000) & 1) + (M((d) > 0x00020000) & 1) +            \
+         (M((d) > 0x00040000) & 1) + (M((d) > 0x00080000) & 1) +            \
+         (M((d) > 0x00100000) & 1) + (M((d) > 0x00200000) & 1) +            \
+         (M((d) > 0x00400000) & 1) + (M((d) > 0x00800000) & 1) +            \
+         (M((d) > 0x01000000) & 1) + (M((d) > 0x02000000) & 1) +            \
+         (M((d) > 0x04000000) & 1) + (M((d) > 0x08000000) & 1) +            \
+         (M((d) > 0x10000000) & 1) + (M((d) > 0x20000000) & 1) +            \
+         (M((d) > 0x40000000) & 1) + (M((d) > 0x80000000) & 1))
+
+/* long division step in base 2^16: next quotient digit and remainder,
+ * remainder avoids "%" as it isn't allowed in inline asm templates */
+
+#define RT_DVQ16(r, d)      (((r) << 16) / (d))
+#define RT_DVR16(r, d)      (((r) << 16) - RT_DVQ16(r, d) * (d))
+
+/* unsigned: 0 < d < 2^32, q = (t + ((n - t) >> S1)) >> S2, t = mulhi(n,M) */
+
+#define RT_DVUS1(d)         (M((d) > 1) & 1)
+#define RT_DVUS2(d)         (RT_DVLOG(d) - RT_DVUS1(d))
+#define RT_DVUR0(d)         ((0x100000000 >> (32 - RT_DVLOG(d))) - (d))
+
+#define RT_DVUM32(d)                                                        \
+        ((0x100000000 * RT_DVUR0(d) / (d) + 1) & 0xFFFFFFFF)
+
+#define RT_DVUL64(d)                                                        \
+        ((RT_DVQ16(RT_DVR16(RT_DVR16(RT_DVUR0(d), d), d), d) << 16) +       \
+          RT_DVQ16(RT_DVR16(RT_DVR16(RT_DVR16(RT_DVUR0(d), d), d), d), d)   \
+          + 1)
+
+#define RT_DVUM64_L(d)      (RT_DVUL64(d) & 0xFFFFFFFF)
+#define RT_DVUM64_H(d)                                                      \
+        (((RT_DVQ16(RT_DVUR0(d), d) << 16) +                                \
+           RT_DVQ16(RT_DVR16(RT_DVUR0(d), d), d) +                          \
+          (RT_DVUL64(d) >> 32)) & 0xFFFFFFFF)
+
+/* signed: 0 < d < 2^31, q = ((n + mulhi(n, M)) >> S) - (n >> (elem-size-1)),
+ * right shifts are arithmetic except for the last one (sign of n) */
+
+#define RT_DVNL(d)          (RT_DVLOG(d) + (M((d) == 1) & 1))
+#define RT_DVNS(d)          (RT_DVNL(d) - 1)
+#define RT_DVNA(d)          (0x100000000 << (RT_DVNL(d) - 1))
+#define RT_DVNR(d)          (RT_DVNA(d) - RT_DVNA(d) / (d) * (d))
+
+#define RT_DVNM32(d)                                                        \
+        ((RT_DVNA(d) / (d) + 1) & 0xFFFFFFFF)
+
+#define RT_DVNL64(d)                                                        \
+        ((RT_DVQ16(RT_DVNR(d), d) << 16) +                                  \
+          RT_DVQ16(RT_DVR16(RT_DVNR(d), d), d) + 1)
+
+#define RT_DVNM64_L(d)      (RT_DVNL64(d) & 0xFFFFFFFF)
+#define RT_DVNM64_H(d)                                                      \
+        ((RT_DVNA(d) / (d) + (RT_DVNL64(d) >> 32)) & 0xFFFFFFFF)
+
+/* div (G = G / IS) vertical integer div by immediate, unsigned/signed
+ * rem (G = G % IS) vertical integer rem by immediate, unsigned/signed
+ * IS takes IB/IH/IV/IW forms of positive divisors: up to 2^32-1 for unsigned
+ * and up to 2^31-1 for signed (negate the result for negative divisors),
+ * signed division by 1 wraps the most negative value (as its magic number
+ * doesn't fit in 32/64-bit), uses inf_SCR01 and inf_SCR02 scratch areas,
+ * generic forms below go element-by-element via scalar multiply-high
+ * in BASE regs (no division is issued), targets with native SIMD
+ * multiply-high override them in corresponding rtarch_***.h files */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define divox_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF))),     \
+                 dvvxx_rx(dvixx_rx, dvuwx_rx, W(IS)))                       \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divon_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF))),     \
+                 dvvxx_rx(dvixx_rx, dvnwx_rx, W(IS)))                       \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remox_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF))),     \
+                 dvvxx_rx(dvixx_rx, rmuwx_rx, W(IS)))                       \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remon_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF))),     \
+                 dvvxx_rx(dvixx_rx, rmnwx_rx, W(IS)))                       \
+        movox_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divqx_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVUM64_H((VAL(IS)) & 0xFFFFFFFF)),    \
+                                IW(RT_DVUM64_L((VAL(IS)) & 0xFFFFFFFF))),   \
+                 dvvxx_rx(dvjxx_rx, dvuzx_rx, W(IS)))                       \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divqn_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVNM64_H((VAL(IS)) & 0x7FFFFFFF)),    \
+                                IW(RT_DVNM64_L((VAL(IS)) & 0x7FFFFFFF))),   \
+                 dvvxx_rx(dvjxx_rx, dvnzx_rx, W(IS)))                       \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remqx_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVUM64_H((VAL(IS)) & 0xFFFFFFFF)),    \
+                                IW(RT_DVUM64_L((VAL(IS)) & 0xFFFFFFFF))),   \
+                 dvvxx_rx(dvjxx_rx, rmuzx_rx, W(IS)))                       \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remqn_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVNM64_H((VAL(IS)) & 0x7FFFFFFF)),    \
+                                IW(RT_DVNM64_L((VAL(IS)) & 0x7FFFFFFF))),   \
+                 dvvxx_rx(dvjxx_rx, rmnzx_rx, W(IS)))                       \
+        movqx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#if   (RT_SIMD == 2048)
+
+#define dvvxx_rx(ch, op, IS) /* not portable, do not use outside */         \
+        ch(op, W(IS), 0x000) ch(op, W(IS), 0x010)                           \
+        ch(op, W(IS), 0x020) ch(op, W(IS), 0x030)                           \
+        ch(op, W(IS), 0x040) ch(op, W(IS), 0x050)                           \
+        ch(op, W(IS), 0x060) ch(op, W(IS), 0x070)                           \
+        ch(op, W(IS), 0x080) ch(op, W(IS), 0x090)                           \
+        ch(op, W(IS), 0x0A0) ch(op, W(IS), 0x0B0)                           \
+        ch(op, W(IS), 0x0C0) ch(op, W(IS), 0x0D0)                           \
+        ch(op, W(IS), 0x0E0) ch(op, W(IS), 0x0F0)
+
+#elif (RT_SIMD == 1024)
+
+#define dvvxx_rx(ch, op, IS) /* not portable, do not use outside */         \
+        ch(op, W(IS), 0x000) ch(op, W(IS), 0x010)                           \
+        ch(op, W(IS), 0x020) ch(op, W(IS), 0x030)                           \
+        ch(op, W(IS), 0x040) ch(op, W(IS), 0x050)                           \
+        ch(op, W(IS), 0x060) ch(op, W(IS), 0x070)
+
+#elif (RT_SIMD == 512)
+
+#define dvvxx_rx(ch, op, IS) /* not portable, do not use outside */         \
+        ch(op, W(IS), 0x000) ch(op, W(IS), 0x010)                           \
+        ch(op, W(IS), 0x020) ch(op, W(IS), 0x030)
+
+#elif (RT_SIMD == 256)
+
+#define dvvxx_rx(ch, op, IS) /* not portable, do not use outside */         \
+        ch(op, W(IS), 0x000) ch(op, W(IS), 0x010)
+
+#elif (RT_SIMD == 128)
+
+#define dvvxx_rx(ch, op, IS) /* not portable, do not use outside */         \
+        ch(op, W(IS), 0x000)
+
+#endif /* RT_SIMD: 2048, 1024, 512, 256, 128 */
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/******************************************************************************/
+/**** 256-bit **** (int-div/rem by immediate) with fixed-32/64-bit element ****/
+/******************************************************************************/
+
+#define divcx_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF))),     \
+                 dvixx_rx(dvuwx_rx, W(IS), 0x000)                           \
+                 dvixx_rx(dvuwx_rx, W(IS), 0x010))                          \
+        movcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divcn_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF))),     \
+                 dvixx_rx(dvnwx_rx, W(IS), 0x000)                           \
+                 dvixx_rx(dvnwx_rx, W(IS), 0x010))                          \
+        movcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remcx_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF))),     \
+                 dvixx_rx(rmuwx_rx, W(IS), 0x000)                           \
+                 dvixx_rx(rmuwx_rx, W(IS), 0x010))                          \
+        movcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remcn_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF))),     \
+                 dvixx_rx(rmnwx_rx, W(IS), 0x000)                           \
+                 dvixx_rx(rmnwx_rx, W(IS), 0x010))                          \
+        movcx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divdx_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movdx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVUM64_H((VAL(IS)) & 0xFFFFFFFF)),    \
+                                IW(RT_DVUM64_L((VAL(IS)) & 0xFFFFFFFF))),   \
+                 dvjxx_rx(dvuzx_rx, W(IS), 0x000)                           \
+                 dvjxx_rx(dvuzx_rx, W(IS), 0x010))                          \
+        movdx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divdn_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        movdx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVNM64_H((VAL(IS)) & 0x7FFFFFFF)),    \
+                                IW(RT_DVNM64_L((VAL(IS)) & 0x7FFFFFFF))),   \
+                 dvjxx_rx(dvnzx_rx, W(IS), 0x000)                           \
+                 dvjxx_rx(dvnzx_rx, W(IS), 0x010))                          \
+        movdx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remdx_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movdx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVUM64_H((VAL(IS)) & 0xFFFFFFFF)),    \
+                                IW(RT_DVUM64_L((VAL(IS)) & 0xFFFFFFFF))),   \
+                 dvjxx_rx(rmuzx_rx, W(IS), 0x000)                           \
+                 dvjxx_rx(rmuzx_rx, W(IS), 0x010))                          \
+        movdx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remdn_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movdx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVNM64_H((VAL(IS)) & 0x7FFFFFFF)),    \
+                                IW(RT_DVNM64_L((VAL(IS)) & 0x7FFFFFFF))),   \
+                 dvjxx_rx(rmnzx_rx, W(IS), 0x000)                           \
+                 dvjxx_rx(rmnzx_rx, W(IS), 0x010))                          \
+        movdx_ld(W(XG), Mebp, inf_SCR02(0))
+
+/******************************************************************************/
+/**** 128-bit **** (int-div/rem by immediate) with fixed-32/64-bit element ****/
+/******************************************************************************/
+
+#define divix_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF))),     \
+                 dvixx_rx(dvuwx_rx, W(IS), 0x000))                          \
+        movix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divin_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF))),     \
+                 dvixx_rx(dvnwx_rx, W(IS), 0x000))                          \
+        movix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remix_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVUM32((VAL(IS)) & 0xFFFFFFFF))),     \
+                 dvixx_rx(rmuwx_rx, W(IS), 0x000))                          \
+        movix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remin_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movwx_ri(Recx, IW(RT_DVNM32((VAL(IS)) & 0x7FFFFFFF))),     \
+                 dvixx_rx(rmnwx_rx, W(IS), 0x000))                          \
+        movix_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divjx_ri(XG, IS) /* vertical integer div by immediate, unsigned */  \
+        movjx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVUM64_H((VAL(IS)) & 0xFFFFFFFF)),    \
+                                IW(RT_DVUM64_L((VAL(IS)) & 0xFFFFFFFF))),   \
+                 dvjxx_rx(dvuzx_rx, W(IS), 0x000))                          \
+        movjx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define divjn_ri(XG, IS) /* vertical integer div by immediate, signed */    \
+        movjx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVNM64_H((VAL(IS)) & 0x7FFFFFFF)),    \
+                                IW(RT_DVNM64_L((VAL(IS)) & 0x7FFFFFFF))),   \
+                 dvjxx_rx(dvnzx_rx, W(IS), 0x000))                          \
+        movjx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remjx_ri(XG, IS) /* vertical integer rem by immediate, unsigned */  \
+        movjx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVUM64_H((VAL(IS)) & 0xFFFFFFFF)),    \
+                                IW(RT_DVUM64_L((VAL(IS)) & 0xFFFFFFFF))),   \
+                 dvjxx_rx(rmuzx_rx, W(IS), 0x000))                          \
+        movjx_ld(W(XG), Mebp, inf_SCR02(0))
+
+#define remjn_ri(XG, IS) /* vertical integer rem by immediate, signed */    \
+        movjx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        dvxxx_rx(movzx_rj(Recx, IW(RT_DVNM64_H((VAL(IS)) & 0x7FFFFFFF)),    \
+                                IW(RT_DVNM64_L((VAL(IS)) & 0x7FFFFFFF))),   \
+                 dvjxx_rx(rmnzx_rx, W(IS), 0x000))                          \
+        movjx_ld(W(XG), Mebp, inf_SCR02(0))
+
+/* Recx holds the magic number, Reax the element, Redx the high product,
+ * elements are read from inf_SCR01, results are written to inf_SCR02 */
+
+#define dvxxx_rx(ld, ops) /* not portable, do not use outside */            \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        ld                                                                  \
+        ops                                                                 \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)
+
+#define dvixx_rx(op, IS, nx) /* not portable, do not use outside */         \
+        op(W(IS), nx+0x00) op(W(IS), nx+0x04)                               \
+        op(W(IS), nx+0x08) op(W(IS), nx+0x0C)
+
+#define dvjxx_rx(op, IS, nx) /* not portable, do not use outside */         \
+        op(W(IS), nx+0x00) op(W(IS), nx+0x08)
+
+/* q = (t + ((n - t) >> S1)) >> S2, t = mulhi(n, M), unsigned */
+
+#define dvuwx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvuwx_rq(W(IS), nx)                                                 \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define rmuwx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvuwx_rq(W(IS), nx)                                                 \
+        rmwxx_rq(W(IS), nx)
+
+#define dvuwx_rq(IS, nx) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulwx_xr(Recx)                                                      \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        subwx_rr(Reax, Redx)                                                \
+        shrwx_ri(Reax, IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))                \
+        addwx_rr(Reax, Redx)                                                \
+        shrwx_ri(Reax, IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+/* q = ((n + mulhi(n, M)) >> S) - (n >> 31), signed, where the last term
+ * is taken from the sign of the shifted sum, as it matches the sign of n */
+
+#define dvnwx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvnwx_rq(W(IS), nx)                                                 \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define rmnwx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvnwx_rq(W(IS), nx)                                                 \
+        rmwxx_rq(W(IS), nx)
+
+#define dvnwx_rq(IS, nx) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulwn_xr(Recx)                                                      \
+        addwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shrwn_ri(Redx, IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                 \
+        movwx_rr(Reax, Redx)                                                \
+        shrwx_ri(Reax, IB(31))                                              \
+        addwx_rr(Reax, Redx)
+
+/* r = n - q * d, the same for unsigned and signed */
+
+#define rmwxx_rq(IS, nx) /* not portable, do not use outside */             \
+        movwx_ri(Redx, W(IS))                                               \
+        mulwx_rr(Reax, Redx)                                                \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        subwx_rr(Redx, Reax)                                                \
+        movwx_st(Redx,  Mebp, inf_SCR02(nx))
+
+/* the same as above for 64-bit elements */
+
+#define dvuzx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvuzx_rq(W(IS), nx)                                                 \
+        movzx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define rmuzx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvuzx_rq(W(IS), nx)                                                 \
+        rmzxx_rq(W(IS), nx)
+
+#define dvuzx_rq(IS, nx) /* not portable, do not use outside */             \
+        movzx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulzx_xr(Recx)                                                      \
+        movzx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        subzx_rr(Reax, Redx)                                                \
+        shrzx_ri(Reax, IB(RT_DVUS1((VAL(IS)) & 0xFFFFFFFF)))                \
+        addzx_rr(Reax, Redx)                                                \
+        shrzx_ri(Reax, IB(RT_DVUS2((VAL(IS)) & 0xFFFFFFFF)))
+
+#define dvnzx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvnzx_rq(W(IS), nx)                                                 \
+        movzx_st(Reax,  Mebp, inf_SCR02(nx))
+
+#define rmnzx_rx(IS, nx) /* not portable, do not use outside */             \
+        dvnzx_rq(W(IS), nx)                                                 \
+        rmzxx_rq(W(IS), nx)
+
+#define dvnzx_rq(IS, nx) /* not portable, do not use outside */             \
+        movzx_ld(Reax,  Mebp, inf_SCR01(nx))                                \
+        mulzn_xr(Recx)                                                      \
+        addzx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        shrzn_ri(Redx, IB(RT_DVNS((VAL(IS)) & 0x7FFFFFFF)))                 \
+        movzx_rr(Reax, Redx)                                                \
+        shrzx_ri(Reax, IB(63))                                              \
+        addzx_rr(Reax, Redx)
+
+#define rmzxx_rq(IS, nx) /* not portable, do not use outside */             \
+        movzx_rj(Redx, IW(0), W(IS))                                        \
+        mulzx_rr(Reax, Redx)                                                \
+        movzx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        subzx_rr(Redx, Reax)                                                \
+        movzx_st(Redx,  Mebp, inf_SCR02(nx))
+
+/******************************************************************************/
+/**** var-len **** (lane shuffle/zip/broadcast) with fixed-32/64-bit element **/
+/******************************************************************************/
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), D[i] = S[(i + T) mod n]
+ * shf takes 2 bits per 32-bit element (as pshufd) or 1 bit per 64-bit
+ * element (as vpermilpd), the same pattern applies to every quad,
+ * zip/uzp work within 128-bit quads (as unpck/shufps on x86 and NEON),
+ * they are inverses of each other (64-bit zip and uzp coincide) and
+ * require (#G != #S), bcx/rot cross quads and take T modulo n elements,
+ * generic forms below go through the scratch area using BASE ops,
+ * targets with native lane permutes override them */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define shfox_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(shfwx_rx, VAL(IT)))                               \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define zipox_rr(XG, XS)     /* destroys scratch area */                    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(zipwx_rx, 0x00))                                  \
+        movox_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movox_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define uzpox_rr(XG, XS)     /* destroys scratch area */                    \
+        movox_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(uzpwx_rx, 0x00))                                  \
+        movox_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movox_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define bcxox_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxwx_rx(VAL(IT), 0x00) gsvxx_rx(bcswx_rx, 0x00))          \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rotox_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(rotwx_rx, ((VAL(IT))&(RT_SIMD/32-1))*4))          \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define shfqx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(shfzx_rx, VAL(IT)))                               \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define zipqx_rr(XG, XS)     /* destroys scratch area */                    \
+        movqx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(zipzx_rx, 0x00))                                  \
+        movqx_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movqx_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define uzpqx_rr(XG, XS)     /* destroys scratch area */                    \
+        zipqx_rr(W(XG), W(XS))
+
+#define bcxqx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxzx_rx(VAL(IT), 0x00) gsvxx_rx(bcszx_rx, 0x00)           \
+                 bcxzx_rx(VAL(IT), 0x04) gsvxx_rx(bcszx_rx, 0x04))          \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rotqx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(rotwx_rx, ((VAL(IT))&(RT_SIMD/64-1))*8))          \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/* Reax is used as a temporary, S (and G) are taken from SCR01 (and SCR02),
+ * results are assembled in SCR02 (and SCR03, SCR04 for zip/uzp) one quad
+ * at a time, byte offsets follow RT_SIMD as 256/128-bit forms are only
+ * used there */
+
+#define shfxx_rx(ops) /* not portable, do not use outside */                \
+        stack_st(Reax)                                                      \
+        ops                                                                 \
+        stack_ld(Reax)
+
+#define shmwx_rx(DD, DS) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, W(DS))                                        \
+        movwx_st(Reax,  Mebp, W(DD))
+
+#define shfwx_rx(it, nx) /* not portable, do not use outside */             \
+        shmwx_rx(inf_SCR02(nx+0x00), inf_SCR01(nx+(((it)>>0)&3)*4))         \
+        shmwx_rx(inf_SCR02(nx+0x04), inf_SCR01(nx+(((it)>>2)&3)*4))         \
+        shmwx_rx(inf_SCR02(nx+0x08), inf_SCR01(nx+(((it)>>4)&3)*4))         \
+        shmwx_rx(inf_SCR02(nx+0x0C), inf_SCR01(nx+(((it)>>6)&3)*4))
+
+#define shfzx_rx(it, nx) /* not portable, do not use outside */             \
+        shmwx_rx(inf_SCR02(nx+0x00), inf_SCR01(nx+(((it)>>0)&1)*8+0x00))    \
+        shmwx_rx(inf_SCR02(nx+0x04), inf_SCR01(nx+(((it)>>0)&1)*8+0x04))    \
+        shmwx_rx(inf_SCR02(nx+0x08), inf_SCR01(nx+(((it)>>1)&1)*8+0x00))    \
+        shmwx_rx(inf_SCR02(nx+0x0C), inf_SCR01(nx+(((it)>>1)&1)*8+0x04))
+
+#define zipwx_rx(it, nx) /* not portable, do not use outside */             \
+        shmwx_rx(inf_SCR03(nx+0x00), inf_SCR01(nx+0x00))                    \
+        shmwx_rx(inf_SCR03(nx+0x04), inf_SCR02(nx+0x00))                    \
+        shmwx_rx(inf_SCR03(nx+0x08), inf_SCR01(nx+0x04))                    \
+        shmwx_rx(inf_SCR03(nx+0x0C), inf_SCR02(nx+0x04))                    \
+        shmwx_rx(inf_SCR04(nx+0x00), inf_SCR01(nx+0x08))                    \
+        shmwx_rx(inf_SCR04(nx+0x04), inf_SCR02(nx+0x08))                    \
+        shmwx_rx(inf_SCR04(nx+0x08), inf_SCR01(nx+0x0C))                    \
+        shmwx_rx(inf_SCR04(nx+0x0C), inf_SCR02(nx+0x0C))
+
+#define uzpwx_rx(it, nx) /* not portable, do not use outside */             \
+        shmwx_rx(inf_SCR03(nx+0x00), inf_SCR01(nx+0x00))                    \
+        shmwx_rx(inf_SCR03(nx+0x04), inf_SCR01(nx+0x08))                    \
+        shmwx_rx(inf_SCR03(nx+0x08), inf_SCR02(nx+0x00))                    \
+        shmwx_rx(inf_SCR03(nx+0x0C), inf_SCR02(nx+0x08))                    \
+        shmwx_rx(inf_SCR04(nx+0x00), inf_SCR01(nx+0x04))                    \
+        shmwx_rx(inf_SCR04(nx+0x04), inf_SCR01(nx+0x0C))                    \
+        shmwx_rx(inf_SCR04(nx+0x08), inf_SCR02(nx+0x04))                    \
+        shmwx_rx(inf_SCR04(nx+0x0C), inf_SCR02(nx+0x0C))
+
+#define zipzx_rx(it, nx) /* not portable, do not use outside */             \
+        shmwx_rx(inf_SCR03(nx+0x00), inf_SCR01(nx+0x00))                    \
+        shmwx_rx(inf_SCR03(nx+0x04), inf_SCR01(nx+0x04))                    \
+        shmwx_rx(inf_SCR03(nx+0x08), inf_SCR02(nx+0x00))                    \
+        shmwx_rx(inf_SCR03(nx+0x0C), inf_SCR02(nx+0x04))                    \
+        shmwx_rx(inf_SCR04(nx+0x00), inf_SCR01(nx+0x08))                    \
+        shmwx_rx(inf_SCR04(nx+0x04), inf_SCR01(nx+0x0C))                    \
+        shmwx_rx(inf_SCR04(nx+0x08), inf_SCR02(nx+0x08))                    \
+        shmwx_rx(inf_SCR04(nx+0x0C), inf_SCR02(nx+0x0C))
+
+#define bcxwx_rx(it, nx) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, inf_SCR01(((it)&(RT_SIMD/32-1))*4))
+
+#define bcswx_rx(it, nx) /* not portable, do not use outside */             \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x00))                           \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x04))                           \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x08))                           \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+0x0C))
+
+#define bcxzx_rx(it, nx) /* not portable, do not use outside */             \
+        movwx_ld(Reax,  Mebp, inf_SCR01(((it)&(RT_SIMD/64-1))*8+nx))
+
+#define bcszx_rx(it, nx) /* not portable, do not use outside */             \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+it+0x00))                        \
+        movwx_st(Reax,  Mebp, inf_SCR02(nx+it+0x08))
+
+#define rotwx_rx(it, nx) /* not portable, do not use outside */             \
+        shmwx_rx(inf_SCR02(nx+0x00), inf_SCR01(rotxx_rx(it, nx+0x00)))      \
+        shmwx_rx(inf_SCR02(nx+0x04), inf_SCR01(rotxx_rx(it, nx+0x04)))      \
+        shmwx_rx(inf_SCR02(nx+0x08), inf_SCR01(rotxx_rx(it, nx+0x08)))      \
+        shmwx_rx(inf_SCR02(nx+0x0C), inf_SCR01(rotxx_rx(it, nx+0x0C)))
+
+#define rotxx_rx(it, nx) /* not portable, do not use outside */             \
+        (((nx)+(it))&(RT_SIMD/8-1))
+
+/******************************************************************************/
+/**** 256-bit **** (lane shuffle/zip/broadcast) with fixed-32/64-bit element **/
+/******************************************************************************/
+
+#define shfcx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(shfwx_rx, VAL(IT)))                               \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define zipcx_rr(XG, XS)     /* destroys scratch area */                    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(zipwx_rx, 0x00))                                  \
+        movcx_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movcx_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define uzpcx_rr(XG, XS)     /* destroys scratch area */                    \
+        movcx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movcx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(uzpwx_rx, 0x00))                                  \
+        movcx_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movcx_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define bcxcx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxwx_rx(VAL(IT), 0x00) gsvxx_rx(bcswx_rx, 0x00))          \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rotcx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(rotwx_rx, ((VAL(IT))&(RT_SIMD/32-1))*4))          \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define shfdx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(shfzx_rx, VAL(IT)))                               \
+        movdx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define zipdx_rr(XG, XS)     /* destroys scratch area */                    \
+        movdx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movdx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(zipzx_rx, 0x00))                                  \
+        movdx_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movdx_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define uzpdx_rr(XG, XS)     /* destroys scratch area */                    \
+        zipdx_rr(W(XG), W(XS))
+
+#define bcxdx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxzx_rx(VAL(IT), 0x00) gsvxx_rx(bcszx_rx, 0x00)           \
+                 bcxzx_rx(VAL(IT), 0x04) gsvxx_rx(bcszx_rx, 0x04))          \
+        movdx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rotdx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(rotwx_rx, ((VAL(IT))&(RT_SIMD/64-1))*8))          \
+        movdx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/******************************************************************************/
+/**** 128-bit **** (lane shuffle/zip/broadcast) with fixed-32/64-bit element **/
+/******************************************************************************/
+
+#define shfix_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(shfwx_rx, VAL(IT)))                               \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define zipix_rr(XG, XS)     /* destroys scratch area */                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(zipwx_rx, 0x00))                                  \
+        movix_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movix_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define uzpix_rr(XG, XS)     /* destroys scratch area */                    \
+        movix_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movix_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(uzpwx_rx, 0x00))                                  \
+        movix_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movix_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define bcxix_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxwx_rx(VAL(IT), 0x00) gsvxx_rx(bcswx_rx, 0x00))          \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rotix_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(rotwx_rx, ((VAL(IT))&(RT_SIMD/32-1))*4))          \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define shfjx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(shfzx_rx, VAL(IT)))                               \
+        movjx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define zipjx_rr(XG, XS)     /* destroys scratch area */                    \
+        movjx_st(W(XG), Mebp, inf_SCR01(0))                                 \
+        movjx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        shfxx_rx(gsvxx_rx(zipzx_rx, 0x00))                                  \
+        movjx_ld(W(XG), Mebp, inf_SCR03(0))                                 \
+        movjx_ld(W(XS), Mebp, inf_SCR04(0))
+
+#define uzpjx_rr(XG, XS)     /* destroys scratch area */                    \
+        zipjx_rr(W(XG), W(XS))
+
+#define bcxjx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxzx_rx(VAL(IT), 0x00) gsvxx_rx(bcszx_rx, 0x00)           \
+                 bcxzx_rx(VAL(IT), 0x04) gsvxx_rx(bcszx_rx, 0x04))          \
+        movjx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define rotjx_ri(XD, XS, IT) /* destroys scratch area */                    \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(gsvxx_rx(rotwx_rx, ((VAL(IT))&(RT_SIMD/64-1))*8))          \
+        movjx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/******************************************************************************/
+/**** var-len **** (broadcast load) with fixed-32/64-bit element **************/
+/******************************************************************************/
+
+/* mov (D = S), broadcast load (bc) replicates one element from memory
+ * to all elements of D, S needs only element alignment, used for uniform
+ * constants to avoid pre-splatted arrays (see RT_MATH_SCALAR above),
+ * generic forms below go through the scalar subset and the scratch area,
+ * targets with native broadcast loads override them */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define movox_bc(XD, MS, DS) /* destroys scratch area */                    \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        movrs_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxwx_rx(0, 0x00) gsvxx_rx(bcswx_rx, 0x00))                \
+        movox_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define movqx_bc(XD, MS, DS) /* destroys scratch area */                    \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        movts_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxzx_rx(0, 0x00) gsvxx_rx(bcszx_rx, 0x00)                 \
+                 bcxzx_rx(0, 0x04) gsvxx_rx(bcszx_rx, 0x04))                \
+        movqx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/******************************************************************************/
+/**** 256-bit **** (broadcast load) with fixed-32/64-bit element **************/
+/******************************************************************************/
+
+#define movcx_bc(XD, MS, DS) /* destroys scratch area */                    \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        movrs_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxwx_rx(0, 0x00) gsvxx_rx(bcswx_rx, 0x00))                \
+        movcx_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define movdx_bc(XD, MS, DS) /* destroys scratch area */                    \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        movts_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxzx_rx(0, 0x00) gsvxx_rx(bcszx_rx, 0x00)                 \
+                 bcxzx_rx(0, 0x04) gsvxx_rx(bcszx_rx, 0x04))                \
+        movdx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/******************************************************************************/
+/**** 128-bit **** (broadcast load) with fixed-32/64-bit element **************/
+/******************************************************************************/
+
+#define movix_bc(XD, MS, DS) /* destroys scratch area */                    \
+        movrs_ld(W(XD), W(MS), W(DS))                                       \
+        movrs_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxwx_rx(0, 0x00) gsvxx_rx(bcswx_rx, 0x00))                \
+        movix_ld(W(XD), Mebp, inf_SCR02(0))
+
+#define movjx_bc(XD, MS, DS) /* destroys scratch area */                    \
+        movts_ld(W(XD), W(MS), W(DS))                                       \
+        movts_st(W(XD), Mebp, inf_SCR01(0))                                 \
+        shfxx_rx(bcxzx_rx(0, 0x00) gsvxx_rx(bcszx_rx, 0x00)                 \
+                 bcxzx_rx(0, 0x04) gsvxx_rx(bcszx_rx, 0x04))                \
+        movjx_ld(W(XD), Mebp, inf_SCR02(0))
+
+/******************************************************************************/
+/**** var-len **** (stream compaction) with fixed-32/64-bit element ***********/
+/******************************************************************************/
+
+/* cmp ([D] = active elements of S packed), compress-store under a mask
+ * exp (G = active elements unpacked from [S]), expand-load under a mask
+ * mkc (D = number of active elements in mask S), to advance the streams
+ * cmp/exp use Xmm0 implicitly as a mask register, mask elements are either
+ * all 0s or all 1s (as produced by SIMD compare ops), cmp stores active
+ * elements of S contiguously at [MD + DD], exp fills active elements of G
+ * from consecutive elements at [MS + DS] keeping inactive ones (as mmv),
+ * both need only element alignment, generic cmp writes and exp reads
+ * at most one element past the mkc count, thus streams need to be padded
+ * by one element past their length, the element stored past the count
+ * is undefined, AVX-512 and SVE store exactly mkc elements under a mask
+ * (safe for exact-sized output arrays), mkc destroys Reax (as mkj) and
+ * returns a count within 31-bit range usable in both 32/64-bit BASE subsets,
+ * exp destroys Xmm0 (as mmv), generic forms below go through the scratch
+ * area using BASE ops, AVX-512 and SVE override them with native ops */
+
+#if   (RT_SIMD >= 512) || (defined RT_SWEX1 || defined RT_SWEX2)
+
+#define cmpox_st(XS, MD, DD) /* destroys scratch area */                    \
+        movox_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movox_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MD), W(DD), gsvxx_rx(gsixx_rx, cmxwx_rx))
+
+#define expox_ld(XG, MS, DS) /* destroys scratch area, Xmm0 */              \
+        movox_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MS), W(DS), gsvxx_rx(gsixx_rx, exxwx_rx))                \
+        mmvox_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mkcox_rx(XS, RD)     /* destroys Reax, scratch area */              \
+        movox_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        movwx_ri(Reax,  IB(0))                                              \
+        gsvxx_rx(gsixx_rx, cmxxx_xx)                                        \
+        stack_ld(Redx)                                                      \
+        movwx_rr(W(RD), Reax)
+
+#define cmpqx_st(XS, MD, DD) /* destroys scratch area */                    \
+        movqx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movqx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MD), W(DD), gsvxx_rx(gsjxx_rx, cmxdx_rx))
+
+#define expqx_ld(XG, MS, DS) /* destroys scratch area, Xmm0 */              \
+        movqx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MS), W(DS), gsvxx_rx(gsjxx_rx, exxdx_rx))                \
+        mmvqx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mkcqx_rx(XS, RD)     /* destroys Reax, scratch area */              \
+        movqx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        movwx_ri(Reax,  IB(0))                                              \
+        gsvxx_rx(gsjxx_rx, cmxxx_xx)                                        \
+        stack_ld(Redx)                                                      \
+        movwx_rr(W(RD), Reax)
+
+#endif /* RT_SIMD: 2K8, 1K4, 512 */
+
+/* Recx holds the stream address, Reax the running count of active elements,
+ * Redx the element data, S is taken from SCR01 (exp gathers elements there),
+ * the mask from SCR02, elements are moved regardless of the mask at the
+ * running count (subsequent active elements overwrite inactive ones),
+ * thus touching at most one element past the final count (only inactive
+ * elements after the last active one land there), mkc runs the count alone
+ * with Redx saved on the stack, byte offsets follow RT_SIMD as 256/128-bit
+ * forms are only used there */
+
+#define cmxxx_rx(MS, DS, ops) /* not portable, do not use outside */        \
+        stack_st(Reax)                                                      \
+        stack_st(Recx)                                                      \
+        stack_st(Redx)                                                      \
+        adrxx_ld(Recx, W(MS), W(DS))                                        \
+        movwx_ri(Reax,  IB(0))                                              \
+        ops                                                                 \
+        stack_ld(Redx)                                                      \
+        stack_ld(Recx)                                                      \
+        stack_ld(Reax)
+
+#define cmxxx_xx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Redx,  Mebp, inf_SCR02(nx))                                \
+        shrwx_ri(Redx,  IB(31))                                             \
+        addwx_rr(Reax,  Redx)
+
+#define cmxwx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx))                                \
+        movwx_st(Redx,  Kecx, DP(0x00))                                     \
+        cmxxx_xx(nx)
+
+#define exxwx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Redx,  Kecx, DP(0x00))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR01(nx))                                \
+        cmxxx_xx(nx)
+
+#define cmxdx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx+0x00))                           \
+        movwx_st(Redx,  Lecx, DP(0x00))                                     \
+        movwx_ld(Redx,  Mebp, inf_SCR01(nx+0x04))                           \
+        movwx_st(Redx,  Lecx, DP(0x04))                                     \
+        cmxxx_xx(nx)
+
+#define exxdx_rx(nx) /* not portable, do not use outside */                 \
+        movwx_ld(Redx,  Lecx, DP(0x00))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR01(nx+0x00))                           \
+        movwx_ld(Redx,  Lecx, DP(0x04))                                     \
+        movwx_st(Redx,  Mebp, inf_SCR01(nx+0x04))                           \
+        cmxxx_xx(nx)
+
+/******************************************************************************/
+/**** 256-bit **** (stream compaction) with fixed-32/64-bit element ***********/
+/******************************************************************************/
+
+#define cmpcx_st(XS, MD, DD) /* destroys scratch area */                    \
+        movcx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movcx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MD), W(DD), gsvxx_rx(gsixx_rx, cmxwx_rx))
+
+#define expcx_ld(XG, MS, DS) /* destroys scratch area, Xmm0 */              \
+        movcx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MS), W(DS), gsvxx_rx(gsixx_rx, exxwx_rx))                \
+        mmvcx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mkccx_rx(XS, RD)     /* destroys Reax, scratch area */              \
+        movcx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        movwx_ri(Reax,  IB(0))                                              \
+        gsvxx_rx(gsixx_rx, cmxxx_xx)                                        \
+        stack_ld(Redx)                                                      \
+        movwx_rr(W(RD), Reax)
+
+#define cmpdx_st(XS, MD, DD) /* destroys scratch area */                    \
+        movdx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movdx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MD), W(DD), gsvxx_rx(gsjxx_rx, cmxdx_rx))
+
+#define expdx_ld(XG, MS, DS) /* destroys scratch area, Xmm0 */              \
+        movdx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MS), W(DS), gsvxx_rx(gsjxx_rx, exxdx_rx))                \
+        mmvdx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mkcdx_rx(XS, RD)     /* destroys Reax, scratch area */              \
+        movdx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        movwx_ri(Reax,  IB(0))                                              \
+        gsvxx_rx(gsjxx_rx, cmxxx_xx)                                        \
+        stack_ld(Redx)                                                      \
+        movwx_rr(W(RD), Reax)
+
+/******************************************************************************/
+/**** 128-bit **** (stream compaction) with fixed-32/64-bit element ***********/
+/******************************************************************************/
+
+#define cmpix_st(XS, MD, DD) /* destroys scratch area */                    \
+        movix_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movix_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MD), W(DD), gsvxx_rx(gsixx_rx, cmxwx_rx))
+
+#define expix_ld(XG, MS, DS) /* destroys scratch area, Xmm0 */              \
+        movix_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MS), W(DS), gsvxx_rx(gsixx_rx, exxwx_rx))                \
+        mmvix_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mkcix_rx(XS, RD)     /* destroys Reax, scratch area */              \
+        movix_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        movwx_ri(Reax,  IB(0))                                              \
+        gsvxx_rx(gsixx_rx, cmxxx_xx)                                        \
+        stack_ld(Redx)                                                      \
+        movwx_rr(W(RD), Reax)
+
+#define cmpjx_st(XS, MD, DD) /* destroys scratch area */                    \
+        movjx_st(W(XS), Mebp, inf_SCR01(0))                                 \
+        movjx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MD), W(DD), gsvxx_rx(gsjxx_rx, cmxdx_rx))
+
+#define expjx_ld(XG, MS, DS) /* destroys scratch area, Xmm0 */              \
+        movjx_st(Xmm0,  Mebp, inf_SCR02(0))                                 \
+        cmxxx_rx(W(MS), W(DS), gsvxx_rx(gsjxx_rx, exxdx_rx))                \
+        mmvjx_ld(W(XG), Mebp, inf_SCR01(0))
+
+#define mkcjx_rx(XS, RD)     /* destroys Reax, scratch area */              \
+        movjx_st(W(XS), Mebp, inf_SCR02(0))                                 \
+        stack_st(Redx)                                                      \
+        movwx_ri(Reax,  IB(0))                                              \
+        gsvxx_rx(gsjxx_rx, cmxxx_xx)                                        \
+        stack_ld(Redx)                                                      \
+        movwx_rr(W(RD), Reax)
+
+/******************************************************************************/
+/**** var-len **** SIMD elementary math with configurable element **** meta ***/
+/******************************************************************************/
+
+/* Elementary functions are built as sequences of cmdp*_** instructions,
+ * argument reduction and polynomial coefficients follow fdlibm (Sun, 1993),
+ * coefficients are loaded from rt_SIMD_MATH (see ASM_INIT_MATH above)
+ * via Redi (set from inf_MAT, preserved on the stack by each function)
+ * as full vectors or broadcast from scalars (RT_MATH_SCALAR, uses mat_SCR05),
+ * shorter polynomials are evaluated for 32-bit elements, each function takes
+ * two temporary registers (X1, X2) which are destroyed along with inf_SCR03/04,
+ * XD must not match X1, X2 (or XS, XT in atnps_rr, X1, X2 in powps_rr),
+ * denormal inputs/results and NaN propagation are not supported,
+ * max error measured against long double libm (fp32/fp64 in ULPs):
+ * exp 1/1, log 1/1, sin/cos 2/2 (larger relative error near zeros of sin/cos
+ * beyond |x| of 10^2/10^5, argument reduction is exact up to these limits),
+ * atan2 4/3, pow grows with |y * log(x)| (up to 16/16 with |y| <= 4) */
+
+/* exp (D = exp(S)), results above (2^127.5)/(2^1023.5) overflow to +inf,
+ * results below the smallest normal value are flushed to 0 */
+
+#define expps_rr(XD, X1, X2, XS)                                            \
+        stack_st(Redi)                                                      \
+        movxx_ld(Redi,  Mebp, inf_MAT)                                      \
+        movpx_rr(W(XD), W(XS))                                              \
+        expps_rx(W(XD), W(X1), W(X2))                                       \
+        stack_ld(Redi)
+
+#define expps_rx(XD, X1, X2) /* not portable, do not use outside */         \
+        mthpx_ld(W(X2), Medi, mat_EXP05)                                    \
+        movpx_rr(W(X1), W(XD))                                              \
+        cgeps_rr(W(X1), W(X2))                                              \
+        movpx_st(W(X1), Mebp, inf_SCR03(0))                                 \
+        mthpx_ld(W(X2), Medi, mat_EXP04)                                    \
+        movpx_rr(W(X1), W(XD))                                              \
+        cgtps_rr(W(X1), W(X2))                                              \
+        shlpx_ri(W(X1), IB(RT_SIMD_MANT))                                   \
+        gpcpx_rs(andpx, W(X1), W(X2), Mebp, inf_GPC04)                      \
+        movpx_st(W(X1), Mebp, inf_SCR04(0))                                 \
+        minps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_EXP05)                                    \
+        maxps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X1), Medi, mat_EXP01)                                    \
+        mulps_rr(W(X1), W(XD))                                              \
+        rnnps_rr(W(X1), W(X1))                                              \
+        mthpx_ld(W(X2), Medi, mat_EXP02)                                    \
+        mulps_rr(W(X2), W(X1))                                              \
+        subps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_EXP03)                                    \
+        mulps_rr(W(X2), W(X1))                                              \
+        subps_rr(W(XD), W(X2))                                              \
+        cvzps_rr(W(X1), W(X1))                                              \
+        shlpx_ri(W(X1), IB(RT_SIMD_MANT))                                   \
+        gpcpx_rt(addpx, W(X1), W(X2), Mebp, inf_GPC05)                      \
+        andpx_ld(W(X1), Mebp, inf_SCR03(0))                                 \
+        orrpx_ld(W(X1), Mebp, inf_SCR04(0))                                 \
+        movpx_st(W(X1), Mebp, inf_SCR03(0))                                 \
+        movpx_rr(W(X1), W(XD))                                              \
+        mulps_rr(W(X1), W(XD))                                              \
+        expps_rp(W(X2), W(X1))                                              \
+        movpx_rr(W(X1), W(XD))                                              \
+        subps_rr(W(X1), W(X2))                                              \
+        movpx_rr(W(X2), W(X1))                                              \
+        mulps_rr(W(X2), W(XD))                                              \
+        gpcpx_rs(xorpx, W(X1), W(X2), Mebp, inf_GPC06)                      \
+        gpcpx_rs(addps, W(X1), W(X2), Mebp, inf_GPC01)                      \
+        gpcpx_rs(addps, W(X1), W(X2), Mebp, inf_GPC01)                      \
+        divps_rr(W(X2), W(X1))                                              \
+        addps_rr(W(XD), W(X2))                                              \
+        gpcpx_rt(addps, W(XD), W(X1), Mebp, inf_GPC01)                      \
+        mulps_ld(W(XD), Mebp, inf_SCR03(0))
+
+/* log (D = log(S)), returns -inf for 0 and NaN for negative values */
+
+#define logps_rr(XD, X1, X2, XS)                                            \
+        stack_st(Redi)                                                      \
+        movxx_ld(Redi,  Mebp, inf_MAT)                                      \
+        movpx_rr(W(XD), W(XS))                                              \
+        logps_rx(W(XD), W(X1), W(X2))                                       \
+        stack_ld(Redi)
+
+#define logps_rx(XD, X1, X2) /* not portable, do not use outside */         \
+        xorpx_rr(W(X1), W(X1))                                              \
+        cgeps_rr(W(X1), W(XD))                                              \
+        movpx_st(W(X1), Mebp, inf_SCR04(0))                                 \
+        shlpx_ri(W(X1), IB(RT_SIMD_MANT))                                   \
+        xorpx_rr(W(X2), W(X2))                                              \
+        cgtps_rr(W(X2), W(XD))                                              \
+        orrpx_rr(W(X1), W(X2))                                              \
+        movpx_st(W(X1), Mebp, inf_SCR03(0))                                 \
+        movpx_rr(W(X1), W(XD))                                              \
+        gpcpx_rt(subpx, W(X1), W(X2), Mebp, inf_GPC05)                      \
+        shrpn_ri(W(X1), IB(RT_SIMD_MANT))                                   \
+        movpx_rr(W(X2), W(X1))                                              \
+        shlpx_ri(W(X2), IB(RT_SIMD_MANT))                                   \
+        subpx_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_LOG01)                                    \
+        cltps_rr(W(X2), W(XD))                                              \
+        subpx_rr(W(X1), W(X2))                                              \
+        gpcpx_rs(andpx, W(X2), W(X1), Mebp, inf_GPC02)                      \
+        gpcpx_rs(addps, W(X2), W(X1), Mebp, inf_GPC01)                      \
+        mulps_rr(W(XD), W(X2))                                              \
+        cvnpn_rr(W(X1), W(X1))                                              \
+        movpx_ld(W(X2), Mebp, inf_SCR04(0))                                 \
+        annpx_rr(W(X2), W(X1))                                              \
+        orrpx_ld(W(X2), Mebp, inf_SCR03(0))                                 \
+        movpx_st(W(X2), Mebp, inf_SCR03(0))                                 \
+        movpx_rr(W(X1), W(XD))                                              \
+        gpcpx_rt(addps, W(X1), W(X2), Mebp, inf_GPC01)                      \
+        gpcpx_rt(subps, W(XD), W(X2), Mebp, inf_GPC01)                      \
+        movpx_rr(W(X2), W(XD))                                              \
+        divps_rr(W(X2), W(X1))                                              \
+        movpx_st(W(X2), Mebp, inf_SCR04(0))                                 \
+        mulps_rr(W(X2), W(X2))                                              \
+        logps_rp(W(X1), W(X2))                                              \
+        movpx_rr(W(X2), W(XD))                                              \
+        mulps_rr(W(X2), W(XD))                                              \
+        gpcpx_rs(mulps, W(X2), W(X1), Mebp, inf_GPC02)                      \
+        subps_rr(W(X1), W(X2))                                              \
+        mulps_ld(W(X1), Mebp, inf_SCR04(0))                                 \
+        addps_rr(W(X1), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_EXP03)                                    \
+        mulps_ld(W(X2), Mebp, inf_SCR03(0))                                 \
+        addps_rr(W(X1), W(X2))                                              \
+        addps_rr(W(XD), W(X1))                                              \
+        mthpx_ld(W(X2), Medi, mat_EXP02)                                    \
+        mulps_ld(W(X2), Mebp, inf_SCR03(0))                                 \
+        addps_rr(W(XD), W(X2))
+
+/* pow (D = pow(S, T)) = exp(T * log(S)) for S > 0 */
+
+#define powps_rr(XD, X1, X2, XS, XT)                                        \
+        stack_st(Redi)                                                      \
+        movxx_ld(Redi,  Mebp, inf_MAT)                                      \
+        movpx_rr(W(XD), W(XS))                                              \
+        logps_rx(W(XD), W(X1), W(X2))                                       \
+        mulps_rr(W(XD), W(XT))                                              \
+        expps_rx(W(XD), W(X1), W(X2))                                       \
+        stack_ld(Redi)
+
+/* sin (D = sin(S)), cos (D = cos(S)), sincos (D = sin(S), E = cos(S)) */
+
+#define sinps_rr(XD, X1, X2, XS)                                            \
+        stack_st(Redi)                                                      \
+        movxx_ld(Redi,  Mebp, inf_MAT)                                      \
+        movpx_rr(W(XD), W(XS))                                              \
+        trgps_rx(W(XD), W(X1), W(X2))                                       \
+        trsps_rx(W(XD), W(X1), W(X2))                                       \
+        stack_ld(Redi)
+
+#define cosps_rr(XD, X1, X2, XS)                                            \
+        stack_st(Redi)                                                      \
+        movxx_ld(Redi,  Mebp, inf_MAT)                                      \
+        movpx_rr(W(XD), W(XS))                                              \
+        trgps_rx(W(XD), W(X1), W(X2))                                       \
+        trcps_rx(W(X1), W(X2))                                              \
+        trsps_rx(W(XD), W(X1), W(X2))                                       \
+        stack_ld(Redi)
+
+#define sncps_rr(XD, XE, X1, X2, XS)                                        \
+        stack_st(Redi)                                                      \
+        movxx_ld(Redi,  Mebp, inf_MAT)                                      \
+        movpx_rr(W(XD), W(XS))                                              \
+        trgps_rx(W(XD), W(X1), W(X2))                                       \
+        movpx_rr(W(XE), W(XD))                                              \
+        trsps_rx(W(XD), W(X1), W(X2))                                       \
+        trcps_rx(W(X1), W(X2))                                              \
+        trsps_rx(W(XE), W(X1), W(X2))                                       \
+        stack_ld(Redi)
+
+/* reduce D to [-pi/4, pi/4] and store quadrant to inf_SCR03,
+ * then D = cos(r), inf_SCR04 = sin(r) */
+
+#define trgps_rx(XD, X1, X2) /* not portable, do not use outside */         \
+        mthpx_ld(W(X1), Medi, mat_TRG01)                                    \
+        mulps_rr(W(X1), W(XD))                                              \
+        rnnps_rr(W(X1), W(X1))                                              \
+        mthpx_ld(W(X2), Medi, mat_TRG02)                                    \
+        mulps_rr(W(X2), W(X1))                                              \
+        subps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_TRG03)                                    \
+        mulps_rr(W(X2), W(X1))                                              \
+        subps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_TRG04)                                    \
+        mulps_rr(W(X2), W(X1))                                              \
+        subps_rr(W(XD), W(X2))                                              \
+        cvzps_rr(W(X1), W(X1))                                              \
+        movpx_st(W(X1), Mebp, inf_SCR03(0))                                 \
+        movpx_rr(W(X1), W(XD))                                              \
+        mulps_rr(W(X1), W(XD))                                              \
+        sinps_rp(W(X2), W(X1))                                              \
+        mulps_rr(W(X2), W(XD))                                              \
+        addps_rr(W(X2), W(XD))                                              \
+        movpx_st(W(X2), Mebp, inf_SCR04(0))                                 \
+        cosps_rp(W(XD), W(X1))                                              \
+        mulps_rr(W(XD), W(X1))                                              \
+        movpx_rr(W(X2), W(X1))                                              \
+        gpcpx_rt(mulps, W(X2), W(X1), Mebp, inf_GPC02)                      \
+        addps_rr(W(XD), W(X2))                                              \
+        gpcpx_rt(addps, W(X2), W(X1), Mebp, inf_GPC01)                      \
+        mthpx_ld(W(X1), Mebp, inf_GPC01)                                    \
+        subps_rr(W(X1), W(X2))                                              \
+        addps_rr(W(XD), W(X1))                                              \
+        addps_rr(W(XD), W(X2))
+
+/* advance quadrant in inf_SCR03 by one (cos(x) = sin(x + pi/2)) */
+
+#define trcps_rx(X1, X2) /* not portable, do not use outside */             \
+        movpx_ld(W(X1), Mebp, inf_SCR03(0))                                 \
+        gpcpx_rt(subpx, W(X1), W(X2), Mebp, inf_GPC07)                      \
+        movpx_st(W(X1), Mebp, inf_SCR03(0))
+
+/* select sin(r) for even and cos(r) for odd quadrants, apply quadrant sign,
+ * D = cos(r) on entry, sin(r) from inf_SCR04, quadrant from inf_SCR03 */
+
+#define trsps_rx(XD, X1, X2) /* not portable, do not use outside */         \
+        movpx_ld(W(X1), Mebp, inf_SCR03(0))                                 \
+        shlpx_ri(W(X1), IB(RT_ELEMENT-1))                                   \
+        shrpn_ri(W(X1), IB(RT_ELEMENT-1))                                   \
+        movpx_ld(W(X2), Mebp, inf_SCR04(0))                                 \
+        xorpx_rr(W(X2), W(XD))                                              \
+        annpx_rr(W(X1), W(X2))                                              \
+        xorpx_rr(W(XD), W(X1))                                              \
+        movpx_ld(W(X1), Mebp, inf_SCR03(0))                                 \
+        shlpx_ri(W(X1), IB(RT_ELEMENT-2))                                   \
+        gpcpx_rt(andpx, W(X1), W(X2), Mebp, inf_GPC06)                      \
+        xorpx_rr(W(XD), W(X1))
+
+/* atan2 (D = atan2(S, T)), returns angle of the point (T, S) in [-pi, pi] */
+
+#define atnps_rr(XD, X1, X2, XS, XT)                                        \
+        stack_st(Redi)                                                      \
+        movxx_ld(Redi,  Mebp, inf_MAT)                                      \
+        movpx_rr(W(X1), W(XS))                                              \
+        gpcpx_rt(andpx, W(X1), W(XD), Mebp, inf_GPC04)                      \
+        movpx_rr(W(X2), W(XT))                                              \
+        gpcpx_rt(andpx, W(X2), W(XD), Mebp, inf_GPC04)                      \
+        movpx_rr(W(XD), W(X1))                                              \
+        cgtps_rr(W(XD), W(X2))                                              \
+        movpx_st(W(XD), Mebp, inf_SCR03(0))                                 \
+        movpx_rr(W(XD), W(X1))                                              \
+        minps_rr(W(XD), W(X2))                                              \
+        maxps_rr(W(X2), W(X1))                                              \
+        divps_rr(W(XD), W(X2))                                              \
+        movpx_rr(W(X1), W(XD))                                              \
+        ceqps_rr(W(X1), W(XD))                                              \
+        andpx_rr(W(XD), W(X1))                                              \
+        movpx_rr(W(X1), W(XD))                                              \
+        gpcpx_rt(addps, W(X1), W(X2), Mebp, inf_GPC01)                      \
+        mthpx_ld(W(X2), Medi, mat_LOG01)                                    \
+        cltps_rr(W(X2), W(X1))                                              \
+        movpx_st(W(X2), Mebp, inf_SCR04(0))                                 \
+        movpx_rr(W(X2), W(XD))                                              \
+        gpcpx_rs(subps, W(X2), W(X1), Mebp, inf_GPC01)                      \
+        divps_rr(W(X2), W(X1))                                              \
+        xorpx_rr(W(X2), W(XD))                                              \
+        andpx_ld(W(X2), Mebp, inf_SCR04(0))                                 \
+        xorpx_rr(W(XD), W(X2))                                              \
+        movpx_rr(W(X1), W(XD))                                              \
+        mulps_rr(W(X1), W(XD))                                              \
+        atnps_rp(W(X2), W(X1))                                              \
+        mulps_rr(W(X2), W(XD))                                              \
+        subps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_TRG03)                                    \
+        andpx_ld(W(X2), Mebp, inf_SCR04(0))                                 \
+        gpcpx_rt(mulps, W(X2), W(X1), Mebp, inf_GPC02)                      \
+        subps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X2), Medi, mat_TRG02)                                    \
+        andpx_ld(W(X2), Mebp, inf_SCR04(0))                                 \
+        gpcpx_rt(mulps, W(X2), W(X1), Mebp, inf_GPC02)                      \
+        subps_rr(W(XD), W(X2))                                              \
+        mthpx_ld(W(X1), Medi, mat_TRG02)                                    \
+        subps_rr(W(X1), W(XD))                                              \
+        mthpx_ld(W(X2), Medi, mat_TRG03)                                    \
+        addps_rr(W(X1), W(X2))                                              \
+        xorpx_rr(W(X1), W(XD))                                              \
+        andpx_ld(W(X1), Mebp, inf_SCR03(0))                                 \
+        xorpx_rr(W(XD), W(X1))                                              \
+        mthpx_ld(W(X1), Medi, mat_TRG02)                                    \
+        addps_rr(W(X1), W(X1))                                              \
+        subps_rr(W(X1), W(XD))                                              \
+        mthpx_ld(W(X2), Medi, mat_TRG03)                                    \
+        addps_rr(W(X1), W(X2))                                              \
+        addps_rr(W(X1), W(X2))                                              \
+        movpx_rr(W(X2), W(XT))                                              \
+        shrpn_ri(W(X2), IB(RT_ELEMENT-1))                                   \
+        xorpx_rr(W(X1), W(XD))                                              \
+        andpx_rr(W(X1), W(X2))                                              \
+        xorpx_rr(W(XD), W(X1))                                              \
+        movpx_rr(W(X1), W(XS))                                              \
+        gpcpx_rt(andpx, W(X1), W(X2), Mebp, inf_GPC06)                      \
+        orrpx_rr(W(XD), W(X1))                                              \
+        stack_ld(Redi)
+
+/* polynomials (G = S * P(S)) in Horner form, shorter for 32-bit elements */
+
+#if   RT_ELEMENT == 32
+
+#define expps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_EXP08)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_EXP07)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_EXP06)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define logps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_LOG05)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG04)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG03)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG02)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define sinps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_TRG08)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG07)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG06)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG05)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define cosps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_TRG14)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG13)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG12)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG11)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define atnps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_ATN08)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN07)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN06)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN05)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN04)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN03)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN02)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN01)                             \
+        plyps_rr(W(XG), W(XS))
+
+#elif RT_ELEMENT == 64
+
+#define expps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_EXP10)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_EXP09)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_EXP08)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_EXP07)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_EXP06)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define logps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_LOG08)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG07)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG06)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG05)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG04)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG03)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_LOG02)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define sinps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_TRG10)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG09)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG08)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG07)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG06)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG05)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define cosps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_TRG16)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG15)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG14)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG13)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG12)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_TRG11)                             \
+        plyps_rr(W(XG), W(XS))
+
+#define atnps_rp(XG, XS) /* not portable, do not use outside */             \
+        plyps_ld(W(XG), W(XS), Medi, mat_ATN11)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN10)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN09)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN08)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN07)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN06)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN05)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN04)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN03)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN02)                             \
+        mlaps_rp(W(XG), W(XS), Medi, mat_ATN01)                             \
+        plyps_rr(W(XG), W(XS))
+
+#endif /* RT_ELEMENT */
+
+/* constant load (D = coefficient) and Horner steps (G = G * S + coefficient),
+ * polynomials start with plyps_ld and end with plyps_rr (G = G * S),
+ * scalar constants keep S in mat_SCR05 and use it as a temporary,
+ * steps are unfused for identical results,
+ * general purpose constants (G = G op inf_GPC**) use load-op forms directly
+ * or broadcast their first element into T in scalar mode, which is then
+ * destroyed (gpcpx_rt) or kept in mat_SCR05 and restored (gpcpx_rs) */
+
+#if RT_MATH_SCALAR == 0
+
+#define mthpx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+        movpx_ld(W(XD), W(MS), W(DS))
+
+#define plyps_ld(XG, XS, MS, DS) /* not portable, do not use outside */     \
+        movpx_ld(W(XG), W(MS), W(DS))
+
+#define mlaps_rp(XG, XS, MT, DT) /* not portable, do not use outside */     \
+        mulps_rr(W(XG), W(XS))                                              \
+        addps_ld(W(XG), W(MT), W(DT))
+
+#define plyps_rr(XG, XS) /* not portable, do not use outside */             \
+        mulps_rr(W(XG), W(XS))
+
+#define gpcpx_rt(op, XG, XT, MS, DS) /* not portable, do not use outside */ \
+        op##_ld(W(XG), W(MS), W(DS))
+
+#define gpcpx_rs(op, XG, XT, MS, DS) /* not portable, do not use outside */ \
+        op##_ld(W(XG), W(MS), W(DS))
+
+#else  /* RT_MATH_SCALAR == 1 */
+
+#define mthpx_ld(XD, MS, DS) /* not portable, do not use outside */         \
+        movpx_bc(W(XD), W(MS), W(DS))
+
+#define plyps_ld(XG, XS, MS, DS) /* not portable, do not use outside */     \
+        movpx_st(W(XS), Medi, mat_SCR05(0))                                 \
+        movpx_bc(W(XG), W(MS), W(DS))
+
+#define mlaps_rp(XG, XS, MT, DT) /* not portable, do not use outside */     \
+        mulps_ld(W(XG), Medi, mat_SCR05(0))                                 \
+        movpx_bc(W(XS), W(MT), W(DT))                                       \
+        addps_rr(W(XG), W(XS))
+
+#define plyps_rr(XG, XS) /* not portable, do not use outside */             \
+        movpx_ld(W(XS), Medi, mat_SCR05(0))                                 \
+        mulps_rr(W(XG), W(XS))
+
+#define gpcpx_rt(op, XG, XT, MS, DS) /* not portable, do not use outside */ \
+        movpx_bc(W(XT), W(MS), W(DS))                                       \
+        op##_rr(W(XG), W(XT))
+
+#define gpcpx_rs(op, XG, XT, MS, DS) /* not portable, do not use outside */ \
+        movpx_st(W(XT), Medi, mat_SCR05(0))                                 \
+        movpx_bc(W(XT), W(MS), W(DS))                                       \
+        op##_rr(W(XG), W(XT))                                               \
+        movpx_ld(W(XT), Medi, mat_SCR05(0))
+
+#endif /* RT_MATH_SCALAR */
+
 #endif /* RT_SIMD_CODE */
 
 /******************************************************************************/
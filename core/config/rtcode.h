@@ -0,0 +1,990 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2026 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTCODE_H
+#define RT_RTCODE_H
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtcode.h: Runtime code generation for ASM sections (enabled by RT_CODE_GEN).
+ *
+ * When RT_CODE_GEN is set to 1 in makefiles, emitters EMITB/EMITW defined
+ * in rtarch.h no longer produce strings for the compiler's inline assembler,
+ * but write instruction bytes/words into a memory buffer at cur++ offset.
+ * ASM_ENTER opens a new buffer, LBL and j***_lb record labels and jumps,
+ * ASM_LEAVE resolves jump distances, copies the code into a separate buffer
+ * with read-write rights, switches them to read-execute, type-casts the buffer
+ * to a function-pointer and calls it with rt_SIMD_INFO as the only argument.
+ *
+ * As the encoding expressions are now evaluated by C/C++ instead of assembler
+ * the true-condition sign M from rtarch.h is set to (-) in dynamic mode.
+ * Numeric labels follow the same rules as local labels in the assembler:
+ * LBL(100500) defines a label, while 100500b and 100500f refer to the nearest
+ * definition backward (b) and forward (f) from the jump, other names are
+ * resolved within the ASM section regardless of the direction.
+ *
+ * Jumps are first emitted in their longest form with zeroed offset fields,
+ * x86 jumps are then shortened to rel8 where the final distance allows it
+ * (label offsets shift accordingly), after which all fields are encoded.
+ * Labels out of range of the instruction's field abort code generation
+ * in the same way as the assembler would fail to build the static code.
+ *
+ * Generated code is kept in a cache shared by all ASM sections of a given
+ * translation unit, so that each section is only generated once and then
+ * called directly on subsequent runs. Cache lookups are keyed on the ASM
+ * section itself, the SIMD target mask from rt_SIMD_INFO->ver (in mask_init
+ * format) and an optional specialization tuple given with ASM_SPEC(...) in
+ * the same scope before ASM_ENTER, which lists runtime values the code was
+ * generated with (for example array length, unroll factor or divisors):
+ *
+ *      ASM_SPEC(size, 4)
+ *      ASM_ENTER(info)
+ *          movxx_ri(Recx, IW(size))
+ *          ...
+ *      ASM_LEAVE(info)
+ *
+ * The cache is bounded by RT_CODE_CACHE_SIZE (bytes of code) and
+ * RT_CODE_CACHE_ITEMS (number of entries), least recently used entries
+ * are evicted first, except for those currently executing in other threads.
+ * Lookups are thread-safe, while code generation itself runs unlocked.
+ *
+ * Current version supports x32/x64, a32/a64, m32/m64 and p32/p64 targets,
+ * legacy x86/arm targets keep using static code generation.
+ */
+
+#if RT_CODE_GEN != 0
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#define RT_CODE_SIZE        0x4000  /* initial size of code staging buffer */
+#define RT_CODE_LBLS        0x40    /* initial size of label/reloc tables */
+#define RT_CODE_SPEC        0x08    /* max size of specialization tuple */
+#define RT_CODE_HASH        0x100   /* number of buckets in the code cache */
+
+/* RT_CODE_CACHE_SIZE limits the total size of cached code in bytes */
+#ifndef RT_CODE_CACHE_SIZE
+#define RT_CODE_CACHE_SIZE  0x1000000
+#endif /* RT_CODE_CACHE_SIZE */
+
+/* RT_CODE_CACHE_ITEMS limits the total number of cached code buffers */
+#ifndef RT_CODE_CACHE_ITEMS
+#define RT_CODE_CACHE_ITEMS 0x1000
+#endif /* RT_CODE_CACHE_ITEMS */
+
+/* emitters aren't inlined, otherwise large ASM sections take too long to build */
+#define RT_CODE_EMIT        __attribute__((noinline))
+
+/*
+ * Relocation types (encoding of label distances into instruction fields).
+ * Relocation is recorded at the offset of the (zeroed) field to be patched,
+ * which is the instruction itself for targets with fixed 32-bit encodings.
+ */
+#define RT_CODE_REL32       0x01    /* x86: lea (rel32, from end of field) */
+#define RT_CODE_IMM26       0x02    /* AArch64: b (imm26, word-scaled) */
+#define RT_CODE_IMM19       0x03    /* AArch64: b.cond (imm19, word-scaled) */
+#define RT_CODE_ADR21       0x04    /* AArch64: adr (immhi:immlo, byte) */
+#define RT_CODE_REL08       0x05    /* x86: jmp/jcc (rel32, rel8 if fits) */
+#define RT_CODE_OFF16       0x06    /* MIPS: b/bcc (16-bit, from delay slot) */
+#define RT_CODE_ADR16       0x07    /* MIPS: addiu (16-bit, from the field) */
+#define RT_CODE_LI24        0x08    /* POWER: b (24-bit LI, word-scaled) */
+#define RT_CODE_BD14        0x09    /* POWER: bc (14-bit BD, word-scaled) */
+#define RT_CODE_LO16        0x0A    /* POWER: addi (16-bit, from bcl + 4) */
+
+/*
+ * Function type for the code generated at runtime.
+ */
+typedef rt_void (*rt_FUNC_CODE)(rt_pntr info);
+
+/******************************************************************************/
+/***************************   CODE BUFFER STRUCTS   **************************/
+/******************************************************************************/
+
+/*
+ * Label definition (LBL), name is kept as stringified in the source.
+ */
+struct rt_CODE_LBL
+{
+    rt_pstr name;           /* label name */
+    rt_si32 offs;           /* byte offset of the label in the buffer */
+};
+
+/*
+ * Label reference (j***_lb, label_ld), resolved in ASM_LEAVE.
+ */
+struct rt_CODE_REL
+{
+    rt_pstr name;           /* label name with optional b/f suffix */
+    rt_si32 offs;           /* byte offset of the field in the buffer */
+    rt_si32 kind;           /* relocation type (RT_CODE_*) */
+    rt_si32 n_lbl;          /* number of labels defined before */
+    rt_si32 drop;           /* bytes dropped when x86 jump is shortened */
+};
+
+/*
+ * Code buffer used by ASM_ENTER/ASM_LEAVE in dynamic mode.
+ */
+struct rt_CODE
+{
+    rt_byte *buf;           /* staging buffer (read-write) */
+    rt_si32 cur;            /* current write offset */
+    rt_si32 max;            /* staging buffer size */
+
+    rt_CODE_LBL *lbl;       /* label definitions */
+    rt_si32 n_lbl;
+    rt_si32 m_lbl;
+
+    rt_CODE_REL *rel;       /* label references */
+    rt_si32 n_rel;
+    rt_si32 m_rel;
+
+    rt_pntr exe;            /* executable buffer (read-execute) */
+    rt_size exe_size;       /* size of executable buffer */
+
+    rt_pntr dsc[3];         /* function descriptor for 64-bit ELFv1 POWER */
+};
+
+/*
+ * Code cache key, specialization values are zeroed past n_spec.
+ */
+struct rt_CODE_KEY
+{
+    rt_pntr site;           /* address unique to the ASM section */
+    rt_ui32 ver;            /* SIMD target mask from rt_SIMD_INFO->ver */
+    rt_si32 n_spec;         /* number of specialization values */
+    rt_si64 spec[RT_CODE_SPEC];
+};
+
+/*
+ * Code cache entry, holds executable buffer for one key.
+ */
+struct rt_CODE_ITEM
+{
+    rt_CODE_KEY key;
+
+    rt_FUNC_CODE func;      /* entry point (or ELFv1 descriptor) */
+    rt_pntr exe;            /* executable buffer (read-execute) */
+    rt_size exe_size;       /* size of executable buffer */
+    rt_pntr dsc[3];         /* function descriptor for 64-bit ELFv1 POWER */
+
+    rt_si32 refs;           /* number of threads executing the code */
+
+    rt_CODE_ITEM *next;     /* next entry in the same hash bucket */
+    rt_CODE_ITEM *prev_lru; /* more recently used entry */
+    rt_CODE_ITEM *next_lru; /* less recently used entry */
+};
+
+/*
+ * Code cache, one per translation unit as the rest of the header.
+ */
+struct rt_CODE_CACHE
+{
+    rt_CODE_ITEM *hash[RT_CODE_HASH];
+
+    rt_CODE_ITEM *head;     /* most recently used entry */
+    rt_CODE_ITEM *tail;     /* least recently used entry */
+
+    rt_size size;           /* total size of cached code */
+    rt_si32 n_item;         /* total number of entries */
+
+    volatile rt_si32 lock;  /* spin-lock guarding the cache */
+};
+
+static rt_CODE_CACHE code_cache;
+
+/*
+ * Default (empty) specialization tuple, ASM_SPEC declares a local one,
+ * which then shadows this definition in ASM_ENTER of the same scope.
+ */
+static const rt_si64 __Spec__[1] = {0};
+
+#define ASM_SPEC(...)                                                       \
+    const rt_si64 __Spec__[] = {__VA_ARGS__};
+
+/*
+ * Open ASM section (ASM_BLOCK_BEG), the code is only generated
+ * if it's not yet found in the cache for the given key.
+ */
+#define CODE_BLOCK_BEG(__Info__)                                            \
+{                                                                           \
+    static rt_byte __Site__;                                                \
+    rt_CODE_KEY __Key__;                                                    \
+    rt_CODE_ITEM *__Item__;                                                 \
+    code_key(&__Key__, &__Site__, ((rt_SIMD_INFO *)(__Info__))->ver,        \
+             __Spec__, (rt_si32)(sizeof(__Spec__) / sizeof(rt_si64)));      \
+    __Item__ = code_load(&__Key__);                                         \
+    if (__Item__ == RT_NULL)                                                \
+    {                                                                       \
+        rt_CODE __Code__;                                                   \
+        code_init(&__Code__);
+
+/*
+ * Close ASM section (ASM_BLOCK_END), newly generated code is put
+ * into the cache, then the code is called with info as the argument.
+ */
+#define CODE_BLOCK_END(__Info__)                                            \
+        __Item__ = code_save(&__Key__, &__Code__);                          \
+    }                                                                       \
+    __Item__->func((rt_pntr)(__Info__));                                    \
+    code_drop(__Item__);                                                    \
+}
+
+/******************************************************************************/
+/**************************   CODE BUFFER FUNCTIONS   *************************/
+/******************************************************************************/
+
+/*
+ * Initialize code buffer, called from ASM_ENTER.
+ */
+static
+rt_void code_init(rt_CODE *code)
+{
+    code->buf = (rt_byte *)malloc(RT_CODE_SIZE);
+    code->cur = 0;
+    code->max = RT_CODE_SIZE;
+
+    code->lbl = (rt_CODE_LBL *)malloc(RT_CODE_LBLS * sizeof(rt_CODE_LBL));
+    code->n_lbl = 0;
+    code->m_lbl = RT_CODE_LBLS;
+
+    code->rel = (rt_CODE_REL *)malloc(RT_CODE_LBLS * sizeof(rt_CODE_REL));
+    code->n_rel = 0;
+    code->m_rel = RT_CODE_LBLS;
+
+    code->exe = RT_NULL;
+    code->exe_size = 0;
+
+    if (code->buf == RT_NULL || code->lbl == RT_NULL || code->rel == RT_NULL)
+    {
+        abort(); /* out of memory at code generation */
+    }
+}
+
+/*
+ * Make room for "size" more bytes in the staging buffer.
+ */
+static
+rt_void code_grow(rt_CODE *code, rt_si32 size)
+{
+    if (code->cur + size <= code->max)
+    {
+        return;
+    }
+
+    code->max *= 2;
+    code->buf = (rt_byte *)realloc(code->buf, code->max);
+
+    if (code->buf == RT_NULL)
+    {
+        abort(); /* out of memory at code generation */
+    }
+}
+
+/*
+ * Emit one byte (EMITB).
+ */
+static RT_CODE_EMIT
+rt_void code_emitb(rt_CODE *code, rt_ui32 b)
+{
+    code_grow(code, 1);
+    code->buf[code->cur++] = (rt_byte)b;
+}
+
+/*
+ * Emit one 32-bit word in native byte order (EMITW).
+ */
+static RT_CODE_EMIT
+rt_void code_emitw(rt_CODE *code, rt_ui32 w)
+{
+    code_grow(code, 4);
+    memcpy(code->buf + code->cur, &w, 4);
+    code->cur += 4;
+}
+
+/*
+ * Define label at current offset (LBL).
+ */
+static
+rt_void code_label(rt_CODE *code, rt_pstr name)
+{
+    if (code->n_lbl == code->m_lbl)
+    {
+        code->m_lbl *= 2;
+        code->lbl = (rt_CODE_LBL *)realloc(code->lbl,
+                                        code->m_lbl * sizeof(rt_CODE_LBL));
+        if (code->lbl == RT_NULL)
+        {
+            abort(); /* out of memory at code generation */
+        }
+    }
+
+    code->lbl[code->n_lbl].name = name;
+    code->lbl[code->n_lbl].offs = code->cur;
+    code->n_lbl++;
+}
+
+/*
+ * Record label reference for the field at current offset (j***_lb).
+ * The instruction itself (with zeroed field) is emitted separately.
+ */
+static
+rt_void code_reloc(rt_CODE *code, rt_pstr name, rt_si32 kind)
+{
+    if (code->n_rel == code->m_rel)
+    {
+        code->m_rel *= 2;
+        code->rel = (rt_CODE_REL *)realloc(code->rel,
+                                        code->m_rel * sizeof(rt_CODE_REL));
+        if (code->rel == RT_NULL)
+        {
+            abort(); /* out of memory at code generation */
+        }
+    }
+
+    code->rel[code->n_rel].name = name;
+    code->rel[code->n_rel].offs = code->cur;
+    code->rel[code->n_rel].kind = kind;
+    code->rel[code->n_rel].n_lbl = code->n_lbl;
+    code->rel[code->n_rel].drop = 0;
+    code->n_rel++;
+}
+
+/*
+ * Find label offset for a given reference, abort if not found
+ * (static code generation would have failed at compile time).
+ */
+static
+rt_si32 code_find(rt_CODE *code, rt_CODE_REL *rel)
+{
+    rt_si32 i, k = 0, n = (rt_si32)strlen(rel->name);
+    rt_char d = n > 1 ? rel->name[n-1] : 0;
+
+    /* check for numeric local label with b/f suffix */
+    if (d == 'b' || d == 'f')
+    {
+        for (k = 1; k < n - 1; k++)
+        {
+            if (rel->name[k] < '0' || rel->name[k] > '9')
+            {
+                break;
+            }
+        }
+        k = (k == n - 1 && rel->name[0] >= '0' && rel->name[0] <= '9');
+    }
+
+    if (k != 0 && d == 'b')
+    {
+        for (i = rel->n_lbl - 1; i >= 0; i--)
+        {
+            if (strncmp(code->lbl[i].name, rel->name, n - 1) == 0
+            &&  code->lbl[i].name[n - 1] == 0)
+            {
+                return code->lbl[i].offs;
+            }
+        }
+    }
+    else
+    if (k != 0 && d == 'f')
+    {
+        for (i = rel->n_lbl; i < code->n_lbl; i++)
+        {
+            if (strncmp(code->lbl[i].name, rel->name, n - 1) == 0
+            &&  code->lbl[i].name[n - 1] == 0)
+            {
+                return code->lbl[i].offs;
+            }
+        }
+    }
+    else
+    {
+        for (i = 0; i < code->n_lbl; i++)
+        {
+            if (strcmp(code->lbl[i].name, rel->name) == 0)
+            {
+                return code->lbl[i].offs;
+            }
+        }
+    }
+
+    abort(); /* undefined label */
+    return 0;
+}
+
+/*
+ * Offset in the buffer after x86 jumps marked (drop) have been shortened.
+ */
+static
+rt_si32 code_move(rt_CODE *code, rt_si32 offs)
+{
+    rt_si32 i, k = offs;
+
+    for (i = 0; i < code->n_rel && code->rel[i].offs < offs; i++)
+    {
+        k -= code->rel[i].drop;
+    }
+
+    return k;
+}
+
+/*
+ * Shorten x86 jumps to rel8 where the final distance allows it.
+ * All jumps start short, those which don't fit are then extended back
+ * until no more changes occur, as extending a jump never shortens others.
+ * The buffer is compacted in-place, labels and fields are moved accordingly.
+ */
+static
+rt_void code_relax(rt_CODE *code)
+{
+    rt_si32 i, j, k, d, n = 0;
+
+    for (i = 0; i < code->n_rel; i++)
+    {
+        rt_CODE_REL *rel = &code->rel[i];
+
+        if (rel->kind == RT_CODE_REL08)
+        {
+            /* E9 rel32 -> EB rel8, 0F 8x rel32 -> 7x rel8 */
+            rel->drop = code->buf[rel->offs - 1] == 0xE9 ? 3 : 4;
+            n++;
+        }
+    }
+
+    for (k = n; k != 0; )
+    {
+        for (i = 0, k = 0; i < code->n_rel; i++)
+        {
+            rt_CODE_REL *rel = &code->rel[i];
+
+            if (rel->kind != RT_CODE_REL08 || rel->drop == 0)
+            {
+                continue;
+            }
+
+            /* distance from the end of the short jump: EB rel8 / 7x rel8 */
+            d = code_move(code, code_find(code, rel))
+              - code_move(code, rel->offs) - (rel->drop == 3 ? 1 : 0);
+
+            if (d < -128 || d > 127)
+            {
+                rel->drop = 0;
+                k++;
+            }
+        }
+    }
+
+    if (n == 0)
+    {
+        return;
+    }
+
+    for (i = 0; i < code->n_lbl; i++)
+    {
+        code->lbl[i].offs = code_move(code, code->lbl[i].offs);
+    }
+
+    for (i = 0, j = 0, k = 0; i < code->n_rel; i++)
+    {
+        rt_CODE_REL *rel = &code->rel[i];
+
+        if (rel->drop == 0)
+        {
+            rel->kind = rel->kind == RT_CODE_REL08 ? RT_CODE_REL32 : rel->kind;
+            continue;
+        }
+
+        /* move the code before the jump's opcode */
+        n = rel->offs - (rel->drop == 3 ? 1 : 2);
+        memmove(code->buf + j, code->buf + k, n - k);
+        j += n - k;
+
+        code->buf[j] = rel->drop == 3 ? 0xEB : 0x70 | (code->buf[n+1] & 0xF);
+        code->buf[j+1] = 0x00;
+        j += 2;
+        k = rel->offs + 4;
+    }
+
+    memmove(code->buf + j, code->buf + k, code->cur - k);
+    code->cur = j + code->cur - k;
+
+    /* relocation offsets are moved last, as code_move relies on them */
+    for (i = code->n_rel - 1; i >= 0; i--)
+    {
+        rt_CODE_REL *rel = &code->rel[i];
+        rel->offs = code_move(code, rel->offs) - (rel->drop == 4 ? 1 : 0);
+    }
+}
+
+/*
+ * Encode label distances into instruction fields.
+ */
+static
+rt_void code_link(rt_CODE *code)
+{
+    rt_si32 i, d;
+    rt_ui32 w;
+
+    code_relax(code);
+
+    for (i = 0; i < code->n_rel; i++)
+    {
+        rt_CODE_REL *rel = &code->rel[i];
+        rt_byte *p = code->buf + rel->offs;
+
+        d = code_find(code, rel) - rel->offs;
+
+        if (rel->kind == RT_CODE_REL08)
+        {
+            p[0] = (rt_byte)(d - 1);
+            continue;
+        }
+
+        memcpy(&w, p, 4);
+
+        switch (rel->kind)
+        {
+            case RT_CODE_REL32:
+            w = (rt_ui32)(d - 4);
+            d = 0;
+            break;
+
+            case RT_CODE_IMM26:
+            w |= ((rt_ui32)d >> 2) & 0x03FFFFFF;
+            d >>= 27;
+            break;
+
+            case RT_CODE_IMM19:
+            w |= (((rt_ui32)d >> 2) & 0x0007FFFF) << 5;
+            d >>= 20;
+            break;
+
+            case RT_CODE_ADR21:
+            w |= ((rt_ui32)d & 0x3) << 29 | (((rt_ui32)d >> 2) & 0x7FFFF) << 5;
+            d >>= 20;
+            break;
+
+            case RT_CODE_OFF16:
+            d -= 4;
+            w |= ((rt_ui32)d >> 2) & 0x0000FFFF;
+            d >>= 17;
+            break;
+
+            case RT_CODE_ADR16:
+            w |= (rt_ui32)d & 0x0000FFFF;
+            d >>= 15;
+            break;
+
+            case RT_CODE_LI24:
+            w |= (rt_ui32)d & 0x03FFFFFC;
+            d >>= 25;
+            break;
+
+            case RT_CODE_BD14:
+            w |= (rt_ui32)d & 0x0000FFFC;
+            d >>= 15;
+            break;
+
+            case RT_CODE_LO16:
+            d += 8;
+            w |= (rt_ui32)d & 0x0000FFFF;
+            d >>= 15;
+            break;
+
+            default:
+            abort(); /* unknown relocation type */
+        }
+
+        if (d != 0 && d != -1)
+        {
+            abort(); /* label out of range */
+        }
+
+        memcpy(p, &w, 4);
+    }
+}
+
+/*
+ * Return function pointer for the code in executable buffer,
+ * descriptor's storage is only used on 64-bit ELFv1 POWER.
+ */
+static
+rt_FUNC_CODE code_func(rt_pntr exe, rt_pntr *dsc)
+{
+#if (defined RT_P64) && (!defined _CALL_ELF || _CALL_ELF == 1)
+    /* function pointers refer to descriptors: entry, TOC, environment */
+    dsc[0] = exe;
+    dsc[1] = RT_NULL;
+    dsc[2] = RT_NULL;
+
+    return (rt_FUNC_CODE)(rt_pntr)dsc;
+#else /* direct function pointers */
+    (void)dsc;
+    return (rt_FUNC_CODE)exe;
+#endif /* RT_P64 ELFv1 */
+}
+
+/*
+ * Release executable buffer.
+ */
+static
+rt_void code_unmap(rt_pntr exe, rt_size exe_size)
+{
+    if (exe == RT_NULL)
+    {
+        return; /* empty code was never mapped */
+    }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+    VirtualFree(exe, 0, MEM_RELEASE);
+#else /* --- Linux, GCC ----------------------------------------------------- */
+    munmap(exe, exe_size);
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Resolve labels and copy the code into executable buffer (ASM_LEAVE).
+ * Buffer is filled with read-write rights, which are then changed
+ * to read-execute, so that writable memory is never executable.
+ * Empty code (nothing emitted) is never mapped, null function is returned.
+ */
+static
+rt_FUNC_CODE code_done(rt_CODE *code)
+{
+    code_link(code);
+
+    code->exe_size = code->cur;
+
+    if (code->cur == 0)
+    {
+        code->exe = RT_NULL; /* nothing emitted, skip executable mapping */
+        return code_func(code->exe, code->dsc);
+    }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    DWORD prot;
+    code->exe = VirtualAlloc(RT_NULL, code->exe_size,
+                             MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+    if (code->exe == RT_NULL)
+    {
+        abort(); /* failed to allocate executable buffer */
+    }
+    memcpy(code->exe, code->buf, code->cur);
+    VirtualProtect(code->exe, code->exe_size, PAGE_EXECUTE_READ, &prot);
+    FlushInstructionCache(GetCurrentProcess(), code->exe, code->exe_size);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    code->exe = mmap(RT_NULL, code->exe_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code->exe == MAP_FAILED)
+    {
+        abort(); /* failed to allocate executable buffer */
+    }
+    memcpy(code->exe, code->buf, code->cur);
+    mprotect(code->exe, code->exe_size, PROT_READ | PROT_EXEC);
+    __builtin___clear_cache((char *)code->exe,
+                            (char *)code->exe + code->exe_size);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    return code_func(code->exe, code->dsc);
+}
+
+/*
+ * Release all buffers, executable one is only released if not yet cached.
+ */
+static
+rt_void code_free(rt_CODE *code)
+{
+    if (code->exe != RT_NULL)
+    {
+        code_unmap(code->exe, code->exe_size);
+    }
+
+    free(code->rel);
+    free(code->lbl);
+    free(code->buf);
+}
+
+/******************************************************************************/
+/**************************   CODE CACHE FUNCTIONS   **************************/
+/******************************************************************************/
+
+/*
+ * Acquire cache spin-lock, only held for table updates (never for codegen).
+ */
+static
+rt_void code_lock(rt_CODE_CACHE *cache)
+{
+    while (__sync_lock_test_and_set(&cache->lock, 1) != 0)
+    {
+        while (cache->lock != 0);
+    }
+}
+
+/*
+ * Release cache spin-lock.
+ */
+static
+rt_void code_unlock(rt_CODE_CACHE *cache)
+{
+    __sync_lock_release(&cache->lock);
+}
+
+/*
+ * Fill code cache key, abort if specialization tuple is too long.
+ */
+static
+rt_void code_key(rt_CODE_KEY *key, rt_pntr site, rt_ui32 ver,
+                 const rt_si64 *spec, rt_si32 n_spec)
+{
+    if (n_spec > RT_CODE_SPEC)
+    {
+        abort(); /* specialization tuple is too long */
+    }
+
+    memset(key, 0, sizeof(rt_CODE_KEY));
+    key->site = site;
+    key->ver = ver;
+    key->n_spec = n_spec;
+    memcpy(key->spec, spec, n_spec * sizeof(rt_si64));
+}
+
+/*
+ * Return hash bucket index for a given key (FNV-1a over key's bytes).
+ */
+static
+rt_si32 code_hash(rt_CODE_KEY *key)
+{
+    rt_byte *p = (rt_byte *)key;
+    rt_ui32 i, h = 0x811C9DC5;
+
+    for (i = 0; i < sizeof(rt_CODE_KEY); i++)
+    {
+        h = (h ^ p[i]) * 0x01000193;
+    }
+
+    return (rt_si32)(h % RT_CODE_HASH);
+}
+
+/*
+ * Find entry for a given key in its hash bucket, cache must be locked.
+ */
+static
+rt_CODE_ITEM *code_seek(rt_CODE_CACHE *cache, rt_CODE_KEY *key)
+{
+    rt_CODE_ITEM *item = cache->hash[code_hash(key)];
+
+    while (item != RT_NULL && memcmp(&item->key, key, sizeof(rt_CODE_KEY)))
+    {
+        item = item->next;
+    }
+
+    return item;
+}
+
+/*
+ * Remove entry from LRU list, cache must be locked.
+ */
+static
+rt_void code_unlink(rt_CODE_CACHE *cache, rt_CODE_ITEM *item)
+{
+    if (item->prev_lru != RT_NULL)
+    {
+        item->prev_lru->next_lru = item->next_lru;
+    }
+    else
+    {
+        cache->head = item->next_lru;
+    }
+
+    if (item->next_lru != RT_NULL)
+    {
+        item->next_lru->prev_lru = item->prev_lru;
+    }
+    else
+    {
+        cache->tail = item->prev_lru;
+    }
+}
+
+/*
+ * Insert entry at the head of LRU list, cache must be locked.
+ */
+static
+rt_void code_front(rt_CODE_CACHE *cache, rt_CODE_ITEM *item)
+{
+    item->prev_lru = RT_NULL;
+    item->next_lru = cache->head;
+
+    if (cache->head != RT_NULL)
+    {
+        cache->head->prev_lru = item;
+    }
+    else
+    {
+        cache->tail = item;
+    }
+
+    cache->head = item;
+}
+
+/*
+ * Evict least recently used entries not executing in other threads
+ * until "size" more bytes and one more entry fit, cache must be locked.
+ */
+static
+rt_void code_evict(rt_CODE_CACHE *cache, rt_size size)
+{
+    rt_CODE_ITEM *item = cache->tail, *prev, **link;
+
+    while (item != RT_NULL && (cache->n_item >= RT_CODE_CACHE_ITEMS
+                           ||  cache->size + size > RT_CODE_CACHE_SIZE))
+    {
+        prev = item->prev_lru;
+
+        if (item->refs == 0)
+        {
+            link = &cache->hash[code_hash(&item->key)];
+
+            while (*link != item)
+            {
+                link = &(*link)->next;
+            }
+
+            *link = item->next;
+            code_unlink(cache, item);
+
+            cache->size -= item->exe_size;
+            cache->n_item--;
+
+            code_unmap(item->exe, item->exe_size);
+            free(item);
+        }
+
+        item = prev;
+    }
+}
+
+/*
+ * Look up the code for a given key (ASM_ENTER), return RT_NULL if not found.
+ * Found entry is marked as executing until released with code_drop.
+ */
+static
+rt_CODE_ITEM *code_load(rt_CODE_KEY *key)
+{
+    rt_CODE_CACHE *cache = &code_cache;
+    rt_CODE_ITEM *item;
+
+    code_lock(cache);
+
+    item = code_seek(cache, key);
+
+    if (item != RT_NULL)
+    {
+        item->refs++;
+        code_unlink(cache, item);
+        code_front(cache, item);
+    }
+
+    code_unlock(cache);
+
+    return item;
+}
+
+/*
+ * Finish code generation and put the code into the cache (ASM_LEAVE).
+ * If another thread has cached the same key meanwhile, its entry is used.
+ * Returned entry is marked as executing until released with code_drop.
+ */
+static
+rt_CODE_ITEM *code_save(rt_CODE_KEY *key, rt_CODE *code)
+{
+    rt_CODE_CACHE *cache = &code_cache;
+    rt_CODE_ITEM *item, *prev;
+    rt_si32 h = code_hash(key);
+
+    item = (rt_CODE_ITEM *)malloc(sizeof(rt_CODE_ITEM));
+
+    if (item == RT_NULL)
+    {
+        abort(); /* out of memory at code generation */
+    }
+
+    code_done(code);
+
+    item->key = *key;
+    item->exe = code->exe;
+    item->exe_size = code->exe_size;
+    item->func = code_func(item->exe, item->dsc);
+    item->refs = 1;
+
+    code->exe = RT_NULL;
+    code_free(code);
+
+    code_lock(cache);
+
+    prev = code_seek(cache, key);
+
+    if (prev != RT_NULL)
+    {
+        prev->refs++;
+        code_unlink(cache, prev);
+        code_front(cache, prev);
+
+        code_unlock(cache);
+
+        code_unmap(item->exe, item->exe_size);
+        free(item);
+
+        return prev;
+    }
+
+    code_evict(cache, item->exe_size);
+
+    item->next = cache->hash[h];
+    cache->hash[h] = item;
+    code_front(cache, item);
+
+    cache->size += item->exe_size;
+    cache->n_item++;
+
+    code_unlock(cache);
+
+    return item;
+}
+
+/*
+ * Release the entry after the code has returned (ASM_LEAVE).
+ */
+static
+rt_void code_drop(rt_CODE_ITEM *item)
+{
+    rt_CODE_CACHE *cache = &code_cache;
+
+    code_lock(cache);
+
+    item->refs--;
+
+    code_unlock(cache);
+}
+
+#else /* RT_CODE_GEN */
+
+/* specialization only affects code generated at runtime */
+#define ASM_SPEC(...)
+
+#endif /* RT_CODE_GEN */
+
+#endif /* RT_RTCODE_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
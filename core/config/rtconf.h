@@ -3711,6 +3711,24 @@
 #define movox_st(XS, MD, DD)                                                \
         movcx_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), non-temporal store, see rtbase.h */
+
+#define movox_nt(XS, MD, DD)                                                \
+        movcx_nt(W(XS), W(MD), W(DD))
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#define movox_bc(XD, MS, DS)                                                \
+        movcx_bc(W(XD), W(MS), W(DS))
+
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#define muvox_ld(XD, MS, DS)                                                \
+        muvcx_ld(W(XD), W(MS), W(DS))
+
+#define muvox_st(XS, MD, DD)                                                \
+        muvcx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -3723,6 +3741,37 @@
 #define mmvox_st(XS, MG, DG)                                                \
         mmvcx_st(W(XS), W(MG), W(DG))
 
+/* cmp ([D] = active elements of S packed), compress-store under a mask
+ * exp (G = active elements unpacked from [S]), expand-load under a mask
+ * use Xmm0 implicitly as a mask register, see rtbase.h */
+
+#define cmpox_st(XS, MD, DD)                                                \
+        cmpcx_st(W(XS), W(MD), W(DD))
+
+#define expox_ld(XG, MS, DS)                                                \
+        expcx_ld(W(XG), W(MS), W(DS))
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#define shfox_ri(XD, XS, IT)                                                \
+        shfcx_ri(W(XD), W(XS), W(IT))
+
+#define zipox_rr(XG, XS)                                                    \
+        zipcx_rr(W(XG), W(XS))
+
+#define uzpox_rr(XG, XS)                                                    \
+        uzpcx_rr(W(XG), W(XS))
+
+#define bcxox_ri(XD, XS, IT)                                                \
+        bcxcx_ri(W(XD), W(XS), W(IT))
+
+#define rotox_ri(XD, XS, IT)                                                \
+        rotcx_ri(W(XD), W(XS), W(IT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -4133,6 +4182,11 @@
 #define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjcx_rx(W(XS), mask, lb)
 
+/* mkc (D = number of active elements in mask S), see rtbase.h */
+
+#define mkcox_rx(XS, RD)        /* destroys Reax */                         \
+        mkccx_rx(W(XS), W(RD))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -4272,6 +4326,31 @@
 #define cvtox_ld(XD, MS, DS)                                                \
         cvtcx_ld(W(XD), W(MS), W(DS))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S), see rtbase.h
+ * memory side holds fp16 elements at half the SIMD width */
+
+#define cvhos_ld(XD, MS, DS)                                                \
+        cvhcs_ld(W(XD), W(MS), W(DS))
+
+#define cvhos_st(XS, MD, DD)                                                \
+        cvhcs_st(W(XS), W(MD), W(DD))
+
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * see rtbase.h, fp64 elements take twice the space of fp32 elements */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        cvlds_rr(W(XD), W(XS))
+
+#define cvuqs_rr(XD, XS)                                                    \
+        cvuds_rr(W(XD), W(XS))
+
+#define cvlos_rr(XD, XS)                                                    \
+        cvlcs_rr(W(XD), W(XS))
+
+#define cvuos_rr(XG, XS)                                                    \
+        cvucs_rr(W(XG), W(XS))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -4471,6 +4550,20 @@
 #define remon3ld(XD, XS, MT, DT)                                            \
         remcn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* div (G = G / IS), rem (G = G % IS) by immediate, see rtbase.h */
+
+#define divox_ri(XG, IS)                                                    \
+        divcx_ri(W(XG), W(IS))
+
+#define divon_ri(XG, IS)                                                    \
+        divcn_ri(W(XG), W(IS))
+
+#define remox_ri(XG, IS)                                                    \
+        remcx_ri(W(XG), W(IS))
+
+#define remon_ri(XG, IS)                                                    \
+        remcn_ri(W(XG), W(IS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -4784,6 +4877,24 @@
 #define movox_st(XS, MD, DD)                                                \
         movix_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), non-temporal store, see rtbase.h */
+
+#define movox_nt(XS, MD, DD)                                                \
+        movix_nt(W(XS), W(MD), W(DD))
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#define movox_bc(XD, MS, DS)                                                \
+        movix_bc(W(XD), W(MS), W(DS))
+
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#define muvox_ld(XD, MS, DS)                                                \
+        muvix_ld(W(XD), W(MS), W(DS))
+
+#define muvox_st(XS, MD, DD)                                                \
+        muvix_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -4796,6 +4907,37 @@
 #define mmvox_st(XS, MG, DG)                                                \
         mmvix_st(W(XS), W(MG), W(DG))
 
+/* cmp ([D] = active elements of S packed), compress-store under a mask
+ * exp (G = active elements unpacked from [S]), expand-load under a mask
+ * use Xmm0 implicitly as a mask register, see rtbase.h */
+
+#define cmpox_st(XS, MD, DD)                                                \
+        cmpix_st(W(XS), W(MD), W(DD))
+
+#define expox_ld(XG, MS, DS)                                                \
+        expix_ld(W(XG), W(MS), W(DS))
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#define shfox_ri(XD, XS, IT)                                                \
+        shfix_ri(W(XD), W(XS), W(IT))
+
+#define zipox_rr(XG, XS)                                                    \
+        zipix_rr(W(XG), W(XS))
+
+#define uzpox_rr(XG, XS)                                                    \
+        uzpix_rr(W(XG), W(XS))
+
+#define bcxox_ri(XD, XS, IT)                                                \
+        bcxix_ri(W(XD), W(XS), W(IT))
+
+#define rotox_ri(XD, XS, IT)                                                \
+        rotix_ri(W(XD), W(XS), W(IT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andox_rr(XG, XS)                                                    \
@@ -5206,6 +5348,11 @@
 #define mkjox_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjix_rx(W(XS), mask, lb)
 
+/* mkc (D = number of active elements in mask S), see rtbase.h */
+
+#define mkcox_rx(XS, RD)        /* destroys Reax */                         \
+        mkcix_rx(W(XS), W(RD))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -5345,6 +5492,31 @@
 #define cvtox_ld(XD, MS, DS)                                                \
         cvtix_ld(W(XD), W(MS), W(DS))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S), see rtbase.h
+ * memory side holds fp16 elements at half the SIMD width */
+
+#define cvhos_ld(XD, MS, DS)                                                \
+        cvhis_ld(W(XD), W(MS), W(DS))
+
+#define cvhos_st(XS, MD, DD)                                                \
+        cvhis_st(W(XS), W(MD), W(DD))
+
+/* cvl (D = fp32-to-fp64 lower half of S), (D = fp64-to-fp32 S in lower half)
+ * cvu (D = fp32-to-fp64 upper half of S), (G = fp64-to-fp32 S in upper half)
+ * see rtbase.h, fp64 elements take twice the space of fp32 elements */
+
+#define cvlqs_rr(XD, XS)                                                    \
+        cvljs_rr(W(XD), W(XS))
+
+#define cvuqs_rr(XD, XS)                                                    \
+        cvujs_rr(W(XD), W(XS))
+
+#define cvlos_rr(XD, XS)                                                    \
+        cvlis_rr(W(XD), W(XS))
+
+#define cvuos_rr(XG, XS)                                                    \
+        cvuis_rr(W(XG), W(XS))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -5544,6 +5716,20 @@
 #define remon3ld(XD, XS, MT, DT)                                            \
         remin3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* div (G = G / IS), rem (G = G % IS) by immediate, see rtbase.h */
+
+#define divox_ri(XG, IS)                                                    \
+        divix_ri(W(XG), W(IS))
+
+#define divon_ri(XG, IS)                                                    \
+        divin_ri(W(XG), W(IS))
+
+#define remox_ri(XG, IS)                                                    \
+        remix_ri(W(XG), W(IS))
+
+#define remon_ri(XG, IS)                                                    \
+        remin_ri(W(XG), W(IS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -5859,6 +6045,24 @@
 #define movqx_st(XS, MD, DD)                                                \
         movdx_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), non-temporal store, see rtbase.h */
+
+#define movqx_nt(XS, MD, DD)                                                \
+        movdx_nt(W(XS), W(MD), W(DD))
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#define movqx_bc(XD, MS, DS)                                                \
+        movdx_bc(W(XD), W(MS), W(DS))
+
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#define muvqx_ld(XD, MS, DS)                                                \
+        muvdx_ld(W(XD), W(MS), W(DS))
+
+#define muvqx_st(XS, MD, DD)                                                \
+        muvdx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -5871,6 +6075,37 @@
 #define mmvqx_st(XS, MG, DG)                                                \
         mmvdx_st(W(XS), W(MG), W(DG))
 
+/* cmp ([D] = active elements of S packed), compress-store under a mask
+ * exp (G = active elements unpacked from [S]), expand-load under a mask
+ * use Xmm0 implicitly as a mask register, see rtbase.h */
+
+#define cmpqx_st(XS, MD, DD)                                                \
+        cmpdx_st(W(XS), W(MD), W(DD))
+
+#define expqx_ld(XG, MS, DS)                                                \
+        expdx_ld(W(XG), W(MS), W(DS))
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#define shfqx_ri(XD, XS, IT)                                                \
+        shfdx_ri(W(XD), W(XS), W(IT))
+
+#define zipqx_rr(XG, XS)                                                    \
+        zipdx_rr(W(XG), W(XS))
+
+#define uzpqx_rr(XG, XS)                                                    \
+        uzpdx_rr(W(XG), W(XS))
+
+#define bcxqx_ri(XD, XS, IT)                                                \
+        bcxdx_ri(W(XD), W(XS), W(IT))
+
+#define rotqx_ri(XD, XS, IT)                                                \
+        rotdx_ri(W(XD), W(XS), W(IT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -6281,6 +6516,11 @@
 #define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjdx_rx(W(XS), mask, lb)
 
+/* mkc (D = number of active elements in mask S), see rtbase.h */
+
+#define mkcqx_rx(XS, RD)        /* destroys Reax */                         \
+        mkcdx_rx(W(XS), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -6619,6 +6859,20 @@
 #define remqn3ld(XD, XS, MT, DT)                                            \
         remdn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* div (G = G / IS), rem (G = G % IS) by immediate, see rtbase.h */
+
+#define divqx_ri(XG, IS)                                                    \
+        divdx_ri(W(XG), W(IS))
+
+#define divqn_ri(XG, IS)                                                    \
+        divdn_ri(W(XG), W(IS))
+
+#define remqx_ri(XG, IS)                                                    \
+        remdx_ri(W(XG), W(IS))
+
+#define remqn_ri(XG, IS)                                                    \
+        remdn_ri(W(XG), W(IS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -6932,6 +7186,24 @@
 #define movqx_st(XS, MD, DD)                                                \
         movjx_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), non-temporal store, see rtbase.h */
+
+#define movqx_nt(XS, MD, DD)                                                \
+        movjx_nt(W(XS), W(MD), W(DD))
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#define movqx_bc(XD, MS, DS)                                                \
+        movjx_bc(W(XD), W(MS), W(DS))
+
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#define muvqx_ld(XD, MS, DS)                                                \
+        muvjx_ld(W(XD), W(MS), W(DS))
+
+#define muvqx_st(XS, MD, DD)                                                \
+        muvjx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -6944,6 +7216,37 @@
 #define mmvqx_st(XS, MG, DG)                                                \
         mmvjx_st(W(XS), W(MG), W(DG))
 
+/* cmp ([D] = active elements of S packed), compress-store under a mask
+ * exp (G = active elements unpacked from [S]), expand-load under a mask
+ * use Xmm0 implicitly as a mask register, see rtbase.h */
+
+#define cmpqx_st(XS, MD, DD)                                                \
+        cmpjx_st(W(XS), W(MD), W(DD))
+
+#define expqx_ld(XG, MS, DS)                                                \
+        expjx_ld(W(XG), W(MS), W(DS))
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#define shfqx_ri(XD, XS, IT)                                                \
+        shfjx_ri(W(XD), W(XS), W(IT))
+
+#define zipqx_rr(XG, XS)                                                    \
+        zipjx_rr(W(XG), W(XS))
+
+#define uzpqx_rr(XG, XS)                                                    \
+        uzpjx_rr(W(XG), W(XS))
+
+#define bcxqx_ri(XD, XS, IT)                                                \
+        bcxjx_ri(W(XD), W(XS), W(IT))
+
+#define rotqx_ri(XD, XS, IT)                                                \
+        rotjx_ri(W(XD), W(XS), W(IT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andqx_rr(XG, XS)                                                    \
@@ -7354,6 +7657,11 @@
 #define mkjqx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjjx_rx(W(XS), mask, lb)
 
+/* mkc (D = number of active elements in mask S), see rtbase.h */
+
+#define mkcqx_rx(XS, RD)        /* destroys Reax */                         \
+        mkcjx_rx(W(XS), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -7692,6 +8000,20 @@
 #define remqn3ld(XD, XS, MT, DT)                                            \
         remjn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* div (G = G / IS), rem (G = G % IS) by immediate, see rtbase.h */
+
+#define divqx_ri(XG, IS)                                                    \
+        divjx_ri(W(XG), W(IS))
+
+#define divqn_ri(XG, IS)                                                    \
+        divjn_ri(W(XG), W(IS))
+
+#define remqx_ri(XG, IS)                                                    \
+        remjx_ri(W(XG), W(IS))
+
+#define remqn_ri(XG, IS)                                                    \
+        remjn_ri(W(XG), W(IS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -8071,6 +8393,46 @@
 #define divps4ld(XD, PS, XS, MT, DT)                                        \
         divos4ld(W(XD), W(PS), W(XS), W(MT), W(DT))
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minpsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        minosMrr(W(XG), W(PS), W(XS))
+
+#define minpsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        minosMld(W(XG), W(PS), W(MS), W(DS))
+
+#define minpsPrr(XG, PS, XS)                                                \
+        minosPrr(W(XG), W(PS), W(XS))
+
+#define minpsPld(XG, PS, MS, DS)                                            \
+        minosPld(W(XG), W(PS), W(MS), W(DS))
+
+#define minps4rr(XD, PS, XS, XT)                                            \
+        minos4rr(W(XD), W(PS), W(XS), W(XT))
+
+#define minps4ld(XD, PS, XS, MT, DT)                                        \
+        minos4ld(W(XD), W(PS), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxpsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        maxosMrr(W(XG), W(PS), W(XS))
+
+#define maxpsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        maxosMld(W(XG), W(PS), W(MS), W(DS))
+
+#define maxpsPrr(XG, PS, XS)                                                \
+        maxosPrr(W(XG), W(PS), W(XS))
+
+#define maxpsPld(XG, PS, MS, DS)                                            \
+        maxosPld(W(XG), W(PS), W(MS), W(DS))
+
+#define maxps4rr(XD, PS, XS, XT)                                            \
+        maxos4rr(W(XD), W(PS), W(XS), W(XT))
+
+#define maxps4ld(XD, PS, XS, MT, DT)                                        \
+        maxos4ld(W(XD), W(PS), W(XS), W(MT), W(DT))
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqpsPrr(PD, XS, XT)                                                \
@@ -8158,16 +8520,21 @@
 /* mxx (D = mask-from-predicate S), (D = predicate-from-mask S) */
 
 #define mmxpx_rr(XD, PS)                                                    \
-        mmxox_rx(W(XD), W(PS))
+        mmxox_rr(W(XD), W(PS))
 
 #define mxmpx_rr(PD, XS)                                                    \
-        mxmox_rx(W(PD), W(XS))
+        mxmox_rr(W(PD), W(XS))
 
 /* mxj (jump to lb) if (S satisfies mask condition) */
 
 #define mxjpx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mxjox_rx(W(PS), mask, lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlpx_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        whlox_rr(W(PD), W(RS))
+
 /* mov (D = S), predicated */
 
 #define mxvpx_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -8418,6 +8785,24 @@
 #define movpx_st(XS, MD, DD)                                                \
         movox_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), non-temporal store, see rtbase.h */
+
+#define movpx_nt(XS, MD, DD)                                                \
+        movox_nt(W(XS), W(MD), W(DD))
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#define movpx_bc(XD, MS, DS)                                                \
+        movox_bc(W(XD), W(MS), W(DS))
+
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#define muvpx_ld(XD, MS, DS)                                                \
+        muvox_ld(W(XD), W(MS), W(DS))
+
+#define muvpx_st(XS, MD, DD)                                                \
+        muvox_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -8430,6 +8815,46 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvox_st(W(XS), W(MG), W(DG))
 
+/* cmp ([D] = active elements of S packed), compress-store under a mask
+ * exp (G = active elements unpacked from [S]), expand-load under a mask
+ * use Xmm0 implicitly as a mask register, see rtbase.h */
+
+#define cmppx_st(XS, MD, DD)                                                \
+        cmpox_st(W(XS), W(MD), W(DD))
+
+#define exppx_ld(XG, MS, DS)                                                \
+        expox_ld(W(XG), W(MS), W(DS))
+
+/* gat (D = [S + T*elem-size]), sca ([D + T*elem-size] = S), see rtbase.h
+ * MS/MD take plain M*** addressing modes, T holds element-size indices */
+
+#define gatpx_ld(XD, MS, XT) /* indexed load, gather requires #D != #T */   \
+        gatox_ld(W(XD), W(MS), W(XT))
+
+#define scapx_st(XS, MD, XT) /* indexed store, last element wins */         \
+        scaox_st(W(XS), W(MD), W(XT))
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#define shfpx_ri(XD, XS, IT)                                                \
+        shfox_ri(W(XD), W(XS), W(IT))
+
+#define zippx_rr(XG, XS)                                                    \
+        zipox_rr(W(XG), W(XS))
+
+#define uzppx_rr(XG, XS)                                                    \
+        uzpox_rr(W(XG), W(XS))
+
+#define bcxpx_ri(XD, XS, IT)                                                \
+        bcxox_ri(W(XD), W(XS), W(IT))
+
+#define rotpx_ri(XD, XS, IT)                                                \
+        rotox_ri(W(XD), W(XS), W(IT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -8840,6 +9265,11 @@
 #define mkjpx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjox_rx(W(XS), mask, lb)
 
+/* mkc (D = number of active elements in mask S), see rtbase.h */
+
+#define mkcpx_rx(XS, RD)        /* destroys Reax */                         \
+        mkcox_rx(W(XS), W(RD))
+
 /*************   packed single-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -8979,6 +9409,15 @@
 #define cvtpx_ld(XD, MS, DS)                                                \
         cvtox_ld(W(XD), W(MS), W(DS))
 
+/* cvh (D = fp16-to-fp32 S), (D = fp32-to-fp16 S), see rtbase.h
+ * memory side holds fp16 elements at half the SIMD width */
+
+#define cvhps_ld(XD, MS, DS)                                                \
+        cvhos_ld(W(XD), W(MS), W(DS))
+
+#define cvhps_st(XS, MD, DD)                                                \
+        cvhos_st(W(XS), W(MD), W(DD))
+
 /* cuz (D = fp-to-unsigned-int S)
  * rounding mode is encoded directly (can be used in FCTRL blocks)
  * NOTE: due to compatibility with legacy targets, fp32 SIMD fp-to-int
@@ -9178,6 +9617,20 @@
 #define rempn3ld(XD, XS, MT, DT)                                            \
         remon3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* div (G = G / IS), rem (G = G % IS) by immediate, see rtbase.h */
+
+#define divpx_ri(XG, IS)                                                    \
+        divox_ri(W(XG), W(IS))
+
+#define divpn_ri(XG, IS)                                                    \
+        divon_ri(W(XG), W(IS))
+
+#define rempx_ri(XG, IS)                                                    \
+        remox_ri(W(XG), W(IS))
+
+#define rempn_ri(XG, IS)                                                    \
+        remon_ri(W(XG), W(IS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -11948,6 +12401,46 @@
 #define divps4ld(XD, PS, XS, MT, DT)                                        \
         divqs4ld(W(XD), W(PS), W(XS), W(MT), W(DT))
 
+/* min (G = G < S ? G : S), (D = S < T ? S : T) if (#D != #T) */
+
+#define minpsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        minqsMrr(W(XG), W(PS), W(XS))
+
+#define minpsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        minqsMld(W(XG), W(PS), W(MS), W(DS))
+
+#define minpsPrr(XG, PS, XS)                                                \
+        minqsPrr(W(XG), W(PS), W(XS))
+
+#define minpsPld(XG, PS, MS, DS)                                            \
+        minqsPld(W(XG), W(PS), W(MS), W(DS))
+
+#define minps4rr(XD, PS, XS, XT)                                            \
+        minqs4rr(W(XD), W(PS), W(XS), W(XT))
+
+#define minps4ld(XD, PS, XS, MT, DT)                                        \
+        minqs4ld(W(XD), W(PS), W(XS), W(MT), W(DT))
+
+/* max (G = G > S ? G : S), (D = S > T ? S : T) if (#D != #T) */
+
+#define maxpsMrr(XG, PS, XS)     /* merging-masking only */                 \
+        maxqsMrr(W(XG), W(PS), W(XS))
+
+#define maxpsMld(XG, PS, MS, DS) /* merging-masking only */                 \
+        maxqsMld(W(XG), W(PS), W(MS), W(DS))
+
+#define maxpsPrr(XG, PS, XS)                                                \
+        maxqsPrr(W(XG), W(PS), W(XS))
+
+#define maxpsPld(XG, PS, MS, DS)                                            \
+        maxqsPld(W(XG), W(PS), W(MS), W(DS))
+
+#define maxps4rr(XD, PS, XS, XT)                                            \
+        maxqs4rr(W(XD), W(PS), W(XS), W(XT))
+
+#define maxps4ld(XD, PS, XS, MT, DT)                                        \
+        maxqs4ld(W(XD), W(PS), W(XS), W(MT), W(DT))
+
 /* ceq (D = S == T ? 1 : 0) */
 
 #define ceqpsPrr(PD, XS, XT)                                                \
@@ -12035,16 +12528,21 @@
 /* mxx (D = mask-from-predicate S), (D = predicate-from-mask S) */
 
 #define mmxpx_rr(XD, PS)                                                    \
-        mmxqx_rx(W(XD), W(PS))
+        mmxqx_rr(W(XD), W(PS))
 
 #define mxmpx_rr(PD, XS)                                                    \
-        mxmqx_rx(W(PD), W(XS))
+        mxmqx_rr(W(PD), W(XS))
 
 /* mxj (jump to lb) if (S satisfies mask condition) */
 
 #define mxjpx_rx(PS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mxjqx_rx(W(PS), mask, lb)
 
+/* whl (D = predicate-from-count S), lane (i) is active if (i < S), signed */
+
+#define whlpx_rr(PD, RS)         /* destroys Reax, S is signed 32-bit */    \
+        whlqx_rr(W(PD), W(RS))
+
 /* mov (D = S), predicated */
 
 #define mxvpx_rr(XD, PS, XS)     /* merging-masking only */                 \
@@ -12295,6 +12793,24 @@
 #define movpx_st(XS, MD, DD)                                                \
         movqx_st(W(XS), W(MD), W(DD))
 
+/* mov (D = S), non-temporal store, see rtbase.h */
+
+#define movpx_nt(XS, MD, DD)                                                \
+        movqx_nt(W(XS), W(MD), W(DD))
+
+/* mov (D = S), broadcast load, see rtbase.h */
+
+#define movpx_bc(XD, MS, DS)                                                \
+        movqx_bc(W(XD), W(MS), W(DS))
+
+/* muv (D = S), unaligned load/store, see rtbase.h */
+
+#define muvpx_ld(XD, MS, DS)                                                \
+        muvqx_ld(W(XD), W(MS), W(DS))
+
+#define muvpx_st(XS, MD, DD)                                                \
+        muvqx_st(W(XS), W(MD), W(DD))
+
 /* mmv (G = G mask-merge S) where (mask-elem: 0 keeps G, -1 picks S)
  * uses Xmm0 implicitly as a mask register, destroys Xmm0, 0-masked XS elems */
 
@@ -12307,6 +12823,46 @@
 #define mmvpx_st(XS, MG, DG)                                                \
         mmvqx_st(W(XS), W(MG), W(DG))
 
+/* cmp ([D] = active elements of S packed), compress-store under a mask
+ * exp (G = active elements unpacked from [S]), expand-load under a mask
+ * use Xmm0 implicitly as a mask register, see rtbase.h */
+
+#define cmppx_st(XS, MD, DD)                                                \
+        cmpqx_st(W(XS), W(MD), W(DD))
+
+#define exppx_ld(XG, MS, DS)                                                \
+        expqx_ld(W(XG), W(MS), W(DS))
+
+/* gat (D = [S + T*elem-size]), sca ([D + T*elem-size] = S), see rtbase.h
+ * MS/MD take plain M*** addressing modes, T holds element-size indices */
+
+#define gatpx_ld(XD, MS, XT) /* indexed load, gather requires #D != #T */   \
+        gatqx_ld(W(XD), W(MS), W(XT))
+
+#define scapx_st(XS, MD, XT) /* indexed store, last element wins */         \
+        scaqx_st(W(XS), W(MD), W(XT))
+
+/* shf (D = S shuffled within 128-bit quads by immediate pattern T)
+ * zip (G = lower halves of G, S interleaved), (S = upper halves interleaved)
+ * uzp (G = even elements of G, S), (S = odd elements of G, S) within quads
+ * bcx (D = element T of S broadcast to all elements of D)
+ * rot (D = elements of S rotated down by T), see rtbase.h */
+
+#define shfpx_ri(XD, XS, IT)                                                \
+        shfqx_ri(W(XD), W(XS), W(IT))
+
+#define zippx_rr(XG, XS)                                                    \
+        zipqx_rr(W(XG), W(XS))
+
+#define uzppx_rr(XG, XS)                                                    \
+        uzpqx_rr(W(XG), W(XS))
+
+#define bcxpx_ri(XD, XS, IT)                                                \
+        bcxqx_ri(W(XD), W(XS), W(IT))
+
+#define rotpx_ri(XD, XS, IT)                                                \
+        rotqx_ri(W(XD), W(XS), W(IT))
+
 /* and (G = G & S), (D = S & T) if (#D != #T) */
 
 #define andpx_rr(XG, XS)                                                    \
@@ -12717,6 +13273,11 @@
 #define mkjpx_rx(XS, mask, lb)   /* destroys Reax, if S == mask jump lb */  \
         mkjqx_rx(W(XS), mask, lb)
 
+/* mkc (D = number of active elements in mask S), see rtbase.h */
+
+#define mkcpx_rx(XS, RD)        /* destroys Reax */                         \
+        mkcqx_rx(W(XS), W(RD))
+
 /*************   packed double-precision floating-point convert   *************/
 
 /* cvz (D = fp-to-signed-int S)
@@ -13055,6 +13616,20 @@
 #define rempn3ld(XD, XS, MT, DT)                                            \
         remqn3ld(W(XD), W(XS), W(MT), W(DT))
 
+/* div (G = G / IS), rem (G = G % IS) by immediate, see rtbase.h */
+
+#define divpx_ri(XG, IS)                                                    \
+        divqx_ri(W(XG), W(IS))
+
+#define divpn_ri(XG, IS)                                                    \
+        divqn_ri(W(XG), W(IS))
+
+#define rempx_ri(XG, IS)                                                    \
+        remqx_ri(W(XG), W(IS))
+
+#define rempn_ri(XG, IS)                                                    \
+        remqn_ri(W(XG), W(IS))
+
 /* shl (G = G << S), (D = S << T) if (#D != #T) - plain, unsigned
  * for maximum compatibility: shift count must be modulo elem-size */
 
@@ -43,6 +43,13 @@
  * that is used to pass all the data to the ASM section and back if needed.
  * ASM section can read and write fields of that structure.
  *
+ * Short sections called very often can use ASM_ENTER_LITE(inf, bmsk, smsk)
+ * and ASM_LEAVE_LITE(inf) instead, which save/load only BASE and SIMD registers
+ * declared in the masks (RT_BASE_*, RT_SIMD_* in "core/config/rtarch.h").
+ * Masked save/load is implemented on x32/x64 and A32/A64 targets, while ARMv7,
+ * MIPS, POWER and legacy x86 ignore the masks and save/load all registers
+ * as ASM_ENTER/ASM_LEAVE do, which keeps the code portable but not faster.
+ *
  * There can be two types of instructions within the ASM section: BASE and SIMD.
  * UniSIMD also defines register sets that are common for all architectures
  * including variants of a single architecture.
@@ -61,6 +68,12 @@
  * while "test/simd_test.cpp" shows how these definitions can be used.
  * Refer to "c_test01" and "s_test01" for a start.
  *
+ * Stream compaction (cmppx_st advanced by mkcpx_rx) may write one element
+ * past the packed count on all targets except AVX-512 and SVE, which store
+ * exactly that many elements, so output buffers need one element of padding
+ * past the compacted length, expand-load (exppx_ld) may read one element
+ * past the count likewise (see "stream compaction" in rtbase.h).
+ *
  * Once the program is expressed with UniSIMD's syntax (C/C++ with ASM sections)
  * it can then be built for any supported architecture without having a need
  * to modify the source code again. Just pick the right makefile.
@@ -101,7 +114,8 @@
  * 4 - means 1/4  DP-level (10-bit displacements) has not been exceeded (Q=1).
  * 8 - means 1/8  DP-level  (9-bit displacements) has not been exceeded (Q=1).
  * 16  means 1/16 DP-level  (8-bit displacements) has not been exceeded (Q=1).
- * NOTE: the built-in rt_SIMD_INFO structure is already filled at full 1/16th.
+ * NOTE: the built-in rt_SIMD_INFO structure is filled a bit over 1/16th,
+ * so 8 is the highest level available for all backend structures.
  *
  * The load-level is measured at Q equal to 1 and UniSIMD then adjusts internal
  * displacement values as Q scales up.
@@ -148,6 +162,16 @@
  * flags for that target. In addition to that a generic ASM section should
  * determine the target at runtime and select appropriate code-path in a switch.
  *
+ * The test framework provides such a harness in "test/simd_multi.cpp", which
+ * is built with "make -f simd_make_x64.mk multi" into simd_test.x64multi.
+ * There simd_test.cpp is compiled once per target with RT_NAMESPACE set to
+ * a target-specific namespace, while the dispatcher (built for the baseline
+ * target) runs verxx_xx at startup, picks the widest target supported by
+ * the CPU among those compiled in (via mask_init/from_mask) and calls its
+ * entry point from a table. New targets are added to the makefile rule and
+ * to RT_TARGET_LIST in the dispatcher, other architectures can follow
+ * the same pattern once their OS-specific detection is in place.
+ *
  * A good example of how to build a multi-target binary with UniSIMD is provided
  * in the QuadRay engine (core/tracer). In that example backend structures are
  * always defined for the maximnal SIMD width (Q internally) configured in
@@ -179,7 +203,9 @@
  *
  * Here "reg" is a pointer to SIMD-aligned structure rt_SIMD_REGS intended
  * to keep the state of all SIMD registers (from C/C++ code) while ASM section
- * is doing some processing. It can be allocated separately or as a part of a
+ * is doing some processing, it also holds constants of elementary math
+ * functions (rt_SIMD_MATH), which are kept out of rt_SIMD_INFO to leave
+ * room for application data. It can be allocated separately or as a part of a
  * larger combined "inf+reg" structure. In any case both pointers should end up
  * SIMD-aligned (divisible by full SIMD-width they are pointing at in bytes).
  *
@@ -0,0 +1,789 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2026 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTHEAP_H
+#define RT_RTHEAP_H
+
+#include <string.h>
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+#include <windows.h>
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
+#endif /* macOS still cannot allocate with mmap within 32-bit range */
+
+#ifndef MAP_NORESERVE
+#define MAP_NORESERVE 0         /* reserved range is committed with mprotect */
+#endif /* MAP_NORESERVE */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtheap.h: Thread-safe arena allocator for SIMD-aligned data structures.
+ * Include after rtbase.h (and rtzero.h where system headers may collide).
+ *
+ * Address range available to the allocator is reserved once on first use,
+ * in 64/32-bit hybrid mode (RT_POINTER=64, RT_ADDRESS=32) it's placed within
+ * RT_ADDRESS_MIN/RT_ADDRESS_MAX, so that all pointers fit 32-bit fields
+ * of rt_SIMD_INFOX and other structures accessed from ASM sections.
+ * The range is then committed in RT_HEAP_CHUNK steps as the arena grows.
+ *
+ * Each thread carves small blocks from its own chunk with a bump pointer,
+ * which only takes the arena lock when a new chunk is needed, large blocks
+ * are carved directly from the arena under lock. Freed blocks are recycled
+ * in power-of-2 size-class free lists (small) or a best-fit list (large),
+ * small ones are first kept in per-thread lists (up to RT_HEAP_CACHE each),
+ * blocks can be freed from any thread regardless of where they were taken.
+ * Memory isn't returned to the system until heap_done releases the arena.
+ *
+ * All blocks are aligned to RT_HEAP_ALIGN (which is at least RT_SIMD_ALIGN
+ * and a cache line), each block is preceded by a header of the same size.
+ * The arena is one per translation unit as the rest of the header.
+ *
+ * Large buffers streamed by SIMD kernels can be backed by huge pages
+ * to reduce TLB misses: explicit ones (MAP_HUGETLB) are tried first,
+ * then transparent ones (madvise with MADV_HUGEPAGE), otherwise regular
+ * pages are used. Huge pages are mapped in place of the reserved range,
+ * so they stay within the address window in hybrid mode too. Windows only
+ * provides large pages for committed-at-once allocations with privileges,
+ * therefore huge blocks are backed by regular pages there.
+ * With RT_HEAP_HUGE set to 1 heap_alloc takes all blocks of at least
+ * RT_HEAP_HUGE_PAGE bytes from huge pages (as if heap_huge was called).
+ *
+ * On NUMA systems pages are placed on the node of the CPU which touches them
+ * first. Blocks carved fresh from the arena are untouched (except the page
+ * holding the header), so the threads which write them first decide where
+ * they are placed (see pool_touch in rtpool.h), recycled blocks keep their
+ * pages where they are. When transparent huge pages are enabled for all
+ * mappings the placement granularity becomes RT_HEAP_HUGE_PAGE.
+ *
+ * heap_alloc(size) - allocate block, returns RT_NULL if the arena is full
+ * heap_huge(size)  - allocate block backed by huge pages where available
+ * heap_page(ptr)   - page size backing the block in bytes
+ * heap_node(ptr)   - NUMA node of the page at the address, -1 if unknown
+ * heap_free(ptr)   - return block to its free list, RT_NULL is ignored
+ * heap_done()      - release the arena (all blocks must be freed by then)
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+/*
+ * Address window for the arena in 64-bit pointer mode (can be overridden).
+ */
+#if RT_POINTER == 64
+
+#ifndef RT_ADDRESS_MIN
+#if RT_ADDRESS == 32
+
+#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000040000000)
+#define RT_ADDRESS_MAX      ((rt_byte *)0x0000000080000000)
+
+#else /* RT_ADDRESS == 64 */
+
+#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000140000000)
+#define RT_ADDRESS_MAX      ((rt_byte *)0x0000080000000000)
+
+#endif /* RT_ADDRESS */
+#endif /* RT_ADDRESS_MIN */
+
+#endif /* RT_POINTER */
+
+/* RT_HEAP_RESERVE limits the size of reserved range in bytes */
+#ifndef RT_HEAP_RESERVE
+#if   (RT_POINTER - RT_ADDRESS) != 0
+#define RT_HEAP_RESERVE     (RT_ADDRESS_MAX - RT_ADDRESS_MIN)
+#elif  RT_POINTER == 64
+#define RT_HEAP_RESERVE     0x400000000
+#else  /* RT_POINTER == 32 */
+#define RT_HEAP_RESERVE     0x20000000
+#endif /* RT_POINTER, RT_ADDRESS */
+#endif /* RT_HEAP_RESERVE */
+
+#define RT_HEAP_CHUNK       0x100000    /* per-thread chunk, commit step */
+#define RT_HEAP_SMALL       0x20000     /* largest block in size-classes */
+#define RT_HEAP_PAGE        0x1000      /* granularity of large blocks */
+#define RT_HEAP_CLASS       16          /* number of small size-classes */
+#define RT_HEAP_CACHE       32          /* per-thread blocks in each class */
+
+/* RT_HEAP_HUGE_PAGE is the size of huge pages (2MB on x86-64/AArch64) */
+#ifndef RT_HEAP_HUGE_PAGE
+#define RT_HEAP_HUGE_PAGE   0x200000
+#endif /* RT_HEAP_HUGE_PAGE */
+
+/* RT_HEAP_HUGE set to 1 takes large blocks in heap_alloc from huge pages */
+#ifndef RT_HEAP_HUGE
+#define RT_HEAP_HUGE        0
+#endif /* RT_HEAP_HUGE */
+
+#if RT_SIMD_ALIGN > 64
+#define RT_HEAP_ALIGN       RT_SIMD_ALIGN
+#else  /* keep blocks (and their headers) on separate cache lines */
+#define RT_HEAP_ALIGN       64
+#endif /* RT_HEAP_ALIGN */
+
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+#define RT_HEAP_TLS         __declspec(thread)
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+#define RT_HEAP_TLS         __thread
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*****************************   ARENA STRUCTS   ******************************/
+/******************************************************************************/
+
+/*
+ * Block header, placed RT_HEAP_ALIGN bytes before the returned pointer.
+ */
+struct rt_HEAP_HEAD
+{
+    rt_size size;           /* full block size including the header */
+    rt_HEAP_HEAD *next;     /* next free block (while in the free list) */
+    rt_si32 page;           /* size of pages backing the block */
+};
+
+/*
+ * Arena, reserved range is [base, base + size), committed up to "cmt".
+ */
+struct rt_HEAP
+{
+    rt_byte *base;          /* start of reserved range */
+    rt_byte *top;           /* first byte not yet carved */
+    rt_byte *cmt;           /* first byte not yet committed */
+    rt_size size;           /* size of reserved range */
+
+    rt_HEAP_HEAD *free[RT_HEAP_CLASS];
+    rt_HEAP_HEAD *large;    /* free blocks above RT_HEAP_SMALL */
+
+    rt_si32 page;           /* size of regular pages */
+    rt_si32 thp;            /* transparent huge pages can be advised */
+    rt_si32 gen;            /* generation, invalidates per-thread chunks */
+
+    volatile rt_si32 lock;  /* spin-lock guarding the arena */
+};
+
+/*
+ * Per-thread chunk and free lists for small blocks.
+ */
+struct rt_HEAP_LOCAL
+{
+    rt_byte *ptr;           /* first byte not yet used */
+    rt_byte *end;           /* end of the chunk */
+    rt_si32 gen;            /* arena generation the chunk belongs to */
+
+    rt_HEAP_HEAD *free[RT_HEAP_CLASS];
+    rt_si32 n_free[RT_HEAP_CLASS];
+};
+
+static rt_HEAP heap_arena;
+
+static RT_HEAP_TLS rt_HEAP_LOCAL heap_local;
+
+/******************************************************************************/
+/*****************************   ARENA FUNCTIONS   ****************************/
+/******************************************************************************/
+
+/*
+ * Acquire arena spin-lock, only held for chunk and free list updates.
+ */
+static
+rt_void heap_lock(rt_HEAP *heap)
+{
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+    while (InterlockedExchange((volatile LONG *)&heap->lock, 1) != 0)
+    {
+        while (heap->lock != 0);
+    }
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+    while (__sync_lock_test_and_set(&heap->lock, 1) != 0)
+    {
+        while (heap->lock != 0);
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Release arena spin-lock.
+ */
+static
+rt_void heap_unlock(rt_HEAP *heap)
+{
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+    InterlockedExchange((volatile LONG *)&heap->lock, 0);
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+    __sync_lock_release(&heap->lock);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Reserve address range for the arena, arena must be locked.
+ * If the full range isn't available at the start of the window
+ * the size is halved until it fits (or drops below RT_HEAP_CHUNK).
+ */
+static
+rt_void heap_init(rt_HEAP *heap)
+{
+    rt_byte *ptr = RT_NULL;
+    rt_size size = (rt_size)RT_HEAP_RESERVE;
+
+#if RT_POINTER == 64
+    rt_byte *hint = RT_ADDRESS_MIN;
+#else  /* RT_POINTER == 32 */
+    rt_byte *hint = RT_NULL;
+#endif /* RT_POINTER */
+
+    for (; size >= RT_HEAP_CHUNK; size /= 2)
+    {
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+        ptr = (rt_byte *)VirtualAlloc(hint, size, MEM_RESERVE, PAGE_NOACCESS);
+        if (ptr == RT_NULL)
+        {
+            continue;
+        }
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+        ptr = (rt_byte *)mmap(hint, size, PROT_NONE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+        if (ptr == (rt_byte *)MAP_FAILED)
+        {
+            ptr = RT_NULL;
+            continue;
+        }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+#if (RT_POINTER - RT_ADDRESS) != 0
+
+        /* in 64/32-bit hybrid mode addresses can't have sign bit
+         * as MIPS64 sign-extends all 32-bit mem-loads by default */
+        if (ptr < RT_ADDRESS_MIN || ptr > RT_ADDRESS_MAX - size)
+        {
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+            VirtualFree(ptr, 0, MEM_RELEASE);
+#else /* --- Linux, GCC ----------------------------------------------------- */
+            munmap(ptr, size);
+#endif /* ------------- OS specific ----------------------------------------- */
+            ptr = RT_NULL;
+            continue;
+        }
+
+#endif /* (RT_POINTER - RT_ADDRESS) */
+
+        break;
+    }
+
+    heap->base = ptr;
+    heap->top  = ptr;
+    heap->cmt  = ptr;
+    heap->size = ptr != RT_NULL ? size : 0;
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    SYSTEM_INFO sys;
+    GetSystemInfo(&sys);
+    heap->page = (rt_si32)sys.dwPageSize;
+    heap->thp  = 0;
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    rt_char buf[64] = {0};
+    rt_si32 fd = open("/sys/kernel/mm/transparent_hugepage/enabled", O_RDONLY);
+    heap->page = (rt_si32)sysconf(_SC_PAGESIZE);
+    heap->thp  = 0;
+
+    /* THP can be disabled system-wide even if madvise succeeds */
+    if (fd >= 0)
+    {
+        heap->thp = read(fd, buf, sizeof(buf) - 1) > 0
+                 && strstr(buf, "[never]") == RT_NULL;
+        close(fd);
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Carve "size" bytes from the top of the arena, arena must be locked.
+ * Pages are committed in RT_HEAP_CHUNK steps ahead of the top.
+ */
+static
+rt_byte *heap_grow(rt_HEAP *heap, rt_size size)
+{
+    rt_byte *ptr = heap->top;
+
+    if (heap->base == RT_NULL)
+    {
+        heap_init(heap);
+        ptr = heap->top;
+    }
+
+    if (ptr == RT_NULL || size > heap->size - (rt_size)(ptr - heap->base))
+    {
+        return RT_NULL;
+    }
+
+    if (ptr + size > heap->cmt)
+    {
+        rt_size step = ptr + size - heap->cmt;
+        step = ((step + RT_HEAP_CHUNK - 1) / RT_HEAP_CHUNK) * RT_HEAP_CHUNK;
+        step = RT_MIN(step, heap->size - (rt_size)(heap->cmt - heap->base));
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+        if (VirtualAlloc(heap->cmt, step, MEM_COMMIT, PAGE_READWRITE) == 0)
+        {
+            return RT_NULL;
+        }
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+        if (mprotect(heap->cmt, step, PROT_READ | PROT_WRITE) != 0)
+        {
+            return RT_NULL;
+        }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+        heap->cmt += step;
+    }
+
+    heap->top = ptr + size;
+
+    return ptr;
+}
+
+/*
+ * Determine size-class for a small block of "size" bytes (header included).
+ */
+static
+rt_si32 heap_class(rt_size size)
+{
+    rt_si32 k = 0;
+
+    while (((rt_size)RT_HEAP_ALIGN << k) < size)
+    {
+        k++;
+    }
+
+    return k;
+}
+
+/*
+ * Allocate SIMD-aligned block of "size" bytes backed by huge pages.
+ * Block is placed at huge page boundary (the gap is recycled if large),
+ * explicit huge pages replace the committed range with MAP_FIXED,
+ * otherwise transparent ones are advised, heap_page reports the outcome.
+ */
+static
+rt_pntr heap_huge(rt_size size)
+{
+    rt_HEAP *heap = &heap_arena;
+    rt_HEAP_HEAD *head = RT_NULL, **prev, **best = RT_NULL;
+    rt_byte *ptr;
+    rt_size gap;
+    rt_si32 page;
+
+    size = ((size + RT_HEAP_ALIGN - 1) / RT_HEAP_ALIGN + 1) * RT_HEAP_ALIGN;
+    size = ((size + RT_HEAP_HUGE_PAGE - 1) / RT_HEAP_HUGE_PAGE)
+                                          * RT_HEAP_HUGE_PAGE;
+
+    heap_lock(heap);
+
+    /* best fit among blocks already backed by huge pages */
+    for (prev = &heap->large; *prev != RT_NULL; prev = &(*prev)->next)
+    {
+        if ((*prev)->page >= RT_HEAP_HUGE_PAGE
+        &&  (*prev)->size >= size && (*prev)->size / 2 <= size
+        &&  (best == RT_NULL || (*prev)->size < (*best)->size))
+        {
+            best = prev;
+        }
+    }
+
+    if (best != RT_NULL)
+    {
+        head = *best;
+        *best = head->next;
+
+        heap_unlock(heap);
+
+        head->next = RT_NULL;
+
+        return (rt_byte *)head + RT_HEAP_ALIGN;
+    }
+
+    ptr = heap_grow(heap, 0);
+    gap = (rt_size)(-(rt_uptr)ptr & (RT_HEAP_HUGE_PAGE - 1));
+
+    if (ptr != RT_NULL && gap != 0)
+    {
+        head = (rt_HEAP_HEAD *)heap_grow(heap, gap);
+        ptr = head != RT_NULL ? heap->top : RT_NULL;
+
+        if (head != RT_NULL && gap > RT_HEAP_SMALL)
+        {
+            head->size = gap;
+            head->page = heap->page;
+            head->next = heap->large;
+            heap->large = head;
+        }
+    }
+
+    if (ptr != RT_NULL)
+    {
+        ptr = heap_grow(heap, size);
+    }
+
+    page = heap->page;
+
+    heap_unlock(heap);
+
+    if (ptr == RT_NULL)
+    {
+        return RT_NULL;
+    }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    /* large pages can't be committed in a reserved range */
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#ifdef MAP_HUGETLB
+
+    if (mmap(ptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS
+           | MAP_FIXED | MAP_HUGETLB, -1, 0) == (rt_pntr)ptr)
+    {
+        page = RT_HEAP_HUGE_PAGE;
+    }
+    else /* failed MAP_FIXED may have unmapped the range, map it again */
+    if (mmap(ptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS
+           | MAP_FIXED, -1, 0) != (rt_pntr)ptr)
+    {
+        return RT_NULL;
+    }
+
+#endif /* MAP_HUGETLB */
+
+#ifdef MADV_HUGEPAGE
+
+    if (page < RT_HEAP_HUGE_PAGE && heap->thp
+    &&  madvise(ptr, size, MADV_HUGEPAGE) == 0)
+    {
+        page = RT_HEAP_HUGE_PAGE;
+    }
+
+#endif /* MADV_HUGEPAGE */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    head = (rt_HEAP_HEAD *)ptr;
+    head->size = size;
+    head->next = RT_NULL;
+    head->page = page;
+
+    return ptr + RT_HEAP_ALIGN;
+}
+
+/*
+ * Drop per-thread chunk and free lists left from previous arena generation.
+ */
+static
+rt_void heap_sync(rt_HEAP *heap, rt_HEAP_LOCAL *local)
+{
+    rt_si32 k;
+
+    if (local->gen == heap->gen)
+    {
+        return;
+    }
+
+    local->ptr = RT_NULL;
+    local->end = RT_NULL;
+    local->gen = heap->gen;
+
+    for (k = 0; k < RT_HEAP_CLASS; k++)
+    {
+        local->free[k] = RT_NULL;
+        local->n_free[k] = 0;
+    }
+}
+
+/*
+ * Allocate SIMD-aligned block of "size" bytes.
+ */
+static
+rt_pntr heap_alloc(rt_size size)
+{
+    rt_HEAP *heap = &heap_arena;
+    rt_HEAP_LOCAL *local = &heap_local;
+    rt_HEAP_HEAD *head = RT_NULL, **prev, **best = RT_NULL;
+    rt_si32 k;
+
+    size = ((size + RT_HEAP_ALIGN - 1) / RT_HEAP_ALIGN + 1) * RT_HEAP_ALIGN;
+
+    if (size <= RT_HEAP_SMALL)
+    {
+        k = heap_class(size);
+        size = (rt_size)RT_HEAP_ALIGN << k;
+
+        heap_sync(heap, local);
+
+        head = local->free[k];
+        if (head != RT_NULL)
+        {
+            local->free[k] = head->next;
+            local->n_free[k]--;
+        }
+        else if (*(rt_HEAP_HEAD *volatile *)&heap->free[k] != RT_NULL)
+        {
+            /* shared free list is re-checked under lock */
+            heap_lock(heap);
+            head = heap->free[k];
+            if (head != RT_NULL)
+            {
+                heap->free[k] = head->next;
+            }
+            heap_unlock(heap);
+        }
+
+        if (head == RT_NULL)
+        {
+            if (local->ptr == RT_NULL
+            ||  size > (rt_size)(local->end - local->ptr))
+            {
+                heap_lock(heap);
+                local->ptr = heap_grow(heap, RT_HEAP_CHUNK);
+                local->end = local->ptr + RT_HEAP_CHUNK;
+                heap_unlock(heap);
+
+                if (local->ptr == RT_NULL)
+                {
+                    return RT_NULL;
+                }
+            }
+
+            head = (rt_HEAP_HEAD *)local->ptr;
+            local->ptr += size;
+        }
+
+        head->page = heap->page;
+    }
+    else
+    {
+#if RT_HEAP_HUGE
+
+        if (size >= RT_HEAP_HUGE_PAGE)
+        {
+            return heap_huge(size - RT_HEAP_ALIGN);
+        }
+
+#endif /* RT_HEAP_HUGE */
+
+        size = ((size + RT_HEAP_PAGE - 1) / RT_HEAP_PAGE) * RT_HEAP_PAGE;
+
+        heap_lock(heap);
+
+        /* best fit, not wasting more than half of the block */
+        for (prev = &heap->large; *prev != RT_NULL; prev = &(*prev)->next)
+        {
+            if ((*prev)->size >= size && (*prev)->size / 2 <= size
+            &&  (best == RT_NULL || (*prev)->size < (*best)->size))
+            {
+                best = prev;
+            }
+        }
+
+        if (best != RT_NULL)
+        {
+            head = *best;
+            *best = head->next;
+            size = head->size;
+        }
+        else
+        {
+            head = (rt_HEAP_HEAD *)heap_grow(heap, size);
+
+            if (head != RT_NULL)
+            {
+                head->page = heap->page;
+            }
+        }
+
+        heap_unlock(heap);
+
+        if (head == RT_NULL)
+        {
+            return RT_NULL;
+        }
+    }
+
+    head->size = size;
+    head->next = RT_NULL;
+
+    return (rt_byte *)head + RT_HEAP_ALIGN;
+}
+
+/*
+ * Determine size of pages backing the block.
+ */
+static
+rt_si32 heap_page(rt_pntr ptr)
+{
+    if (ptr == RT_NULL)
+    {
+        return 0;
+    }
+
+    return ((rt_HEAP_HEAD *)((rt_byte *)ptr - RT_HEAP_ALIGN))->page;
+}
+
+/*
+ * Determine NUMA node of the page at the address (once it's been touched),
+ * only available on Linux, returns -1 otherwise.
+ */
+static
+rt_si32 heap_node(rt_pntr ptr)
+{
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    return -1;
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#ifdef SYS_get_mempolicy
+
+    int node = -1;
+
+    /* MPOL_F_NODE | MPOL_F_ADDR, node of the page instead of the policy */
+    if (syscall(SYS_get_mempolicy, &node, RT_NULL, 0, ptr, 3) == 0)
+    {
+        return (rt_si32)node;
+    }
+
+#endif /* SYS_get_mempolicy */
+
+    return -1;
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Return block to the free lists of the calling thread (or shared ones).
+ */
+static
+rt_void heap_free(rt_pntr ptr)
+{
+    rt_HEAP *heap = &heap_arena;
+    rt_HEAP_LOCAL *local = &heap_local;
+    rt_HEAP_HEAD *head;
+    rt_si32 k;
+
+    if (ptr == RT_NULL)
+    {
+        return;
+    }
+
+    head = (rt_HEAP_HEAD *)((rt_byte *)ptr - RT_HEAP_ALIGN);
+
+    if (head->size <= RT_HEAP_SMALL)
+    {
+        k = heap_class(head->size);
+
+        heap_sync(heap, local);
+
+        if (local->n_free[k] < RT_HEAP_CACHE)
+        {
+            head->next = local->free[k];
+            local->free[k] = head;
+            local->n_free[k]++;
+            return;
+        }
+    }
+
+    heap_lock(heap);
+
+    if (head->size <= RT_HEAP_SMALL)
+    {
+        k = heap_class(head->size);
+        head->next = heap->free[k];
+        heap->free[k] = head;
+    }
+    else
+    {
+        head->next = heap->large;
+        heap->large = head;
+    }
+
+    heap_unlock(heap);
+}
+
+/*
+ * Release the arena, chunks held by other threads are invalidated,
+ * next allocation reserves the address range again.
+ */
+static
+rt_void heap_done()
+{
+    rt_HEAP *heap = &heap_arena;
+    rt_si32 k;
+
+    heap_lock(heap);
+
+    if (heap->base != RT_NULL)
+    {
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+        VirtualFree(heap->base, 0, MEM_RELEASE);
+#else /* --- Linux, GCC ----------------------------------------------------- */
+        munmap(heap->base, heap->size);
+#endif /* ------------- OS specific ----------------------------------------- */
+    }
+
+    heap->base = RT_NULL;
+    heap->top  = RT_NULL;
+    heap->cmt  = RT_NULL;
+    heap->size = 0;
+
+    for (k = 0; k < RT_HEAP_CLASS; k++)
+    {
+        heap->free[k] = RT_NULL;
+    }
+    heap->large = RT_NULL;
+
+    heap->gen++;
+
+    heap_unlock(heap);
+}
+
+#endif /* RT_RTHEAP_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
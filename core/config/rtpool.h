@@ -0,0 +1,1119 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2026 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#ifndef RT_RTPOOL_H
+#define RT_RTPOOL_H
+
+#include "rtheap.h"
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+#include <windows.h>
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#include <pthread.h>
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/******************************************************************************/
+/*********************************   LEGEND   *********************************/
+/******************************************************************************/
+
+/*
+ * rtpool.h: Per-thread SIMD contexts for running ASM sections on many cores.
+ * Include after rtbase.h (before rtzero.h, as ASM_INIT uses short names),
+ * on Windows include <windows.h> before rtbase.h to avoid name collisions.
+ *
+ * Each ASM section uses scratchpads (inf_SCR01/inf_SCR02) and the spill area
+ * (inf_REGS) of its rt_SIMD_INFO/rt_SIMD_REGS pair, therefore threads running
+ * ASM sections at the same time must not share the pair. The pool allocates
+ * N pairs (contexts) from the arena in rtheap.h, so that they are reachable
+ * in 64/32-bit hybrid mode, each info and regs is SIMD-aligned and padded
+ * to separate cache lines (RT_POOL_ALIGN) to avoid false sharing.
+ * All contexts are initialized with ASM_INIT when the pool is created.
+ *
+ * Contexts can be addressed by index (worker k uses context k) or handed out
+ * to any thread with pool_take/pool_give. Info structure can be extended
+ * (as rt_SIMD_INFOX in the test framework) by giving its size to pool_init,
+ * pool_clone then copies the SIMD target (ver) and the extension fields
+ * from a template, leaving constants set by ASM_INIT and the context's own
+ * regs pointer intact, so cloning costs only the size of the extension.
+ *
+ * pool_team starts worker threads on the last contexts of the pool, which
+ * then run ASM-section functions (kernels) over large arrays with
+ * parallel_for. Array pointers of the template (registered with pool_array)
+ * are rebased in each worker's clone to the beginning of a chunk of "grain"
+ * elements and the element count field (pool_count) is set to its length.
+ * The grain is rounded up, so that all chunks start at RT_SIMD_ALIGN
+ * boundaries given that the arrays in the template are aligned.
+ * Each worker initially owns an equal range of chunks and takes them from
+ * the front, once its range is empty it steals the back half of the largest
+ * remaining range, which balances the load when chunks take uneven time.
+ * The calling thread waits for all chunks to complete, parallel_for is not
+ * reentrant and should only be called from one thread at a time per pool.
+ * Without a team the chunks run in the calling thread on a taken context,
+ * if all contexts are taken nothing is run and parallel_for returns 0.
+ *
+ * Workers can be pinned to CPUs with pool_pin, each worker then records
+ * the NUMA node of its CPU at the start of every job. As pages are placed
+ * on the node which touches them first, pool_touch zeroes fresh arrays
+ * chunk by chunk from the workers which initially own these chunks in
+ * parallel_for with the same number of elements and grain, so that each
+ * worker streams from its local node (stealing aside). With "remote" set
+ * chunks are touched by the next worker on a different node instead
+ * (if any), which places them remote to their owners for comparison.
+ * pool_local reports the share of pages local to their owners' nodes.
+ *
+ * pool_init(pool, n, size) - create n contexts with info of "size" bytes
+ * pool_info(pool, k)       - info of k-th context
+ * pool_take(pool)          - hand out a free context, RT_NULL if none left
+ * pool_give(pool, info)    - return context taken with pool_take
+ * pool_clone(pool, info, src) - copy target and extension from template
+ * pool_cpus()              - number of online CPUs (default team size)
+ * pool_team(pool, n)       - start n worker threads on the last n contexts
+ * pool_array(pool, info, field, elem) - register array field of template
+ * pool_count(pool, info, field)       - register element count field
+ * parallel_for(pool, kern, info, n, grain) - run kern, returns chunks run
+ * pool_pin(pool, cpu)      - pin worker k to CPU (cpu + k) % pool_cpus()
+ * pool_touch(pool, info, n, grain, remote) - place pages of fresh arrays
+ * pool_local(pool, info, n, grain)  - percent of pages local to owners
+ * pool_done(pool)          - stop the team, release all contexts
+ */
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+/* keep adjacent-line prefetch from pairing lines of different contexts */
+#if RT_HEAP_ALIGN > 128
+#define RT_POOL_ALIGN       RT_HEAP_ALIGN
+#else  /* RT_HEAP_ALIGN <= 128 */
+#define RT_POOL_ALIGN       128
+#endif /* RT_POOL_ALIGN */
+
+#define RT_POOL_ARRAY       16          /* max array fields per template */
+#define RT_POOL_SPLIT       8           /* chunks per worker (default grain) */
+
+/*
+ * Function type for kernels run with parallel_for.
+ */
+typedef rt_void (*rt_FUNC_POOL)(rt_SIMD_INFO *info);
+
+/******************************************************************************/
+/*****************************   CONTEXT STRUCTS   ****************************/
+/******************************************************************************/
+
+/*
+ * Worker thread, owns range of chunks [beg, end) of the current job.
+ */
+struct rt_SIMD_WORK
+{
+    struct rt_SIMD_POOL *pool; /* pool the worker belongs to */
+    rt_SIMD_INFO *info;     /* worker's own context */
+
+    volatile rt_si32 beg;   /* next chunk to run (taken from the front) */
+    volatile rt_si32 end;   /* end of range (stolen from the back) */
+    volatile rt_si32 lock;  /* spin-lock guarding the range */
+
+    rt_si32 node;           /* NUMA node of the worker's CPU, -1 unknown */
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    HANDLE thread;
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    pthread_t thread;
+
+#endif /* ------------- OS specific ----------------------------------------- */
+};
+
+/*
+ * Pool of SIMD contexts, k-th info is at mem + k * step (followed by regs).
+ */
+struct rt_SIMD_POOL
+{
+    rt_byte *mem;           /* contexts, each info followed by its regs */
+    rt_si32 *busy;          /* contexts handed out with pool_take */
+
+    rt_size size;           /* size of info structure (with extension) */
+    rt_size regs;           /* offset of regs from info (padded size) */
+    rt_size step;           /* distance between contexts */
+    rt_si32 n_ctx;          /* number of contexts */
+
+    volatile rt_si32 lock;  /* spin-lock guarding busy flags */
+
+    /* template layout (offsets from info) */
+
+    rt_size arr_off[RT_POOL_ARRAY]; /* array fields rebased to chunks */
+    rt_size arr_elm[RT_POOL_ARRAY]; /* element sizes of the arrays */
+    rt_si32 n_arr;          /* number of array fields */
+    rt_size cnt_off;        /* element count field (0 if not set) */
+
+    /* worker team */
+
+    rt_byte *work;          /* workers, each on a separate cache line */
+    rt_si32 n_thr;          /* number of worker threads */
+    rt_si32 n_run;          /* workers still running current job */
+    rt_si32 job;            /* job counter, wakes up workers */
+    rt_si32 quit;           /* asks workers to exit */
+
+    /* current job */
+
+    rt_FUNC_POOL kern;      /* kernel run for each chunk */
+    rt_SIMD_INFO *tmpl;     /* template cloned to workers */
+    rt_si32 n_elm;          /* number of elements */
+    rt_si32 grain;          /* elements per chunk (aligned) */
+    rt_si32 n_chk;          /* number of chunks */
+    rt_bool remote;         /* pool_touch places chunks remote to owners */
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    CRITICAL_SECTION mutex;
+    CONDITION_VARIABLE wake;
+    CONDITION_VARIABLE done;
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+
+#endif /* ------------- OS specific ----------------------------------------- */
+};
+
+/******************************************************************************/
+/****************************   CONTEXT FUNCTIONS   ***************************/
+/******************************************************************************/
+
+/*
+ * Acquire spin-lock, only held to update busy flags or ranges of chunks.
+ */
+static
+rt_void pool_lock(volatile rt_si32 *lock)
+{
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+    while (InterlockedExchange((volatile LONG *)lock, 1) != 0)
+    {
+        while (*lock != 0);
+    }
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+    while (__sync_lock_test_and_set(lock, 1) != 0)
+    {
+        while (*lock != 0);
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Release spin-lock.
+ */
+static
+rt_void pool_unlock(volatile rt_si32 *lock)
+{
+#if   (defined RT_WIN32) /* Win32, MSVC -------- for older versions --------- */
+
+    InterlockedExchange((volatile LONG *)lock, 0);
+
+#else /* --- Win64, GCC --- Linux, GCC -------------------------------------- */
+
+    __sync_lock_release(lock);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Info of k-th context.
+ */
+static
+rt_SIMD_INFO *pool_info(rt_SIMD_POOL *pool, rt_si32 k)
+{
+    return (rt_SIMD_INFO *)(pool->mem + k * pool->step);
+}
+
+/*
+ * Create "n_ctx" contexts with info structure of "size" bytes,
+ * returns the number of contexts or 0 if allocation failed.
+ */
+static
+rt_si32 pool_init(rt_SIMD_POOL *pool, rt_si32 n_ctx, rt_size size)
+{
+    rt_SIMD_INFO *info;
+    rt_SIMD_REGS *regs;
+    rt_si32 k;
+
+    size = RT_MAX(size, (rt_size)sizeof(rt_SIMD_INFO));
+
+    pool->size = size;
+    pool->regs = ((size + RT_POOL_ALIGN - 1) / RT_POOL_ALIGN) * RT_POOL_ALIGN;
+    pool->step = pool->regs + ((sizeof(rt_SIMD_REGS) + RT_POOL_ALIGN - 1)
+                                          / RT_POOL_ALIGN) * RT_POOL_ALIGN;
+    pool->n_ctx = 0;
+    pool->lock = 0;
+
+    pool->n_arr = 0;
+    pool->cnt_off = 0;
+
+    pool->work = RT_NULL;
+    pool->n_thr = 0;
+
+    pool->kern = RT_NULL;
+    pool->n_chk = 0;
+    pool->remote = RT_FALSE;
+
+    pool->mem  = (rt_byte *)heap_alloc(n_ctx * pool->step);
+    pool->busy = (rt_si32 *)heap_alloc(n_ctx * sizeof(rt_si32));
+
+    if (pool->mem == RT_NULL || pool->busy == RT_NULL)
+    {
+        heap_free(pool->busy);
+        heap_free(pool->mem);
+        return 0;
+    }
+
+    memset(pool->mem, 0, n_ctx * pool->step);
+
+    for (k = 0; k < n_ctx; k++)
+    {
+        info = pool_info(pool, k);
+        regs = (rt_SIMD_REGS *)((rt_byte *)info + pool->regs);
+
+        ASM_INIT(info, regs)
+
+        pool->busy[k] = 0;
+    }
+
+    pool->n_ctx = n_ctx;
+
+    return n_ctx;
+}
+
+/*
+ * Hand out a free context (to the calling thread).
+ */
+static
+rt_SIMD_INFO *pool_take(rt_SIMD_POOL *pool)
+{
+    rt_SIMD_INFO *info = RT_NULL;
+    rt_si32 k;
+
+    pool_lock(&pool->lock);
+
+    for (k = 0; k < pool->n_ctx; k++)
+    {
+        if (pool->busy[k] == 0)
+        {
+            pool->busy[k] = 1;
+            info = pool_info(pool, k);
+            break;
+        }
+    }
+
+    pool_unlock(&pool->lock);
+
+    return info;
+}
+
+/*
+ * Return context taken with pool_take.
+ */
+static
+rt_void pool_give(rt_SIMD_POOL *pool, rt_SIMD_INFO *info)
+{
+    rt_si32 k = (rt_si32)(((rt_byte *)info - pool->mem) / pool->step);
+
+    pool_lock(&pool->lock);
+
+    pool->busy[k] = 0;
+
+    pool_unlock(&pool->lock);
+}
+
+/*
+ * Copy SIMD target and extension fields (past rt_SIMD_INFO) from template.
+ */
+static
+rt_SIMD_INFO *pool_clone(rt_SIMD_POOL *pool, rt_SIMD_INFO *info,
+                         const rt_SIMD_INFO *src)
+{
+    info->ver = src->ver;
+
+    memcpy((rt_byte *)info + sizeof(rt_SIMD_INFO),
+           (const rt_byte *)src + sizeof(rt_SIMD_INFO),
+           pool->size - sizeof(rt_SIMD_INFO));
+
+    return info;
+}
+
+/******************************************************************************/
+/*****************************   TEAM FUNCTIONS   *****************************/
+/******************************************************************************/
+
+/*
+ * Number of online CPUs.
+ */
+static
+rt_si32 pool_cpus()
+{
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+
+    return (rt_si32)si.dwNumberOfProcessors;
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    rt_si32 n = (rt_si32)sysconf(_SC_NPROCESSORS_ONLN);
+
+    return RT_MAX(n, 1);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * NUMA node of the CPU the calling thread runs on, -1 if unknown.
+ */
+static
+rt_si32 pool_node()
+{
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    UCHAR node = 0;
+
+    if (GetNumaProcessorNode((UCHAR)GetCurrentProcessorNumber(), &node))
+    {
+        return (rt_si32)node;
+    }
+
+    return -1;
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#ifdef SYS_getcpu
+
+    unsigned int cpu = 0, node = 0;
+
+    if (syscall(SYS_getcpu, &cpu, &node, RT_NULL) == 0)
+    {
+        return (rt_si32)node;
+    }
+
+#endif /* SYS_getcpu */
+
+    return -1;
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Worker k of the team.
+ */
+static
+rt_SIMD_WORK *pool_work(rt_SIMD_POOL *pool, rt_si32 k)
+{
+    return (rt_SIMD_WORK *)(pool->work + k * RT_POOL_ALIGN);
+}
+
+/*
+ * First chunk of the range initially owned by worker k in the current job,
+ * the range ends where the one of worker k + 1 begins.
+ */
+static
+rt_si32 pool_first(rt_SIMD_POOL *pool, rt_si32 k)
+{
+    return (rt_si32)(((rt_full)pool->n_chk * k) / RT_MAX(pool->n_thr, 1));
+}
+
+/*
+ * Next worker after k running on a different node (k itself if none).
+ */
+static
+rt_si32 pool_peer(rt_SIMD_POOL *pool, rt_si32 k)
+{
+    rt_si32 i, p;
+
+    for (i = 1; i < pool->n_thr; i++)
+    {
+        p = (k + i) % pool->n_thr;
+
+        if (pool_work(pool, p)->node != pool_work(pool, k)->node)
+        {
+            return p;
+        }
+    }
+
+    return k;
+}
+
+/*
+ * Register array field of the template (given by its address within "info")
+ * with elements of "elem" bytes, to be rebased to chunks in parallel_for.
+ */
+static
+rt_void pool_array(rt_SIMD_POOL *pool, rt_SIMD_INFO *info, rt_pntr field,
+                   rt_size elem)
+{
+    if (pool->n_arr < RT_POOL_ARRAY)
+    {
+        pool->arr_off[pool->n_arr] = (rt_byte *)field - (rt_byte *)info;
+        pool->arr_elm[pool->n_arr] = elem;
+        pool->n_arr++;
+    }
+}
+
+/*
+ * Register 32-bit element count field of the template (given by its address
+ * within "info"), set to the length of the chunk in parallel_for.
+ */
+static
+rt_void pool_count(rt_SIMD_POOL *pool, rt_SIMD_INFO *info, rt_pntr field)
+{
+    pool->cnt_off = (rt_byte *)field - (rt_byte *)info;
+}
+
+/*
+ * Run kernel over chunk "c" of the current job in context "info".
+ */
+static
+rt_void pool_chunk(rt_SIMD_POOL *pool, rt_SIMD_INFO *info, rt_si32 c)
+{
+    rt_si32 beg = c * pool->grain;
+    rt_si32 cnt = RT_MIN(pool->grain, pool->n_elm - beg);
+    rt_si32 k;
+
+    for (k = 0; k < pool->n_arr; k++)
+    {
+        *(rt_byte **)((rt_byte *)info + pool->arr_off[k]) =
+        *(rt_byte **)((rt_byte *)pool->tmpl + pool->arr_off[k])
+                                            + beg * pool->arr_elm[k];
+    }
+
+    if (pool->cnt_off != 0)
+    {
+        *(rt_si32 *)((rt_byte *)info + pool->cnt_off) = cnt;
+    }
+
+    /* no kernel, zero the chunk to touch its pages (pool_touch) */
+    if (pool->kern == RT_NULL)
+    {
+        for (k = 0; k < pool->n_arr; k++)
+        {
+            memset(*(rt_byte **)((rt_byte *)info + pool->arr_off[k]), 0,
+                                                cnt * pool->arr_elm[k]);
+        }
+        return;
+    }
+
+    pool->kern(info);
+}
+
+/*
+ * Run chunks of the worker's own range, then steal from other workers
+ * until no chunks are left in any range.
+ */
+static
+rt_void pool_steal(rt_SIMD_POOL *pool, rt_SIMD_WORK *work)
+{
+    rt_SIMD_WORK *vict;
+    rt_si32 b, e, c, k, m, n, v;
+
+    for (;;)
+    {
+        pool_lock(&work->lock);
+
+        c = work->beg;
+        if (c < work->end)
+        {
+            work->beg = c + 1;
+        }
+
+        pool_unlock(&work->lock);
+
+        if (c < work->end)
+        {
+            pool_chunk(pool, work->info, c);
+            continue;
+        }
+
+        /* find the largest remaining range (may shrink, checked below) */
+        for (k = 0, v = -1, n = 0; k < pool->n_thr; k++)
+        {
+            vict = pool_work(pool, k);
+
+            pool_lock(&vict->lock);
+
+            m = vict->end - vict->beg;
+
+            pool_unlock(&vict->lock);
+
+            if (m > n)
+            {
+                n = m;
+                v = k;
+            }
+        }
+
+        if (v < 0)
+        {
+            break;
+        }
+
+        vict = pool_work(pool, v);
+
+        pool_lock(&vict->lock);
+
+        n = vict->end - vict->beg;
+        b = e = vict->end;
+        if (n > 0)
+        {
+            b = e - (n + 1) / 2;
+            vict->end = b;
+        }
+
+        pool_unlock(&vict->lock);
+
+        /* stolen range becomes own, so that it can be stolen further */
+        pool_lock(&work->lock);
+
+        work->beg = b;
+        work->end = e;
+
+        pool_unlock(&work->lock);
+    }
+}
+
+/*
+ * Touch chunks of the ranges initially owned by the worker itself
+ * or, with "remote" set, by the workers it is the peer of (pool_touch).
+ */
+static
+rt_void pool_fill(rt_SIMD_POOL *pool, rt_SIMD_WORK *work)
+{
+    rt_si32 k = (rt_si32)(((rt_byte *)work - pool->work) / RT_POOL_ALIGN);
+    rt_si32 c, o;
+
+    for (o = 0; o < pool->n_thr; o++)
+    {
+        if ((pool->remote ? pool_peer(pool, o) : o) != k)
+        {
+            continue;
+        }
+
+        for (c = pool_first(pool, o); c < pool_first(pool, o + 1); c++)
+        {
+            pool_chunk(pool, work->info, c);
+        }
+    }
+}
+
+/*
+ * Worker thread loop, waits for jobs from parallel_for until pool_done.
+ */
+static
+rt_void pool_loop(rt_SIMD_WORK *work)
+{
+    rt_SIMD_POOL *pool = work->pool;
+    rt_si32 job = 0;
+
+    for (;;)
+    {
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+        EnterCriticalSection(&pool->mutex);
+        while (pool->job == job && pool->quit == 0)
+        {
+            SleepConditionVariableCS(&pool->wake, &pool->mutex, INFINITE);
+        }
+        job = pool->job;
+        LeaveCriticalSection(&pool->mutex);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->job == job && pool->quit == 0)
+        {
+            pthread_cond_wait(&pool->wake, &pool->mutex);
+        }
+        job = pool->job;
+        pthread_mutex_unlock(&pool->mutex);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+        if (pool->quit != 0)
+        {
+            break;
+        }
+
+        work->node = pool_node();
+
+        if (pool->kern == RT_NULL)
+        {
+            pool_fill(pool, work);
+        }
+        else
+        {
+            pool_clone(pool, work->info, pool->tmpl);
+            pool_steal(pool, work);
+        }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+        EnterCriticalSection(&pool->mutex);
+        if (--pool->n_run == 0)
+        {
+            WakeConditionVariable(&pool->done);
+        }
+        LeaveCriticalSection(&pool->mutex);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->n_run == 0)
+        {
+            pthread_cond_signal(&pool->done);
+        }
+        pthread_mutex_unlock(&pool->mutex);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+    }
+}
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+/*
+ * Worker thread entry point.
+ */
+static
+DWORD WINAPI pool_thread(LPVOID arg)
+{
+    pool_loop((rt_SIMD_WORK *)arg);
+
+    return 0;
+}
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+/*
+ * Worker thread entry point.
+ */
+static
+rt_pntr pool_thread(rt_pntr arg)
+{
+    pool_loop((rt_SIMD_WORK *)arg);
+
+    return RT_NULL;
+}
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/*
+ * Start "n_thr" worker threads on the last contexts of the pool,
+ * which are marked busy, returns the number of threads or 0 on failure.
+ */
+static
+rt_si32 pool_team(rt_SIMD_POOL *pool, rt_si32 n_thr)
+{
+    rt_SIMD_WORK *work;
+    rt_si32 k, n;
+
+    if (pool->n_thr != 0 || n_thr <= 0 || n_thr > pool->n_ctx)
+    {
+        return 0;
+    }
+
+    pool->work = (rt_byte *)heap_alloc(n_thr * RT_POOL_ALIGN);
+
+    if (pool->work == RT_NULL)
+    {
+        return 0;
+    }
+
+    memset(pool->work, 0, n_thr * RT_POOL_ALIGN);
+
+    pool_lock(&pool->lock);
+
+    for (k = 0, n = pool->n_ctx - n_thr; k < n_thr; k++)
+    {
+        pool->busy[n + k] = 1;
+
+        work = pool_work(pool, k);
+        work->pool = pool;
+        work->info = pool_info(pool, n + k);
+        work->node = -1;
+    }
+
+    pool_unlock(&pool->lock);
+
+    pool->n_run = 0;
+    pool->job = 0;
+    pool->quit = 0;
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    InitializeCriticalSection(&pool->mutex);
+    InitializeConditionVariable(&pool->wake);
+    InitializeConditionVariable(&pool->done);
+
+    for (k = 0; k < n_thr; k++)
+    {
+        work = pool_work(pool, k);
+        work->thread = CreateThread(NULL, 0, pool_thread, work, 0, NULL);
+
+        if (work->thread == NULL)
+        {
+            break;
+        }
+    }
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    for (k = 0; k < n_thr; k++)
+    {
+        work = pool_work(pool, k);
+
+        if (pthread_create(&work->thread, NULL, pool_thread, work) != 0)
+        {
+            break;
+        }
+    }
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+    /* keep the threads started so far, release contexts of the others */
+    pool->n_thr = k;
+
+    pool_lock(&pool->lock);
+
+    for (; k < n_thr; k++)
+    {
+        pool->busy[n + k] = 0;
+    }
+
+    pool_unlock(&pool->lock);
+
+    return pool->n_thr;
+}
+
+/*
+ * Pin worker k to CPU (cpu + k) modulo the number of CPUs,
+ * returns the number of workers pinned.
+ */
+static
+rt_si32 pool_pin(rt_SIMD_POOL *pool, rt_si32 cpu)
+{
+    rt_si32 k, c, n = 0, m = pool_cpus();
+
+    for (k = 0; k < pool->n_thr; k++)
+    {
+        c = (cpu + k) % m;
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+        if (c < (rt_si32)sizeof(DWORD_PTR) * 8
+        &&  SetThreadAffinityMask(pool_work(pool, k)->thread,
+                                  (DWORD_PTR)1 << c) != 0)
+        {
+            n++;
+        }
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+#ifdef CPU_SET
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(c, &set);
+
+        if (pthread_setaffinity_np(pool_work(pool, k)->thread,
+                                   sizeof(set), &set) == 0)
+        {
+            n++;
+        }
+
+#endif /* CPU_SET */
+
+#endif /* ------------- OS specific ----------------------------------------- */
+    }
+
+    return n;
+}
+
+/*
+ * Set up chunks of the next job, the grain is rounded up so that chunks
+ * start at RT_SIMD_ALIGN in all arrays, returns the number of chunks.
+ */
+static
+rt_si32 pool_split(rt_SIMD_POOL *pool, rt_FUNC_POOL kern,
+                   rt_SIMD_INFO *info, rt_si32 n_elm, rt_si32 grain)
+{
+    rt_si32 k, u;
+
+    for (k = 0, u = 1; k < pool->n_arr; k++)
+    {
+        if (pool->arr_elm[k] < RT_SIMD_ALIGN)
+        {
+            u = RT_MAX(u, (rt_si32)(RT_SIMD_ALIGN / pool->arr_elm[k]));
+        }
+    }
+
+    if (grain <= 0)
+    {
+        grain = n_elm / (RT_MAX(pool->n_thr, 1) * RT_POOL_SPLIT);
+    }
+
+    pool->kern = kern;
+    pool->tmpl = info;
+    pool->n_elm = RT_MAX(n_elm, 0);
+    pool->grain = RT_MAX(((grain + u - 1) / u) * u, u);
+    pool->n_chk = (pool->n_elm + pool->grain - 1) / pool->grain;
+
+    return pool->n_chk;
+}
+
+/*
+ * Wake up workers to run the job, wait for all of them to complete.
+ */
+static
+rt_void pool_job(rt_SIMD_POOL *pool)
+{
+    rt_SIMD_WORK *work;
+    rt_si32 k;
+
+    for (k = 0; k < pool->n_thr; k++)
+    {
+        work = pool_work(pool, k);
+        work->beg = pool_first(pool, k + 0);
+        work->end = pool_first(pool, k + 1);
+    }
+
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+    EnterCriticalSection(&pool->mutex);
+    pool->n_run = pool->n_thr;
+    pool->job++;
+    WakeAllConditionVariable(&pool->wake);
+    while (pool->n_run != 0)
+    {
+        SleepConditionVariableCS(&pool->done, &pool->mutex, INFINITE);
+    }
+    LeaveCriticalSection(&pool->mutex);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->n_run = pool->n_thr;
+    pool->job++;
+    pthread_cond_broadcast(&pool->wake);
+    while (pool->n_run != 0)
+    {
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+}
+
+/*
+ * Run kernel over "n_elm" elements split into chunks of "grain" elements
+ * (0 for default), array fields of the template registered with pool_array
+ * are rebased to chunks in workers' clones, the count field is set to the
+ * length of the chunk. Returns when all chunks are complete with the number
+ * of chunks run, 0 if there is no team and no free context to run them in
+ * (the kernel is then not run at all, take the template with pool_take).
+ */
+static
+rt_si32 parallel_for(rt_SIMD_POOL *pool, rt_FUNC_POOL kern,
+                     rt_SIMD_INFO *info, rt_si32 n_elm, rt_si32 grain)
+{
+    rt_si32 k, n = pool_split(pool, kern, info, n_elm, grain);
+
+    if (n == 0)
+    {
+        return 0;
+    }
+
+    /* no team, run chunks in the calling thread */
+    if (pool->n_thr == 0)
+    {
+        rt_SIMD_INFO *own = pool_take(pool);
+
+        if (own == RT_NULL)
+        {
+            return 0;
+        }
+
+        pool_clone(pool, own, info);
+
+        for (k = 0; k < n; k++)
+        {
+            pool_chunk(pool, own, k);
+        }
+
+        pool_give(pool, own);
+
+        return n;
+    }
+
+    pool_job(pool);
+
+    return n;
+}
+
+/*
+ * Zero fresh arrays of the template (registered with pool_array) chunk by
+ * chunk from the workers which own these chunks in parallel_for with
+ * the same "n_elm" and "grain", or from their peers on a different node
+ * if "remote" is set, so that pages are placed on the corresponding nodes
+ * by the first-touch policy. Pin the workers beforehand with pool_pin.
+ * Returns the number of chunks touched (as parallel_for).
+ */
+static
+rt_si32 pool_touch(rt_SIMD_POOL *pool, rt_SIMD_INFO *info,
+                   rt_si32 n_elm, rt_si32 grain, rt_bool remote)
+{
+    rt_si32 n;
+
+    /* empty job first, so that nodes of all workers are known */
+    if (remote && pool->n_thr != 0)
+    {
+        pool_split(pool, RT_NULL, info, 0, grain);
+        pool_job(pool);
+    }
+
+    pool->remote = remote;
+
+    n = parallel_for(pool, RT_NULL, info, n_elm, grain);
+
+    pool->remote = RT_FALSE;
+
+    return n;
+}
+
+/*
+ * Percent of pages of the arrays of the template (registered with pool_array)
+ * which are on the nodes of the workers owning them in parallel_for with
+ * the same "n_elm" and "grain", returns -1 if nodes are unknown.
+ */
+static
+rt_si32 pool_local(rt_SIMD_POOL *pool, rt_SIMD_INFO *info,
+                   rt_si32 n_elm, rt_si32 grain)
+{
+    rt_byte *ptr, *end;
+    rt_size page = (rt_size)heap_arena.page;
+    rt_si32 c, k, o, m, node, n_loc = 0, n_all = 0;
+
+    pool_split(pool, pool->kern, info, n_elm, grain);
+
+    for (o = 0; o < RT_MAX(pool->n_thr, 1); o++)
+    {
+        node = pool->n_thr != 0 ? pool_work(pool, o)->node : pool_node();
+
+        for (c = pool_first(pool, o); c < pool_first(pool, o + 1); c++)
+        {
+            for (k = 0; k < pool->n_arr; k++)
+            {
+                ptr = *(rt_byte **)((rt_byte *)info + pool->arr_off[k])
+                                 + c * pool->grain * pool->arr_elm[k];
+                end = ptr + RT_MIN(pool->grain, pool->n_elm - c * pool->grain)
+                                                      * pool->arr_elm[k];
+
+                ptr = (rt_byte *)((rt_uptr)ptr & ~(rt_uptr)(page - 1));
+
+                for (; ptr < end; ptr += page, n_all++)
+                {
+                    m = heap_node(ptr);
+
+                    if (node < 0 || m < 0)
+                    {
+                        return -1;
+                    }
+
+                    n_loc += m == node;
+                }
+            }
+        }
+    }
+
+    return n_all != 0 ? (rt_si32)(((rt_full)n_loc * 100) / n_all) : -1;
+}
+
+/*
+ * Stop worker threads (if any) and release all contexts.
+ */
+static
+rt_void pool_done(rt_SIMD_POOL *pool)
+{
+    rt_si32 k;
+
+    if (pool->work != RT_NULL)
+    {
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+
+        EnterCriticalSection(&pool->mutex);
+        pool->quit = 1;
+        WakeAllConditionVariable(&pool->wake);
+        LeaveCriticalSection(&pool->mutex);
+
+        for (k = 0; k < pool->n_thr; k++)
+        {
+            WaitForSingleObject(pool_work(pool, k)->thread, INFINITE);
+            CloseHandle(pool_work(pool, k)->thread);
+        }
+
+        DeleteCriticalSection(&pool->mutex);
+
+#else /* --- Linux, GCC ----------------------------------------------------- */
+
+        pthread_mutex_lock(&pool->mutex);
+        pool->quit = 1;
+        pthread_cond_broadcast(&pool->wake);
+        pthread_mutex_unlock(&pool->mutex);
+
+        for (k = 0; k < pool->n_thr; k++)
+        {
+            pthread_join(pool_work(pool, k)->thread, NULL);
+        }
+
+        pthread_cond_destroy(&pool->done);
+        pthread_cond_destroy(&pool->wake);
+        pthread_mutex_destroy(&pool->mutex);
+
+#endif /* ------------- OS specific ----------------------------------------- */
+
+        heap_free(pool->work);
+
+        pool->work = RT_NULL;
+        pool->n_thr = 0;
+    }
+
+    for (k = 0; k < pool->n_ctx; k++)
+    {
+        ASM_DONE(pool_info(pool, k))
+    }
+
+    heap_free(pool->busy);
+    heap_free(pool->mem);
+
+    pool->mem  = RT_NULL;
+    pool->busy = RT_NULL;
+    pool->n_ctx = 0;
+}
+
+#endif /* RT_RTPOOL_H */
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
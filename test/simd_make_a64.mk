@@ -8,10 +8,12 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
 
 
 build: build_a64 build_a64sve
+jit: build_a64jit
 clang: clang_a64 clang_a64sve
 
 strip:
@@ -95,6 +97,34 @@ simd_test_a64f64sve:
         ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.a64f64sve
 
 
+build_a64jit: simd_test_a64_32jit simd_test_a64_64jit \
+              simd_test_a64f32jit simd_test_a64f64jit
+
+simd_test_a64_32jit:
+	aarch64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_A64 -DRT_128=1 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.a64_32jit
+
+simd_test_a64_64jit:
+	aarch64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_A64 -DRT_256=1 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.a64_64jit
+
+simd_test_a64f32jit:
+	aarch64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_A64 -DRT_512=4 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.a64f32jit
+
+simd_test_a64f64jit:
+	aarch64-linux-gnu-g++ -O3 -g -static \
+        -DRT_LINUX -DRT_A64 -DRT_1K4=1 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+        ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.a64f64jit
+
+
 clang_a64: simd_test.a64_32 simd_test.a64_64 simd_test.a64f32 simd_test.a64f64
 
 simd_test.a64_32:
@@ -8,10 +8,14 @@ SRC_LIST =                              \
 LIB_PATH =
 
 LIB_LIST =                              \
-        -lm
+        -lm                             \
+        -lpthread
 
 
 build: build_x64 build_x64avx build_x64avx512
+jit: build_x64jit
+math: build_x64math
+multi: build_x64multi
 clang: clang_x64 clang_x64avx clang_x64avx512
 
 strip:
@@ -124,6 +128,94 @@ simd_test_x64f64avx512:
       ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64avx512
 
 
+build_x64jit: simd_test_x64_32jit simd_test_x64_64jit \
+              simd_test_x64f32jit simd_test_x64f64jit
+
+simd_test_x64_32jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_SIMD_COMPAT_SSE=2 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32jit
+
+simd_test_x64_64jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64jit
+
+simd_test_x64f32jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256_R8=4 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f32jit
+
+simd_test_x64f64jit:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 -DRT_CODE_GEN=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64jit
+
+
+build_x64math: simd_test_x64_32math simd_test_x64_64math \
+               simd_test_x64f32math simd_test_x64f64math
+
+simd_test_x64_32math:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_SIMD_COMPAT_SSE=2 -DRT_DEBUG=0 -DRT_MATH_SCALAR=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_32math
+
+simd_test_x64_64math:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 -DRT_MATH_SCALAR=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=32 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64_64math
+
+simd_test_x64f32math:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 -DRT_MATH_SCALAR=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f32math
+
+simd_test_x64f64math:
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 -DRT_MATH_SCALAR=1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=64 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} ${LIB_PATH} ${LIB_LIST} -o simd_test.x64f64math
+
+
+build_x64multi: simd_test_x64multi
+
+# same code-base built for each target in its own namespace (RT_NAMESPACE),
+# targets need to match the list in simd_multi.cpp (dispatcher)
+simd_test_x64multi:
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 -DRT_NAMESPACE=simd_128v4 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64multi_128v4.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=1 -DRT_DEBUG=0 -DRT_NAMESPACE=simd_256v1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64multi_256v1.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_256=2 -DRT_DEBUG=0 -DRT_NAMESPACE=simd_256v2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64multi_256v2.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=1 -DRT_DEBUG=0 -DRT_NAMESPACE=simd_512v1 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64multi_512v1.o
+	g++ -O3 -g -c \
+        -DRT_LINUX -DRT_X64 -DRT_512=2 -DRT_DEBUG=0 -DRT_NAMESPACE=simd_512v2 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} ${SRC_LIST} -o simd_test.x64multi_512v2.o
+	g++ -O3 -g \
+        -DRT_LINUX -DRT_X64 -DRT_128=4 -DRT_DEBUG=0 \
+        -DRT_POINTER=64 -DRT_ADDRESS=64 -DRT_ELEMENT=32 -DRT_ENDIAN=0 \
+      ${INC_PATH} simd_multi.cpp simd_test.x64multi_*.o \
+      ${LIB_PATH} ${LIB_LIST} -o simd_test.x64multi
+
+
 clang_x64: simd_test.x64_32 simd_test.x64_64 simd_test.x64f32 simd_test.x64f64
 
 simd_test.x64_32:
@@ -232,6 +324,10 @@ simd_test.x64f64avx512:
 # sde64 -hsw -- ./simd_test.x64f32avx -c 1
 # sde64 -skx -- ./simd_test.x64f32avx512 -c 1
 # Use "-c 1" option to reduce test time when emulating with Intel SDE
+#
+# Compiling/running multi-target SIMD test (picks the widest supported):
+# make -f simd_make_x64.mk multi
+# ./simd_test.x64multi -c 1
 
 # Clang native build works too (takes much longer prior to 3.8), use (replace):
 # clang++ (in place of g++)
@@ -0,0 +1,174 @@
+/******************************************************************************/
+/* Copyright (c) 2013-2026 VectorChief (at github, bitbucket, sourceforge)    */
+/* Distributed under the MIT software license, see the accompanying           */
+/* file COPYING or http://www.opensource.org/licenses/mit-license.php         */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+/*
+ * simd_multi.cpp: Multi-target dispatcher for the SIMD test framework.
+ *
+ * The same portable code-base (simd_test.cpp) is compiled once per target
+ * with a set of flags for that target and wrapped into a target-specific
+ * namespace given by RT_NAMESPACE (check the multi-target makefile rules).
+ * This file is then built for the baseline target of the architecture,
+ * determines supported SIMD targets at runtime with verxx_xx, selects
+ * the widest target available in the binary using mask_init/from_mask
+ * and passes control to it through a table of entry points.
+ *
+ * Only BASE instructions are used here, therefore RT_SIMD_CODE is not set.
+ */
+#include "rtbase.h"
+
+/******************************************************************************/
+/*******************************   DEFINITIONS   ******************************/
+/******************************************************************************/
+
+#define RT_LOGI             printf
+#define RT_LOGE             printf
+
+#define MASK                (RT_SIMD_ALIGN - 1) /* SIMD alignment mask */
+
+/*
+ * List of targets compiled into the multi-target binary (namespace, simd),
+ * "simd" parameters are given in the format of mask_init input:
+ * SIMD native-size (1,..,16) in 0th (lowest) byte  <- number of 128-bit chunks
+ * SIMD type (1,2,4,8, 16,32) in 1st (higher) byte  <- in format for given size
+ * SIMD size-factor (1, 2, 4) in 2nd (higher) byte  <- register = size * factor
+ * The list needs to match the target objects linked in the makefile.
+ */
+#if   (defined RT_X64)
+
+#define RT_TARGET_LIST(TARGET)                                              \
+        TARGET(simd_128v4,  (1 << 16) | (4 << 8) | 1)   /* SSE4 */          \
+        TARGET(simd_256v1,  (1 << 16) | (1 << 8) | 2)   /* AVX1 */          \
+        TARGET(simd_256v2,  (1 << 16) | (2 << 8) | 2)   /* AVX2 */          \
+        TARGET(simd_512v1,  (1 << 16) | (1 << 8) | 4)   /* AVX512F */       \
+        TARGET(simd_512v2,  (1 << 16) | (2 << 8) | 4)   /* AVX512DQ */
+
+#else  /* report an error if the list of targets is not configured */
+#error "multi-target build isn't configured for this architecture"
+#endif /* RT_X64 */
+
+/******************************************************************************/
+/***************************   VARS, FUNCS, TYPES   ***************************/
+/******************************************************************************/
+
+typedef rt_si32 (*testMAIN)(rt_si32 argc, rt_char *argv[]);
+
+typedef rt_void (*testVER)(rt_SIMD_INFO *);
+
+/*
+ * Entry points of target-specific namespaces.
+ */
+#define RT_TARGET_DECL(ns, simd)                                            \
+namespace ns                                                                \
+{                                                                           \
+    rt_si32 main(rt_si32 argc, rt_char *argv[]);                            \
+}
+
+RT_TARGET_LIST(RT_TARGET_DECL)
+
+/*
+ * Table of targets compiled into the binary.
+ */
+struct rt_SIMD_TARGET
+{
+    rt_pstr name;           /* namespace of the target */
+    rt_si32 simd;           /* SIMD parameters in mask_init format */
+    testMAIN main;          /* entry point of the target */
+};
+
+#define RT_TARGET_ITEM(ns, simd)                                            \
+    { #ns, simd, ns::main },
+
+rt_SIMD_TARGET t_list[] =
+{
+    RT_TARGET_LIST(RT_TARGET_ITEM)
+};
+
+/*
+ * Determine supported SIMD targets in rt_SIMD_INFO->ver format.
+ * ASM section is kept in a separate non-inlined function (as in simd_test).
+ */
+rt_void simd_version(rt_SIMD_INFO *s_inf)
+{
+    ASM_ENTER(s_inf)
+        verxx_xx()
+    ASM_LEAVE(s_inf)
+}
+
+volatile
+testVER v_simd = simd_version;
+
+/******************************************************************************/
+/**********************************   MAIN   **********************************/
+/******************************************************************************/
+
+rt_si32 main(rt_si32 argc, rt_char *argv[])
+{
+    rt_si32 k, n = -1, size = 0, simd = 0, mask, ver;
+
+    rt_pntr info = malloc(sizeof(rt_SIMD_INFO) + MASK);
+    rt_SIMD_INFO *inf0 = (rt_SIMD_INFO *)(((rt_full)info + MASK) & ~MASK);
+
+    rt_pntr regs = malloc(sizeof(rt_SIMD_REGS) + MASK);
+    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(((rt_full)regs + MASK) & ~MASK);
+
+    if (info == RT_NULL || regs == RT_NULL)
+    {
+        RT_LOGE("alloc failed with NULL address, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ASM_INIT(inf0, reg0)
+
+    v_simd(inf0);
+    ver = (rt_si32)inf0->ver;
+
+    ASM_DONE(inf0)
+
+    free(regs);
+    free(info);
+
+    /* pick the widest supported target, later entries win the ties */
+    for (k = 0; k < (rt_si32)RT_ARR_SIZE(t_list); k++)
+    {
+        mask = mask_init(t_list[k].simd) & ver;
+
+        if (mask == 0)
+        {
+            continue;
+        }
+
+        mask = from_mask(mask);
+
+        if ((mask & 0xFF) * ((mask >> 16) & 0xFF) >= size)
+        {
+            size = (mask & 0xFF) * ((mask >> 16) & 0xFF);
+            simd = mask;
+            n = k;
+        }
+    }
+
+    RT_LOGI("--------------------------------------------------------\n");
+    RT_LOGI("Supported SIMD targets (ver): 0x%08X\n", ver);
+
+    if (n < 0)
+    {
+        RT_LOGI("None of the compiled SIMD targets is supported, exiting...\n");
+        return EXIT_FAILURE;
+    }
+
+    RT_LOGI("Selected SIMD target: %s (%dx%dv%d)\n", t_list[n].name,
+            (simd & 0xFF) * 128, (simd >> 16) & 0xFF, (simd >> 8) & 0xFF);
+
+    return t_list[n].main(argc, argv);
+}
+
+/******************************************************************************/
+/******************************************************************************/
+/******************************************************************************/
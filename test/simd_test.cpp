@@ -8,6 +8,32 @@
 #include <string.h>
 #include <stdio.h>
 
+/* system headers used by rtheap.h/rtpool.h are included ahead of rtbase.h
+ * as short names defined there may collide with them (mostly windows.h) */
+#if   (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC - */
+#include <windows.h>
+#else /* --- Linux, GCC ----------------------------------------------------- */
+#include <sys/time.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#endif /* ------------- OS specific ----------------------------------------- */
+
+/* multi-target build (simd_multi.cpp) compiles this file once per target
+ * wrapping it into a namespace given by RT_NAMESPACE from the makefile,
+ * system headers are included beforehand to keep them in global scope */
+#ifdef RT_NAMESPACE
+
+#include <math.h>
+#include <float.h>
+
+namespace RT_NAMESPACE
+{
+
+#endif /* RT_NAMESPACE */
+
 #define RT_SIMD_CODE /* enable SIMD instruction definitions */
 #define RT_BASE_TEST /* enable BASE instruction sub-tests */
 #define RT_ELEM_TEST /* enable ELEM instruction sub-tests (scalar SIMD) */
@@ -37,16 +63,16 @@
 
 /*
  * RT_OFFS_DATA is intended for testing different displacement levels locally.
- * 0x060 - 1/8  DP-level  (9-bit displacements) has not been exceeded (Q=1).
- * 0x260 - 1/4  DP-level (10-bit displacements) has not been exceeded (Q=1).
- * 0x660 - 1/2  DP-level (11-bit displacements) has not been exceeded (Q=1).
- * 0xE60 - full DP-level (12-bit displacements) has not been exceeded (Q=1).
- * 0x1E60  full DE-level (13-bit displacements) has not been exceeded (Q=1).
- * 0x3E60  full DF-level (14-bit displacements) has not been exceeded (Q=1).
- * 0x7E60  full DG-level (15-bit displacements) has not been exceeded (Q=1).
- * 0xFE60  full DH-level (16-bit displacements) has not been exceeded (Q=1).
+ * 0x010 - 1/8  DP-level  (9-bit displacements) has not been exceeded (Q=1).
+ * 0x210 - 1/4  DP-level (10-bit displacements) has not been exceeded (Q=1).
+ * 0x610 - 1/2  DP-level (11-bit displacements) has not been exceeded (Q=1).
+ * 0xE10 - full DP-level (12-bit displacements) has not been exceeded (Q=1).
+ * 0x1E10  full DE-level (13-bit displacements) has not been exceeded (Q=1).
+ * 0x3E10  full DF-level (14-bit displacements) has not been exceeded (Q=1).
+ * 0x7E10  full DG-level (15-bit displacements) has not been exceeded (Q=1).
+ * 0xFE10  full DH-level (16-bit displacements) has not been exceeded (Q=1).
  * NOTE: the offset value must be divisible by 16 in order for code to work.
- * NOTE: the built-in rt_SIMD_INFO structure is already filled at full 1/16th.
+ * NOTE: the built-in rt_SIMD_INFO structure is filled a bit over 1/16th.
  */
 #define RT_OFFS_DATA        0x000 /* test different displacement levels */
 #define RT_OFFS_SIMD        (RT_OFFS_DATA/16) /* number of quads in offset */
@@ -59,30 +85,30 @@
  * 4 - means 1/4  DP-level (10-bit displacements) has not been exceeded (Q=1).
  * 8 - means 1/8  DP-level  (9-bit displacements) has not been exceeded (Q=1).
  * 16  means 1/16 DP-level  (8-bit displacements) has not been exceeded (Q=1).
- * NOTE: the built-in rt_SIMD_INFO structure is already filled at full 1/16th.
+ * NOTE: the built-in rt_SIMD_INFO structure is filled a bit over 1/16th.
  */
-#if     RT_OFFS_DATA <= 0x060
+#if     RT_OFFS_DATA <= 0x010
 #define DS DP
 #define RT_DATA 8
-#elif   RT_OFFS_DATA <= 0x260
+#elif   RT_OFFS_DATA <= 0x210
 #define DS DP
 #define RT_DATA 4
-#elif   RT_OFFS_DATA <= 0x660
+#elif   RT_OFFS_DATA <= 0x610
 #define DS DP
 #define RT_DATA 2
-#elif   RT_OFFS_DATA <= 0xE60
+#elif   RT_OFFS_DATA <= 0xE10
 #define DS DP
 #define RT_DATA 1
-#elif   RT_OFFS_DATA <= 0x1E60
+#elif   RT_OFFS_DATA <= 0x1E10
 #define DS DE
 #define RT_DATA 1
-#elif   RT_OFFS_DATA <= 0x3E60
+#elif   RT_OFFS_DATA <= 0x3E10
 #define DS DF
 #define RT_DATA 1
-#elif   RT_OFFS_DATA <= 0x7E60
+#elif   RT_OFFS_DATA <= 0x7E10
 #define DS DG
 #define RT_DATA 1
-#elif   RT_OFFS_DATA <= 0xFE60
+#elif   RT_OFFS_DATA <= 0xFE10
 #define DS DH
 #define RT_DATA 1
 #else /* RT_OFFS_DATA > 0xFFFF */
@@ -91,15 +117,22 @@
 #endif /* RT_OFFS_DATA */
 
 #include "rtbase.h"
+#include "rtpool.h"
 
 /******************************************************************************/
 /*******************************   DEFINITIONS   ******************************/
 /******************************************************************************/
 
-#define SUB_TEST            51
+#define SUB_TEST            69
 #define CYC_SIZE            1000000
 
 #define ARR_SIZE            S*3 /* hardcoded in ASM sections, S = SIMD elems */
+#define BW_SIZE             (48*1024*1024) /* bandwidth buffer, above LLC */
+#define BW_LOOP             (64/Q) /* array copies per call (in bandwidth) */
+#define TLB_STEP            (0x1000 + Q*0x10) /* next page, next SIMD vector */
+#define TLB_LOOP            16 /* pages per call (in TLB benchmark) */
+#define PAR_SIZE            (256*1024) /* slab per call (in parallel-for) */
+#define PAR_GRAIN           (8*1024) /* bytes per chunk (in parallel-for) */
 #define MASK                (RT_SIMD_ALIGN - 1) /* SIMD alignment mask */
 
 /* NOTE: floating point values are not tested for equality precisely due to
@@ -116,6 +149,9 @@
 #define FEQ(f1, f2)         (RT_FABS((f1) - (f2)) <= t_diff *               \
                              RT_MIN(FRK(f1), FRK(f2)))
 
+/* subtest "t" (numbered from 1) is within the range given by -b/-e */
+#define SUB_RUN(t)          (n_init <= (t)-1 && (t)-1 <= n_done)
+
 #define RT_LOGI             printf
 #define RT_LOGE             printf
 
@@ -128,6 +164,8 @@ rt_si32     n_done      = SUB_TEST-1;   /* subtest-done (from command-line) */
 rt_si32     t_diff      = 2;          /* diff-threshold (from command-line) */
 rt_si32     r_test      = CYC_SIZE;   /* test-redundant (from command-line) */
 rt_bool     v_mode      = RT_FALSE;     /* verbose mode (from command-line) */
+rt_si32     n_work      = 0;          /* worker-threads (from command-line) */
+rt_bool     p_mode      = RT_FALSE;     /* pin threads (from command-line) */
 
 /*
  * Get system time in milliseconds.
@@ -144,91 +182,159 @@ rt_pntr sys_alloc(rt_size size);
  */
 rt_void sys_free(rt_pntr ptr, rt_size size);
 
+/*
+ * Allocate memory from system heap backed by huge pages (if available).
+ */
+rt_pntr sys_huge(rt_size size);
+
+/*
+ * Get size of pages backing memory from system heap.
+ */
+rt_si32 sys_page(rt_pntr ptr);
+
 /*
  * Extended SIMD info structure for ASM_ENTER/ASM_LEAVE
  * serves as a container for test arrays and internal variables.
- * Note that DP offsets below start where rt_SIMD_INFO ends (at Q*0x100).
+ * Note that DP offsets below start where rt_SIMD_INFO ends (RT_OFFS_INFO).
  * SIMD width is taken into account via S and Q from rtbase.h
  */
+#define RT_OFFS_INFO        RT_SIMD_INFO_SIZE /* Q*0x130 */
+
 struct rt_SIMD_INFOX : public rt_SIMD_INFO
 {
 #if RT_OFFS_SIMD != 0
 
     rt_elem pad01[S*RT_OFFS_SIMD];
-#define inf_PAD01           DS(Q*0x100)
+#define inf_PAD01           DS(RT_OFFS_INFO)
 
 #endif /* RT_OFFS_SIMD */
 
     /* internal variables */
 
     rt_si32 cyc;
-#define inf_CYC             DS(Q*0x100 + Q*RT_OFFS_DATA + 0x000)
+#define inf_CYC             DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x000)
 
     rt_si32 loc;
-#define inf_LOC             DS(Q*0x100 + Q*RT_OFFS_DATA + 0x004)
+#define inf_LOC             DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x004)
 
     rt_si32 size;
-#define inf_SIZE            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x008)
+#define inf_SIZE            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x008)
 
     rt_si32 simd;
-#define inf_SIMD            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x00C)
+#define inf_SIMD            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x00C)
 
     rt_pntr label;
-#define inf_LABEL           DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x000*P)
+#define inf_LABEL           DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x000*P)
 
     rt_pntr tail;
-#define inf_TAIL            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x004*P)
+#define inf_TAIL            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x004*P)
 
     /* floating point arrays */
 
     rt_real*far0;
-#define inf_FAR0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x008*P+E)
+#define inf_FAR0            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x008*P+E)
 
     rt_real*fco1;
-#define inf_FCO1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x00C*P+E)
+#define inf_FCO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x00C*P+E)
 
     rt_real*fco2;
-#define inf_FCO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x010*P+E)
+#define inf_FCO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x010*P+E)
 
     rt_real*fso1;
-#define inf_FSO1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x014*P+E)
+#define inf_FSO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x014*P+E)
 
     rt_real*fso2;
-#define inf_FSO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x018*P+E)
+#define inf_FSO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x018*P+E)
 
     /* integer arrays */
 
     rt_elem*iar0;
-#define inf_IAR0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x01C*P+E)
+#define inf_IAR0            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x01C*P+E)
 
     rt_elem*ico1;
-#define inf_ICO1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x020*P+E)
+#define inf_ICO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x020*P+E)
 
     rt_elem*ico2;
-#define inf_ICO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x024*P+E)
+#define inf_ICO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x024*P+E)
 
     rt_elem*iso1;
-#define inf_ISO1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x028*P+E)
+#define inf_ISO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x028*P+E)
 
     rt_elem*iso2;
-#define inf_ISO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x02C*P+E)
+#define inf_ISO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x02C*P+E)
 
     /* half-int arrays */
 
     rt_half*har0;
-#define inf_HAR0            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x030*P+E)
+#define inf_HAR0            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x030*P+E)
 
     rt_half*hco1;
-#define inf_HCO1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x034*P+E)
+#define inf_HCO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x034*P+E)
 
     rt_half*hco2;
-#define inf_HCO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x038*P+E)
+#define inf_HCO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x038*P+E)
 
     rt_half*hso1;
-#define inf_HSO1            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x03C*P+E)
+#define inf_HSO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x03C*P+E)
 
     rt_half*hso2;
-#define inf_HSO2            DS(Q*0x100 + Q*RT_OFFS_DATA + 0x010+0x040*P+E)
+#define inf_HSO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x040*P+E)
+
+    /* S-side of bandwidth, page-size and parallel-for buffers (in ASM) */
+
+    rt_real*fbs1;
+#define inf_FBS1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x044*P+E)
+
+    rt_real*fbs2;
+#define inf_FBS2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x048*P+E)
+
+    rt_real*fbi3;
+#define inf_FBI3            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x04C*P+E)
+
+    rt_real*fbo3;
+#define inf_FBO3            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x050*P+E)
+
+    rt_si32 bso1;
+#define inf_BSO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x010+0x054*P)
+
+    rt_si32 bso2;
+#define inf_BSO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x014+0x054*P)
+
+    /* C-side of the buffers above, NUMA-placed buffers and the pool
+     * are only used in C code, so they don't count into the load-level */
+
+    rt_real*fbc1;
+#define inf_FBC1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x018+0x054*P+E)
+
+    rt_real*fbc2;
+#define inf_FBC2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x018+0x058*P+E)
+
+    rt_real*fbc4;
+#define inf_FBC4            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x018+0x05C*P+E)
+
+    rt_real*fbs4;
+#define inf_FBS4            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x018+0x060*P+E)
+
+    rt_SIMD_POOL *pool;
+#define inf_POOL            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x018+0x064*P+E)
+
+    rt_si32 bco1;
+#define inf_BCO1            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x018+0x068*P)
+
+    rt_si32 bco2;
+#define inf_BCO2            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x01C+0x068*P)
+
+    rt_si32 bco3;
+#define inf_BCO3            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x020+0x068*P)
+
+    rt_si32 bso3;
+#define inf_BSO3            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x024+0x068*P)
+
+    rt_si32 bco4;
+#define inf_BCO4            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x028+0x068*P)
+
+    rt_si32 bso4;
+#define inf_BSO4            DS(RT_OFFS_INFO + Q*RT_OFFS_DATA + 0x02C+0x068*P)
 
 };
 
@@ -279,6 +385,10 @@ rt_void s_test01(rt_SIMD_INFOX *info)
         movxx_ld(Redx, Mebp, inf_FSO1)
         movxx_ld(Rebx, Mebp, inf_FSO2)
 
+        prfxx_ld(Mecx, AJ0, L1)
+        prfxx_ld(Mecx, AJ1, L2)
+        prfxx_ld(Medx, AJ0, NT)
+
         movpx_ld(Xmm0, Mecx, AJ0)
         movpx_ld(Xmm1, Mecx, AJ1)
         movpx_rr(Xmm2, Xmm0)
@@ -3188,6 +3298,21 @@ rt_void s_test20(rt_SIMD_INFOX *info)
         movpx_rr(Xmm3, Xmm0)
         fmaps_rr(Xmm0, Xmm1, Xmm2)
         fmsps_rr(Xmm3, Xmm1, Xmm2)
+#if (defined RT_X32 || defined RT_X64) && (RT_SIMD == 128) && (RT_128X1 == 4) \
+ && (RT_SIMD_COMPAT_FMA == 3) && (RT_SIMD_COMPAT_FMS == 3) /* aliased G, S */
+        movpx_rr(Xmm4, Xmm1)
+        movpx_rr(Xmm5, Xmm1)
+        fmaps_rr(Xmm4, Xmm4, Xmm2)
+        fmaps_rr(Xmm5, Xmm1, Xmm2)
+        ceqps_rr(Xmm4, Xmm5)
+        andpx_rr(Xmm0, Xmm4)
+        movpx_rr(Xmm4, Xmm2)
+        movpx_rr(Xmm5, Xmm2)
+        fmsps_rr(Xmm4, Xmm1, Xmm4)
+        fmsps_rr(Xmm5, Xmm1, Xmm2)
+        ceqps_rr(Xmm4, Xmm5)
+        andpx_rr(Xmm3, Xmm4)
+#endif /* RT_SIMD: 128, RT_SIMD_COMPAT_FMA/FMS == 3 */
         movpx_st(Xmm0, Medx, AJ0)
         movpx_st(Xmm3, Mebx, AJ0)
 #ifdef RT_FP16_TEST
@@ -3226,6 +3351,21 @@ rt_void s_test20(rt_SIMD_INFOX *info)
         movpx_rr(Xmm3, Xmm0)
         fmaps_ld(Xmm0, Xmm1, Mecx, AJ0)
         fmsps_ld(Xmm3, Xmm1, Mecx, AJ0)
+#if (defined RT_X32 || defined RT_X64) && (RT_SIMD == 128) && (RT_128X1 == 4) \
+ && (RT_SIMD_COMPAT_FMA == 3) && (RT_SIMD_COMPAT_FMS == 3) /* aliased G, S */
+        movpx_rr(Xmm4, Xmm1)
+        movpx_rr(Xmm5, Xmm1)
+        fmaps_ld(Xmm4, Xmm4, Mecx, AJ0)
+        fmaps_ld(Xmm5, Xmm1, Mecx, AJ0)
+        ceqps_rr(Xmm4, Xmm5)
+        andpx_rr(Xmm0, Xmm4)
+        movpx_rr(Xmm4, Xmm1)
+        movpx_rr(Xmm5, Xmm1)
+        fmsps_ld(Xmm4, Xmm4, Mecx, AJ0)
+        fmsps_ld(Xmm5, Xmm1, Mecx, AJ0)
+        ceqps_rr(Xmm4, Xmm5)
+        andpx_rr(Xmm3, Xmm4)
+#endif /* RT_SIMD: 128, RT_SIMD_COMPAT_FMA/FMS == 3 */
         movpx_st(Xmm0, Medx, AJ1)
         movpx_st(Xmm3, Mebx, AJ1)
 #ifdef RT_FP16_TEST
@@ -3929,9 +4069,17 @@ rt_void s_test25(rt_SIMD_INFOX *info)
         sqrps_rr(Xmm0, Xmm0)
         sqrps_rr(Xmm0, Xmm0)
         adhps_rr(Xmm3, Xmm0)
+        movpx_rr(Xmm7, Xmm0)
+        adhps_rr(Xmm7, Xmm7)
+        ceqps_rr(Xmm7, Xmm3)
+        andpx_rr(Xmm3, Xmm7)
         elmpx_st(Xmm3, Medx, AJ0)
         addxx_ri(Redx, IB(4*L))
         mlhps_rr(Xmm6, Xmm0)
+        movpx_rr(Xmm7, Xmm0)
+        mlhps_rr(Xmm7, Xmm7)
+        ceqps_rr(Xmm7, Xmm6)
+        andpx_rr(Xmm6, Xmm7)
         elmpx_st(Xmm6, Mebx, AJ0)
         addxx_ri(Rebx, IB(4*L))
 #endif /* RT_ELEM_TEST */
@@ -4087,9 +4235,17 @@ rt_void s_test26(rt_SIMD_INFOX *info)
 
         movpx_ld(Xmm0, Mecx, AJ2)
         mnhps_rr(Xmm3, Xmm0)
+        movpx_rr(Xmm7, Xmm0)
+        mnhps_rr(Xmm7, Xmm7)
+        ceqps_rr(Xmm7, Xmm3)
+        andpx_rr(Xmm3, Xmm7)
         elmpx_st(Xmm3, Medx, AJ0)
         addxx_ri(Redx, IB(4*L))
         mxhps_rr(Xmm6, Xmm0)
+        movpx_rr(Xmm7, Xmm0)
+        mxhps_rr(Xmm7, Xmm7)
+        ceqps_rr(Xmm7, Xmm6)
+        andpx_rr(Xmm6, Xmm7)
         elmpx_st(Xmm6, Mebx, AJ0)
         addxx_ri(Rebx, IB(4*L))
 #endif /* RT_ELEM_TEST */
@@ -7662,152 +7818,2491 @@ rt_void p_test51(rt_SIMD_INFOX *info)
 #endif /* SUB_TEST 51 */
 
 /******************************************************************************/
-/*********************************   TABLES   *********************************/
+/*******************************   SUB TEST 52   ******************************/
 /******************************************************************************/
 
-typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+#if SUB_TEST >= 52
 
-volatile
-testXX c_test[SUB_TEST] =
+rt_void c_test52(rt_SIMD_INFOX *info)
 {
-#if SUB_TEST >=  1
-    c_test01,
-#endif /* SUB_TEST  1 */
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >=  2
-    c_test02,
-#endif /* SUB_TEST  2 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >=  3
-    c_test03,
-#endif /* SUB_TEST  3 */
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[j] * far0[(j + S) % n] + far0[j];
+        fco2[j] = far0[j] * far0[(j + S) % n] - far0[j];
+    }
+}
 
-#if SUB_TEST >=  4
-    c_test04,
-#endif /* SUB_TEST  4 */
+/*
+ * ASM_ENTER_LITE/ASM_LEAVE_LITE save/load only the registers from the masks,
+ * which makes them a better fit for short sections called very often.
+ * All registers used in the section (including temporary) must be listed.
+ */
+rt_void s_test52(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER_LITE(info, RT_BASE_RECX | RT_BASE_REDX | RT_BASE_REBX,
+                         RT_SIMD_XMM0 | RT_SIMD_XMM1 | RT_SIMD_XMM2)
 
-#if SUB_TEST >=  5
-    c_test05,
-#endif /* SUB_TEST  5 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
 
-#if SUB_TEST >=  6
-    c_test06,
-#endif /* SUB_TEST  6 */
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        mulps_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm1)
+        addps_rr(Xmm2, Xmm0)
+        subps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm2, Medx, AJ0)
+        movpx_st(Xmm1, Mebx, AJ0)
 
-#if SUB_TEST >=  7
-    c_test07,
-#endif /* SUB_TEST  7 */
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_ld(Xmm1, Mecx, AJ2)
+        mulps_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm1)
+        addps_rr(Xmm2, Xmm0)
+        subps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm2, Medx, AJ1)
+        movpx_st(Xmm1, Mebx, AJ1)
 
-#if SUB_TEST >=  8
-    c_test08,
-#endif /* SUB_TEST  8 */
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        mulps_rr(Xmm1, Xmm0)
+        movpx_rr(Xmm2, Xmm1)
+        addps_rr(Xmm2, Xmm0)
+        subps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm2, Medx, AJ2)
+        movpx_st(Xmm1, Mebx, AJ2)
 
-#if SUB_TEST >=  9
-    c_test09,
-#endif /* SUB_TEST  9 */
+    ASM_LEAVE_LITE(info)
+}
 
-#if SUB_TEST >= 10
-    c_test10,
-#endif /* SUB_TEST 10 */
+rt_void p_test52(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 11
-    c_test11,
-#endif /* SUB_TEST 11 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 12
-    c_test12,
-#endif /* SUB_TEST 12 */
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
 
-#if SUB_TEST >= 13
-    c_test13,
-#endif /* SUB_TEST 13 */
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[%d]*farr[%d]+farr[%d] = %e,"
+                 " farr[%d]*farr[%d]-farr[%d] = %e\n",
+                j, (j + S) % n, j, fco1[j], j, (j + S) % n, j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[%d]*farr[%d]+farr[%d] = %e,"
+                 " farr[%d]*farr[%d]-farr[%d] = %e\n",
+                j, (j + S) % n, j, fso1[j], j, (j + S) % n, j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
 
-#if SUB_TEST >= 14
-    c_test14,
-#endif /* SUB_TEST 14 */
+#endif /* SUB_TEST 52 */
 
-#if SUB_TEST >= 15
-    c_test15,
-#endif /* SUB_TEST 15 */
+/******************************************************************************/
+/*******************************   SUB TEST 53   ******************************/
+/******************************************************************************/
 
-#if SUB_TEST >= 16
-    c_test16,
-#endif /* SUB_TEST 16 */
+#if SUB_TEST >= 53
 
-#if SUB_TEST >= 17
-    c_test17,
-#endif /* SUB_TEST 17 */
+rt_void c_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 18
-    c_test18,
-#endif /* SUB_TEST 18 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 19
-    c_test19,
-#endif /* SUB_TEST 19 */
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = far0[iar0[j] & 3];
+        fco2[j] = 0.0;
+    }
 
-#if SUB_TEST >= 20
-    c_test20,
-#endif /* SUB_TEST 20 */
+    for (j = 0; j < n; j++)
+    {
+        fco2[iar0[j] & 3] = far0[j];
+    }
+}
 
-#if SUB_TEST >= 21
-    c_test21,
-#endif /* SUB_TEST 21 */
+/*
+ * Indices for gather/scatter are counted in elements from the base register,
+ * which is passed as plain M*** addressing mode without displacement.
+ */
+rt_void s_test53(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
 
-#if SUB_TEST >= 22
-    c_test22,
-#endif /* SUB_TEST 22 */
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Rebx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Resi, Mebp, inf_FSO2)
+        adrxx_ld(Redi, Mecx, AJ0)
 
-#if SUB_TEST >= 23
-    c_test23,
-#endif /* SUB_TEST 23 */
+        movpx_ld(Xmm1, Mebx, AJ0)
+        shlpx_ri(Xmm1, IB(32*L-2))
+        shrpx_ri(Xmm1, IB(32*L-2))
+        gatpx_ld(Xmm0, Medi, Xmm1)
+        movpx_st(Xmm0, Medx, AJ0)
 
-#if SUB_TEST >= 24
-    c_test24,
-#endif /* SUB_TEST 24 */
+        movpx_ld(Xmm0, Mebx, AJ1)
+        shlpx_ri(Xmm0, IB(32*L-2))
+        shrpx_ri(Xmm0, IB(32*L-2))
+        gatpx_ld(Xmm1, Medi, Xmm0)
+        movpx_st(Xmm1, Medx, AJ1)
 
-#if SUB_TEST >= 25
-    c_test25,
-#endif /* SUB_TEST 25 */
+        movpx_ld(Xmm7, Mebx, AJ2)
+        shlpx_ri(Xmm7, IB(32*L-2))
+        shrpx_ri(Xmm7, IB(32*L-2))
+        gatpx_ld(Xmm6, Medi, Xmm7)
+        movpx_st(Xmm6, Medx, AJ2)
 
-#if SUB_TEST >= 26
-    c_test26,
-#endif /* SUB_TEST 26 */
+        xorpx_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mesi, AJ0)
+        movpx_st(Xmm0, Mesi, AJ1)
+        movpx_st(Xmm0, Mesi, AJ2)
+        adrxx_ld(Resi, Mesi, AJ0)
 
-#if SUB_TEST >= 27
-    c_test27,
-#endif /* SUB_TEST 27 */
+        movpx_ld(Xmm1, Mebx, AJ0)
+        shlpx_ri(Xmm1, IB(32*L-2))
+        shrpx_ri(Xmm1, IB(32*L-2))
+        movpx_ld(Xmm0, Mecx, AJ0)
+        scapx_st(Xmm0, Mesi, Xmm1)
 
-#if SUB_TEST >= 28
-    c_test28,
-#endif /* SUB_TEST 28 */
+        movpx_ld(Xmm0, Mebx, AJ1)
+        shlpx_ri(Xmm0, IB(32*L-2))
+        shrpx_ri(Xmm0, IB(32*L-2))
+        movpx_ld(Xmm1, Mecx, AJ1)
+        scapx_st(Xmm1, Mesi, Xmm0)
 
-#if SUB_TEST >= 29
-    c_test29,
-#endif /* SUB_TEST 29 */
+        movpx_ld(Xmm7, Mebx, AJ2)
+        shlpx_ri(Xmm7, IB(32*L-2))
+        shrpx_ri(Xmm7, IB(32*L-2))
+        movpx_ld(Xmm6, Mecx, AJ2)
+        scapx_st(Xmm6, Mesi, Xmm7)
 
-#if SUB_TEST >= 30
-    c_test30,
-#endif /* SUB_TEST 30 */
+    ASM_LEAVE(info)
+}
 
-#if SUB_TEST >= 31
-    c_test31,
-#endif /* SUB_TEST 31 */
+rt_void p_test53(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
 
-#if SUB_TEST >= 32
-    c_test32,
-#endif /* SUB_TEST 32 */
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
 
-#if SUB_TEST >= 33
-    c_test33,
-#endif /* SUB_TEST 33 */
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
 
-#if SUB_TEST >= 34
-    c_test34,
-#endif /* SUB_TEST 34 */
+        RT_LOGI("farr[%d] = %e, iarr[%d]&3 = %d\n",
+                j, far0[j], j, (rt_si32)(iar0[j] & 3));
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr[iarr[%d]&3] = %e, scatter[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr[iarr[%d]&3] = %e, scatter[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
 
-#if SUB_TEST >= 35
-    c_test35,
+#endif /* SUB_TEST 53 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 54   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 54
+
+rt_void c_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fbc1 = info->fbc1 + info->bco1 / sizeof(rt_real);
+
+    for (k = 0; k < BW_LOOP; k++, fbc1 += n)
+    {
+        for (j = 0; j < n; j++)
+        {
+            fbc1[j] = far0[j];
+        }
+    }
+
+    info->bco1 += BW_LOOP * n * sizeof(rt_real);
+    if (info->bco1 >= BW_SIZE)
+    {
+        info->bco1 = 0;
+    }
+}
+
+/*
+ * Each call writes the next BW_LOOP copies of the source array with streaming
+ * stores, wrapping around a buffer which is larger than the last-level cache,
+ * so that with the default number of cycles Time S shows sustained bandwidth
+ * of non-temporal stores against regular cached stores in Time C.
+ */
+rt_void s_test54(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_ld(Xmm2, Mecx, AJ2)
+
+        movxx_ld(Redx, Mebp, inf_FBS1)
+        movwx_ld(Reax, Mebp, inf_BSO1)
+        addxx_rr(Redx, Reax)
+        movwx_ri(Redi, IB(BW_LOOP))
+
+    LBL(100500) /* loc_beg */
+
+        movpx_nt(Xmm0, Medx, DP(Q*0x000))
+        movpx_nt(Xmm1, Medx, DP(Q*0x010))
+        movpx_nt(Xmm2, Medx, DP(Q*0x020))
+
+        addxx_ri(Redx, IM(Q*0x030))
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100500b) /* loc_beg */
+
+        fence_xx()
+
+        addwx_ri(Reax, IM(BW_LOOP*Q*0x030))
+        cmjwx_ri(Reax, IV(BW_SIZE),
+        /* if */ LT_x, 100501f) /* loc_end */
+
+        movwx_ri(Reax, IB(0))
+
+    LBL(100501) /* loc_end */
+
+        movwx_st(Reax, Mebp, inf_BSO1)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test54(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = BW_SIZE / sizeof(rt_real);
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fbc1 = info->fbc1;
+    rt_real *fbs1 = info->fbs1;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fbc1[j], fbs1[j]) && (!v_mode || j >= info->size))
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j % info->size, far0[j % info->size]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C fbuf[%d] = %e\n",
+                j, fbc1[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S fbuf[%d] = %e\n",
+                j, fbs1[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 54 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 55   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 55
+
+rt_void c_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+    rt_elem m;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        m = (rt_elem)((rt_uelm)iar0[j] << (32*L-1));
+        ico1[j] = (rt_elem)((rt_uelm)~iar0[j] / 117 + (rt_uelm)iar0[j] % 65537
+                          + (rt_uelm)~iar0[j] / 1 + (rt_uelm)~iar0[j] / 64
+                          + (rt_uelm)~iar0[j] / 0x80000001
+                          + (rt_uelm)~iar0[j] % 0xFFFFFFFB);
+        ico2[j] = iar0[j] / 289 + (-iar0[j]) % 7 + (-iar0[j]) / 1
+                + (-iar0[j]) / 4096 + m / 7 + m % 0x7FFFFFFF;
+    }
+}
+
+/*
+ * Division by immediate is done via multiply-high with a magic number,
+ * which is derived from the divisor at compile time (no division is issued),
+ * unsigned division on inverted values exercises the upper half of the range,
+ * edge divisors (1, powers of 2, above 2^31) take degenerate magic numbers,
+ * signed forms also see the most negative value (odd elements shifted left).
+ */
+rt_void s_test55(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        notpx_rx(Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        divpx_ri(Xmm0, IB(117))
+        movpx_ld(Xmm1, Mecx, AJ0)
+        rempx_ri(Xmm1, IV(65537))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IB(1))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IB(64))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IW(0x80000001))
+        addpx_rr(Xmm0, Xmm1)
+        rempx_ri(Xmm2, IW(0xFFFFFFFB))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_st(Xmm0, Medx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        divpn_ri(Xmm0, IH(289))
+        xorpx_rr(Xmm2, Xmm2)
+        subpx_ld(Xmm2, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm2)
+        rempn_ri(Xmm1, IB(7))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpn_ri(Xmm1, IB(1))
+        addpx_rr(Xmm0, Xmm1)
+        divpn_ri(Xmm2, IH(4096))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_ld(Xmm2, Mecx, AJ0)
+        shlpx_ri(Xmm2, IB(32*L-1))
+        movpx_rr(Xmm1, Xmm2)
+        divpn_ri(Xmm1, IB(7))
+        addpx_rr(Xmm0, Xmm1)
+        rempn_ri(Xmm2, IV(0x7FFFFFFF))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_st(Xmm0, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        notpx_rx(Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        divpx_ri(Xmm0, IB(117))
+        movpx_ld(Xmm1, Mecx, AJ1)
+        rempx_ri(Xmm1, IV(65537))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IB(1))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IB(64))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IW(0x80000001))
+        addpx_rr(Xmm0, Xmm1)
+        rempx_ri(Xmm2, IW(0xFFFFFFFB))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_st(Xmm0, Medx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        divpn_ri(Xmm0, IH(289))
+        xorpx_rr(Xmm2, Xmm2)
+        subpx_ld(Xmm2, Mecx, AJ1)
+        movpx_rr(Xmm1, Xmm2)
+        rempn_ri(Xmm1, IB(7))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpn_ri(Xmm1, IB(1))
+        addpx_rr(Xmm0, Xmm1)
+        divpn_ri(Xmm2, IH(4096))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_ld(Xmm2, Mecx, AJ1)
+        shlpx_ri(Xmm2, IB(32*L-1))
+        movpx_rr(Xmm1, Xmm2)
+        divpn_ri(Xmm1, IB(7))
+        addpx_rr(Xmm0, Xmm1)
+        rempn_ri(Xmm2, IV(0x7FFFFFFF))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_st(Xmm0, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        notpx_rx(Xmm0)
+        movpx_rr(Xmm2, Xmm0)
+        divpx_ri(Xmm0, IB(117))
+        movpx_ld(Xmm1, Mecx, AJ2)
+        rempx_ri(Xmm1, IV(65537))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IB(1))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IB(64))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpx_ri(Xmm1, IW(0x80000001))
+        addpx_rr(Xmm0, Xmm1)
+        rempx_ri(Xmm2, IW(0xFFFFFFFB))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_st(Xmm0, Medx, AJ2)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        divpn_ri(Xmm0, IH(289))
+        xorpx_rr(Xmm2, Xmm2)
+        subpx_ld(Xmm2, Mecx, AJ2)
+        movpx_rr(Xmm1, Xmm2)
+        rempn_ri(Xmm1, IB(7))
+        addpx_rr(Xmm0, Xmm1)
+        movpx_rr(Xmm1, Xmm2)
+        divpn_ri(Xmm1, IB(1))
+        addpx_rr(Xmm0, Xmm1)
+        divpn_ri(Xmm2, IH(4096))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_ld(Xmm2, Mecx, AJ2)
+        shlpx_ri(Xmm2, IB(32*L-1))
+        movpx_rr(Xmm1, Xmm2)
+        divpn_ri(Xmm1, IB(7))
+        addpx_rr(Xmm0, Xmm1)
+        rempn_ri(Xmm2, IV(0x7FFFFFFF))
+        addpx_rr(Xmm0, Xmm2)
+        movpx_st(Xmm0, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test55(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d\n",
+                j, iar0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C ~iarr[%d]/117+iarr[%d]%%65537+... = %" PR_L "d, "
+                  "iarr[%d]/289+(-iarr[%d])%%7+... = %" PR_L "d\n",
+                j, j, ico1[j], j, j, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S ~iarr[%d]/117+iarr[%d]%%65537+... = %" PR_L "d, "
+                  "iarr[%d]/289+(-iarr[%d])%%7+... = %" PR_L "d\n",
+                j, j, iso1[j], j, j, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 55 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 56   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 56
+
+rt_void c_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        ico1[j] = (rt_elem)((rt_uelm)~iar0[j] / (rt_uelm)iar0[(j + S) % n]
+                          + (rt_uelm)iar0[j] % (rt_uelm)iar0[(j + S) % n]);
+        ico2[j] = iar0[j] / -iar0[(j + S) % n] + (-iar0[j]) % iar0[(j + S) % n];
+    }
+}
+
+/*
+ * Division by a vector of divisors is done on SIMD registers where targets
+ * allow (via fp64 on x86, NEON, VSX, native on SVE), otherwise elementwise,
+ * divisors are kept intact (Xmm2 is reused) for both signed and unsigned ops.
+ */
+rt_void s_test56(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_IAR0)
+        movxx_ld(Redx, Mebp, inf_ISO1)
+        movxx_ld(Rebx, Mebp, inf_ISO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        notpx_rx(Xmm0)
+        movpx_ld(Xmm2, Mecx, AJ1)
+        divpx_rr(Xmm0, Xmm2)
+        movpx_ld(Xmm1, Mecx, AJ0)
+        rempx_rr(Xmm1, Xmm2)
+        addpx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Medx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        xorpx_rr(Xmm2, Xmm2)
+        subpx_ld(Xmm2, Mecx, AJ1)
+        divpn_rr(Xmm0, Xmm2)
+        xorpx_rr(Xmm1, Xmm1)
+        subpx_ld(Xmm1, Mecx, AJ0)
+        rempn_ld(Xmm1, Mecx, AJ1)
+        addpx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        notpx_rx(Xmm0)
+        movpx_ld(Xmm2, Mecx, AJ2)
+        divpx_rr(Xmm0, Xmm2)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        rempx_rr(Xmm1, Xmm2)
+        addpx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Medx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        xorpx_rr(Xmm2, Xmm2)
+        subpx_ld(Xmm2, Mecx, AJ2)
+        divpn_rr(Xmm0, Xmm2)
+        xorpx_rr(Xmm1, Xmm1)
+        subpx_ld(Xmm1, Mecx, AJ1)
+        rempn_ld(Xmm1, Mecx, AJ2)
+        addpx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        notpx_rx(Xmm0)
+        movpx_ld(Xmm2, Mecx, AJ0)
+        divpx_rr(Xmm0, Xmm2)
+        movpx_ld(Xmm1, Mecx, AJ2)
+        rempx_rr(Xmm1, Xmm2)
+        addpx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Medx, AJ2)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        xorpx_rr(Xmm2, Xmm2)
+        subpx_ld(Xmm2, Mecx, AJ0)
+        divpn_rr(Xmm0, Xmm2)
+        xorpx_rr(Xmm1, Xmm1)
+        subpx_ld(Xmm1, Mecx, AJ2)
+        rempn_ld(Xmm1, Mecx, AJ0)
+        addpx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test56(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_elem *iar0 = info->iar0 + S*RT_OFFS_SIMD;
+    rt_elem *ico1 = info->ico1 + S*RT_OFFS_SIMD;
+    rt_elem *ico2 = info->ico2 + S*RT_OFFS_SIMD;
+    rt_elem *iso1 = info->iso1 + S*RT_OFFS_SIMD;
+    rt_elem *iso2 = info->iso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (IEQ(ico1[j], iso1[j]) && IEQ(ico2[j], iso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("iarr[%d] = %" PR_L "d, iarr[%d] = %" PR_L "d\n",
+                j, iar0[j], (j + S) % n, iar0[(j + S) % n]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C ~iarr[%d]/iarr[%d]+iarr[%d]%%iarr[%d] = %" PR_L "d, "
+                  "iarr[%d]/-iarr[%d]+(-iarr[%d])%%iarr[%d] = %" PR_L "d\n",
+                j, (j + S) % n, j, (j + S) % n, ico1[j],
+                j, (j + S) % n, j, (j + S) % n, ico2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S ~iarr[%d]/iarr[%d]+iarr[%d]%%iarr[%d] = %" PR_L "d, "
+                  "iarr[%d]/-iarr[%d]+(-iarr[%d])%%iarr[%d] = %" PR_L "d\n",
+                j, (j + S) % n, j, (j + S) % n, iso1[j],
+                j, (j + S) % n, j, (j + S) % n, iso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 56 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 57   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 57
+
+rt_void c_test57(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = RT_EXP(RT_SIN(RT_LOG(far0[j])))
+                + RT_COS(RT_LOG(far0[(j + S) % n]));
+        fco2[j] = RT_ATAN(RT_LOG(far0[j]), RT_LOG(far0[(j + S) % n]))
+                + RT_POW(far0[j], RT_SIN(RT_LOG(far0[(j + S) % n])));
+    }
+}
+
+/*
+ * Elementary functions are sequences of regular SIMD instructions
+ * with polynomial coefficients taken from the built-in rt_SIMD_INFO,
+ * each of them takes two temporary registers (Xmm4, Xmm5 below).
+ */
+rt_void s_test57(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm7, Mecx, AJ0)
+        logps_rr(Xmm0, Xmm4, Xmm5, Xmm7)
+        movpx_ld(Xmm6, Mecx, AJ1)
+        logps_rr(Xmm1, Xmm4, Xmm5, Xmm6)
+        sinps_rr(Xmm2, Xmm4, Xmm5, Xmm0)
+        expps_rr(Xmm3, Xmm4, Xmm5, Xmm2)
+        sncps_rr(Xmm2, Xmm6, Xmm4, Xmm5, Xmm1)
+        addps_rr(Xmm3, Xmm6)
+        movpx_st(Xmm3, Medx, AJ0)
+        atnps_rr(Xmm3, Xmm4, Xmm5, Xmm0, Xmm1)
+        powps_rr(Xmm6, Xmm4, Xmm5, Xmm7, Xmm2)
+        addps_rr(Xmm3, Xmm6)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+        movpx_ld(Xmm7, Mecx, AJ1)
+        logps_rr(Xmm0, Xmm4, Xmm5, Xmm7)
+        movpx_ld(Xmm6, Mecx, AJ2)
+        logps_rr(Xmm1, Xmm4, Xmm5, Xmm6)
+        sinps_rr(Xmm2, Xmm4, Xmm5, Xmm0)
+        expps_rr(Xmm3, Xmm4, Xmm5, Xmm2)
+        sncps_rr(Xmm2, Xmm6, Xmm4, Xmm5, Xmm1)
+        addps_rr(Xmm3, Xmm6)
+        movpx_st(Xmm3, Medx, AJ1)
+        atnps_rr(Xmm3, Xmm4, Xmm5, Xmm0, Xmm1)
+        powps_rr(Xmm6, Xmm4, Xmm5, Xmm7, Xmm2)
+        addps_rr(Xmm3, Xmm6)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm7, Mecx, AJ2)
+        logps_rr(Xmm0, Xmm4, Xmm5, Xmm7)
+        movpx_ld(Xmm6, Mecx, AJ0)
+        logps_rr(Xmm1, Xmm4, Xmm5, Xmm6)
+        sinps_rr(Xmm2, Xmm4, Xmm5, Xmm0)
+        expps_rr(Xmm3, Xmm4, Xmm5, Xmm2)
+        sncps_rr(Xmm2, Xmm6, Xmm4, Xmm5, Xmm1)
+        addps_rr(Xmm3, Xmm6)
+        movpx_st(Xmm3, Medx, AJ2)
+        atnps_rr(Xmm3, Xmm4, Xmm5, Xmm0, Xmm1)
+        powps_rr(Xmm6, Xmm4, Xmm5, Xmm7, Xmm2)
+        addps_rr(Xmm3, Xmm6)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test57(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e, farr[%d] = %e\n",
+                j, far0[j], (j + S) % n, far0[(j + S) % n]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C exp(sin(log(farr[%d])))+cos(log(farr[%d])) = %e, "
+                  "atan2(log(farr[%d]),log(farr[%d]))+"
+                  "pow(farr[%d],sin(log(farr[%d]))) = %e\n",
+                j, (j + S) % n, fco1[j],
+                j, (j + S) % n, j, (j + S) % n, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S exp(sin(log(farr[%d])))+cos(log(farr[%d])) = %e, "
+                  "atan2(log(farr[%d]),log(farr[%d]))+"
+                  "pow(farr[%d],sin(log(farr[%d]))) = %e\n",
+                j, (j + S) % n, fso1[j],
+                j, (j + S) % n, j, (j + S) % n, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 57 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 58   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 58
+
+#if   RT_ELEMENT == 32
+
+/*
+ * Reference fp32-to-fp16-to-fp32 round trip with round-to-nearest-even.
+ */
+rt_fp32 c_f16rt(rt_fp32 x)
+{
+    union { rt_fp32 f; rt_ui32 u; } v;
+    rt_ui32 s, f, h, e, m;
+
+    v.f = x;
+    s = v.u & 0x80000000;
+    f = v.u & 0x7FFFFFFF;
+
+    if (f >= 0x47800000)
+    {
+        h = f > 0x7F800000 ? 0x7E00 : 0x7C00;
+    }
+    else
+    if (f <  0x38800000)
+    {
+        v.u = f;
+        v.f += 0.5f;
+        h = v.u - 0x3F000000;
+    }
+    else
+    {
+        h = (f + 0xC8000FFF + ((f >> 13) & 1)) >> 13;
+    }
+
+    e = h >> 10;
+    m = h & 0x3FF;
+
+    if (e == 0x1F)
+    {
+        v.u = 0x7F800000 | m << 13;
+    }
+    else
+    {
+        v.f = e == 0x00 ? ldexpf((rt_fp32)m, -24) :
+                          ldexpf((rt_fp32)(m + 0x400), (rt_si32)e - 25);
+    }
+
+    v.u |= s;
+
+    return v.f;
+}
+
+#endif /* RT_ELEMENT */
+
+rt_void c_test58(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+#if   RT_ELEMENT == 32
+        fco1[j] = c_f16rt(far0[j]);
+        fco2[j] = c_f16rt(fco1[j] - far0[j]);
+#elif RT_ELEMENT == 64
+        fco1[j] = far0[j];
+        fco2[j] = fco1[j] - far0[j];
+#endif /* RT_ELEMENT */
+    }
+}
+
+/*
+ * Fp16 converters are only exposed for 32-bit elements (cvhps_ld/cvhps_st),
+ * the round trip goes through the half-int array used here as fp16 storage,
+ * the second result is the fp16 rounding error (exercises fp16 denormals).
+ */
+rt_void s_test58(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+        movxx_ld(Resi, Mebp, inf_HSO1)
+
+#if   RT_ELEMENT == 32
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        cvhps_st(Xmm0, Mesi, AJ0)
+        cvhps_ld(Xmm1, Mesi, AJ0)
+        movpx_st(Xmm1, Medx, AJ0)
+        subps_rr(Xmm1, Xmm0)
+        cvhps_st(Xmm1, Mesi, AJ0)
+        cvhps_ld(Xmm2, Mesi, AJ0)
+        movpx_st(Xmm2, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        cvhps_st(Xmm0, Mesi, AJ1)
+        cvhps_ld(Xmm1, Mesi, AJ1)
+        movpx_st(Xmm1, Medx, AJ1)
+        subps_rr(Xmm1, Xmm0)
+        cvhps_st(Xmm1, Mesi, AJ1)
+        cvhps_ld(Xmm2, Mesi, AJ1)
+        movpx_st(Xmm2, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        cvhps_st(Xmm0, Mesi, AJ2)
+        cvhps_ld(Xmm1, Mesi, AJ2)
+        movpx_st(Xmm1, Medx, AJ2)
+        subps_rr(Xmm1, Xmm0)
+        cvhps_st(Xmm1, Mesi, AJ2)
+        cvhps_ld(Xmm2, Mesi, AJ2)
+        movpx_st(Xmm2, Mebx, AJ2)
+
+#elif RT_ELEMENT == 64
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_st(Xmm0, Medx, AJ0)
+        subps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_st(Xmm0, Medx, AJ1)
+        subps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_st(Xmm0, Medx, AJ2)
+        subps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebx, AJ2)
+
+#endif /* RT_ELEMENT */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test58(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if ((fco1[j] == fso1[j] || FEQ(fco1[j], fso1[j]))
+        &&  (fco2[j] == fso2[j] || FEQ(fco2[j], fso2[j])) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C f16(farr[%d]) = %e, f16(f16(farr[%d])-farr[%d]) = %e\n",
+                j, fco1[j], j, j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S f16(farr[%d]) = %e, f16(f16(farr[%d])-farr[%d]) = %e\n",
+                j, fso1[j], j, j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 58 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 59   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 59
+
+rt_void c_test59(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+#if   RT_ELEMENT == 32
+        rt_si32 i, k = j % S;
+        rt_fp64 a = 0.0;
+
+        for (i = 0; i <= j / S; i++)
+        {
+            a += (rt_fp64)far0[i*S + k] * (rt_fp64)far0[((i+1)*S + k) % n];
+        }
+
+        fco1[j] = (rt_fp32)a;
+        fco2[j] = (rt_fp32)(a - (rt_fp64)fco1[j]);
+#elif RT_ELEMENT == 64
+        fco1[j] = (rt_fp64)(rt_fp32)far0[j];
+        fco2[j] = fco1[j] - far0[j];
+#endif /* RT_ELEMENT */
+    }
+}
+
+/*
+ * Fp32/fp64 converters are exposed for fixed-size elements (cvlqs/cvuqs
+ * widen lower/upper halves, cvlos/cvuos narrow into lower/upper halves),
+ * fp32 builds accumulate dot products of three rotated chunks in fp64
+ * and store the running sum narrowed back along with its rounding error,
+ * fp64 builds round-trip each chunk through fp32 and store the error.
+ */
+rt_void s_test59(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+#if   RT_ELEMENT == 32
+
+        xorqx_rr(Xmm4, Xmm4)
+        xorqx_rr(Xmm5, Xmm5)
+
+        movox_ld(Xmm0, Mecx, AJ0)
+        movox_ld(Xmm1, Mecx, AJ1)
+        cvlqs_rr(Xmm2, Xmm0)
+        cvlqs_rr(Xmm3, Xmm1)
+        mulqs_rr(Xmm2, Xmm3)
+        addqs_rr(Xmm4, Xmm2)
+        cvuqs_rr(Xmm2, Xmm0)
+        cvuqs_rr(Xmm3, Xmm1)
+        mulqs_rr(Xmm2, Xmm3)
+        addqs_rr(Xmm5, Xmm2)
+        cvlos_rr(Xmm2, Xmm4)
+        cvuos_rr(Xmm2, Xmm5)
+        movox_st(Xmm2, Medx, AJ0)
+        cvlqs_rr(Xmm0, Xmm2)
+        movqx_rr(Xmm1, Xmm4)
+        subqs_rr(Xmm1, Xmm0)
+        cvlos_rr(Xmm3, Xmm1)
+        cvuqs_rr(Xmm0, Xmm2)
+        movqx_rr(Xmm1, Xmm5)
+        subqs_rr(Xmm1, Xmm0)
+        cvuos_rr(Xmm3, Xmm1)
+        movox_st(Xmm3, Mebx, AJ0)
+
+        movox_ld(Xmm0, Mecx, AJ1)
+        movox_ld(Xmm1, Mecx, AJ2)
+        cvlqs_rr(Xmm2, Xmm0)
+        cvlqs_rr(Xmm3, Xmm1)
+        mulqs_rr(Xmm2, Xmm3)
+        addqs_rr(Xmm4, Xmm2)
+        cvuqs_rr(Xmm2, Xmm0)
+        cvuqs_rr(Xmm3, Xmm1)
+        mulqs_rr(Xmm2, Xmm3)
+        addqs_rr(Xmm5, Xmm2)
+        cvlos_rr(Xmm2, Xmm4)
+        cvuos_rr(Xmm2, Xmm5)
+        movox_st(Xmm2, Medx, AJ1)
+        cvlqs_rr(Xmm0, Xmm2)
+        movqx_rr(Xmm1, Xmm4)
+        subqs_rr(Xmm1, Xmm0)
+        cvlos_rr(Xmm3, Xmm1)
+        cvuqs_rr(Xmm0, Xmm2)
+        movqx_rr(Xmm1, Xmm5)
+        subqs_rr(Xmm1, Xmm0)
+        cvuos_rr(Xmm3, Xmm1)
+        movox_st(Xmm3, Mebx, AJ1)
+
+        movox_ld(Xmm0, Mecx, AJ2)
+        movox_ld(Xmm1, Mecx, AJ0)
+        cvlqs_rr(Xmm2, Xmm0)
+        cvlqs_rr(Xmm3, Xmm1)
+        mulqs_rr(Xmm2, Xmm3)
+        addqs_rr(Xmm4, Xmm2)
+        cvuqs_rr(Xmm2, Xmm0)
+        cvuqs_rr(Xmm3, Xmm1)
+        mulqs_rr(Xmm2, Xmm3)
+        addqs_rr(Xmm5, Xmm2)
+        cvlos_rr(Xmm2, Xmm4)
+        cvuos_rr(Xmm2, Xmm5)
+        movox_st(Xmm2, Medx, AJ2)
+        cvlqs_rr(Xmm0, Xmm2)
+        movqx_rr(Xmm1, Xmm4)
+        subqs_rr(Xmm1, Xmm0)
+        cvlos_rr(Xmm3, Xmm1)
+        cvuqs_rr(Xmm0, Xmm2)
+        movqx_rr(Xmm1, Xmm5)
+        subqs_rr(Xmm1, Xmm0)
+        cvuos_rr(Xmm3, Xmm1)
+        movox_st(Xmm3, Mebx, AJ2)
+
+#elif RT_ELEMENT == 64
+
+        movqx_ld(Xmm0, Mecx, AJ0)
+        cvlos_rr(Xmm1, Xmm0)
+        cvlqs_rr(Xmm2, Xmm1)
+        movqx_st(Xmm2, Medx, AJ0)
+        cvuos_rr(Xmm1, Xmm0)
+        cvuqs_rr(Xmm3, Xmm1)
+        subqs_rr(Xmm3, Xmm0)
+        movqx_st(Xmm3, Mebx, AJ0)
+
+        movqx_ld(Xmm0, Mecx, AJ1)
+        cvlos_rr(Xmm1, Xmm0)
+        cvlqs_rr(Xmm2, Xmm1)
+        movqx_st(Xmm2, Medx, AJ1)
+        cvuos_rr(Xmm1, Xmm0)
+        cvuqs_rr(Xmm3, Xmm1)
+        subqs_rr(Xmm3, Xmm0)
+        movqx_st(Xmm3, Mebx, AJ1)
+
+        movqx_ld(Xmm0, Mecx, AJ2)
+        cvlos_rr(Xmm1, Xmm0)
+        cvlqs_rr(Xmm2, Xmm1)
+        movqx_st(Xmm2, Medx, AJ2)
+        cvuos_rr(Xmm1, Xmm0)
+        cvuqs_rr(Xmm3, Xmm1)
+        subqs_rr(Xmm3, Xmm0)
+        movqx_st(Xmm3, Mebx, AJ2)
+
+#endif /* RT_ELEMENT */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test59(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if ((fco1[j] == fso1[j] || FEQ(fco1[j], fso1[j]))
+        &&  (fco2[j] == fso2[j] || FEQ(fco2[j], fso2[j])) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C dot(farr)[%d] = %e, err(dot(farr))[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S dot(farr)[%d] = %e, err(dot(farr))[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 59 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 60   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 60
+
+rt_void c_test60(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+#if   (defined RT_SWEX1 || defined RT_SWEX2)
+    rt_si32 m1 = n - 1, m2 = S + S/2;
+#else  /* RT_SWEX1, RT_SWEX2 */
+    rt_si32 m1 = n, m2 = n;
+#endif /* RT_SWEX1, RT_SWEX2 */
+
+    j = n;
+    while (j-->0)
+    {
+        fco1[j] = j < m1 ? far0[j] * far0[j] + far0[j] : 0.0;
+        fco2[j] = j < m2 ? far0[j] * far0[j] : 0.0;
+    }
+}
+
+/*
+ * Predicated targets process row remainders without scalar code or padding,
+ * the first row ends one element short of the array (partial last chunk),
+ * the second row ends in the middle of the second chunk (the remaining count
+ * goes negative in the third), predicates are generated with whlpx_rr,
+ * regular targets process full rows (C code mirrors both configurations).
+ */
+rt_void s_test60(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+#if   (defined RT_SWEX1 || defined RT_SWEX2)
+
+        movwx_ri(Redi, IH(S*3-1))
+        movwx_ri(Resi, IH(S+S/2))
+        xorpx_rr(Xmm7, Xmm7)
+
+        movpx_st(Xmm7, Medx, AJ0)
+        whlpx_rr(X1, Redi)
+        whlpx_rr(X2, Resi)
+        mxvpx_ld(Xmm0, X1, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        mulpsMrr(Xmm1, X1, Xmm0)
+        addpsMrr(Xmm1, X1, Xmm0)
+        mxvpx_st(Xmm1, X1, Medx, AJ0)
+        movpx_ld(Xmm2, Mecx, AJ0)
+        mulps4rr(Xmm3, Z2, Xmm2, Xmm2)
+        movpx_st(Xmm3, Mebx, AJ0)
+        subwx_ri(Redi, IB(S))
+        subwx_ri(Resi, IB(S))
+
+        movpx_st(Xmm7, Medx, AJ1)
+        whlpx_rr(X1, Redi)
+        whlpx_rr(X2, Resi)
+        mxvpx_ld(Xmm0, X1, Mecx, AJ1)
+        movpx_rr(Xmm1, Xmm0)
+        mulpsMrr(Xmm1, X1, Xmm0)
+        addpsMrr(Xmm1, X1, Xmm0)
+        mxvpx_st(Xmm1, X1, Medx, AJ1)
+        movpx_ld(Xmm2, Mecx, AJ1)
+        mulps4rr(Xmm3, Z2, Xmm2, Xmm2)
+        movpx_st(Xmm3, Mebx, AJ1)
+        subwx_ri(Redi, IB(S))
+        subwx_ri(Resi, IB(S))
+
+        movpx_st(Xmm7, Medx, AJ2)
+        whlpx_rr(X1, Redi)
+        whlpx_rr(X2, Resi)
+        mxvpx_ld(Xmm0, X1, Mecx, AJ2)
+        movpx_rr(Xmm1, Xmm0)
+        mulpsMrr(Xmm1, X1, Xmm0)
+        addpsMrr(Xmm1, X1, Xmm0)
+        mxvpx_st(Xmm1, X1, Medx, AJ2)
+        movpx_ld(Xmm2, Mecx, AJ2)
+        mulps4rr(Xmm3, Z2, Xmm2, Xmm2)
+        movpx_st(Xmm3, Mebx, AJ2)
+
+#else  /* RT_SWEX1, RT_SWEX2 */
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        mulps_rr(Xmm1, Xmm0)
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Medx, AJ0)
+        mulps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebx, AJ0)
+
+        movpx_ld(Xmm0, Mecx, AJ1)
+        movpx_rr(Xmm1, Xmm0)
+        mulps_rr(Xmm1, Xmm0)
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Medx, AJ1)
+        mulps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ2)
+        movpx_rr(Xmm1, Xmm0)
+        mulps_rr(Xmm1, Xmm0)
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Medx, AJ2)
+        mulps_rr(Xmm0, Xmm0)
+        movpx_st(Xmm0, Mebx, AJ2)
+
+#endif /* RT_SWEX1, RT_SWEX2 */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test60(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C tail(farr[%d]*farr[%d]+farr[%d]) = %e, "
+                "tail(farr[%d]*farr[%d]) = %e\n",
+                j, j, j, fco1[j], j, j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S tail(farr[%d]*farr[%d]+farr[%d]) = %e, "
+                "tail(farr[%d]*farr[%d]) = %e\n",
+                j, j, j, fso1[j], j, j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 60 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 61   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 61
+
+rt_void c_test61(rt_SIMD_INFOX *info)
+{
+    rt_si32 i, j, k;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    rt_si32 e = 16 / (rt_si32)sizeof(rt_real), h = e / 2;
+
+    j = S;
+    while (j-->0)
+    {
+        i = j - j % e;
+        k = j % e;
+
+        fco1[j + 0] = far0[i + k / 2 + 0 + (k % 2) * S];
+        fco1[j + S] = far0[i + k / 2 + h + (k % 2) * S];
+
+        fco2[j + 0] = far0[i + (k % h) * 2 + 0 + (k / h) * S];
+        fco2[j + S] = far0[i + (k % h) * 2 + 1 + (k / h) * S];
+
+        fco1[j + S*2] = far0[i + e - 1 - k + S*2];
+        fco2[j + S*2] = far0[S - 1 + S*2] + far0[(j + 1) % S + S*2];
+    }
+}
+
+/*
+ * Lane permutes convert between interleaved (AoS) and planar (SoA) layouts
+ * in registers, zip/uzp pair the first two chunks within 128-bit quads,
+ * shf reverses each quad of the third chunk, bcx/rot cross quads
+ * (broadcast of the last element, rotation down by one element).
+ */
+rt_void s_test61(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm2, Xmm0)
+        movpx_rr(Xmm3, Xmm1)
+        zippx_rr(Xmm0, Xmm1)
+        movpx_st(Xmm0, Medx, AJ0)
+        movpx_st(Xmm1, Medx, AJ1)
+        uzppx_rr(Xmm2, Xmm3)
+        movpx_st(Xmm2, Mebx, AJ0)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm4, Mecx, AJ2)
+#if   RT_ELEMENT == 32
+        shfpx_ri(Xmm5, Xmm4, IB(0x1B))
+#elif RT_ELEMENT == 64
+        shfpx_ri(Xmm5, Xmm4, IB(0x01))
+#endif /* RT_ELEMENT */
+        movpx_st(Xmm5, Medx, AJ2)
+        bcxpx_ri(Xmm6, Xmm4, IB(S-1))
+        rotpx_ri(Xmm7, Xmm4, IB(1))
+        addps_rr(Xmm6, Xmm7)
+        movpx_st(Xmm6, Mebx, AJ2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test61(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C zip/shf(farr)[%d] = %e, uzp/bcx+rot(farr)[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S zip/shf(farr)[%d] = %e, uzp/bcx+rot(farr)[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 61 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 62   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 62
+
+rt_void c_test62(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = S;
+    while (j-->0)
+    {
+        fco1[j + 0] = far0[j + 0] + far0[1];
+        fco2[j + S] = far0[j + S] * far0[S*3 - 1];
+    }
+}
+
+/*
+ * Broadcast loads replicate a single element taken from memory at element
+ * (not SIMD) alignment: the 2nd element of the first chunk is added to it,
+ * the last element of the third chunk multiplies the second chunk.
+ */
+rt_void s_test62(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+#if   RT_ELEMENT == 32
+        movpx_bc(Xmm0, Mecx, DS(Q*0x000 + Q*RT_OFFS_DATA + 0x04))
+        movpx_bc(Xmm2, Mecx, DS(Q*0x030 + Q*RT_OFFS_DATA - 0x04))
+#elif RT_ELEMENT == 64
+        movpx_bc(Xmm0, Mecx, DS(Q*0x000 + Q*RT_OFFS_DATA + 0x08))
+        movpx_bc(Xmm2, Mecx, DS(Q*0x030 + Q*RT_OFFS_DATA - 0x08))
+#endif /* RT_ELEMENT */
+        movpx_ld(Xmm1, Mecx, AJ0)
+        addps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Medx, AJ0)
+        movpx_ld(Xmm3, Mecx, AJ1)
+        mulps_rr(Xmm3, Xmm2)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test62(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr+bc[%d] = %e, farr*bc[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr+bc[%d] = %e, farr*bc[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 62 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 63   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 63
+
+rt_void c_test63(rt_SIMD_INFOX *info)
+{
+    rt_si32 j;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    j = S;
+    while (j-->0)
+    {
+        fco1[j + 1] = far0[j + 1] + far0[j + S + 1];
+        fco2[j + S + 1] = far0[j + S*2 - 1] * far0[j + S - 1];
+    }
+}
+
+/*
+ * Unaligned loads/stores work on array slices shifted by one element
+ * from SIMD alignment: the first slice is added to the one a chunk further,
+ * the second product is taken on slices shifted back by one element.
+ */
+rt_void s_test63(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+#if   RT_ELEMENT == 32
+        addxx_ri(Recx, IB(0x04))
+        addxx_ri(Redx, IB(0x04))
+        addxx_ri(Rebx, IB(0x04))
+#elif RT_ELEMENT == 64
+        addxx_ri(Recx, IB(0x08))
+        addxx_ri(Redx, IB(0x08))
+        addxx_ri(Rebx, IB(0x08))
+#endif /* RT_ELEMENT */
+        muvpx_ld(Xmm0, Mecx, AJ0)
+        muvpx_ld(Xmm1, Mecx, AJ1)
+        addps_rr(Xmm0, Xmm1)
+        muvpx_st(Xmm0, Medx, AJ0)
+#if   RT_ELEMENT == 32
+        subxx_ri(Recx, IB(0x08))
+#elif RT_ELEMENT == 64
+        subxx_ri(Recx, IB(0x10))
+#endif /* RT_ELEMENT */
+        muvpx_ld(Xmm2, Mecx, AJ2)
+        muvpx_ld(Xmm3, Mecx, AJ1)
+        mulps_rr(Xmm2, Xmm3)
+        muvpx_st(Xmm2, Mebx, AJ1)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test63(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr+muv[%d] = %e, farr*muv[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr+muv[%d] = %e, farr*muv[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 63 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 64   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 64
+
+rt_void c_test64(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    k = 0;
+    for (j = 0; j < S; j++)
+    {
+        if (far0[j] > far0[j + S])
+        {
+            fco1[k] = far0[j];
+            fco2[j] = far0[k + S*2];
+            k++;
+        }
+        else
+        {
+            fco2[j] = far0[j + S];
+        }
+    }
+    for (j = 0; j < S; j++)
+    {
+        fco1[k + j] = far0[j + S];
+    }
+}
+
+/*
+ * Stream compaction packs elements passing the compare to the output stream
+ * advancing it by the mask popcount, then the next chunk is appended there,
+ * expand-load unpacks consecutive elements into the lanes passing the compare.
+ */
+rt_void s_test64(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm2, Xmm0)
+        cgtps_rr(Xmm0, Xmm1)
+        cmppx_st(Xmm2, Medx, AJ0)
+        mkcpx_rx(Xmm0, Reax)
+#if   RT_ELEMENT == 32
+        shlxx_ri(Reax, IB(2))
+#elif RT_ELEMENT == 64
+        shlxx_ri(Reax, IB(3))
+#endif /* RT_ELEMENT */
+        addxx_rr(Redx, Reax)
+        muvpx_st(Xmm1, Medx, AJ0)
+        exppx_ld(Xmm1, Mecx, AJ2)
+        movpx_st(Xmm1, Mebx, AJ0)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test64(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr?cmp[%d] = %e, farr?exp[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr?cmp[%d] = %e, farr?exp[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 64 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 65   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 65
+
+rt_void c_test65(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k;
+
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fbs2 = info->fbs2 + info->bco2 / sizeof(rt_real);
+
+    for (j = 0; j < S; j++)
+    {
+        fco1[j] = 0.0;
+    }
+
+    for (k = 0; k < TLB_LOOP; k++, fbs2 += TLB_STEP / sizeof(rt_real))
+    {
+        for (j = 0; j < S; j++)
+        {
+            fco1[j] += fbs2[j];
+        }
+    }
+
+    info->bco2 += TLB_LOOP * TLB_STEP;
+    if (info->bco2 > BW_SIZE - TLB_LOOP * TLB_STEP)
+    {
+        info->bco2 = 0;
+    }
+}
+
+/*
+ * Each call sums one SIMD vector from each of the next TLB_LOOP pages,
+ * stepping over a buffer which is larger than the reach of the TLB,
+ * while the vectors touched during a full pass still fit the caches.
+ * Time S walks a buffer from huge pages (where available), Time R printed
+ * along with page sizes repeats it on a copy with regular pages, which shows
+ * the TLB-miss reduction, Time C is the scalar reference on huge pages.
+ */
+rt_void s_test65(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Redx, Mebp, inf_FBS2)
+        movwx_ld(Reax, Mebp, inf_BSO2)
+        addxx_rr(Redx, Reax)
+        movwx_ri(Redi, IB(TLB_LOOP))
+        xorpx_rr(Xmm0, Xmm0)
+
+    LBL(100500) /* loc_beg */
+
+        addps_ld(Xmm0, Medx, DP(Q*0x000))
+
+        addxx_ri(Redx, IH(TLB_STEP))
+        subwx_ri(Redi, IB(1))
+        cmjwx_rz(Redi,
+        /* if */ GT_x, 100500b) /* loc_beg */
+
+        movxx_ld(Recx, Mebp, inf_FSO1)
+        movpx_st(Xmm0, Mecx, AJ0)
+
+        addwx_ri(Reax, IV(TLB_LOOP*TLB_STEP))
+        cmjwx_ri(Reax, IV(BW_SIZE - TLB_LOOP*TLB_STEP),
+        /* if */ LE_x, 100501f) /* loc_end */
+
+        movwx_ri(Reax, IB(0))
+
+    LBL(100501) /* loc_end */
+
+        movwx_st(Reax, Mebp, inf_BSO2)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test65(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = S;
+
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && !v_mode)
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C fsum[%d] = %e\n",
+                j, fco1[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S fsum[%d] = %e\n",
+                j, fso1[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+#ifdef RT_PRINT_NUM
+    /* SIMD kernel on the copy with regular pages (after the check above) */
+    rt_real *fbs2 = info->fbs2;
+    rt_si32 bso2 = info->bso2;
+
+    info->fbs2 = info->fbc2;
+
+    rt_time time1 = get_time();
+
+    j = info->cyc;
+    while (j-->0) s_test65(info);
+
+    rt_time time2 = get_time();
+
+    info->fbs2 = fbs2;
+    info->bso2 = bso2;
+
+    RT_LOGI("Time R   = %6d\n", (rt_si32)(time2 - time1));
+    RT_LOGI("Page R   = %6dK\n", sys_page(info->fbc2) / 1024);
+    RT_LOGI("Page S   = %6dK\n", sys_page(info->fbs2) / 1024);
+#endif /* RT_PRINT_NUM */
+}
+
+#endif /* SUB_TEST 65 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 66   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 66
+
+rt_void c_test66(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = PAR_SIZE / sizeof(rt_real);
+
+    rt_real *fbc2 = info->fbc2 + info->bco3 / sizeof(rt_real);
+    rt_real *fbc1 = info->fbc1 + info->bco3 / sizeof(rt_real);
+
+    for (j = 0; j < n; j++)
+    {
+        fbc1[j] = fbc2[j] * fbc2[j];
+    }
+
+    info->bco3 += PAR_SIZE;
+    if (info->bco3 >= BW_SIZE)
+    {
+        info->bco3 = 0;
+    }
+}
+
+/*
+ * Kernel run by parallel_for on each chunk with its own cloned info,
+ * where slab pointers are rebased to the chunk and size is its length.
+ */
+rt_void s_kern66(rt_SIMD_INFO *inf0)
+{
+    rt_SIMD_INFOX *info = (rt_SIMD_INFOX *)inf0;
+
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FBI3)
+        movxx_ld(Redx, Mebp, inf_FBO3)
+        movwx_ld(Reax, Mebp, inf_SIZE)
+#if   RT_ELEMENT == 32
+        shlwx_ri(Reax, IB(2))
+#elif RT_ELEMENT == 64
+        shlwx_ri(Reax, IB(3))
+#endif /* RT_ELEMENT */
+
+    LBL(100500) /* loc_beg */
+
+        movpx_ld(Xmm0, Mecx, DP(Q*0x000))
+        movpx_rr(Xmm1, Xmm0)
+        mulps_rr(Xmm1, Xmm0)
+        movpx_st(Xmm1, Medx, DP(Q*0x000))
+
+        addxx_ri(Recx, IM(Q*0x010))
+        addxx_ri(Redx, IM(Q*0x010))
+        subwx_ri(Reax, IM(Q*0x010))
+        cmjwx_rz(Reax,
+        /* if */ GT_x, 100500b) /* loc_beg */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Each call splits the next slab of PAR_SIZE bytes into SIMD-aligned chunks
+ * of PAR_GRAIN bytes run on the worker team of the pool (-t n, one thread
+ * per CPU by default), wrapping around a buffer larger than the last-level
+ * cache, so that Time S shows throughput of all cores against one in Time C.
+ */
+rt_void s_test66(rt_SIMD_INFOX *info)
+{
+    info->fbi3 = info->fbc2 + info->bso3 / sizeof(rt_real);
+    info->fbo3 = info->fbs1 + info->bso3 / sizeof(rt_real);
+
+    parallel_for(info->pool, s_kern66, info,
+                 PAR_SIZE / sizeof(rt_real), PAR_GRAIN / sizeof(rt_real));
+
+    info->bso3 += PAR_SIZE;
+    if (info->bso3 >= BW_SIZE)
+    {
+        info->bso3 = 0;
+    }
+}
+
+rt_void p_test66(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = BW_SIZE / sizeof(rt_real);
+
+    rt_real *fbc2 = info->fbc2;
+    rt_real *fbc1 = info->fbc1;
+    rt_real *fbs1 = info->fbs1;
+
+#ifdef RT_PRINT_NUM
+    RT_LOGI("Threads  = %6d\n", info->pool->n_thr);
+#endif /* RT_PRINT_NUM */
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fbc1[j], fbs1[j]) && (!v_mode || j >= info->size))
+        {
+            continue;
+        }
+
+        RT_LOGI("fbuf[%d] = %e\n",
+                j, fbc2[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C fbuf[%d]^2 = %e\n",
+                j, fbc1[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S fbuf[%d]^2 = %e\n",
+                j, fbs1[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 66 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 67   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 67
+
+rt_void c_test67(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = PAR_SIZE / sizeof(rt_real);
+
+    rt_real *fbc4 = info->fbc4 + info->bco4 / sizeof(rt_real);
+
+    for (j = 0; j < n; j++)
+    {
+        fbc4[j] = -fbc4[j];
+    }
+
+    info->bco4 += PAR_SIZE;
+    if (info->bco4 >= BW_SIZE)
+    {
+        info->bco4 = 0;
+    }
+}
+
+/*
+ * Kernel run by parallel_for on each chunk with its own cloned info,
+ * where slab pointers are rebased to the chunk and size is its length.
+ */
+rt_void s_kern67(rt_SIMD_INFO *inf0)
+{
+    rt_SIMD_INFOX *info = (rt_SIMD_INFOX *)inf0;
+
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FBI3)
+        movxx_ld(Redx, Mebp, inf_FBO3)
+        movwx_ld(Reax, Mebp, inf_SIZE)
+#if   RT_ELEMENT == 32
+        shlwx_ri(Reax, IB(2))
+#elif RT_ELEMENT == 64
+        shlwx_ri(Reax, IB(3))
+#endif /* RT_ELEMENT */
+
+    LBL(100500) /* loc_beg */
+
+        xorpx_rr(Xmm0, Xmm0)
+        subps_ld(Xmm0, Mecx, DP(Q*0x000))
+        movpx_st(Xmm0, Medx, DP(Q*0x000))
+
+        addxx_ri(Recx, IM(Q*0x010))
+        addxx_ri(Redx, IM(Q*0x010))
+        subwx_ri(Reax, IM(Q*0x010))
+        cmjwx_rz(Reax,
+        /* if */ GT_x, 100500b) /* loc_beg */
+
+    ASM_LEAVE(info)
+}
+
+/*
+ * Each call negates the next slab of PAR_SIZE bytes in place on the worker
+ * team (as in test 66), Time S streams from a buffer placed local to the
+ * workers owning its chunks, Time R printed along with shares of local pages
+ * repeats it on a copy placed remote to them (both with first touch
+ * by pool_touch), which shows NUMA bandwidth loss on multi-socket systems
+ * given that workers are pinned to CPUs (-p), Time C is the scalar
+ * single-thread reference.
+ */
+rt_void s_test67(rt_SIMD_INFOX *info)
+{
+    info->fbi3 = info->fbs4 + info->bso4 / sizeof(rt_real);
+    info->fbo3 = info->fbs4 + info->bso4 / sizeof(rt_real);
+
+    parallel_for(info->pool, s_kern67, info,
+                 PAR_SIZE / sizeof(rt_real), PAR_GRAIN / sizeof(rt_real));
+
+    info->bso4 += PAR_SIZE;
+    if (info->bso4 >= BW_SIZE)
+    {
+        info->bso4 = 0;
+    }
+}
+
+rt_void p_test67(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = BW_SIZE / sizeof(rt_real);
+
+    rt_real *fbc4 = info->fbc4;
+    rt_real *fbs4 = info->fbs4;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fbc4[j], fbs4[j]) && (!v_mode || j >= info->size))
+        {
+            continue;
+        }
+
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C fbuf[%d] = %e\n",
+                j, fbc4[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S fbuf[%d] = %e\n",
+                j, fbs4[j]);
+#endif /* RT_PRINT_ASM */
+    }
+
+#ifdef RT_PRINT_NUM
+    /* SIMD kernel on the copy placed remote (after the check above) */
+    rt_si32 bso4 = info->bso4;
+
+    info->fbs4 = fbc4;
+
+    rt_time time1 = get_time();
+
+    j = info->cyc;
+    while (j-->0) s_test67(info);
+
+    rt_time time2 = get_time();
+
+    info->fbs4 = fbs4;
+    info->bso4 = bso4;
+
+    RT_LOGI("Time R   = %6d\n", (rt_si32)(time2 - time1));
+
+    rt_si32 k, lr = 0, ls = 0;
+
+    for (k = 0; k < BW_SIZE && lr >= 0 && ls >= 0; k += PAR_SIZE)
+    {
+        info->fbi3 = info->fbo3 = fbc4 + k / sizeof(rt_real);
+        j = pool_local(info->pool, info,
+                       PAR_SIZE / sizeof(rt_real), PAR_GRAIN / sizeof(rt_real));
+        lr = j < 0 ? -1 : lr + j;
+
+        info->fbi3 = info->fbo3 = fbs4 + k / sizeof(rt_real);
+        j = pool_local(info->pool, info,
+                       PAR_SIZE / sizeof(rt_real), PAR_GRAIN / sizeof(rt_real));
+        ls = j < 0 ? -1 : ls + j;
+    }
+
+    RT_LOGI("Local R  = %6d%%\n", lr < 0 ? -1 : lr / (BW_SIZE / PAR_SIZE));
+    RT_LOGI("Local S  = %6d%%\n", ls < 0 ? -1 : ls / (BW_SIZE / PAR_SIZE));
+#endif /* RT_PRINT_NUM */
+}
+
+#endif /* SUB_TEST 67 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 68   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 68
+
+rt_void c_test68(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+#if   (defined RT_SWEX1 || defined RT_SWEX2)
+    rt_si32 m = S*2 + S/2 + 1;
+#else  /* RT_SWEX1, RT_SWEX2 */
+    rt_si32 m = n;
+#endif /* RT_SWEX1, RT_SWEX2 */
+
+    j = n;
+    while (j-->0)
+    {
+        rt_real a = far0[j] * far0[j] + far0[j];
+        a = a < +3.0 ? a : +3.0;
+        a = a > -0.5 ? a : -0.5;
+
+        fco1[j] = j < m ? a : +1.0;
+        fco2[j] = j < m ? (far0[j] > -0.5 ? far0[j] : -0.5) : 0.0;
+    }
+}
+
+/*
+ * Clamped polynomial over a row which is not a multiple of S elements,
+ * predicated targets run the same vector loop body over the remainder
+ * under a predicate from whlpx_rr (no scalar epilogue or padding),
+ * masked loads don't touch memory past the row, masked stores keep it
+ * (filled with +1.0 beforehand), zeroing ops clear lanes past the row,
+ * regular targets process full rows (C code mirrors both configurations).
+ */
+rt_void s_test68(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+        movpx_ld(Xmm5, Mebp, inf_GPC01)
+        movpx_ld(Xmm6, Mebp, inf_GPC03)
+        movpx_ld(Xmm7, Mebp, inf_GPC02)
+
+        movpx_st(Xmm5, Medx, AJ0)
+        movpx_st(Xmm5, Medx, AJ1)
+        movpx_st(Xmm5, Medx, AJ2)
+
+#if   (defined RT_SWEX1 || defined RT_SWEX2)
+
+        movwx_ri(Redi, IH(S*2+S/2+1))
+
+    LBL(100500) /* loc_beg */
+
+        whlpx_rr(X1, Redi)
+        mxvpx_ld(Xmm0, X1, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        mulpsMrr(Xmm1, X1, Xmm0)
+        addpsMrr(Xmm1, X1, Xmm0)
+        minpsMrr(Xmm1, X1, Xmm6)
+        maxpsMrr(Xmm1, X1, Xmm7)
+        mxvpx_st(Xmm1, X1, Medx, AJ0)
+        movpx_ld(Xmm2, Mecx, AJ0)
+        maxps4rr(Xmm3, Z1, Xmm2, Xmm7)
+        movpx_st(Xmm3, Mebx, AJ0)
+
+#else  /* RT_SWEX1, RT_SWEX2 */
+
+        movwx_ri(Redi, IH(S*3))
+
+    LBL(100500) /* loc_beg */
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_rr(Xmm1, Xmm0)
+        mulps_rr(Xmm1, Xmm0)
+        addps_rr(Xmm1, Xmm0)
+        minps_rr(Xmm1, Xmm6)
+        maxps_rr(Xmm1, Xmm7)
+        movpx_st(Xmm1, Medx, AJ0)
+        maxps_rr(Xmm0, Xmm7)
+        movpx_st(Xmm0, Mebx, AJ0)
+
+#endif /* RT_SWEX1, RT_SWEX2 */
+
+        addxx_ri(Recx, IM(16*Q))
+        addxx_ri(Redx, IM(16*Q))
+        addxx_ri(Rebx, IM(16*Q))
+        subwx_ri(Redi, IB(S))
+        cmjwx_rz(Redi,
+        /* if */ GT_n, 100500b) /* loc_beg */
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test68(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C tail(clamp(farr[%d]*farr[%d]+farr[%d])) = %e, "
+                "tail(max(farr[%d], -0.5)) = %e\n",
+                j, j, j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S tail(clamp(farr[%d]*farr[%d]+farr[%d])) = %e, "
+                "tail(max(farr[%d], -0.5)) = %e\n",
+                j, j, j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 68 */
+
+/******************************************************************************/
+/*******************************   SUB TEST 69   ******************************/
+/******************************************************************************/
+
+#if SUB_TEST >= 69
+
+rt_void c_test69(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, k;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+
+    for (j = 0; j < S*2; j++)
+    {
+        fco1[j] = far0[j % S + S*2];
+        fco2[j] = far0[j % S + S*2];
+    }
+
+    k = 0;
+    for (j = 0; j < S; j++)
+    {
+        if (far0[j] > far0[j + S])
+        {
+            fco1[k++] = far0[j];
+        }
+    }
+    fco1[k] = far0[S];
+
+    k = 0;
+    for (j = 0; j < S; j++)
+    {
+        if (!(far0[j] > far0[j + S]))
+        {
+            fco2[k++] = far0[j + S];
+        }
+    }
+    fco2[k] = far0[S];
+}
+
+/*
+ * Compress-store into streams pre-filled with a known pattern, followed by
+ * a scalar append at the popcount, checks that no elements past the count
+ * are clobbered (generic forms may touch only the one the append overwrites),
+ * the inverted mask packs the remaining elements into the second stream.
+ */
+rt_void s_test69(rt_SIMD_INFOX *info)
+{
+    ASM_ENTER(info)
+
+        movxx_ld(Recx, Mebp, inf_FAR0)
+        movxx_ld(Redx, Mebp, inf_FSO1)
+        movxx_ld(Rebx, Mebp, inf_FSO2)
+
+        movpx_ld(Xmm3, Mecx, AJ2)
+        movpx_st(Xmm3, Medx, AJ0)
+        movpx_st(Xmm3, Medx, AJ1)
+        movpx_st(Xmm3, Mebx, AJ0)
+        movpx_st(Xmm3, Mebx, AJ1)
+
+        movpx_ld(Xmm0, Mecx, AJ0)
+        movpx_ld(Xmm1, Mecx, AJ1)
+        movpx_rr(Xmm2, Xmm0)
+        cgtps_rr(Xmm0, Xmm1)
+        cmppx_st(Xmm2, Medx, AJ0)
+        mkcpx_rx(Xmm0, Reax)
+#if   RT_ELEMENT == 32
+        shlxx_ri(Reax, IB(2))
+#elif RT_ELEMENT == 64
+        shlxx_ri(Reax, IB(3))
+#endif /* RT_ELEMENT */
+        addxx_rr(Redx, Reax)
+        movss_st(Xmm1, Medx, AJ0)
+
+        notpx_rx(Xmm0)
+        cmppx_st(Xmm1, Mebx, AJ0)
+        mkcpx_rx(Xmm0, Reax)
+#if   RT_ELEMENT == 32
+        shlxx_ri(Reax, IB(2))
+#elif RT_ELEMENT == 64
+        shlxx_ri(Reax, IB(3))
+#endif /* RT_ELEMENT */
+        addxx_rr(Rebx, Reax)
+        movss_st(Xmm1, Mebx, AJ0)
+
+    ASM_LEAVE(info)
+}
+
+rt_void p_test69(rt_SIMD_INFOX *info)
+{
+    rt_si32 j, n = info->size;
+
+    rt_real *far0 = info->far0 + S*RT_OFFS_SIMD;
+    rt_real *fco1 = info->fco1 + S*RT_OFFS_SIMD;
+    rt_real *fco2 = info->fco2 + S*RT_OFFS_SIMD;
+    rt_real *fso1 = info->fso1 + S*RT_OFFS_SIMD;
+    rt_real *fso2 = info->fso2 + S*RT_OFFS_SIMD;
+
+    j = n;
+    while (j-->0)
+    {
+        if (FEQ(fco1[j], fso1[j]) && FEQ(fco2[j], fso2[j]) && !v_mode)
+        {
+            continue;
+        }
+
+        RT_LOGI("farr[%d] = %e\n",
+                j, far0[j]);
+#ifdef RT_PRINT_CPP
+        RT_LOGI("C farr?cmp+pad[%d] = %e, farr!cmp+pad[%d] = %e\n",
+                j, fco1[j], j, fco2[j]);
+#endif /* RT_PRINT_CPP */
+#ifdef RT_PRINT_ASM
+        RT_LOGI("S farr?cmp+pad[%d] = %e, farr!cmp+pad[%d] = %e\n",
+                j, fso1[j], j, fso2[j]);
+#endif /* RT_PRINT_ASM */
+    }
+}
+
+#endif /* SUB_TEST 69 */
+
+/******************************************************************************/
+/*********************************   TABLES   *********************************/
+/******************************************************************************/
+
+typedef rt_void (*testXX)(rt_SIMD_INFOX *);
+
+volatile
+testXX c_test[SUB_TEST] =
+{
+#if SUB_TEST >=  1
+    c_test01,
+#endif /* SUB_TEST  1 */
+
+#if SUB_TEST >=  2
+    c_test02,
+#endif /* SUB_TEST  2 */
+
+#if SUB_TEST >=  3
+    c_test03,
+#endif /* SUB_TEST  3 */
+
+#if SUB_TEST >=  4
+    c_test04,
+#endif /* SUB_TEST  4 */
+
+#if SUB_TEST >=  5
+    c_test05,
+#endif /* SUB_TEST  5 */
+
+#if SUB_TEST >=  6
+    c_test06,
+#endif /* SUB_TEST  6 */
+
+#if SUB_TEST >=  7
+    c_test07,
+#endif /* SUB_TEST  7 */
+
+#if SUB_TEST >=  8
+    c_test08,
+#endif /* SUB_TEST  8 */
+
+#if SUB_TEST >=  9
+    c_test09,
+#endif /* SUB_TEST  9 */
+
+#if SUB_TEST >= 10
+    c_test10,
+#endif /* SUB_TEST 10 */
+
+#if SUB_TEST >= 11
+    c_test11,
+#endif /* SUB_TEST 11 */
+
+#if SUB_TEST >= 12
+    c_test12,
+#endif /* SUB_TEST 12 */
+
+#if SUB_TEST >= 13
+    c_test13,
+#endif /* SUB_TEST 13 */
+
+#if SUB_TEST >= 14
+    c_test14,
+#endif /* SUB_TEST 14 */
+
+#if SUB_TEST >= 15
+    c_test15,
+#endif /* SUB_TEST 15 */
+
+#if SUB_TEST >= 16
+    c_test16,
+#endif /* SUB_TEST 16 */
+
+#if SUB_TEST >= 17
+    c_test17,
+#endif /* SUB_TEST 17 */
+
+#if SUB_TEST >= 18
+    c_test18,
+#endif /* SUB_TEST 18 */
+
+#if SUB_TEST >= 19
+    c_test19,
+#endif /* SUB_TEST 19 */
+
+#if SUB_TEST >= 20
+    c_test20,
+#endif /* SUB_TEST 20 */
+
+#if SUB_TEST >= 21
+    c_test21,
+#endif /* SUB_TEST 21 */
+
+#if SUB_TEST >= 22
+    c_test22,
+#endif /* SUB_TEST 22 */
+
+#if SUB_TEST >= 23
+    c_test23,
+#endif /* SUB_TEST 23 */
+
+#if SUB_TEST >= 24
+    c_test24,
+#endif /* SUB_TEST 24 */
+
+#if SUB_TEST >= 25
+    c_test25,
+#endif /* SUB_TEST 25 */
+
+#if SUB_TEST >= 26
+    c_test26,
+#endif /* SUB_TEST 26 */
+
+#if SUB_TEST >= 27
+    c_test27,
+#endif /* SUB_TEST 27 */
+
+#if SUB_TEST >= 28
+    c_test28,
+#endif /* SUB_TEST 28 */
+
+#if SUB_TEST >= 29
+    c_test29,
+#endif /* SUB_TEST 29 */
+
+#if SUB_TEST >= 30
+    c_test30,
+#endif /* SUB_TEST 30 */
+
+#if SUB_TEST >= 31
+    c_test31,
+#endif /* SUB_TEST 31 */
+
+#if SUB_TEST >= 32
+    c_test32,
+#endif /* SUB_TEST 32 */
+
+#if SUB_TEST >= 33
+    c_test33,
+#endif /* SUB_TEST 33 */
+
+#if SUB_TEST >= 34
+    c_test34,
+#endif /* SUB_TEST 34 */
+
+#if SUB_TEST >= 35
+    c_test35,
 #endif /* SUB_TEST 35 */
 
 #if SUB_TEST >= 36
@@ -7873,6 +10368,65 @@ testXX c_test[SUB_TEST] =
 #if SUB_TEST >= 51
     c_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    c_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    c_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    c_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    c_test55,
+#endif /* SUB_TEST 55 */
+#if SUB_TEST >= 56
+    c_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    c_test57,
+#endif /* SUB_TEST 57 */
+#if SUB_TEST >= 58
+    c_test58,
+#endif /* SUB_TEST 58 */
+#if SUB_TEST >= 59
+    c_test59,
+#endif /* SUB_TEST 59 */
+#if SUB_TEST >= 60
+    c_test60,
+#endif /* SUB_TEST 60 */
+#if SUB_TEST >= 61
+    c_test61,
+#endif /* SUB_TEST 61 */
+#if SUB_TEST >= 62
+    c_test62,
+#endif /* SUB_TEST 62 */
+#if SUB_TEST >= 63
+    c_test63,
+#endif /* SUB_TEST 63 */
+#if SUB_TEST >= 64
+    c_test64,
+#endif /* SUB_TEST 64 */
+#if SUB_TEST >= 65
+    c_test65,
+#endif /* SUB_TEST 65 */
+#if SUB_TEST >= 66
+    c_test66,
+#endif /* SUB_TEST 66 */
+#if SUB_TEST >= 67
+    c_test67,
+#endif /* SUB_TEST 67 */
+#if SUB_TEST >= 68
+    c_test68,
+#endif /* SUB_TEST 68 */
+#if SUB_TEST >= 69
+    c_test69,
+#endif /* SUB_TEST 69 */
 };
 
 volatile
@@ -8081,6 +10635,65 @@ testXX s_test[SUB_TEST] =
 #if SUB_TEST >= 51
     s_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    s_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    s_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    s_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    s_test55,
+#endif /* SUB_TEST 55 */
+#if SUB_TEST >= 56
+    s_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    s_test57,
+#endif /* SUB_TEST 57 */
+#if SUB_TEST >= 58
+    s_test58,
+#endif /* SUB_TEST 58 */
+#if SUB_TEST >= 59
+    s_test59,
+#endif /* SUB_TEST 59 */
+#if SUB_TEST >= 60
+    s_test60,
+#endif /* SUB_TEST 60 */
+#if SUB_TEST >= 61
+    s_test61,
+#endif /* SUB_TEST 61 */
+#if SUB_TEST >= 62
+    s_test62,
+#endif /* SUB_TEST 62 */
+#if SUB_TEST >= 63
+    s_test63,
+#endif /* SUB_TEST 63 */
+#if SUB_TEST >= 64
+    s_test64,
+#endif /* SUB_TEST 64 */
+#if SUB_TEST >= 65
+    s_test65,
+#endif /* SUB_TEST 65 */
+#if SUB_TEST >= 66
+    s_test66,
+#endif /* SUB_TEST 66 */
+#if SUB_TEST >= 67
+    s_test67,
+#endif /* SUB_TEST 67 */
+#if SUB_TEST >= 68
+    s_test68,
+#endif /* SUB_TEST 68 */
+#if SUB_TEST >= 69
+    s_test69,
+#endif /* SUB_TEST 69 */
 };
 
 volatile
@@ -8289,6 +10902,65 @@ testXX p_test[SUB_TEST] =
 #if SUB_TEST >= 51
     p_test51,
 #endif /* SUB_TEST 51 */
+
+#if SUB_TEST >= 52
+    p_test52,
+#endif /* SUB_TEST 52 */
+
+#if SUB_TEST >= 53
+    p_test53,
+#endif /* SUB_TEST 53 */
+
+#if SUB_TEST >= 54
+    p_test54,
+#endif /* SUB_TEST 54 */
+
+#if SUB_TEST >= 55
+    p_test55,
+#endif /* SUB_TEST 55 */
+#if SUB_TEST >= 56
+    p_test56,
+#endif /* SUB_TEST 56 */
+
+#if SUB_TEST >= 57
+    p_test57,
+#endif /* SUB_TEST 57 */
+#if SUB_TEST >= 58
+    p_test58,
+#endif /* SUB_TEST 58 */
+#if SUB_TEST >= 59
+    p_test59,
+#endif /* SUB_TEST 59 */
+#if SUB_TEST >= 60
+    p_test60,
+#endif /* SUB_TEST 60 */
+#if SUB_TEST >= 61
+    p_test61,
+#endif /* SUB_TEST 61 */
+#if SUB_TEST >= 62
+    p_test62,
+#endif /* SUB_TEST 62 */
+#if SUB_TEST >= 63
+    p_test63,
+#endif /* SUB_TEST 63 */
+#if SUB_TEST >= 64
+    p_test64,
+#endif /* SUB_TEST 64 */
+#if SUB_TEST >= 65
+    p_test65,
+#endif /* SUB_TEST 65 */
+#if SUB_TEST >= 66
+    p_test66,
+#endif /* SUB_TEST 66 */
+#if SUB_TEST >= 67
+    p_test67,
+#endif /* SUB_TEST 67 */
+#if SUB_TEST >= 68
+    p_test68,
+#endif /* SUB_TEST 68 */
+#if SUB_TEST >= 69
+    p_test69,
+#endif /* SUB_TEST 69 */
 };
 
 /******************************************************************************/
@@ -8359,6 +11031,8 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         RT_LOGI(" -e n, specify subtest # at which testing ends, n <= max\n");
         RT_LOGI(" -d n, override diff-threshold for qualification, n >= 0\n");
         RT_LOGI(" -c n, override counter of redundant test cycles, n >= 1\n");
+        RT_LOGI(" -t n, override number of worker threads (parallel-for)\n");
+        RT_LOGI(" -p, pin worker threads to CPUs (one per CPU in order)\n");
         RT_LOGI(" -v, enable verbose mode, always print values from tests\n");
         RT_LOGI("all options can be used together\n");
         RT_LOGI("--------------------------------------------------------\n");
@@ -8434,6 +11108,28 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
                 return 0;
             }
         }
+        if (k < argc && strcmp(argv[k], "-t") == 0 && ++k < argc)
+        {
+            for (l = strlen(argv[k]), r = 1, t = 0; l > 0; l--, r *= 10)
+            {
+                t += (argv[k][l-1] - '0') * r;
+            }
+            if (t >= 1)
+            {
+                RT_LOGI("Worker-threads overridden: %d\n", t);
+                n_work = t;
+            }
+            else
+            {
+                RT_LOGI("Worker-threads value out of range\n");
+                return 0;
+            }
+        }
+        if (k < argc && strcmp(argv[k], "-p") == 0 && !p_mode)
+        {
+            p_mode = RT_TRUE;
+            RT_LOGI("Thread pinning enabled\n");
+        }
         if (k < argc && strcmp(argv[k], "-v") == 0 && !v_mode)
         {
             v_mode = RT_TRUE;
@@ -8569,13 +11265,87 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
         memcpy(hbr0 + N*RT_OFFS_SIMD + RT_ARR_SIZE(harr)*k, harr, sizeof(harr));
     }
 
-    rt_pntr info = sys_alloc(sizeof(rt_SIMD_INFOX) + MASK);
-    rt_SIMD_INFOX *inf0 = (rt_SIMD_INFOX *)(((rt_full)info + MASK) & ~MASK);
+    /* bandwidth buffers (BW_SIZE each) and the worker team are only set up
+     * if subtests which use them are run, otherwise they are left empty */
+    rt_pntr mbuf = RT_NULL, tbuf = RT_NULL, hbuf = RT_NULL;
+    rt_pntr rbuf = RT_NULL, lbuf = RT_NULL;
+
+    rt_real *fbc1 = RT_NULL, *fbs1 = RT_NULL;
+    rt_real *fbc2 = RT_NULL, *fbs2 = RT_NULL;
+    rt_real *fbc4 = RT_NULL, *fbs4 = RT_NULL;
+
+    if (SUB_RUN(54) || SUB_RUN(66))
+    {
+        mbuf = sys_alloc(2*BW_SIZE + MASK);
+        memset(mbuf, 0, 2*BW_SIZE + MASK);
+        rt_pntr mbu0 = (rt_pntr)(((rt_uptr)mbuf + MASK) & ~MASK);
+
+        fbc1 = (rt_real *)mbu0;
+        fbs1 = (rt_real *)mbu0 + BW_SIZE / sizeof(rt_real);
+    }
+
+    if (SUB_RUN(65) || SUB_RUN(66))
+    {
+        tbuf = sys_alloc(BW_SIZE + MASK);
+        rt_pntr tbu0 = (rt_pntr)(((rt_uptr)tbuf + MASK) & ~MASK);
+
+        hbuf = sys_huge(BW_SIZE + MASK);
+        rt_pntr hbu0 = (rt_pntr)(((rt_uptr)hbuf + MASK) & ~MASK);
+
+        fbc2 = (rt_real *)tbu0;
+        fbs2 = (rt_real *)hbu0;
+
+        for (k = 0; k < (rt_si32)(BW_SIZE / sizeof(rt_real)); k++)
+        {
+            fbc2[k] = fbs2[k] = farr[k % RT_ARR_SIZE(farr)];
+        }
+    }
+
+    /* pages are left untouched until placed by the workers (pool_touch) */
+    if (SUB_RUN(67))
+    {
+        rbuf = sys_alloc(BW_SIZE + MASK);
+        rt_pntr rbu0 = (rt_pntr)(((rt_uptr)rbuf + MASK) & ~MASK);
+
+        lbuf = sys_alloc(BW_SIZE + MASK);
+        rt_pntr lbu0 = (rt_pntr)(((rt_uptr)lbuf + MASK) & ~MASK);
+
+        fbc4 = (rt_real *)rbu0;
+        fbs4 = (rt_real *)lbu0;
+    }
+
+    /* no team unless parallel-for subtests are run, one thread per CPU
+     * there by default (-t n overrides) */
+    if (!SUB_RUN(66) && !SUB_RUN(67))
+    {
+        n_work = 0;
+    }
+    else if (n_work == 0)
+    {
+        n_work = pool_cpus();
+    }
+
+    rt_SIMD_POOL pool;
+
+    if (pool_init(&pool, 1 + n_work, sizeof(rt_SIMD_INFOX)) == 0)
+    {
+        RT_LOGE("alloc failed with NULL address, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (n_work != 0 && pool_team(&pool, n_work) == 0)
+    {
+        RT_LOGE("failed to start worker threads, exiting...\n");
+        exit(EXIT_FAILURE);
+    }
 
-    rt_pntr regs = sys_alloc(sizeof(rt_SIMD_REGS) + MASK);
-    rt_SIMD_REGS *reg0 = (rt_SIMD_REGS *)(((rt_full)regs + MASK) & ~MASK);
+    if (n_work != 0 && p_mode && pool_pin(&pool, 0) != n_work)
+    {
+        RT_LOGI("Thread pinning failed for some workers\n");
+    }
 
-    ASM_INIT(inf0, reg0)
+    /* template is taken, so that parallel_for never runs chunks in it */
+    rt_SIMD_INFOX *inf0 = (rt_SIMD_INFOX *)pool_take(&pool);
 
     inf0->far0 = far0;
     inf0->fco1 = fco1;
@@ -8595,6 +11365,54 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
     inf0->hso1 = (rt_half *)hso1;
     inf0->hso2 = (rt_half *)hso2;
 
+    inf0->fbc1 = fbc1;
+    inf0->fbs1 = fbs1;
+    inf0->bco1 = 0;
+    inf0->bso1 = 0;
+
+    inf0->fbc2 = fbc2;
+    inf0->fbs2 = fbs2;
+
+    inf0->bco2 = 0;
+    inf0->bso2 = 0;
+
+    inf0->fbi3 = fbc2;
+    inf0->fbo3 = fbs1;
+    inf0->bco3 = 0;
+    inf0->bso3 = 0;
+
+    inf0->pool = &pool;
+
+    pool_array(&pool, inf0, &inf0->fbi3, sizeof(rt_real));
+    pool_array(&pool, inf0, &inf0->fbo3, sizeof(rt_real));
+    pool_count(&pool, inf0, &inf0->size);
+
+    inf0->fbc4 = fbc4;
+    inf0->fbs4 = fbs4;
+    inf0->bco4 = 0;
+    inf0->bso4 = 0;
+
+    if (SUB_RUN(67))
+    {
+        /* copy remote to the workers owning its chunks in test 67 (Time R),
+         * S buffer local to them, then fill both from the main thread */
+        for (k = 0; k < BW_SIZE; k += PAR_SIZE)
+        {
+            inf0->fbi3 = inf0->fbo3 = fbc4 + k / sizeof(rt_real);
+            pool_touch(&pool, inf0, PAR_SIZE / sizeof(rt_real),
+                                    PAR_GRAIN / sizeof(rt_real), RT_TRUE);
+
+            inf0->fbi3 = inf0->fbo3 = fbs4 + k / sizeof(rt_real);
+            pool_touch(&pool, inf0, PAR_SIZE / sizeof(rt_real),
+                                    PAR_GRAIN / sizeof(rt_real), RT_FALSE);
+        }
+
+        for (k = 0; k < (rt_si32)(BW_SIZE / sizeof(rt_real)); k++)
+        {
+            fbc4[k] = fbs4[k] = farr[k % RT_ARR_SIZE(farr)];
+        }
+    }
+
     inf0->cyc  = r_test;
     inf0->size = ARR_SIZE;
     inf0->tail = (rt_pntr)0xABCDEF01;
@@ -8697,11 +11515,17 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 #endif /* RT_PRINT_NUM */
     }
 
-    ASM_DONE(inf0)
+    pool_give(&pool, inf0);
+    pool_done(&pool);
+
+    sys_free(lbuf, BW_SIZE + MASK);
+    sys_free(rbuf, BW_SIZE + MASK);
+    sys_free(hbuf, BW_SIZE + MASK);
+    sys_free(tbuf, BW_SIZE + MASK);
+    sys_free(mbuf, 2*BW_SIZE + MASK);
+    sys_free(marr, 15*ARR_SIZE*sizeof(rt_elem) + MASK);
 
-    sys_free(regs, sizeof(rt_SIMD_REGS) + MASK);
-    sys_free(info, sizeof(rt_SIMD_INFOX) + MASK);
-    sys_free(marr, 10 * ARR_SIZE * sizeof(rt_ui32) + MASK);
+    heap_done();
 
 #if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
 
@@ -8720,28 +11544,8 @@ rt_si32 main(rt_si32 argc, rt_char *argv[])
 
 #include "rtzero.h"
 
-#if RT_POINTER == 64
-#if RT_ADDRESS == 32
-
-#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000040000000)
-#define RT_ADDRESS_MAX      ((rt_byte *)0x0000000080000000)
-
-#else /* RT_ADDRESS == 64 */
-
-#define RT_ADDRESS_MIN      ((rt_byte *)0x0000000140000000)
-#define RT_ADDRESS_MAX      ((rt_byte *)0x0000080000000000)
-
-#endif /* RT_ADDRESS */
-
-rt_byte *s_ptr = RT_ADDRESS_MIN;
-
-#endif /* RT_POINTER */
-
-
 #if (defined RT_WIN32) || (defined RT_WIN64) /* Win32, MSVC -- Win64, GCC --- */
 
-#include <windows.h>
-
 /*
  * Get system time in milliseconds.
  */
@@ -8754,41 +11558,29 @@ rt_time get_time()
     return (rt_time)(tm.QuadPart * 1000 / fr.QuadPart);
 }
 
-DWORD s_step = 0;
+#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
 
-SYSTEM_INFO s_sys = {0};
+#include <sys/time.h>
 
 /*
- * Allocate memory from system heap.
- * Not thread-safe due to common static ptr.
+ * Get system time in milliseconds.
  */
-rt_pntr sys_alloc(rt_size size)
+rt_time get_time()
 {
-#if (RT_POINTER - RT_ADDRESS) != 0
-
-    /* loop around RT_ADDRESS_MAX boundary */
-    if (s_ptr >= RT_ADDRESS_MAX - size)
-    {
-        s_ptr  = RT_ADDRESS_MIN;
-    }
-
-    if (s_step == 0)
-    {
-        GetSystemInfo(&s_sys);
-        s_step = s_sys.dwAllocationGranularity;
-    }
-
-    rt_pntr ptr = VirtualAlloc(s_ptr, size, MEM_COMMIT | MEM_RESERVE,
-                  PAGE_READWRITE);
-
-    /* advance with allocation granularity */
-    s_ptr = (rt_byte *)ptr + ((size + s_step - 1) / s_step) * s_step;
-
-#else /* (RT_POINTER - RT_ADDRESS) */
+    timeval tm;
+    gettimeofday(&tm, NULL);
+    return (rt_time)(tm.tv_sec * 1000 + tm.tv_usec / 1000);
+}
 
-    rt_pntr ptr = malloc(size);
+#endif /* ------------- OS specific ----------------------------------------- */
 
-#endif /* (RT_POINTER - RT_ADDRESS) */
+/*
+ * Allocate memory from system heap.
+ * Thread-safe, blocks are taken from the arena in rtheap.h.
+ */
+rt_pntr sys_alloc(rt_size size)
+{
+    rt_pntr ptr = heap_alloc(size);
 
 #if RT_DEBUG >= 2
 
@@ -8817,83 +11609,35 @@ rt_pntr sys_alloc(rt_size size)
 
 /*
  * Free memory from system heap.
+ * Block is recycled in the arena, size is only used for printouts.
  */
 rt_void sys_free(rt_pntr ptr, rt_size size)
 {
-#if (RT_POINTER - RT_ADDRESS) != 0
-
-    VirtualFree(ptr, 0, MEM_RELEASE);
-
-#else /* (RT_POINTER - RT_ADDRESS) */
-
-    free(ptr);
-
-#endif /* (RT_POINTER - RT_ADDRESS) */
+    heap_free(ptr);
 
 #if RT_DEBUG >= 2
 
     RT_LOGI("FREED PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
 
-#endif /* RT_DEBUG */
-}
-
-#elif (defined RT_LINUX) /* Linux, GCC -------------------------------------- */
+#else  /* RT_DEBUG */
 
-#include <sys/time.h>
+    (void)size; /* block size is kept by the arena */
 
-/*
- * Get system time in milliseconds.
- */
-rt_time get_time()
-{
-    timeval tm;
-    gettimeofday(&tm, NULL);
-    return (rt_time)(tm.tv_sec * 1000 + tm.tv_usec / 1000);
+#endif /* RT_DEBUG */
 }
 
-#if (RT_POINTER - RT_ADDRESS) != 0
-
-#include <sys/mman.h>
-
-#ifndef MAP_ANONYMOUS
-#define MAP_ANONYMOUS MAP_ANON  /* workaround for macOS compilation */
-#endif /* macOS still cannot allocate with mmap within 32-bit range */
-
-#endif /* (RT_POINTER - RT_ADDRESS) */
-
 /*
- * Allocate memory from system heap.
- * Not thread-safe due to common static ptr.
+ * Allocate memory from system heap backed by huge pages (if available).
+ * Thread-safe, falls back to regular pages, check sys_page for the outcome.
  */
-rt_pntr sys_alloc(rt_size size)
+rt_pntr sys_huge(rt_size size)
 {
-#if (RT_POINTER - RT_ADDRESS) != 0
-
-    /* loop around RT_ADDRESS_MAX boundary */
-    /* in 64/32-bit hybrid mode addresses can't have sign bit
-     * as MIPS64 sign-extends all 32-bit mem-loads by default */
-    if (s_ptr >= RT_ADDRESS_MAX - size)
-    {
-        s_ptr  = RT_ADDRESS_MIN;
-    }
-
-    rt_pntr ptr = mmap(s_ptr, size, PROT_READ | PROT_WRITE,
-                  MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
-
-    /* advance with allocation granularity */
-    /* in case when page-size differs from default 4096 bytes
-     * mmap should round toward closest correct page boundary */
-    s_ptr = (rt_byte *)ptr + ((size + 4095) / 4096) * 4096;
-
-#else /* (RT_POINTER - RT_ADDRESS) */
-
-    rt_pntr ptr = malloc(size);
-
-#endif /* (RT_POINTER - RT_ADDRESS) */
+    rt_pntr ptr = heap_huge(size);
 
 #if RT_DEBUG >= 2
 
-    RT_LOGI("ALLOC PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
+    RT_LOGI("ALLOC PTR = %016" PR_Z "X, size = %ld, page = %d\n",
+                                       (rt_full)ptr, size, heap_page(ptr));
 
 #endif /* RT_DEBUG */
 
@@ -8917,28 +11661,18 @@ rt_pntr sys_alloc(rt_size size)
 }
 
 /*
- * Free memory from system heap.
+ * Get size of pages backing memory from system heap.
  */
-rt_void sys_free(rt_pntr ptr, rt_size size)
+rt_si32 sys_page(rt_pntr ptr)
 {
-#if (RT_POINTER - RT_ADDRESS) != 0
-
-    munmap(ptr, size);
-
-#else /* (RT_POINTER - RT_ADDRESS) */
-
-    free(ptr);
-
-#endif /* (RT_POINTER - RT_ADDRESS) */
-
-#if RT_DEBUG >= 2
+    return heap_page(ptr);
+}
 
-    RT_LOGI("FREED PTR = %016" PR_Z "X, size = %ld\n", (rt_full)ptr, size);
+#ifdef RT_NAMESPACE
 
-#endif /* RT_DEBUG */
-}
+} /* namespace RT_NAMESPACE */
 
-#endif /* ------------- OS specific ----------------------------------------- */
+#endif /* RT_NAMESPACE */
 
 /******************************************************************************/
 /******************************************************************************/